@@ -1,3613 +0,0 @@
-
-#include <Arduino.h>
-
-// 'startscreen', 240x240px
-const uint16_t _startscreen [] PROGMEM = {
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0xef7d, 0xef5d, 0xe73c, 0xe71c, 0xdedb, 
-	0xd6ba, 0xce79, 0xce59, 0xce59, 0xc638, 0xc638, 0xc618, 0xbdf7, 0xbdf7, 0xc618, 0xc638, 0xc638, 0xce59, 0xce59, 0xce79, 0xd6ba, 
-	0xdedb, 0xe71c, 0xe73c, 0xef5d, 0xef7d, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xf7be, 0xef7d, 0xe71c, 0xd6ba, 0xce79, 0xc618, 0xbdd7, 0xb5b6, 0xb5b6, 0xb596, 0xad75, 0xad55, 0xad55, 
-	0xa534, 0xa534, 0xa534, 0xa514, 0xa514, 0xa514, 0xa514, 0xa514, 0xa514, 0xa514, 0xa514, 0xa514, 0xa514, 0xa534, 0xa534, 0xa534, 
-	0xad55, 0xad55, 0xad75, 0xb596, 0xb5b6, 0xb5b6, 0xbdd7, 0xc618, 0xce79, 0xd6ba, 0xe71c, 0xef7d, 0xf7be, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0xe73c, 
-	0xdedb, 0xce59, 0xbdf7, 0xb5b6, 0xb596, 0xad75, 0xad55, 0xa534, 0xa514, 0x9cf3, 0x9cd3, 0x94b2, 0x9492, 0x9492, 0x8c71, 0x8c51, 
-	0x8c51, 0x8430, 0x8430, 0x8430, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8430, 0x8430, 0x8430, 0x8c51, 
-	0x8c51, 0x8c71, 0x9492, 0x9492, 0x94b2, 0x9cd3, 0x9cf3, 0xa514, 0xa534, 0xad55, 0xad75, 0xb596, 0xb5b6, 0xbdf7, 0xce59, 0xdedb, 
-	0xe73c, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf79e, 0xe71c, 0xd69a, 0xbdf7, 0xb5b6, 0xb596, 
-	0xad55, 0xa534, 0x9cf3, 0x9cd3, 0x94b2, 0x8c71, 0x8c51, 0x8430, 0x8410, 0x7bef, 0x7bcf, 0x7bcf, 0x73ae, 0x738e, 0x6b6d, 0x6b6d, 
-	0x6b4d, 0x6b4d, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x630c, 0x630c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x6b4d, 0x6b4d, 
-	0x6b6d, 0x6b6d, 0x738e, 0x73ae, 0x7bcf, 0x7bcf, 0x7bef, 0x8410, 0x8430, 0x8c51, 0x8c71, 0x94b2, 0x9cd3, 0x9cf3, 0xa534, 0xad55, 
-	0xb596, 0xb5b6, 0xbdf7, 0xd69a, 0xe71c, 0xf79e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0xef5d, 0xd69a, 0xbdf7, 0xb5b6, 0xad75, 0xa534, 0xa514, 0x9cd3, 0x9492, 
-	0x8c71, 0x8430, 0x8410, 0x7bef, 0x73ae, 0x738e, 0x6b6d, 0x6b4d, 0x632c, 0x630c, 0x5aeb, 0x5acb, 0x52aa, 0x52aa, 0x528a, 0x4a69, 
-	0x4a69, 0x4a49, 0x4a49, 0x4a49, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a49, 0x4a49, 0x4a49, 0x4a69, 
-	0x4a69, 0x528a, 0x52aa, 0x52aa, 0x5acb, 0x5aeb, 0x630c, 0x632c, 0x6b4d, 0x6b6d, 0x738e, 0x73ae, 0x7bef, 0x8410, 0x8430, 0x8c71, 
-	0x9492, 0x9cd3, 0xa514, 0xa534, 0xad75, 0xb5b6, 0xbdf7, 0xce79, 0xe73c, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xf79e, 0xdedb, 0xc638, 0xbdd7, 0xad75, 0xa534, 0x9cf3, 0x9cd3, 0x9492, 0x8c51, 0x8410, 0x7bef, 0x73ae, 
-	0x6b6d, 0x6b4d, 0x630c, 0x5aeb, 0x5acb, 0x52aa, 0x4a69, 0x4a49, 0x4228, 0x4208, 0x39e7, 0x39e7, 0x39c7, 0x31a6, 0x3186, 0x3186, 
-	0x2965, 0x2965, 0x2945, 0x2945, 0x2945, 0x2945, 0x2124, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 
-	0x3186, 0x3186, 0x31a6, 0x39c7, 0x39e7, 0x39e7, 0x4208, 0x4228, 0x4a49, 0x4a69, 0x52aa, 0x5acb, 0x5aeb, 0x630c, 0x6b4d, 0x6b6d, 
-	0x73ae, 0x7bef, 0x8410, 0x8c51, 0x9492, 0x9cd3, 0x9cf3, 0xa534, 0xad75, 0xbdd7, 0xc638, 0xdefb, 0xf79e, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xf79e, 0xdefb, 0xc618, 0xb5b6, 0xad75, 0xa534, 0x9cd3, 0x9492, 0x8c51, 0x8410, 0x7bcf, 0x738e, 0x6b6d, 0x632c, 0x5aeb, 0x5acb, 
-	0x528a, 0x4a69, 0x4228, 0x4208, 0x39c7, 0x31a6, 0x3186, 0x2965, 0x2945, 0x2124, 0x2104, 0x18e3, 0x18c3, 0x18c3, 0x10a2, 0x1082, 
-	0x1082, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x1082, 
-	0x1082, 0x10a2, 0x18c3, 0x18c3, 0x18e3, 0x2104, 0x2124, 0x2945, 0x2965, 0x3186, 0x31a6, 0x39c7, 0x4208, 0x4228, 0x4a69, 0x528a, 
-	0x5acb, 0x5aeb, 0x632c, 0x6b6d, 0x738e, 0x7bcf, 0x8410, 0x8c51, 0x9492, 0x9cd3, 0xa534, 0xad75, 0xb5b6, 0xc618, 0xdedb, 0xef7d, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0xdefb, 0xc618, 
-	0xb5b6, 0xad75, 0xa514, 0x9cd3, 0x9492, 0x8430, 0x7bef, 0x73ae, 0x6b6d, 0x632c, 0x5aeb, 0x52aa, 0x4a69, 0x4a49, 0x4208, 0x39c7, 
-	0x31a6, 0x2965, 0x2945, 0x2104, 0x18e3, 0x18c3, 0x10a2, 0x0861, 0x0841, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0841, 0x0861, 0x10a2, 0x18c3, 0x18e3, 0x2104, 0x2945, 0x2965, 0x31a6, 
-	0x39c7, 0x4208, 0x4a49, 0x4a69, 0x52aa, 0x5aeb, 0x632c, 0x6b6d, 0x73ae, 0x7bef, 0x8430, 0x9492, 0x9cd3, 0xa514, 0xad75, 0xb5b6, 
-	0xc638, 0xdefb, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef5d, 0xce79, 0xbdd7, 0xad75, 0xa534, 
-	0x9cd3, 0x8c71, 0x8430, 0x7bef, 0x738e, 0x6b4d, 0x630c, 0x5acb, 0x528a, 0x4a49, 0x4208, 0x39c7, 0x3186, 0x2945, 0x2124, 0x18e3, 
-	0x10a2, 0x1082, 0x0841, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0841, 0x1082, 0x10a2, 
-	0x18e3, 0x2124, 0x2945, 0x3186, 0x39c7, 0x4208, 0x4a49, 0x528a, 0x5acb, 0x630c, 0x6b4d, 0x738e, 0x7bef, 0x8430, 0x8c71, 0x9cd3, 
-	0xa534, 0xad75, 0xbdd7, 0xce79, 0xef5d, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0xdefb, 0xc618, 0xb596, 0xa534, 0x9cf3, 0x9492, 0x8430, 
-	0x7bef, 0x738e, 0x6b4d, 0x630c, 0x52aa, 0x4a69, 0x4228, 0x39e7, 0x3186, 0x2945, 0x2104, 0x18e3, 0x10a2, 0x0861, 0x0020, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0020, 0x0861, 0x10a2, 0x18e3, 0x2104, 0x2945, 0x3186, 0x39e7, 0x4228, 0x4a69, 0x52aa, 0x630c, 0x6b4d, 0x738e, 0x7bef, 
-	0x8430, 0x9492, 0x9cf3, 0xa534, 0xb596, 0xc618, 0xdefb, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf79e, 0xd6ba, 0xbdd7, 0xad75, 0xa514, 0x94b2, 0x8c51, 0x8410, 0x73ae, 0x6b4d, 
-	0x630c, 0x52aa, 0x4a69, 0x4208, 0x39c7, 0x3186, 0x2124, 0x18e3, 0x10a2, 0x0861, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0861, 0x10a2, 0x18e3, 0x2124, 0x3186, 0x39c7, 0x4208, 0x4a69, 0x52aa, 0x630c, 
-	0x6b4d, 0x73ae, 0x8410, 0x8c51, 0x94b2, 0xa514, 0xad75, 0xbdd7, 0xd69a, 0xef7d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xef7d, 0xce59, 0xb5b6, 0xad55, 0x9cf3, 0x9492, 0x8430, 0x7bcf, 0x6b6d, 0x632c, 0x5acb, 0x4a69, 
-	0x4228, 0x39c7, 0x3186, 0x2124, 0x18e3, 0x10a2, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x10a2, 0x18e3, 0x2124, 0x3186, 0x39c7, 0x4228, 
-	0x4a69, 0x5acb, 0x632c, 0x6b6d, 0x7bcf, 0x8430, 0x9492, 0x9cf3, 0xad55, 0xb5b6, 0xce79, 0xef7d, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xef7d, 0xce59, 0xb5b6, 0xad55, 0x9cd3, 0x8c71, 0x8410, 0x73ae, 0x6b4d, 0x5aeb, 0x528a, 0x4a49, 0x39e7, 0x3186, 
-	0x2945, 0x18e3, 0x10a2, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x10a2, 0x18e3, 0x2945, 
-	0x3186, 0x39e7, 0x4a49, 0x528a, 0x5aeb, 0x6b4d, 0x73ae, 0x8410, 0x8c71, 0x9cd3, 0xad55, 0xb5b6, 0xce59, 0xef5d, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xef7d, 0xce59, 0xb5b6, 0xa534, 0x9cd3, 0x8c71, 0x8410, 0x738e, 0x632c, 0x5acb, 0x4a69, 0x4208, 0x31a6, 0x2965, 0x2104, 0x10a2, 
-	0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 
-	0x10a2, 0x2104, 0x2965, 0x31a6, 0x4208, 0x4a69, 0x5acb, 0x632c, 0x738e, 0x8410, 0x8c71, 0x9cd3, 0xa534, 0xb5b6, 0xce59, 0xef5d, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef7d, 0xce59, 
-	0xb5b6, 0xa534, 0x9cd3, 0x8c71, 0x7bef, 0x738e, 0x632c, 0x5acb, 0x4a49, 0x39e7, 0x3186, 0x2124, 0x18e3, 0x1082, 0x0020, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0020, 0x1082, 0x18e3, 0x2124, 0x3186, 0x39e7, 0x4a49, 0x5acb, 0x632c, 0x738e, 0x7bef, 0x8c71, 0x9cd3, 0xa534, 0xb5b6, 
-	0xce59, 0xf79e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0xd69a, 0xb5b6, 0xad55, 
-	0x9cd3, 0x8c71, 0x7bef, 0x738e, 0x630c, 0x52aa, 0x4a49, 0x39e7, 0x3186, 0x2124, 0x10a2, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x10a2, 0x2124, 0x3186, 0x39e7, 0x4a49, 0x52aa, 0x630c, 0x738e, 0x7bef, 0x8c71, 0x9cd3, 
-	0xad55, 0xb5b6, 0xd69a, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xe71c, 0xbdd7, 0xad55, 0x9cf3, 0x8c71, 
-	0x8410, 0x738e, 0x632c, 0x52aa, 0x4a49, 0x39c7, 0x2965, 0x2104, 0x10a2, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x10a2, 0x2104, 0x2965, 0x39c7, 0x4a49, 0x52aa, 0x632c, 0x738e, 0x8410, 
-	0x8c71, 0x9cf3, 0xad55, 0xbdd7, 0xdedb, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef5d, 0xc618, 0xad75, 0xa514, 0x9492, 0x8410, 0x73ae, 
-	0x632c, 0x52aa, 0x4a49, 0x39c7, 0x2965, 0x2104, 0x1082, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1082, 0x2104, 0x2965, 0x39c7, 0x4a49, 0x52aa, 0x632c, 
-	0x73ae, 0x8410, 0x9492, 0xa514, 0xad75, 0xc618, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xd69a, 0xb5b6, 0xa534, 0x94b2, 0x8430, 0x73ae, 0x6b4d, 0x5acb, 
-	0x4a49, 0x39e7, 0x2965, 0x2104, 0x1082, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1082, 0x2104, 0x2965, 0x39e7, 0x4a49, 
-	0x5acb, 0x6b4d, 0x73ae, 0x8430, 0x94b2, 0xa534, 0xb5b6, 0xd69a, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xe73c, 0xbdf7, 0xad55, 0x9cd3, 0x8c51, 0x7bef, 0x6b6d, 0x5aeb, 0x4a69, 0x39e7, 
-	0x3186, 0x2104, 0x10a2, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x10a2, 0x2104, 0x3186, 
-	0x39e7, 0x4a69, 0x5aeb, 0x6b6d, 0x7bef, 0x8c51, 0x9cd3, 0xad55, 0xbdf7, 0xe71c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0xce59, 0xb596, 0xa514, 0x9492, 0x8410, 0x738e, 0x630c, 0x528a, 0x4208, 0x31a6, 0x2124, 
-	0x10a2, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x10a2, 
-	0x2124, 0x31a6, 0x4208, 0x528a, 0x630c, 0x738e, 0x8410, 0x9492, 0xa514, 0xb596, 0xce79, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xe73c, 0xbdf7, 0xad55, 0x9cd3, 0x8c51, 0x7bcf, 0x6b4d, 0x5acb, 0x4a49, 0x39c7, 0x2945, 0x18c3, 0x0841, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0841, 0x18c3, 0x2945, 0x39c7, 0x4a49, 0x5acb, 0x6b4d, 0x7bcf, 0x8c51, 0x9cd3, 0xad55, 0xbdf7, 0xe73c, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffdf, 0xd69a, 0xb5b6, 0xa514, 0x9492, 0x8410, 0x738e, 0x5aeb, 0x4a69, 0x39e7, 0x2965, 0x18e3, 0x0861, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0861, 0x18e3, 0x2965, 0x39e7, 0x4a69, 0x5aeb, 0x738e, 0x8410, 0x9492, 0xa514, 0xb5b6, 0xd69a, 0xffdf, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xef7d, 0xc618, 0xad75, 0x9cd3, 0x8c51, 0x7bcf, 0x632c, 0x52aa, 0x4228, 0x31a6, 0x2124, 0x10a2, 0x0020, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0020, 0x10a2, 0x2124, 0x31a6, 0x4228, 0x52aa, 0x632c, 0x7bcf, 0x8c51, 0x9cd3, 0xad75, 0xc618, 0xef7d, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdefb, 
-	0xbdd7, 0xa534, 0x94b2, 0x8410, 0x738e, 0x630c, 0x4a69, 0x39e7, 0x2965, 0x18e3, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x18e3, 0x2965, 0x39e7, 0x4a69, 0x630c, 0x738e, 0x8410, 0x94b2, 0xa534, 0xbdd7, 
-	0xdefb, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xd69a, 0xb596, 
-	0xa514, 0x8c71, 0x7bef, 0x6b4d, 0x5acb, 0x4228, 0x31a6, 0x2124, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x2124, 0x31a6, 0x4228, 0x5acb, 0x6b4d, 0x7bef, 0x8c71, 0xa514, 
-	0xb596, 0xd69a, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0xc638, 0xad75, 0x9cd3, 
-	0x8c51, 0x73ae, 0x630c, 0x528a, 0x4208, 0x2965, 0x18e3, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x18e3, 0x2965, 0x4208, 0x528a, 0x630c, 0x73ae, 0x8c51, 
-	0x9cd3, 0xad75, 0xc638, 0xf79e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef5d, 0xbdf7, 0xad55, 0x94b2, 0x8410, 
-	0x738e, 0x5aeb, 0x4a49, 0x39c7, 0x2124, 0x10a2, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x10a2, 0x2124, 0x39c7, 0x4a49, 0x5aeb, 0x738e, 
-	0x8410, 0x94b2, 0xad55, 0xbdf7, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xe71c, 0xb5b6, 0xa534, 0x9492, 0x7bef, 0x6b4d, 
-	0x5acb, 0x4228, 0x3186, 0x2104, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x2104, 0x3186, 0x4228, 0x5acb, 
-	0x6b4d, 0x7bef, 0x9492, 0xa534, 0xb5b6, 0xdefb, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdedb, 0xb596, 0xa514, 0x8c71, 0x7bcf, 0x632c, 0x528a, 
-	0x4208, 0x2965, 0x18c3, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x18c3, 0x2965, 0x4208, 
-	0x528a, 0x632c, 0x7bcf, 0x8c71, 0xa514, 0xb596, 0xd6ba, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xd69a, 0xb596, 0x9cf3, 0x8c51, 0x73ae, 0x630c, 0x4a69, 0x39e7, 
-	0x2945, 0x10a2, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x10a2, 0x2945, 
-	0x39e7, 0x4a69, 0x630c, 0x73ae, 0x8c51, 0x9cf3, 0xb596, 0xce79, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xce59, 0xad75, 0x9cd3, 0x8430, 0x738e, 0x5aeb, 0x4a49, 0x31a6, 0x2124, 
-	0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 
-	0x2124, 0x31a6, 0x4a49, 0x5aeb, 0x738e, 0x8430, 0x9cd3, 0xad75, 0xce59, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xc638, 0xad75, 0x94b2, 0x8410, 0x6b6d, 0x5acb, 0x4228, 0x31a6, 0x2104, 0x0861, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0861, 0x2104, 0x31a6, 0x4228, 0x5acb, 0x6b6d, 0x8410, 0x94b2, 0xad75, 0xc638, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0xc638, 0xad55, 0x94b2, 0x8410, 0x6b6d, 0x5acb, 0x4228, 0x3186, 0x18e3, 0x0841, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0841, 0x18e3, 0x3186, 0x4228, 0x5acb, 0x6b6d, 0x8410, 0x94b2, 0xad55, 0xc638, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xf7be, 0xc618, 0xad55, 0x94b2, 0x8410, 0x6b4d, 0x52aa, 0x4208, 0x2965, 0x18c3, 0x0020, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0020, 0x18c3, 0x2965, 0x4208, 0x52aa, 0x6b4d, 0x8410, 0x94b2, 0xad55, 0xc618, 0xf7be, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xf7be, 0xc618, 0xad55, 0x94b2, 0x7bef, 0x6b4d, 0x52aa, 0x4208, 0x2965, 0x18c3, 0x0020, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0020, 0x18c3, 0x2965, 0x4208, 0x52aa, 0x6b4d, 0x7bef, 0x94b2, 0xad55, 0xc618, 0xf7be, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffdf, 0xc618, 0xad55, 0x9492, 0x7bef, 0x6b4d, 0x52aa, 0x39e7, 0x2945, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x2945, 0x39e7, 0x52aa, 0x6b4d, 0x7bef, 0x9492, 0xad55, 0xc618, 0xf7be, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffdf, 0xc638, 0xad55, 0x94b2, 0x7bef, 0x6b4d, 0x528a, 0x39e7, 0x2945, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x2945, 0x39e7, 0x528a, 0x6b4d, 0x7bef, 0x94b2, 0xad55, 0xc638, 0xffdf, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 
-	0xc638, 0xad55, 0x94b2, 0x7bef, 0x6b4d, 0x528a, 0x39e7, 0x2945, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x2945, 0x39e7, 0x528a, 0x6b4d, 0x7bef, 0x94b2, 0xad55, 0xc638, 
-	0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xce59, 
-	0xad75, 0x94b2, 0x8410, 0x6b4d, 0x52aa, 0x39e7, 0x2945, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 
-	0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 
-	0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x2945, 0x39e7, 0x52aa, 0x6b4d, 0x8410, 0x94b2, 0xad75, 
-	0xce59, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xd69a, 0xad75, 
-	0x94b2, 0x8410, 0x6b4d, 0x52aa, 0x39e7, 0x2945, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 
-	0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 
-	0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x2945, 0x39e7, 0x52aa, 0x6b4d, 0x8410, 0x94b2, 
-	0xad75, 0xd69a, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdedb, 0xb596, 0x9cd3, 
-	0x8410, 0x6b6d, 0x52aa, 0x4208, 0x2945, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 
-	0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 
-	0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x2945, 0x4208, 0x52aa, 0x6b6d, 0x8410, 
-	0x9cd3, 0xb596, 0xdedb, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xe71c, 0xb596, 0x9cf3, 0x8430, 
-	0x6b6d, 0x5acb, 0x4208, 0x2965, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 
-	0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 
-	0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 
-	0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 
-	0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x2965, 0x4208, 0x5acb, 0x6b6d, 
-	0x8430, 0x9cf3, 0xb596, 0xe71c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef5d, 0xb5b6, 0xa514, 0x8c51, 0x738e, 
-	0x5acb, 0x4228, 0x2965, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 
-	0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 
-	0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 
-	0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 
-	0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c3, 0x2965, 0x4228, 0x5acb, 
-	0x738e, 0x8c51, 0xa514, 0xb5b6, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf79e, 0xbdf7, 0xa534, 0x8c71, 0x73ae, 0x5aeb, 
-	0x4228, 0x3186, 0x18c3, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 
-	0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 
-	0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 
-	0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 
-	0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x18c3, 0x3186, 0x4228, 
-	0x5aeb, 0x73ae, 0x8c71, 0xa534, 0xbdf7, 0xf79e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xc638, 0xad55, 0x9492, 0x7bcf, 0x630c, 0x4a49, 
-	0x31a6, 0x18e3, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0820, 0x0841, 0x0841, 0x0841, 
-	0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1082, 0x1082, 0x1082, 
-	0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 
-	0x1082, 0x1082, 0x1082, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 
-	0x0841, 0x0841, 0x0841, 0x0820, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x18e3, 0x31a6, 
-	0x4a49, 0x630c, 0x7bcf, 0x9492, 0xad55, 0xc638, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xd69a, 0xad75, 0x94b2, 0x7bef, 0x632c, 0x4a69, 0x31a6, 
-	0x2104, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 
-	0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 
-	0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 
-	0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 
-	0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x2104, 
-	0x31a6, 0x4a69, 0x632c, 0x7bef, 0x94b2, 0xad75, 0xd69a, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdefb, 0xb596, 0x9cd3, 0x8410, 0x6b4d, 0x528a, 0x39e7, 0x2124, 
-	0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 
-	0x0861, 0x0861, 0x0861, 0x1061, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10a2, 0x10a2, 0x10a2, 
-	0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 
-	0x10a2, 0x10a2, 0x10a2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1061, 0x0861, 0x0861, 0x0861, 
-	0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 
-	0x2124, 0x39e7, 0x528a, 0x6b4d, 0x8410, 0x9cd3, 0xb596, 0xdefb, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef7d, 0xbdd7, 0xa514, 0x8c51, 0x738e, 0x5acb, 0x4208, 0x2945, 0x1082, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 
-	0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 
-	0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 
-	0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 
-	0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x1082, 0x2945, 0x4208, 0x5acb, 0x738e, 0x8c51, 0xa514, 0xbdd7, 0xef7d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xc618, 0xa534, 0x8c71, 0x73ae, 0x5aeb, 0x4228, 0x2965, 0x10a2, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 
-	0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1082, 0x1082, 
-	0x1082, 0x1082, 0x1082, 0x1082, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x18a2, 0x18c3, 0x18c3, 
-	0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 
-	0x18c3, 0x18c3, 0x18a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x1082, 0x1082, 0x1082, 0x1082, 
-	0x1082, 0x1082, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 
-	0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x10a2, 0x2965, 0x4228, 0x5aeb, 0x73ae, 0x8c71, 0xa534, 0xc618, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xd69a, 0xad75, 0x94b2, 0x7bef, 0x630c, 0x4a49, 0x3186, 0x18c3, 0x0020, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 
-	0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 
-	0x1082, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 
-	0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 
-	0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x1082, 
-	0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 
-	0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0020, 0x18c3, 0x3186, 0x4a49, 0x630c, 0x7bef, 0x94b2, 0xad75, 0xd69a, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xe73c, 0xb5b6, 0x9cd3, 0x8410, 0x6b4d, 0x528a, 0x39c7, 0x2104, 0x0841, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 
-	0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10a2, 0x10a2, 
-	0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x18a2, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 
-	0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 
-	0x18e3, 0x18e3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 
-	0x10a2, 0x10a2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 
-	0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0841, 0x2104, 0x39c7, 0x528a, 0x6b4d, 0x8410, 0x9cd3, 0xb5b6, 0xe73c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0xbdf7, 0xa514, 0x8c51, 0x738e, 0x5acb, 0x4208, 0x2124, 0x0861, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 
-	0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 
-	0x10a2, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 
-	0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 
-	0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x10a2, 
-	0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 
-	0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0861, 0x2124, 0x4208, 0x5acb, 0x738e, 0x8c51, 0xa514, 0xbdf7, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xce59, 0xad55, 0x9492, 0x7bcf, 0x630c, 0x4228, 0x2965, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 
-	0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1082, 0x1082, 0x1082, 0x1082, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x18a2, 0x18c3, 
-	0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x20e3, 0x20e3, 0x2104, 
-	0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 
-	0x2104, 0x20e3, 0x20e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 
-	0x18c3, 0x18a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 
-	0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x2965, 0x4228, 0x630c, 0x7bcf, 0x9492, 0xad55, 0xce79, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xe71c, 0xb596, 0x9cd3, 0x8410, 0x632c, 0x4a69, 0x31a6, 0x18e3, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 
-	0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 
-	0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x20e3, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 
-	0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 
-	0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x20e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18c3, 0x18c3, 
-	0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x1082, 0x1082, 0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 
-	0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x18e3, 0x31a6, 0x4a69, 0x632c, 0x8410, 0x9cd3, 0xb596, 0xe73c, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffdf, 0xbdf7, 0xa514, 0x8c51, 0x738e, 0x52aa, 0x39e7, 0x2124, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 
-	0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x18a2, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18e3, 
-	0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 
-	0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 
-	0x2124, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 
-	0x18e3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x1082, 0x1082, 0x1082, 0x1082, 0x0861, 
-	0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x2124, 0x39e7, 0x52aa, 0x738e, 0x8c51, 0xa514, 0xbdf7, 0xf7be, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xd69a, 0xad55, 0x9492, 0x7bcf, 0x5aeb, 0x4228, 0x2965, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x1061, 
-	0x1082, 0x1082, 0x1082, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x18a2, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x18e3, 
-	0x18e3, 0x18e3, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 
-	0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 
-	0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x18e3, 0x18e3, 
-	0x18e3, 0x18e3, 0x18e3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x1082, 0x1082, 0x1082, 
-	0x1061, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x2965, 0x4228, 0x5aeb, 0x7bcf, 0x9492, 0xad55, 0xd69a, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xef5d, 0xb5b6, 0x9cd3, 0x8410, 0x6b4d, 0x4a69, 0x31a6, 0x18e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 
-	0x1082, 0x1082, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x2104, 
-	0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2924, 0x2924, 
-	0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 
-	0x2924, 0x2924, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 
-	0x2104, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x1082, 0x1082, 
-	0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18e3, 0x31a6, 0x4a69, 0x6b4d, 0x8410, 0x9cd3, 0xb5b6, 0xef5d, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffdf, 0xc618, 0xa534, 0x8c51, 0x738e, 0x5acb, 0x39e7, 0x2124, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x1061, 0x1082, 0x1082, 0x1082, 
-	0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x2104, 0x2104, 0x2104, 
-	0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2924, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 
-	0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 
-	0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2924, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 
-	0x2104, 0x2104, 0x2104, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 
-	0x1082, 0x1082, 0x1082, 0x1061, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x2124, 0x39e7, 0x5acb, 0x738e, 0x8c51, 0xa534, 0xc618, 0xffdf, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xdefb, 0xad75, 0x94b2, 0x7bef, 0x630c, 0x4a49, 0x2965, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x10a2, 
-	0x10a2, 0x10a2, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x20e3, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 
-	0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2924, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 
-	0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 
-	0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2924, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 
-	0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x20e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x10a2, 0x10a2, 
-	0x10a2, 0x1082, 0x1082, 0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x2965, 0x4a49, 0x630c, 0x7bef, 0x94b2, 0xad75, 0xdefb, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 
-	0xbdd7, 0xa514, 0x8430, 0x6b6d, 0x528a, 0x39c7, 0x18e3, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x1082, 0x10a2, 0x10a2, 0x10a2, 
-	0x10a2, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x18e3, 0x20e3, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 
-	0x2124, 0x2124, 0x2924, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 
-	0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 
-	0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2924, 0x2124, 0x2124, 
-	0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x20e3, 0x18e3, 0x18e3, 0x18e3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x10a2, 
-	0x10a2, 0x10a2, 0x10a2, 0x1082, 0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x18e3, 0x39c7, 0x528a, 0x6b6d, 0x8430, 0xa514, 0xbdd7, 
-	0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xd69a, 
-	0xad55, 0x9492, 0x73ae, 0x5aeb, 0x4208, 0x2945, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 
-	0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x1061, 0x1082, 0x1082, 0x1082, 0x10a2, 0x10a2, 0x10a2, 0x18c3, 
-	0x18c3, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 
-	0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x3165, 0x3165, 
-	0x3165, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3165, 
-	0x3165, 0x3165, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 
-	0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x2104, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18c3, 0x18c3, 0x18c3, 
-	0x18c3, 0x10a2, 0x10a2, 0x10a2, 0x1082, 0x1082, 0x1082, 0x1061, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 
-	0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x2945, 0x4208, 0x5aeb, 0x73ae, 0x9492, 0xad55, 
-	0xd69a, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf79e, 0xb5b6, 
-	0x9cf3, 0x8410, 0x6b4d, 0x4a69, 0x31a6, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 
-	0x0020, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x10a2, 0x10a2, 0x10a2, 0x18c3, 0x18c3, 
-	0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x18e3, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2924, 0x2945, 0x2945, 
-	0x2945, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x3165, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 
-	0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 
-	0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3165, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2945, 0x2945, 0x2945, 0x2945, 
-	0x2945, 0x2945, 0x2924, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x18e3, 0x18e3, 0x18e3, 0x18c3, 0x18c3, 
-	0x18c3, 0x18c3, 0x10a2, 0x10a2, 0x10a2, 0x1082, 0x1082, 0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0020, 
-	0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c3, 0x31a6, 0x4a69, 0x6b4d, 0x8410, 0x9cf3, 
-	0xb5b6, 0xf79e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xce79, 0xad55, 
-	0x8c71, 0x73ae, 0x5acb, 0x39e7, 0x2124, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 
-	0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x1082, 0x10a2, 0x10a2, 0x10a2, 0x18a2, 0x18c3, 0x18c3, 0x18c3, 
-	0x18e3, 0x18e3, 0x18e3, 0x20e3, 0x18c3, 0x10a2, 0x10c2, 0x10c2, 0x08a2, 0x10a2, 0x10c2, 0x10c2, 0x18e3, 0x2945, 0x2945, 0x2945, 
-	0x2945, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x3165, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 
-	0x3186, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x3186, 
-	0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3165, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2945, 
-	0x2945, 0x2945, 0x2945, 0x2945, 0x2924, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x2104, 0x20e3, 0x18e3, 0x18e3, 0x18e3, 
-	0x18c3, 0x18c3, 0x18c3, 0x18a2, 0x10a2, 0x10a2, 0x10a2, 0x1082, 0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 
-	0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0040, 0x0881, 0x0881, 0x0881, 0x0881, 0x0881, 0x0020, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x2124, 0x39e7, 0x5acb, 0x73ae, 0x8c71, 
-	0xad55, 0xce79, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef7d, 0xb5b6, 0x9cd3, 
-	0x8410, 0x632c, 0x4a49, 0x3186, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0040, 0x0881, 0x0881, 0x0881, 0x0881, 0x0881, 0x0881, 0x0881, 0x0881, 0x0881, 0x0881, 0x0881, 0x0881, 0x0881, 
-	0x0881, 0x0881, 0x0881, 0x0881, 0x0881, 0x0881, 0x0881, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0041, 0x0881, 0x0881, 
-	0x0881, 0x0881, 0x0881, 0x0881, 0x0881, 0x0881, 0x0881, 0x0881, 0x0881, 0x0881, 0x0881, 0x10a2, 0x18c3, 0x18c3, 0x18c3, 0x18e3, 
-	0x18e3, 0x18e3, 0x10a2, 0x08a2, 0x1943, 0x4bcb, 0x6db1, 0x7ed4, 0x8735, 0x7ef5, 0x7632, 0x5cee, 0x2a87, 0x0881, 0x18e3, 0x2924, 
-	0x2965, 0x2965, 0x2965, 0x3165, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x18e3, 0x0882, 0x08a2, 0x08a2, 0x08a2, 0x08a2, 0x08a2, 
-	0x08a2, 0x08a2, 0x08a2, 0x08a2, 0x08a2, 0x08a2, 0x08a2, 0x08a2, 0x08a2, 0x08a2, 0x08a2, 0x08a2, 0x08a2, 0x0861, 0x3186, 0x31a6, 
-	0x31a6, 0x31a6, 0x1903, 0x0881, 0x08a2, 0x0882, 0x0882, 0x0882, 0x0882, 0x0882, 0x0882, 0x0882, 0x0881, 0x0881, 0x0881, 0x0881, 
-	0x0881, 0x0881, 0x0881, 0x0881, 0x0881, 0x0881, 0x0881, 0x0881, 0x18e3, 0x2124, 0x2104, 0x2104, 0x2104, 0x10c2, 0x0881, 0x0881, 
-	0x0881, 0x0881, 0x0881, 0x0881, 0x0881, 0x0881, 0x0881, 0x0881, 0x0881, 0x0881, 0x0881, 0x0040, 0x0861, 0x0861, 0x0841, 0x0841, 
-	0x0841, 0x0020, 0x0020, 0x0041, 0x0881, 0x2206, 0x54ae, 0x7632, 0x7ef5, 0x8756, 0x7ed4, 0x6dd1, 0x4c0c, 0x1964, 0x0881, 0x0020, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x3186, 0x4a49, 0x632c, 0x8410, 
-	0x9cd3, 0xb5b6, 0xef7d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xce59, 0xa534, 0x8c71, 
-	0x738e, 0x52aa, 0x39e7, 0x2104, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x2a67, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x2a87, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x3b29, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97d7, 0x1103, 0x18c3, 0x18e3, 0x18e3, 0x18e3, 
-	0x18c3, 0x08a2, 0x3287, 0x7e94, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8fb7, 0x54ae, 0x10c2, 
-	0x1903, 0x2965, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x31a6, 0x1944, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x32a8, 0x3186, 0x39a6, 
-	0x39a6, 0x31a6, 0x1944, 0x8f97, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x86f5, 0x1924, 0x2124, 0x2124, 0x2124, 0x2104, 0x1923, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x2a26, 0x0861, 0x0861, 0x0861, 0x0841, 
-	0x0841, 0x0841, 0x08a2, 0x544d, 0x8f76, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x86f5, 0x3b09, 
-	0x0881, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x2104, 0x39e7, 0x52aa, 0x738e, 
-	0x8c71, 0xa534, 0xce59, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef7d, 0xb5b6, 0x9cd3, 0x7bef, 
-	0x632c, 0x4a49, 0x2965, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x2a67, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x2a87, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x3b29, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97d7, 0x1103, 0x18e3, 0x18e3, 0x18e3, 0x10c3, 
-	0x1103, 0x7673, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8fb7, 
-	0x436a, 0x10c2, 0x2965, 0x3186, 0x3186, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x1944, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x32a8, 0x31a6, 0x39c7, 
-	0x39c7, 0x39c7, 0x2144, 0x8f97, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x86f5, 0x1924, 0x2924, 0x2124, 0x2124, 0x2124, 0x1923, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x2a26, 0x0861, 0x0861, 0x0861, 0x0841, 
-	0x0881, 0x32c8, 0x8f76, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x7ed4, 0x1964, 0x0041, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x2965, 0x4a49, 0x632c, 
-	0x7bef, 0x9cd3, 0xb5b6, 0xef7d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xce59, 0xa534, 0x8c71, 0x738e, 
-	0x52aa, 0x39c7, 0x2104, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x21c5, 0x6dd1, 0x7653, 0x7653, 0x7653, 0x8756, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x8f76, 0x6dd1, 0x6dd1, 0x6dd1, 0x6dd1, 0x6dd1, 0x21c5, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x2a47, 0x6dd1, 0x7673, 
-	0x97d7, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8f76, 0x6dd1, 0x6dd1, 0x6dd1, 0x6dd1, 0x6db1, 0x1103, 0x18e3, 0x18e3, 0x10c3, 0x2a47, 
-	0x8fb7, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8f76, 0x8fb7, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x6db1, 0x10c2, 0x2965, 0x31a6, 0x31a6, 0x31a6, 0x39a6, 0x39c7, 0x1944, 0x6dd1, 0x6dd1, 0x6dd1, 0x6dd1, 0x6dd1, 0x8715, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97d7, 0x6dd1, 0x6dd1, 0x6dd1, 0x6dd1, 0x6dd1, 0x21e6, 0x31a6, 0x39c7, 
-	0x39c7, 0x39c7, 0x2144, 0x6590, 0x6dd1, 0x6dd1, 0x6dd1, 0x7632, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8756, 0x6df2, 0x6dd1, 0x5d0f, 0x1944, 0x2945, 0x2945, 0x2124, 0x2124, 0x1923, 0x6dd1, 0x6dd1, 
-	0x6df2, 0x86f5, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x7e94, 0x7653, 0x7653, 0x7653, 0x6dd1, 0x19a5, 0x1082, 0x1082, 0x0861, 0x08a2, 
-	0x5d0f, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8fb7, 0x8f76, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97d7, 0x32e8, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x2104, 0x39c7, 0x52aa, 
-	0x738e, 0x8c71, 0xa534, 0xce59, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef5d, 0xb5b6, 0x9cd3, 0x7bef, 0x630c, 
-	0x4a49, 0x2965, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0061, 0x0881, 0x0881, 0x08a2, 0x0881, 0x2226, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x7ed4, 0x0041, 0x0881, 0x0881, 0x0881, 0x0881, 0x0861, 0x0000, 0x0020, 0x0020, 0x0020, 0x0841, 0x0881, 0x08a2, 0x10c2, 
-	0x1964, 0x438a, 0x97f8, 0x97f8, 0x97f8, 0x43ab, 0x08a2, 0x10a2, 0x10c2, 0x10c2, 0x10c2, 0x10c2, 0x18e3, 0x10c3, 0x3288, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x7612, 0x1103, 0x08a2, 0x0881, 0x436a, 0x97d7, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x7632, 0x10e2, 0x31a6, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x2124, 0x1903, 0x1903, 0x1903, 0x1903, 0x10c2, 0x544d, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8756, 0x0882, 0x1903, 0x1903, 0x1903, 0x1903, 0x18e3, 0x39c7, 0x39e7, 
-	0x39e7, 0x39e7, 0x2144, 0x1903, 0x1903, 0x1903, 0x1903, 0x10a2, 0x8735, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x434a, 0x3227, 0x2164, 0x10e3, 0x10e3, 0x10e3, 0x1904, 0x2945, 0x2945, 0x2945, 0x2924, 0x18e3, 0x10c2, 0x10c2, 
-	0x10c2, 0x08a2, 0x97d7, 0x97f8, 0x97f8, 0x8756, 0x0881, 0x10c2, 0x10c2, 0x10a2, 0x10a2, 0x0881, 0x1082, 0x1082, 0x08a2, 0x6591, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x43cb, 0x0861, 0x0881, 0x08c2, 0x6db1, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x3b4a, 0x0061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x2965, 0x4a49, 
-	0x630c, 0x7bef, 0x9cd3, 0xb5b6, 0xef7d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xce59, 0xad55, 0x8c71, 0x738e, 0x52aa, 
-	0x39c7, 0x2104, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x08c2, 0x8756, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x1964, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 
-	0x10a2, 0x6591, 0x97f8, 0x97f8, 0x97f8, 0x1123, 0x18c3, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x20e3, 0x18c3, 0x19a5, 0x97d7, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x7632, 0x10c2, 0x2124, 0x2965, 0x2965, 0x18e3, 0x32a8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x6570, 0x1903, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x2965, 0x544d, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8756, 0x2165, 0x4208, 0x4208, 0x4208, 0x4208, 0x41e7, 0x41e7, 0x41e7, 
-	0x41e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x2965, 0x43cb, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x5cef, 0x2144, 0x3186, 0x3186, 0x3165, 0x2965, 0x2965, 0x2965, 0x2945, 0x2945, 0x2945, 0x2945, 0x2124, 0x2124, 
-	0x2104, 0x21e6, 0x97f8, 0x97f8, 0x97f8, 0x4c2c, 0x10a2, 0x18c3, 0x18c3, 0x18c3, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x54ae, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x3b4a, 0x0861, 0x0000, 0x0000, 0x0000, 0x0881, 0x6590, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x2206, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x2104, 0x39c7, 
-	0x52aa, 0x738e, 0x8c71, 0xad55, 0xce79, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf79e, 0xb5b6, 0x9cd3, 0x8410, 0x632c, 0x4a49, 
-	0x2965, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4bec, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x546d, 0x0020, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x1082, 
-	0x1923, 0x97d8, 0x97f8, 0x97f8, 0x7632, 0x10e3, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x20e3, 0x2104, 0x10e2, 0x8735, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8f97, 0x1103, 0x2945, 0x3165, 0x3186, 0x3186, 0x3186, 0x1903, 0x5d2f, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x3b29, 0x2965, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x41e7, 0x41e7, 0x4208, 0x3186, 0x544d, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8756, 0x2165, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 
-	0x4208, 0x4208, 0x4208, 0x41e7, 0x41e7, 0x39e7, 0x39e7, 0x39e7, 0x1944, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x8fb7, 0x1964, 0x3186, 0x3186, 0x3186, 0x3186, 0x3165, 0x2965, 0x2965, 0x2965, 0x2945, 0x2945, 0x2945, 0x2124, 
-	0x18e3, 0x5d0f, 0x97f8, 0x97f8, 0x97f8, 0x1944, 0x18e3, 0x18e3, 0x18c3, 0x18c3, 0x18c3, 0x10a2, 0x1082, 0x2a47, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x6dd1, 0x08a2, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x08c2, 0x8756, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8f76, 0x10e2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x2965, 
-	0x4a49, 0x632c, 0x8410, 0x9cd3, 0xb5b6, 0xf79e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xd69a, 0xad55, 0x8c71, 0x738e, 0x5acb, 0x39e7, 
-	0x2104, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1103, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x8f96, 0x10e2, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x1082, 0x0861, 
-	0x32e8, 0x97f8, 0x97f8, 0x97f8, 0x32a8, 0x10a2, 0x18c3, 0x18e3, 0x18e3, 0x20e3, 0x2104, 0x18e3, 0x54ae, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x4bec, 0x2104, 0x3186, 0x3186, 0x3186, 0x3186, 0x31a6, 0x3186, 0x1923, 0x97d7, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8f97, 0x1923, 0x39e7, 0x39e7, 0x41e7, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x3186, 0x544d, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8756, 0x2165, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x4208, 0x4208, 
-	0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x41e7, 0x2165, 0x6db1, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x32c8, 0x2965, 0x31a6, 0x3186, 0x3186, 0x3186, 0x3186, 0x2965, 0x2965, 0x2965, 0x2945, 0x2945, 0x2945, 
-	0x1944, 0x8fb7, 0x97f8, 0x97f8, 0x7e94, 0x1903, 0x20e3, 0x18e3, 0x18e3, 0x18c3, 0x18c3, 0x18c3, 0x10e2, 0x8756, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x1143, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x3b09, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x6570, 0x0881, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x2104, 
-	0x39e7, 0x5acb, 0x738e, 0x8c71, 0xad55, 0xd6ba, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0xbdd7, 0x9cf3, 0x8410, 0x632c, 0x4a49, 0x3186, 
-	0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0881, 0x6df2, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x2a46, 0x0000, 0x0000, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x1061, 0x1082, 0x10e2, 
-	0x7673, 0x97f8, 0x97f8, 0x8fb7, 0x1103, 0x18c3, 0x18e3, 0x18e3, 0x20e3, 0x2104, 0x2104, 0x1123, 0x97d8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x1923, 0x3165, 0x3186, 0x3186, 0x3186, 0x31a6, 0x31a6, 0x31a6, 0x2144, 0x6550, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x544d, 0x2965, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4228, 0x3186, 0x544d, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8756, 0x2185, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 
-	0x4228, 0x4228, 0x4228, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x39c7, 0x2a26, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x7673, 0x2144, 0x31a6, 0x31a6, 0x3186, 0x3186, 0x3186, 0x3186, 0x2965, 0x2965, 0x2965, 0x2945, 0x2124, 
-	0x3287, 0x97f8, 0x97f8, 0x97f8, 0x3b29, 0x18c3, 0x2104, 0x20e3, 0x18e3, 0x18e3, 0x18c3, 0x10a2, 0x438a, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x6e12, 0x08a2, 0x0841, 0x0841, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x10e2, 0x8fb7, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x1944, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 
-	0x3186, 0x4a49, 0x632c, 0x8410, 0x9cf3, 0xbdd7, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdefb, 0xad75, 0x9492, 0x73ae, 0x5acb, 0x39e7, 0x2124, 
-	0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2a26, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x6df2, 0x0881, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x1944, 
-	0x97f8, 0x97f8, 0x97f8, 0x652f, 0x10c2, 0x18e3, 0x18e3, 0x20e3, 0x2104, 0x2104, 0x18e3, 0x544d, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x7632, 0x1924, 0x3186, 0x3186, 0x31a6, 0x31a6, 0x31a6, 0x39a6, 0x39c7, 0x31a6, 0x2a27, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8f97, 0x1944, 0x4208, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x31a6, 0x544d, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8756, 0x2185, 0x4a49, 0x4a49, 0x4a49, 0x4a28, 0x4a28, 0x4a28, 0x4a28, 
-	0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x4208, 0x1944, 0x8736, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x2184, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x3186, 0x3186, 0x3186, 0x3165, 0x2965, 0x2965, 0x1924, 
-	0x6df2, 0x97f8, 0x97f8, 0x97d8, 0x1123, 0x2124, 0x2104, 0x2104, 0x20e3, 0x18e3, 0x18e3, 0x1103, 0x8736, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x32c8, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0041, 0x6570, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x5d0f, 0x0041, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 
-	0x2124, 0x39e7, 0x5acb, 0x73ae, 0x9492, 0xad75, 0xdefb, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0xa514, 0x8430, 0x6b4d, 0x4a69, 0x3186, 0x10a2, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x08c2, 0x8f76, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x1123, 0x0020, 0x0020, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x1082, 0x4bcb, 
-	0x97f8, 0x97f8, 0x97f8, 0x21c5, 0x18c3, 0x18e3, 0x20e3, 0x2104, 0x2104, 0x2124, 0x1923, 0x8756, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x43ab, 0x2124, 0x3186, 0x31a6, 0x31a6, 0x31a6, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x1944, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x2a47, 0x39e7, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a28, 0x4a28, 0x31a6, 0x544d, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8756, 0x2185, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 
-	0x4a49, 0x4a49, 0x4a28, 0x4a28, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x3186, 0x4bec, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x542d, 0x2945, 0x39c7, 0x31a6, 0x31a6, 0x31a6, 0x3186, 0x3186, 0x3186, 0x3165, 0x2965, 0x1944, 
-	0x97f8, 0x97f8, 0x97f8, 0x6db1, 0x1903, 0x2124, 0x2124, 0x2104, 0x2104, 0x20e3, 0x18e3, 0x21a5, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x1943, 0x0861, 0x0861, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x32c8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8fb7, 0x10e2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x10a2, 0x3186, 0x4a69, 0x6b4d, 0x8430, 0xa514, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef5d, 0xb596, 0x94b2, 0x7bcf, 0x5aeb, 0x4208, 0x2124, 0x0841, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4c2c, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x43cb, 0x0020, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x1082, 0x1082, 0x1082, 0x1103, 0x8715, 
-	0x97f8, 0x97f8, 0x8756, 0x1103, 0x18e3, 0x20e3, 0x2104, 0x2104, 0x2104, 0x2124, 0x1964, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x21e6, 0x3186, 0x31a6, 0x31a6, 0x39a6, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39e7, 0x2164, 0x86f5, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x652f, 0x2985, 0x4a28, 0x4a28, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x39c7, 0x544d, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8756, 0x2185, 0x4a69, 0x4a69, 0x4a69, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 
-	0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a28, 0x4a28, 0x4228, 0x4228, 0x1944, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8f76, 0x1944, 0x39c7, 0x39c7, 0x39a6, 0x31a6, 0x31a6, 0x3186, 0x3186, 0x3186, 0x2124, 0x3b4a, 
-	0x97f8, 0x97f8, 0x97f8, 0x2a27, 0x2104, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x10a2, 0x4c2c, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x8f97, 0x1103, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0000, 0x0000, 0x1964, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x19a5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0841, 0x2124, 0x4208, 0x5aeb, 0x7bcf, 0x94b2, 0xb596, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xce79, 0xa534, 0x8c51, 0x6b6d, 0x528a, 0x31a6, 0x18e3, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1123, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8735, 0x10e2, 0x0841, 0x0841, 0x0861, 0x0861, 0x1061, 0x1082, 0x1082, 0x1082, 0x21a5, 0x97f8, 
-	0x97f8, 0x97f8, 0x4c2c, 0x10a2, 0x18e3, 0x2104, 0x2104, 0x2104, 0x2124, 0x2104, 0x3287, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x2185, 0x31a6, 0x31a6, 0x39a6, 0x39c7, 0x39c7, 0x39c7, 0x39e7, 0x39e7, 0x39e7, 0x2965, 0x6dd1, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x7ed4, 0x2985, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x39c7, 0x544d, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8756, 0x2985, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 
-	0x4a69, 0x4a69, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a28, 0x2965, 0x6df1, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x2a26, 0x31a6, 0x39c7, 0x39c7, 0x39a6, 0x31a6, 0x31a6, 0x31a6, 0x3186, 0x1924, 0x7eb4, 
-	0x97f8, 0x97f8, 0x8f97, 0x1923, 0x2945, 0x2945, 0x2124, 0x2124, 0x2104, 0x2104, 0x18e3, 0x7632, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x7e73, 0x10c2, 0x1061, 0x0861, 0x0861, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0000, 0x1103, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x3b4a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x18e3, 0x31a6, 0x528a, 0x6b6d, 0x8c51, 0xa534, 0xce79, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0xbdd7, 0x9cf3, 0x8410, 0x632c, 0x4a49, 0x2965, 0x1082, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0881, 0x7612, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x21c5, 0x0841, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x10a2, 0x10a2, 0x5cce, 0x97f8, 
-	0x97f8, 0x97f8, 0x1944, 0x18e3, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x18e3, 0x4bcb, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x1964, 0x31a6, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39e7, 0x39e7, 0x41e7, 0x4208, 0x2965, 0x652f, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97d8, 0x2164, 0x4a49, 0x4a49, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x39c7, 0x544d, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8756, 0x2985, 0x528a, 0x528a, 0x5269, 0x5269, 0x5269, 0x5269, 0x4a69, 
-	0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4208, 0x2a47, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x6db1, 0x2145, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x31a6, 0x31a6, 0x3186, 0x1964, 0x97f8, 
-	0x97f8, 0x97f8, 0x5cae, 0x1904, 0x2945, 0x2945, 0x2945, 0x2124, 0x2124, 0x2104, 0x1923, 0x8756, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x6df2, 0x10a2, 0x1082, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0020, 0x0020, 0x0000, 0x10e2, 0x97d8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x5cce, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x1082, 0x2965, 0x4a49, 0x632c, 0x8410, 0x9cf3, 0xbdd7, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdefb, 0xad75, 0x9492, 0x73ae, 0x5acb, 0x39e7, 0x2104, 0x0020, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2a47, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x6550, 0x0881, 0x0861, 0x0861, 0x1082, 0x1082, 0x1082, 0x10a2, 0x1103, 0x8f97, 0x97f8, 
-	0x97f8, 0x7e94, 0x1103, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2924, 0x18e3, 0x5cce, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x1944, 0x39c7, 0x39c7, 0x39c7, 0x39e7, 0x39e7, 0x39e7, 0x41e7, 0x4208, 0x4208, 0x3186, 0x546d, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x2185, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x5269, 0x5269, 0x39e7, 0x544d, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8756, 0x29a5, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 
-	0x528a, 0x528a, 0x5269, 0x5269, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a49, 0x4a49, 0x4a49, 0x2144, 0x8756, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x1944, 0x39e7, 0x39e7, 0x39c7, 0x39c7, 0x39c7, 0x31a6, 0x2144, 0x544d, 0x97f8, 
-	0x97f8, 0x97f8, 0x21a5, 0x2945, 0x2965, 0x2945, 0x2945, 0x2924, 0x2124, 0x2124, 0x1923, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x6570, 0x0861, 0x1082, 0x1082, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x10e2, 0x8fb7, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x6db1, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0020, 0x2104, 0x39e7, 0x5acb, 0x73ae, 0x9492, 0xad75, 0xdefb, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0xa534, 0x8430, 0x6b4d, 0x4a69, 0x3186, 0x10a2, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10e2, 0x8f76, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97d8, 0x1123, 0x0861, 0x1061, 0x1082, 0x1082, 0x10a2, 0x10a2, 0x3287, 0x97f8, 0x97f8, 
-	0x97f8, 0x3b09, 0x18c3, 0x2104, 0x2104, 0x2124, 0x2124, 0x2924, 0x2945, 0x18e3, 0x5cee, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x1944, 0x39c7, 0x39c7, 0x39e7, 0x39e7, 0x39e7, 0x4208, 0x4208, 0x4208, 0x4208, 0x3186, 0x548d, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x2185, 0x4a69, 0x5269, 0x5269, 0x528a, 0x528a, 0x528a, 0x39e7, 0x544d, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8756, 0x29a5, 0x52aa, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 
-	0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x5269, 0x5269, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x31a6, 0x4c0c, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x4beb, 0x3185, 0x39e7, 0x39e7, 0x39c7, 0x39c7, 0x39c7, 0x1964, 0x8f76, 0x97f8, 
-	0x97f8, 0x86f5, 0x1924, 0x2965, 0x2965, 0x2965, 0x2945, 0x2945, 0x2924, 0x2124, 0x1923, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x6570, 0x0881, 0x1082, 0x1082, 0x1061, 0x0861, 0x0861, 0x0841, 0x0841, 0x0020, 0x0020, 0x10e2, 0x8f76, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x6db1, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x10a2, 0x3186, 0x4a69, 0x6b4d, 0x8430, 0xa534, 0xc638, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf79e, 0xb5b6, 0x9cd3, 0x7bef, 0x630c, 0x4228, 0x2945, 0x0861, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x544d, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x43ab, 0x0861, 0x1082, 0x1082, 0x10a2, 0x10a2, 0x10e3, 0x7653, 0x97f8, 0x97f8, 
-	0x97d8, 0x1123, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2104, 0x544d, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x1964, 0x39c7, 0x39e7, 0x39e7, 0x41e7, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x3186, 0x5cee, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x2185, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x41e7, 0x544d, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8756, 0x29a5, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 
-	0x52aa, 0x528a, 0x528a, 0x528a, 0x31c6, 0x1903, 0x1903, 0x2965, 0x5269, 0x4a69, 0x4a69, 0x4a69, 0x1964, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8f56, 0x2185, 0x41e7, 0x39e7, 0x39e7, 0x39c7, 0x31a6, 0x3287, 0x97f8, 0x97f8, 
-	0x97f8, 0x43ab, 0x2124, 0x3186, 0x2965, 0x2965, 0x2945, 0x2945, 0x2945, 0x2124, 0x1923, 0x8f97, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x6db1, 0x10a2, 0x10a2, 0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0020, 0x10e2, 0x97d7, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x6530, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0861, 0x2945, 0x4228, 0x630c, 0x7bef, 0x9cd3, 0xb5b6, 0xf79e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdedb, 0xad75, 0x8c71, 0x738e, 0x52aa, 0x39c7, 0x18e3, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1123, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8756, 0x1923, 0x1082, 0x1082, 0x10a2, 0x10a2, 0x21a5, 0x97f8, 0x97f8, 0x97f8, 
-	0x6db1, 0x18e3, 0x2104, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2124, 0x3b09, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x2185, 0x39e7, 0x39e7, 0x41e7, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4228, 0x3186, 0x6570, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8736, 0x29a5, 0x528a, 0x528a, 0x528a, 0x52aa, 0x52aa, 0x52aa, 0x4208, 0x544d, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8756, 0x29a5, 0x5aaa, 0x5aaa, 0x5aaa, 0x5aaa, 0x5aaa, 0x5aaa, 0x52aa, 
-	0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x2185, 0x7612, 0x7653, 0x2165, 0x528a, 0x528a, 0x5269, 0x4a69, 0x2985, 0x6df2, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x32a8, 0x39e7, 0x41e7, 0x39e7, 0x39e7, 0x2985, 0x7632, 0x97f8, 0x97f8, 
-	0x97f8, 0x1944, 0x3186, 0x3186, 0x3186, 0x2965, 0x2965, 0x2945, 0x2945, 0x2945, 0x1924, 0x7e93, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x7632, 0x10c2, 0x10a2, 0x1082, 0x1082, 0x1082, 0x0861, 0x0861, 0x0841, 0x0841, 0x0020, 0x1123, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x43eb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x18e3, 0x39c7, 0x52aa, 0x738e, 0x8c71, 0xad75, 0xdedb, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0xa514, 0x8430, 0x6b4d, 0x4a69, 0x3186, 0x10a2, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x08a1, 0x7653, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x2a87, 0x1082, 0x10a2, 0x10a2, 0x10a2, 0x544d, 0x97f8, 0x97f8, 0x97f8, 
-	0x2a26, 0x18e3, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x21c5, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x21c5, 0x39e7, 0x41e7, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4a28, 0x4a49, 0x2985, 0x7e94, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x6db1, 0x31c6, 0x528a, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x5aaa, 0x4208, 0x544d, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8756, 0x29a5, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 
-	0x5acb, 0x5aaa, 0x5aaa, 0x52aa, 0x2185, 0x97f8, 0x97f8, 0x2185, 0x528a, 0x528a, 0x528a, 0x528a, 0x4228, 0x2a47, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x7673, 0x29a6, 0x4208, 0x41e7, 0x39e7, 0x2a06, 0x97f8, 0x97f8, 0x97f8, 
-	0x7632, 0x2144, 0x31a6, 0x3186, 0x3186, 0x3165, 0x2965, 0x2965, 0x2945, 0x2945, 0x18e3, 0x5cee, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x8756, 0x1103, 0x10a2, 0x10a2, 0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x1944, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x2206, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x10a2, 0x3186, 0x4a69, 0x6b4d, 0x8430, 0xa514, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf79e, 0xb5b6, 0x9cd3, 0x7bef, 0x630c, 0x4208, 0x2124, 0x0841, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2a67, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x7653, 0x10e3, 0x10a2, 0x10a2, 0x1964, 0x8f97, 0x97f8, 0x97f8, 0x8f96, 
-	0x1103, 0x2104, 0x2124, 0x2124, 0x2924, 0x2945, 0x2945, 0x2965, 0x2965, 0x3165, 0x1944, 0x8fb7, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x3b09, 0x31a6, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4a28, 0x4a49, 0x4a49, 0x2164, 0x8fb7, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x434a, 0x4228, 0x52aa, 0x52aa, 0x5aaa, 0x5aaa, 0x5acb, 0x5acb, 0x4208, 0x544d, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8756, 0x29a6, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 
-	0x5acb, 0x5acb, 0x5acb, 0x5aaa, 0x21c6, 0x97f8, 0x97f8, 0x2185, 0x52aa, 0x52aa, 0x528a, 0x528a, 0x528a, 0x2144, 0x8f76, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x3247, 0x4208, 0x4208, 0x39c7, 0x4c2d, 0x97f8, 0x97f8, 0x97f8, 
-	0x32a8, 0x2965, 0x31a6, 0x31a6, 0x3186, 0x3186, 0x3165, 0x2965, 0x2965, 0x2945, 0x2124, 0x2a67, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x1923, 0x10a2, 0x10a2, 0x10a2, 0x1082, 0x1082, 0x0861, 0x0861, 0x0841, 0x0841, 0x2a26, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x1103, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0841, 0x2124, 0x4208, 0x630c, 0x7bef, 0x9cd3, 0xb5b6, 0xf79e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdedb, 0xad75, 0x9492, 0x738e, 0x52aa, 0x39c7, 0x18e3, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10e2, 0x8f97, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x2a26, 0x10a2, 0x18c3, 0x32c8, 0x97f8, 0x97f8, 0x97f8, 0x54ae, 
-	0x18e3, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186, 0x2124, 0x6570, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x6570, 0x2965, 0x4208, 0x4208, 0x4228, 0x4228, 0x4a28, 0x4a49, 0x4a49, 0x4a49, 0x21c5, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x1964, 0x52aa, 0x5aaa, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x4228, 0x544d, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8756, 0x29a6, 0x5aeb, 0x5aeb, 0x5aeb, 0x5aeb, 0x5aeb, 0x5aeb, 0x5aeb, 
-	0x5acb, 0x5acb, 0x5acb, 0x4228, 0x4bcb, 0x97f8, 0x97f8, 0x2185, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x528a, 0x39c7, 0x544d, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x5cce, 0x39c7, 0x4208, 0x31e6, 0x8f96, 0x97f8, 0x97f8, 0x8fb7, 
-	0x1924, 0x39c7, 0x31a6, 0x31a6, 0x3186, 0x3186, 0x3186, 0x2965, 0x2965, 0x2965, 0x2945, 0x1923, 0x97d7, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x2206, 0x10a2, 0x10a2, 0x10a2, 0x1082, 0x1082, 0x1061, 0x0861, 0x0861, 0x0841, 0x548d, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x7632, 0x0881, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x18e3, 0x39c7, 0x52aa, 0x738e, 0x9492, 0xad75, 0xdefb, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc638, 0xa534, 0x8430, 0x6b4d, 0x4a69, 0x3186, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x546d, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x54ae, 0x10a2, 0x18e3, 0x7633, 0x97f8, 0x97f8, 0x97f8, 0x1984, 
-	0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x3165, 0x21c5, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x8fb7, 0x1944, 0x4208, 0x4228, 0x4228, 0x4a28, 0x4a49, 0x4a49, 0x4a49, 0x39c7, 0x4c0c, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x6dd1, 0x29a6, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5aeb, 0x5aeb, 0x4228, 0x544d, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8756, 0x29a6, 0x62eb, 0x62eb, 0x62eb, 0x62eb, 0x62eb, 0x5aeb, 0x5aeb, 
-	0x5aeb, 0x5aeb, 0x5aeb, 0x2165, 0x7ef5, 0x97f8, 0x97f8, 0x2185, 0x5acb, 0x5aaa, 0x52aa, 0x52aa, 0x52aa, 0x528a, 0x1964, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97d7, 0x3227, 0x4208, 0x432a, 0x97f8, 0x97f8, 0x97f8, 0x6550, 
-	0x2145, 0x39c7, 0x39c7, 0x31a6, 0x31a6, 0x3186, 0x3186, 0x3186, 0x2965, 0x2965, 0x2945, 0x1903, 0x5d0f, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x5cef, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x1082, 0x1082, 0x0861, 0x0861, 0x10e2, 0x8736, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x2a26, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x3186, 0x4a69, 0x6b4d, 0x8430, 0xa534, 0xc638, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0xbdd7, 0x9cd3, 0x7bef, 0x630c, 0x4228, 0x2124, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1943, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97d7, 0x21c5, 0x2a26, 0x97f8, 0x97f8, 0x97f8, 0x86f5, 0x1903, 
-	0x2124, 0x2124, 0x2924, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x31a6, 0x1924, 0x7632, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x32c8, 0x39c7, 0x4228, 0x4a49, 0x4a49, 0x4a49, 0x4a69, 0x4a69, 0x1944, 0x8735, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x21a5, 0x528a, 0x5acb, 0x5acb, 0x5acb, 0x5aeb, 0x5aeb, 0x5aeb, 0x5aeb, 0x4a49, 0x544d, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8756, 0x29c6, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 
-	0x62eb, 0x62eb, 0x4a49, 0x3287, 0x97f8, 0x97f8, 0x97f8, 0x2185, 0x5acb, 0x5acb, 0x5acb, 0x5aaa, 0x52aa, 0x52aa, 0x29a6, 0x7612, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x4bab, 0x39e7, 0x7632, 0x97f8, 0x97f8, 0x97f8, 0x29e6, 
-	0x39c7, 0x39c7, 0x39c7, 0x39a6, 0x31a6, 0x31a6, 0x3186, 0x3186, 0x3186, 0x2965, 0x2965, 0x2945, 0x1923, 0x97d8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8fb7, 0x10e3, 0x18c3, 0x10a2, 0x10a2, 0x1082, 0x1082, 0x1061, 0x0861, 0x21e6, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x7ed4, 0x08c2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x2124, 0x4228, 0x630c, 0x7bef, 0x9cd3, 0xbdd7, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xe73c, 0xad75, 0x9492, 0x73ae, 0x5acb, 0x39e7, 0x18e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x08a2, 0x7673, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x438b, 0x544d, 0x97f8, 0x97f8, 0x97f8, 0x438b, 0x18c3, 
-	0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x3165, 0x3186, 0x3186, 0x31a6, 0x31a6, 0x3186, 0x1984, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x7ed4, 0x1923, 0x4a28, 0x4a49, 0x4a49, 0x4a69, 0x4a69, 0x39c7, 0x3b09, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x652f, 0x29a6, 0x5acb, 0x5aeb, 0x5aeb, 0x5aeb, 0x5aeb, 0x62eb, 0x62eb, 0x630c, 0x4a49, 0x544d, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8756, 0x29c6, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 
-	0x630c, 0x528a, 0x1923, 0x8756, 0x97f8, 0x97f8, 0x97f8, 0x2185, 0x5aeb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5aaa, 0x4a49, 0x3288, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8735, 0x29e6, 0x97f8, 0x97f8, 0x97f8, 0x8756, 0x1944, 
-	0x39e7, 0x39e7, 0x39c7, 0x39c7, 0x39a6, 0x31a6, 0x31a6, 0x3186, 0x3186, 0x3165, 0x2965, 0x2965, 0x1903, 0x4c2c, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x43cb, 0x10a2, 0x18a2, 0x10a2, 0x10a2, 0x1082, 0x1082, 0x10c2, 0x7653, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x21c5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18e3, 0x39e7, 0x5acb, 0x73ae, 0x9492, 0xad75, 0xe73c, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xd69a, 0xa534, 0x8c51, 0x6b6d, 0x528a, 0x3186, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x3287, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8735, 0x8f97, 0x97f8, 0x97f8, 0x97f8, 0x1923, 0x2124, 
-	0x2124, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x31a6, 0x31a6, 0x39c7, 0x2144, 0x43ab, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x4bec, 0x2144, 0x4a49, 0x4a69, 0x4a69, 0x41e7, 0x1944, 0x8f97, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x8715, 0x1903, 0x5aaa, 0x5aeb, 0x5aeb, 0x5aeb, 0x62eb, 0x630c, 0x630c, 0x630c, 0x630c, 0x4a49, 0x544d, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8756, 0x29c6, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x630c, 
-	0x39e7, 0x10e3, 0x7e73, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x2185, 0x5aeb, 0x5aeb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5aaa, 0x2164, 
-	0x8f76, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x7ef5, 0x97f8, 0x97f8, 0x97f8, 0x544d, 0x2965, 
-	0x39e7, 0x39e7, 0x39c7, 0x39c7, 0x39c7, 0x31a6, 0x31a6, 0x3186, 0x3186, 0x3186, 0x2965, 0x2965, 0x2945, 0x10e3, 0x7eb4, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97d7, 0x1964, 0x10a2, 0x10a2, 0x10a2, 0x1082, 0x0881, 0x3b29, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x4c2c, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x3186, 0x528a, 0x6b6d, 0x8c51, 0xa534, 0xd69a, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xbdf7, 0x9cf3, 0x8410, 0x632c, 0x4a49, 0x2945, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x10e2, 
-	0x8f97, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x7612, 0x1903, 0x2124, 
-	0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x3165, 0x3186, 0x3186, 0x31a6, 0x31a6, 0x39c7, 0x39c7, 0x39c7, 0x1903, 0x652f, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x436a, 0x10e3, 0x2945, 0x2144, 0x1923, 0x86f5, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x8f56, 0x1944, 0x4a49, 0x5aeb, 0x5aeb, 0x62eb, 0x630c, 0x3a07, 0x29a5, 0x29a5, 0x29a5, 0x29a6, 0x2144, 0x544d, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8756, 0x10c2, 0x29a6, 0x29a6, 0x2965, 0x2165, 0x2124, 0x1924, 0x08a2, 
-	0x3b09, 0x8756, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x2185, 0x62eb, 0x5aeb, 0x5aeb, 0x5aeb, 0x5acb, 0x5acb, 0x5acb, 0x39e7, 
-	0x546d, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x1984, 0x41e7, 
-	0x4208, 0x39e7, 0x39e7, 0x39c7, 0x39c7, 0x39c7, 0x31a6, 0x31a6, 0x3186, 0x3186, 0x3165, 0x2965, 0x2965, 0x2124, 0x1103, 0x8756, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8736, 0x1944, 0x10a2, 0x0861, 0x08a2, 0x32c8, 0x97d8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x6591, 0x08a1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x2945, 0x4a49, 0x632c, 0x8410, 0x9cf3, 0xbdf7, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xef7d, 0xb5b6, 0x9cd3, 0x7bcf, 0x5aeb, 0x4208, 0x2104, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0841, 0x0861, 
-	0x54ae, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x3287, 0x20e3, 0x2124, 
-	0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x31a6, 0x31a6, 0x39a6, 0x39c7, 0x39c7, 0x39e7, 0x39c7, 0x10e3, 0x5d0f, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x7e94, 0x5cae, 0x6570, 0x97d7, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x8736, 0x1964, 0x4228, 0x5aeb, 0x62eb, 0x630c, 0x630c, 0x630c, 0x2185, 0x6dd1, 0x6dd1, 0x6dd1, 0x6dd1, 0x6dd1, 0x8715, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97d7, 0x6dd1, 0x6dd1, 0x6dd1, 0x6dd1, 0x7612, 0x7653, 0x7ed4, 0x8fb7, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x2185, 0x630c, 0x630c, 0x62eb, 0x5aeb, 0x5aeb, 0x5acb, 0x5acb, 0x5aaa, 
-	0x2184, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x7e94, 0x2165, 0x4208, 
-	0x4208, 0x41e7, 0x39e7, 0x39e7, 0x39c7, 0x39c7, 0x39a6, 0x31a6, 0x31a6, 0x3186, 0x3186, 0x2965, 0x2965, 0x2945, 0x2104, 0x1123, 
-	0x8735, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97d8, 0x6591, 0x54ae, 0x7673, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x6db1, 0x08a1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x2104, 0x4208, 0x5aeb, 0x7bcf, 0x9cd3, 0xb5b6, 0xf79e, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xe71c, 0xad75, 0x9492, 0x738e, 0x52aa, 0x39c7, 0x18e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0841, 0x0841, 
-	0x1944, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8fb7, 0x1103, 0x2124, 0x2924, 
-	0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x31a6, 0x31a6, 0x39c7, 0x39c7, 0x39c7, 0x39e7, 0x41e7, 0x39e7, 0x18e3, 
-	0x438b, 0x97d7, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x7612, 0x10e3, 0x4228, 0x5aeb, 0x62eb, 0x630c, 0x630c, 0x630c, 0x630c, 0x2185, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x2185, 0x630c, 0x630c, 0x630c, 0x62eb, 0x5aeb, 0x5aeb, 0x5aeb, 0x5acb, 
-	0x29a6, 0x7633, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x3b4a, 0x31a6, 0x4228, 
-	0x4208, 0x4208, 0x41e7, 0x39e7, 0x39c7, 0x39c7, 0x39c7, 0x31a6, 0x31a6, 0x3186, 0x3186, 0x3186, 0x2965, 0x2965, 0x2945, 0x2104, 
-	0x10c2, 0x6df2, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x4c0c, 0x0881, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18e3, 0x39c7, 0x52aa, 0x738e, 0x9492, 0xad75, 0xe71c, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xd69a, 0xa534, 0x8c51, 0x6b6d, 0x4a69, 0x3186, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0820, 0x0841, 0x0841, 
-	0x10c2, 0x7e93, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x5d2f, 0x18e3, 0x2124, 0x2945, 
-	0x2945, 0x2945, 0x2965, 0x3165, 0x3186, 0x3186, 0x31a6, 0x31a6, 0x39a6, 0x39c7, 0x39c7, 0x39e7, 0x39e7, 0x4208, 0x4208, 0x4208, 
-	0x2144, 0x1923, 0x6dd1, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8756, 0x3ae9, 
-	0x18e3, 0x528a, 0x62eb, 0x630c, 0x630c, 0x630c, 0x630c, 0x632c, 0x632c, 0x2185, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x21a5, 0x632c, 0x630c, 0x630c, 0x630c, 0x630c, 0x62eb, 0x5aeb, 0x5aeb, 
-	0x4a69, 0x32a8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97d8, 0x1944, 0x4228, 0x4228, 
-	0x4208, 0x4208, 0x4208, 0x39e7, 0x39e7, 0x39c7, 0x39c7, 0x39a6, 0x31a6, 0x31a6, 0x3186, 0x3186, 0x3165, 0x2965, 0x2945, 0x2945, 
-	0x2104, 0x10a2, 0x32a8, 0x86f5, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x6df2, 
-	0x1943, 0x0881, 0x0820, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x3186, 0x4a69, 0x6b6d, 0x8c51, 0xa534, 0xd69a, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xbdf7, 0xa514, 0x8410, 0x632c, 0x4a49, 0x2945, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0841, 0x0841, 0x0861, 
-	0x0841, 0x0020, 0x0040, 0x0040, 0x0041, 0x0881, 0x08a1, 0x08a1, 0x0881, 0x0881, 0x0881, 0x0040, 0x0041, 0x2104, 0x2924, 0x2945, 
-	0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x31a6, 0x31a6, 0x39c7, 0x39c7, 0x39e7, 0x39e7, 0x41e7, 0x4208, 0x4208, 0x4228, 
-	0x4228, 0x39c7, 0x1903, 0x1923, 0x546d, 0x7eb4, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8f76, 0x6550, 0x2a67, 0x10a2, 0x39c7, 
-	0x5aeb, 0x62eb, 0x630c, 0x630c, 0x630c, 0x632c, 0x632c, 0x632c, 0x6b2c, 0x2145, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 
-	0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 
-	0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x2144, 0x632c, 0x632c, 0x632c, 0x630c, 0x630c, 0x630c, 0x62eb, 0x5aeb, 
-	0x5aeb, 0x1903, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0041, 0x2985, 0x4a28, 0x4228, 
-	0x4228, 0x4208, 0x4208, 0x41e7, 0x39e7, 0x39e7, 0x39c7, 0x39c7, 0x31a6, 0x31a6, 0x3186, 0x3186, 0x3186, 0x2965, 0x2965, 0x2945, 
-	0x2945, 0x2924, 0x18c3, 0x08a2, 0x2a26, 0x6550, 0x8756, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x7ed4, 0x546d, 0x1123, 0x08a2, 
-	0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x2945, 0x4a49, 0x632c, 0x8410, 0xa514, 0xbdf7, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xf7be, 0xb5b6, 0x9cd3, 0x7bef, 0x5aeb, 0x4208, 0x2124, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0841, 0x0841, 0x0861, 
-	0x0861, 0x1082, 0x1082, 0x10a2, 0x10a2, 0x18a2, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x2104, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 
-	0x2945, 0x2965, 0x3165, 0x3186, 0x3186, 0x31a6, 0x31a6, 0x39c7, 0x39c7, 0x39c7, 0x39e7, 0x39e7, 0x4208, 0x4208, 0x4228, 0x4228, 
-	0x4a28, 0x4a49, 0x4a49, 0x4208, 0x2965, 0x10e3, 0x0881, 0x10e2, 0x1923, 0x1103, 0x08a2, 0x08a2, 0x2165, 0x4208, 0x5acb, 0x5aeb, 
-	0x62eb, 0x630c, 0x630c, 0x630c, 0x632c, 0x632c, 0x6b2c, 0x6b2c, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b6d, 0x6b6d, 0x6b6d, 0x736d, 
-	0x736d, 0x736d, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x736d, 0x736d, 
-	0x736d, 0x6b6d, 0x6b6d, 0x6b6d, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b2c, 0x6b2c, 0x632c, 0x632c, 0x630c, 0x630c, 0x630c, 0x62eb, 
-	0x5aeb, 0x5aeb, 0x5acb, 0x5acb, 0x5acb, 0x5aaa, 0x52aa, 0x52aa, 0x528a, 0x528a, 0x5269, 0x4a69, 0x4a69, 0x4a49, 0x4a49, 0x4a28, 
-	0x4228, 0x4228, 0x4208, 0x4208, 0x39e7, 0x39e7, 0x39c7, 0x39c7, 0x39c7, 0x31a6, 0x31a6, 0x3186, 0x3186, 0x3165, 0x2965, 0x2945, 
-	0x2945, 0x2945, 0x2124, 0x2124, 0x18c3, 0x10c2, 0x0881, 0x0861, 0x08a2, 0x10e2, 0x0881, 0x0061, 0x08a2, 0x0881, 0x0861, 0x0861, 
-	0x0861, 0x0841, 0x0841, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x2124, 0x4208, 0x5aeb, 0x7bef, 0x9cd3, 0xb5b6, 0xf7be, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xe73c, 0xb596, 0x9492, 0x73ae, 0x5acb, 0x39c7, 0x18e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0861, 
-	0x0861, 0x1082, 0x1082, 0x10a2, 0x10a2, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 
-	0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x31a6, 0x39a6, 0x39c7, 0x39c7, 0x39e7, 0x39e7, 0x41e7, 0x4208, 0x4208, 0x4228, 0x4228, 
-	0x4a49, 0x4a49, 0x4a49, 0x4a69, 0x5269, 0x528a, 0x528a, 0x4a69, 0x4a49, 0x528a, 0x52aa, 0x5acb, 0x5acb, 0x5aeb, 0x5aeb, 0x62eb, 
-	0x630c, 0x630c, 0x630c, 0x632c, 0x632c, 0x6b2c, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b6d, 0x6b6d, 0x6b6d, 0x736d, 0x736d, 0x738e, 
-	0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 
-	0x738e, 0x736d, 0x736d, 0x6b6d, 0x6b6d, 0x6b6d, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b2c, 0x632c, 0x632c, 0x630c, 0x630c, 0x630c, 
-	0x62eb, 0x5aeb, 0x5aeb, 0x5acb, 0x5acb, 0x5acb, 0x52aa, 0x52aa, 0x528a, 0x528a, 0x528a, 0x5269, 0x4a69, 0x4a49, 0x4a49, 0x4a49, 
-	0x4228, 0x4228, 0x4208, 0x4208, 0x41e7, 0x39e7, 0x39e7, 0x39c7, 0x39c7, 0x39a6, 0x31a6, 0x3186, 0x3186, 0x3186, 0x2965, 0x2965, 
-	0x2945, 0x2945, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x18e3, 0x18c3, 0x18c3, 0x18a2, 0x10a2, 0x10a2, 0x1082, 0x1082, 0x0861, 
-	0x0861, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18e3, 0x39c7, 0x5acb, 0x73ae, 0x9492, 0xb596, 0xef5d, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xdedb, 0xad55, 0x8c71, 0x6b6d, 0x528a, 0x31a6, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0020, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0041, 0x0041, 0x0841, 0x0861, 0x0861, 0x0861, 
-	0x0861, 0x0881, 0x0861, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x18c3, 0x2104, 0x2124, 0x2945, 0x2945, 0x2945, 
-	0x2965, 0x2965, 0x1903, 0x18e3, 0x18e3, 0x18e3, 0x1903, 0x1903, 0x1904, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 
-	0x2144, 0x2144, 0x2144, 0x2145, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2985, 0x2985, 0x2985, 0x2986, 0x2986, 
-	0x3186, 0x528a, 0x632c, 0x632c, 0x6b2c, 0x6b4d, 0x4228, 0x31a6, 0x31a6, 0x31c6, 0x31c6, 0x31c6, 0x31c6, 0x31c6, 0x31c6, 0x31c7, 
-	0x31c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39e7, 0x738e, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x4228, 0x39c7, 0x31c7, 
-	0x31c7, 0x31c6, 0x31c6, 0x31c6, 0x31c6, 0x31c6, 0x31c6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x630c, 0x39e7, 0x3186, 0x3186, 
-	0x2986, 0x2986, 0x2985, 0x2985, 0x2985, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2945, 0x2945, 0x2145, 0x2144, 0x2144, 0x2144, 
-	0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x1904, 0x1903, 0x1903, 0x18e3, 0x18e3, 0x2104, 0x3186, 0x2965, 0x2965, 
-	0x2945, 0x2945, 0x2945, 0x2124, 0x2124, 0x2104, 0x2104, 0x18e3, 0x1082, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 
-	0x0020, 0x0020, 0x0020, 0x0841, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x31a6, 0x528a, 0x6b6d, 0x8c71, 0xad55, 0xdedb, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xce59, 0xa534, 0x8430, 0x6b4d, 0x4a69, 0x2965, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x1103, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 
-	0x5cce, 0x5cce, 0x5cce, 0x548d, 0x4c2c, 0x4c2c, 0x4c2c, 0x4c2c, 0x4c2c, 0x438a, 0x21e6, 0x0881, 0x10c2, 0x2104, 0x2945, 0x2965, 
-	0x2965, 0x3165, 0x1944, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 
-	0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 
-	0x3ae9, 0x4228, 0x632c, 0x6b2c, 0x6b4d, 0x6b4d, 0x2185, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 
-	0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x436a, 0x31c6, 0x7bae, 0x7bae, 0x7bae, 0x7bae, 0x7bae, 0x7bae, 0x21a5, 0x5cce, 0x5cce, 
-	0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x21c5, 0x5acb, 0x2185, 0x5cce, 0x5cce, 
-	0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 
-	0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x1944, 0x3186, 0x3165, 0x2965, 
-	0x2965, 0x2945, 0x2945, 0x2124, 0x2124, 0x2104, 0x2104, 0x10c3, 0x32a8, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 0x5cce, 
-	0x5cce, 0x5cce, 0x1964, 0x0841, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x2965, 0x4a69, 0x6b4d, 0x8430, 0xa534, 0xce59, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xbdf7, 0x9cf3, 0x8410, 0x630c, 0x4228, 0x2945, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x1964, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97d7, 0x6570, 0x1123, 0x1903, 0x2965, 
-	0x2965, 0x3186, 0x1964, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x5cef, 0x4228, 0x6b2c, 0x6b4d, 0x6b4d, 0x6b4d, 0x29a5, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x3ae9, 0x4a49, 0x7bcf, 0x7bcf, 0x7bcf, 0x7bcf, 0x7bcf, 0x29c6, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x3b09, 0x5aeb, 0x29c6, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x1944, 0x3186, 0x3186, 0x2965, 
-	0x2965, 0x2945, 0x2945, 0x2924, 0x2124, 0x2104, 0x2104, 0x1103, 0x8f56, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x6dd1, 0x08a2, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x2945, 0x4228, 0x630c, 0x8410, 0x9cf3, 0xbdf7, 0xffff, 0xffff, 
-	0xffff, 0xf7be, 0xb5b6, 0x9cd3, 0x7bef, 0x5aeb, 0x4208, 0x2104, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x1964, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97d7, 0x32a8, 0x1903, 
-	0x3165, 0x3186, 0x1964, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x5cef, 0x4a28, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b6d, 0x29a5, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97d7, 0x21e6, 0x5acb, 0x7bcf, 0x7bcf, 0x7bcf, 0x7bcf, 0x29c6, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x3b09, 0x62eb, 0x29c6, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x1944, 0x3186, 0x3186, 0x3165, 
-	0x2965, 0x2945, 0x2945, 0x2945, 0x2124, 0x2124, 0x18e3, 0x2a67, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x1123, 0x0841, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x2104, 0x4208, 0x5aeb, 0x7bef, 0x9cd3, 0xb5b6, 0xf7be, 0xffff, 
-	0xffff, 0xef7d, 0xb596, 0x94b2, 0x73ae, 0x5acb, 0x39c7, 0x18e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0041, 0x0040, 0x0040, 0x0040, 0x0040, 0x0020, 0x6dd1, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8fb7, 
-	0x1123, 0x1103, 0x1944, 0x21c5, 0x43cb, 0x8715, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x21c5, 
-	0x2945, 0x3186, 0x10c2, 0x0041, 0x0041, 0x0041, 0x0041, 0x0040, 0x4c2c, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x8715, 0x0020, 0x0041, 0x0841, 0x0841, 0x0841, 0x0841, 0x08a2, 0x10a2, 0x1103, 0x5cef, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x5cef, 0x4a49, 0x6b4d, 0x6b4d, 0x6b6d, 0x736d, 0x2985, 0x0861, 0x0861, 0x0861, 0x0861, 0x21a5, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8f76, 0x1944, 0x6b4d, 0x7bef, 0x7bef, 0x7bef, 0x2145, 0x0861, 0x0861, 
-	0x0861, 0x10c2, 0x2a67, 0x97f8, 0x97f8, 0x97f8, 0x6550, 0x0040, 0x0861, 0x0861, 0x0861, 0x0841, 0x630c, 0x29c6, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x7ef5, 0x3288, 0x0881, 0x0881, 0x0841, 0x2a06, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x1944, 0x0041, 0x0861, 0x10c2, 0x3b29, 0x8735, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x1944, 0x3186, 0x3186, 0x3186, 
-	0x2965, 0x2965, 0x2945, 0x2945, 0x2124, 0x2124, 0x1903, 0x7653, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x4c4d, 0x0841, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18e3, 0x39c7, 0x5acb, 0x73ae, 0x94b2, 0xb596, 0xef7d, 0xffff, 
-	0xffff, 0xe71c, 0xad75, 0x8c71, 0x738e, 0x52aa, 0x31a6, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0041, 0x6dd1, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8f97, 
-	0x10e3, 0x1082, 0x1082, 0x1082, 0x1082, 0x08a2, 0x6db1, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x86f5, 
-	0x1923, 0x3186, 0x31a6, 0x31a6, 0x39c7, 0x39c7, 0x39c7, 0x3186, 0x4bec, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x8715, 0x29a5, 0x528a, 0x528a, 0x52aa, 0x52aa, 0x5acb, 0x5acb, 0x5acb, 0x528a, 0x2165, 0x2a26, 0x97d7, 0x97f8, 0x97f8, 0x97f8, 
-	0x5cef, 0x4a49, 0x6b4d, 0x6b6d, 0x736d, 0x738e, 0x738e, 0x738e, 0x73ae, 0x73ae, 0x7bae, 0x2a06, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x7eb4, 0x1924, 0x73ae, 0x83ef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 
-	0x7bcf, 0x7bcf, 0x2a06, 0x97f8, 0x97f8, 0x97f8, 0x6550, 0x4a69, 0x738e, 0x738e, 0x738e, 0x736d, 0x6b6d, 0x29c6, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x6550, 0x10e3, 0x4208, 0x5aeb, 0x5aeb, 0x5acb, 0x2a06, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x21c5, 0x4a49, 0x4228, 0x4208, 0x2945, 0x10c2, 0x7633, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x1944, 0x31a6, 0x3186, 0x3186, 
-	0x2965, 0x2965, 0x2945, 0x2945, 0x2924, 0x2104, 0x1964, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x8f96, 0x10e2, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c3, 0x31a6, 0x52aa, 0x738e, 0x8c71, 0xad75, 0xe71c, 0xffff, 
-	0xffff, 0xd6ba, 0xad55, 0x8c51, 0x6b6d, 0x4a69, 0x3186, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0041, 0x6dd1, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8f97, 
-	0x1103, 0x10a2, 0x10a2, 0x18c3, 0x18c3, 0x18c3, 0x10e2, 0x8756, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x21c5, 0x3186, 0x31a6, 0x31a6, 0x39c7, 0x39c7, 0x39e7, 0x3186, 0x4bec, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x8715, 0x29a5, 0x528a, 0x52aa, 0x52aa, 0x5aaa, 0x5acb, 0x5acb, 0x5aeb, 0x5aeb, 0x630c, 0x39e7, 0x436a, 0x97f8, 0x97f8, 0x97f8, 
-	0x5cef, 0x4a49, 0x6b6d, 0x736d, 0x738e, 0x738e, 0x738e, 0x73ae, 0x73ae, 0x7bae, 0x7bcf, 0x2a06, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x6dd1, 0x2165, 0x7bef, 0x83ef, 0x83ef, 0x83ef, 0x7bef, 
-	0x7bef, 0x7bef, 0x2a06, 0x97f8, 0x97f8, 0x97f8, 0x6550, 0x4a69, 0x73ae, 0x738e, 0x738e, 0x738e, 0x736d, 0x29c6, 0x97f8, 0x97f8, 
-	0x97f8, 0x7632, 0x1924, 0x5aeb, 0x630c, 0x630c, 0x5aeb, 0x5aeb, 0x2a06, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x21c5, 0x4a49, 0x4a28, 0x4228, 0x4208, 0x39c7, 0x10e3, 0x8736, 0x97f8, 0x97f8, 0x97f8, 0x1944, 0x31a6, 0x3186, 0x3186, 
-	0x3165, 0x2965, 0x2945, 0x2945, 0x2945, 0x18e3, 0x5cef, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x32a8, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x3186, 0x4a69, 0x6b6d, 0x8c51, 0xad55, 0xdedb, 0xffff, 
-	0xffff, 0xce59, 0xa534, 0x8430, 0x6b4d, 0x4a49, 0x2965, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0041, 0x6dd1, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8f97, 
-	0x1103, 0x10a2, 0x10a2, 0x18c3, 0x18c3, 0x18e3, 0x18c3, 0x436a, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x436a, 0x2945, 0x31a6, 0x39a6, 0x39c7, 0x39c7, 0x39e7, 0x3186, 0x4bec, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x8715, 0x29a5, 0x528a, 0x52aa, 0x52aa, 0x5acb, 0x5acb, 0x5aeb, 0x5aeb, 0x62eb, 0x630c, 0x630c, 0x2164, 0x7ed4, 0x97f8, 0x97f8, 
-	0x5cef, 0x4a49, 0x6b6d, 0x736d, 0x738e, 0x738e, 0x73ae, 0x73ae, 0x7bae, 0x7bcf, 0x7bcf, 0x2a06, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x548e, 0x31e7, 0x8410, 0x8410, 0x8410, 0x83ef, 
-	0x83ef, 0x7bef, 0x2a06, 0x97f8, 0x97f8, 0x97f8, 0x6550, 0x5269, 0x73ae, 0x73ae, 0x738e, 0x738e, 0x736d, 0x29c6, 0x97f8, 0x97f8, 
-	0x97f8, 0x21c5, 0x5aeb, 0x632c, 0x630c, 0x630c, 0x62eb, 0x5aeb, 0x2a06, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x21c5, 0x4a49, 0x4a49, 0x4228, 0x4228, 0x4208, 0x3186, 0x32c8, 0x97f8, 0x97f8, 0x97f8, 0x1944, 0x31a6, 0x3186, 0x3186, 
-	0x3186, 0x2965, 0x2965, 0x2945, 0x2945, 0x1103, 0x8fb7, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x5d0f, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x7eb4, 0x08c2, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x2965, 0x4a49, 0x6b4d, 0x8430, 0xa534, 0xce79, 0xffff, 
-	0xffff, 0xc618, 0xa514, 0x8410, 0x632c, 0x4228, 0x2945, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0041, 0x6dd1, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8f97, 
-	0x1103, 0x10a2, 0x18c3, 0x18c3, 0x18c3, 0x18e3, 0x20e3, 0x21a5, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x544d, 0x2924, 0x31a6, 0x39c7, 0x39c7, 0x39c7, 0x39e7, 0x3186, 0x4bec, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x8715, 0x29a6, 0x528a, 0x52aa, 0x5aaa, 0x5acb, 0x5acb, 0x5aeb, 0x5aeb, 0x630c, 0x630c, 0x630c, 0x5269, 0x438b, 0x97f8, 0x97f8, 
-	0x5cef, 0x4a49, 0x736d, 0x738e, 0x738e, 0x73ae, 0x73ae, 0x7bae, 0x7bcf, 0x7bcf, 0x7bcf, 0x2a06, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x3b29, 0x4a89, 0x8410, 0x8410, 0x8410, 
-	0x8410, 0x83ef, 0x2a06, 0x97f8, 0x97f8, 0x97f8, 0x6550, 0x528a, 0x7bae, 0x73ae, 0x73ae, 0x738e, 0x738e, 0x29c6, 0x97f8, 0x97f8, 
-	0x7673, 0x31c6, 0x6b2c, 0x632c, 0x630c, 0x630c, 0x630c, 0x5aeb, 0x2a06, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x21c5, 0x4a49, 0x4a49, 0x4a28, 0x4228, 0x4208, 0x4208, 0x1924, 0x8f97, 0x97f8, 0x97f8, 0x1944, 0x31a6, 0x31a6, 0x3186, 
-	0x3186, 0x2965, 0x2965, 0x2945, 0x2104, 0x3b4a, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x6570, 0x08a2, 0x8756, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x1984, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x2945, 0x4228, 0x632c, 0x8410, 0xa514, 0xc618, 0xffff, 
-	0xffdf, 0xbdd7, 0x9cf3, 0x7bef, 0x630c, 0x4208, 0x2124, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0041, 0x6dd1, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8f97, 
-	0x1103, 0x10a2, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x2104, 0x1984, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x5cae, 0x2124, 0x31a6, 0x39c7, 0x39c7, 0x39e7, 0x39e7, 0x3186, 0x4bec, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x8715, 0x29a6, 0x52aa, 0x52aa, 0x5acb, 0x5acb, 0x5acb, 0x5aeb, 0x62eb, 0x630c, 0x630c, 0x632c, 0x632c, 0x21c5, 0x97f8, 0x97f8, 
-	0x5cef, 0x4a69, 0x738e, 0x738e, 0x738e, 0x73ae, 0x7bae, 0x7bcf, 0x7bcf, 0x7bcf, 0x7bef, 0x2a06, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97d8, 0x2a47, 0x632c, 0x8430, 0x8410, 
-	0x8410, 0x8410, 0x2a06, 0x97f8, 0x97f8, 0x97f8, 0x6550, 0x528a, 0x7bcf, 0x7bae, 0x73ae, 0x738e, 0x738e, 0x29e6, 0x97f8, 0x97f8, 
-	0x4bab, 0x528a, 0x6b4d, 0x632c, 0x632c, 0x630c, 0x630c, 0x62eb, 0x2a06, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x21c5, 0x4a49, 0x4a49, 0x4a28, 0x4228, 0x4228, 0x4208, 0x2965, 0x6db1, 0x97f8, 0x97f8, 0x1944, 0x31a6, 0x31a6, 0x3186, 
-	0x3186, 0x2965, 0x2965, 0x2945, 0x1903, 0x8715, 0x97f8, 0x97f8, 0x97f8, 0x8fb7, 0x2a06, 0x10a2, 0x43ab, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x6550, 0x0881, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x2124, 0x4208, 0x630c, 0x7bef, 0x9cf3, 0xbdd7, 0xffff, 
-	0xf7be, 0xb5b6, 0x9cd3, 0x7bcf, 0x5aeb, 0x39e7, 0x2104, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0041, 0x6dd1, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8f97, 
-	0x1103, 0x10a2, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x2104, 0x21a5, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x4c0c, 0x2945, 0x39a6, 0x39c7, 0x39c7, 0x39e7, 0x39e7, 0x3186, 0x4bec, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x8715, 0x29a6, 0x52aa, 0x5aaa, 0x5acb, 0x5acb, 0x5aeb, 0x5aeb, 0x630c, 0x630c, 0x630c, 0x632c, 0x6b2c, 0x29a5, 0x97f8, 0x97f8, 
-	0x5cef, 0x4a69, 0x738e, 0x738e, 0x73ae, 0x7bae, 0x7bcf, 0x7bcf, 0x7bcf, 0x7bef, 0x7bef, 0x2a06, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8fb7, 0x29e6, 0x738e, 0x8430, 
-	0x8430, 0x8410, 0x3227, 0x97f8, 0x97f8, 0x97f8, 0x6550, 0x528a, 0x7bcf, 0x7bcf, 0x7bae, 0x73ae, 0x738e, 0x29e6, 0x97f8, 0x97f8, 
-	0x2a27, 0x6b4d, 0x6b4d, 0x6b2c, 0x632c, 0x630c, 0x630c, 0x630c, 0x2a06, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x21c5, 0x4a69, 0x4a49, 0x4a49, 0x4228, 0x4228, 0x4208, 0x3186, 0x4bec, 0x97f8, 0x97f8, 0x1964, 0x39a6, 0x31a6, 0x3186, 
-	0x3186, 0x3165, 0x2965, 0x2124, 0x2206, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x6dd1, 0x10c2, 0x18e3, 0x1103, 0x97d7, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97d7, 0x1103, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x39e7, 0x5aeb, 0x7bcf, 0x9cd3, 0xb5b6, 0xf7be, 
-	0xef7d, 0xb5b6, 0x94b2, 0x7bcf, 0x5acb, 0x39e7, 0x18e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0061, 0x6dd1, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8f97, 
-	0x1103, 0x10a2, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x18c3, 0x32c8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x3b09, 0x2965, 0x39a6, 0x39c7, 0x39c7, 0x39e7, 0x41e7, 0x3186, 0x4bec, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x8715, 0x29a6, 0x52aa, 0x5aaa, 0x5acb, 0x5acb, 0x5aeb, 0x62eb, 0x630c, 0x630c, 0x632c, 0x632c, 0x6b4d, 0x29c6, 0x6591, 0x6dd1, 
-	0x43ab, 0x4a69, 0x738e, 0x73ae, 0x73ae, 0x7bae, 0x7bcf, 0x7bcf, 0x7bef, 0x7bef, 0x83ef, 0x2a06, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8f56, 0x29e6, 0x83ef, 
-	0x8430, 0x8430, 0x3ac9, 0x97f8, 0x97f8, 0x97f8, 0x6550, 0x528a, 0x7bcf, 0x7bcf, 0x7bae, 0x73ae, 0x73ae, 0x21a5, 0x6dd1, 0x6dd1, 
-	0x21a5, 0x6b4d, 0x6b4d, 0x6b4d, 0x632c, 0x632c, 0x630c, 0x630c, 0x2a06, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x21c5, 0x4a69, 0x4a49, 0x4a49, 0x4228, 0x4228, 0x4208, 0x39c7, 0x2a47, 0x6dd1, 0x6dd1, 0x1944, 0x39a6, 0x31a6, 0x31a6, 
-	0x3186, 0x3186, 0x2965, 0x1903, 0x6dd1, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x1944, 0x18e3, 0x18e3, 0x10c2, 0x5cef, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x43ab, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18e3, 0x39e7, 0x5acb, 0x7bcf, 0x94b2, 0xb5b6, 0xef7d, 
-	0xef5d, 0xb596, 0x9492, 0x73ae, 0x52aa, 0x39c7, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0061, 0x6dd1, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8f97, 
-	0x1103, 0x10a2, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x10c2, 0x7ed4, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x2185, 0x31a6, 0x39c7, 0x39c7, 0x39e7, 0x39e7, 0x41e7, 0x3186, 0x4bec, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x8715, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x18e3, 0x630c, 0x632c, 0x6b2c, 0x6b4d, 0x4228, 0x2165, 0x2165, 
-	0x2965, 0x5acb, 0x738e, 0x73ae, 0x7bae, 0x7bcf, 0x7bcf, 0x7bcf, 0x7bef, 0x83ef, 0x8410, 0x2a06, 0x97f8, 0x97f8, 0x97f8, 0x97d8, 
-	0x546d, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x86f5, 0x3227, 
-	0x8c30, 0x8430, 0x432a, 0x97f8, 0x97f8, 0x97f8, 0x6550, 0x528a, 0x7bcf, 0x7bcf, 0x7bcf, 0x7bae, 0x73ae, 0x31c7, 0x2965, 0x2965, 
-	0x31a6, 0x6b6d, 0x6b4d, 0x6b4d, 0x6b2c, 0x632c, 0x630c, 0x630c, 0x2a06, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x21c5, 0x4a69, 0x4a49, 0x4a49, 0x4a28, 0x4228, 0x4208, 0x39e7, 0x1903, 0x1903, 0x1903, 0x2124, 0x39c7, 0x31a6, 0x31a6, 
-	0x3186, 0x3186, 0x2965, 0x1944, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x6570, 0x18e3, 0x18e3, 0x18e3, 0x18c3, 0x1964, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8756, 0x10e2, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c3, 0x39c7, 0x52aa, 0x73ae, 0x9492, 0xb596, 0xef5d, 
-	0xe73c, 0xad75, 0x9492, 0x738e, 0x52aa, 0x31a6, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0061, 0x6dd1, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8f97, 
-	0x1103, 0x18a2, 0x18c3, 0x18c3, 0x10a2, 0x08a2, 0x652f, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8715, 
-	0x1924, 0x31a6, 0x39c7, 0x39c7, 0x39e7, 0x39e7, 0x4208, 0x31a6, 0x4bec, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x29c5, 0x632c, 0x632c, 0x6b2c, 0x6b4d, 0x6b4d, 0x6b6d, 0x736d, 
-	0x738e, 0x738e, 0x73ae, 0x73ae, 0x7bcf, 0x7bcf, 0x7bcf, 0x7bef, 0x83ef, 0x8410, 0x8410, 0x2a06, 0x97f8, 0x97f8, 0x97f8, 0x6dd1, 
-	0x18c3, 0x5cce, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x7653, 
-	0x4aa9, 0x8c30, 0x53cc, 0x97f8, 0x97f8, 0x97f8, 0x6550, 0x52aa, 0x7bef, 0x7bcf, 0x7bcf, 0x7bcf, 0x73ae, 0x73ae, 0x738e, 0x738e, 
-	0x736d, 0x6b6d, 0x6b4d, 0x6b4d, 0x6b2c, 0x632c, 0x632c, 0x630c, 0x2a06, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x21c5, 0x4a69, 0x4a49, 0x4a49, 0x4a28, 0x4228, 0x4228, 0x4208, 0x4208, 0x39e7, 0x39e7, 0x39c7, 0x39c7, 0x31a6, 0x31a6, 
-	0x3186, 0x3186, 0x2104, 0x546d, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x21c5, 0x18e3, 0x20e3, 0x18e3, 0x18c3, 0x10e3, 0x7653, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x2a46, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c3, 0x31a6, 0x52aa, 0x738e, 0x9492, 0xad75, 0xe73c, 
-	0xe71c, 0xad55, 0x8c71, 0x6b6d, 0x528a, 0x3186, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0061, 0x6dd1, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8f97, 
-	0x0040, 0x0861, 0x0861, 0x0861, 0x2a47, 0x7e94, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x3288, 
-	0x2945, 0x31a6, 0x39c7, 0x39c7, 0x39e7, 0x39e7, 0x4208, 0x31a6, 0x4bec, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x29c5, 0x632c, 0x6b2c, 0x6b4d, 0x6b4d, 0x6b6d, 0x6b6d, 0x736d, 
-	0x738e, 0x738e, 0x73ae, 0x7bae, 0x7bcf, 0x7bcf, 0x7bef, 0x7bef, 0x83ef, 0x8410, 0x8410, 0x2a06, 0x97f8, 0x97f8, 0x97f8, 0x6590, 
-	0x5acb, 0x31c6, 0x6dd1, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x6d91, 0x5b2c, 0x5c4d, 0x97f8, 0x97f8, 0x97f8, 0x6550, 0x52aa, 0x7bef, 0x7bef, 0x7bcf, 0x7bcf, 0x7bae, 0x73ae, 0x738e, 0x738e, 
-	0x736d, 0x6b6d, 0x6b6d, 0x6b4d, 0x6b4d, 0x6b2c, 0x632c, 0x630c, 0x2a06, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x21c5, 0x4a69, 0x4a69, 0x4a49, 0x4a49, 0x4228, 0x4228, 0x4208, 0x4208, 0x39e7, 0x39e7, 0x39c7, 0x39c7, 0x31a6, 0x31a6, 
-	0x3186, 0x3186, 0x1923, 0x8f97, 0x97f8, 0x97f8, 0x97f8, 0x7ed4, 0x1103, 0x2104, 0x20e3, 0x18e3, 0x18e3, 0x10a2, 0x2a26, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x7653, 0x08a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x3186, 0x528a, 0x6b6d, 0x8c71, 0xad55, 0xe71c, 
-	0xdedb, 0xad55, 0x8c51, 0x6b6d, 0x4a69, 0x3186, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x6dd1, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x8f76, 0x8f76, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x5cce, 0x1903, 
-	0x31a6, 0x39a6, 0x39c7, 0x39c7, 0x39e7, 0x41e7, 0x4208, 0x31a6, 0x4bec, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x8f96, 0x4c2c, 0x4c2c, 0x4c2c, 0x4c2c, 0x4c2c, 0x4c2c, 0x4c2c, 0x2164, 0x632c, 0x6b2c, 0x6b4d, 0x6b4d, 0x6b6d, 0x736d, 0x738e, 
-	0x738e, 0x73ae, 0x73ae, 0x7bae, 0x7bcf, 0x7bcf, 0x7bef, 0x83ef, 0x8410, 0x8410, 0x8430, 0x2a06, 0x97f8, 0x97f8, 0x97f8, 0x6570, 
-	0x5aeb, 0x8c51, 0x2985, 0x7eb4, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x64ef, 0x542d, 0x97f8, 0x97f8, 0x97f8, 0x6550, 0x52aa, 0x83ef, 0x7bef, 0x7bcf, 0x7bcf, 0x7bae, 0x73ae, 0x73ae, 0x738e, 
-	0x738e, 0x736d, 0x6b6d, 0x6b4d, 0x6b4d, 0x6b2c, 0x632c, 0x630c, 0x2a06, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x21c5, 0x4a69, 0x4a69, 0x4a49, 0x4a49, 0x4228, 0x4228, 0x4208, 0x4208, 0x41e7, 0x39e7, 0x39c7, 0x39c7, 0x39a6, 0x31a6, 
-	0x3186, 0x2924, 0x3ae9, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x3b09, 0x1082, 0x18c3, 0x10a2, 0x18e3, 0x18c3, 0x18c3, 0x1103, 0x8f76, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x1944, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x3186, 0x4a69, 0x6b6d, 0x8c51, 0xad55, 0xdedb, 
-	0xd6ba, 0xa534, 0x8c51, 0x6b4d, 0x4a69, 0x2965, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x6dd1, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8f97, 0x436a, 0x10c2, 0x3186, 
-	0x31a6, 0x39a6, 0x39c7, 0x39c7, 0x39e7, 0x41e7, 0x4208, 0x31a6, 0x4bec, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x8715, 0x18e3, 0x2965, 0x3186, 0x3186, 0x3186, 0x3186, 0x31a6, 0x41e7, 0x632c, 0x6b2c, 0x6b4d, 0x6b4d, 0x6b6d, 0x736d, 0x738e, 
-	0x738e, 0x73ae, 0x7bae, 0x7bcf, 0x7bcf, 0x7bef, 0x7bef, 0x83ef, 0x8410, 0x8410, 0x8430, 0x2a06, 0x97f8, 0x97f8, 0x97f8, 0x6570, 
-	0x5aeb, 0x9471, 0x8410, 0x2185, 0x8756, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x8756, 0x97f8, 0x97f8, 0x97f8, 0x6550, 0x52aa, 0x83ef, 0x7bef, 0x7bef, 0x7bcf, 0x7bcf, 0x7bae, 0x73ae, 0x738e, 
-	0x738e, 0x736d, 0x6b6d, 0x6b4d, 0x6b4d, 0x6b2c, 0x632c, 0x630c, 0x2a06, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x21c5, 0x4a69, 0x4a69, 0x4a49, 0x4a49, 0x4a28, 0x4228, 0x4208, 0x4208, 0x41e7, 0x39e7, 0x39c7, 0x39c7, 0x39a6, 0x31a6, 
-	0x3186, 0x1924, 0x7ed4, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x32e8, 0x2a26, 0x2a26, 0x2a26, 0x5cae, 0x6550, 0x6550, 0x54ae, 0x8756, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x5cce, 0x0041, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x2965, 0x4a69, 0x6b4d, 0x8c51, 0xa534, 0xd6ba, 
-	0xce79, 0xa534, 0x8430, 0x6b4d, 0x4a49, 0x2965, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x6dd1, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8fb7, 
-	0x7ef5, 0x7ef5, 0x7ef5, 0x7ef5, 0x7ef5, 0x7eb4, 0x7653, 0x7653, 0x7653, 0x6df2, 0x5cef, 0x3287, 0x0881, 0x1903, 0x3186, 0x31a6, 
-	0x31a6, 0x39a6, 0x39c7, 0x39c7, 0x39e7, 0x41e7, 0x4208, 0x31a6, 0x4bec, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x8715, 0x29a6, 0x5acb, 0x5acb, 0x5aeb, 0x5aeb, 0x630c, 0x630c, 0x632c, 0x632c, 0x6b4d, 0x6b4d, 0x6b6d, 0x39e7, 0x10a2, 0x10a2, 
-	0x10a2, 0x52aa, 0x7bae, 0x7bcf, 0x7bcf, 0x7bef, 0x83ef, 0x8410, 0x8410, 0x8430, 0x8430, 0x2a07, 0x97f8, 0x97f8, 0x97f8, 0x6570, 
-	0x5aeb, 0x9492, 0x9492, 0x7bae, 0x21c5, 0x8fb7, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x6550, 0x52aa, 0x8410, 0x83ef, 0x7bef, 0x7bcf, 0x7bcf, 0x7bae, 0x73ae, 0x738e, 
-	0x738e, 0x736d, 0x6b6d, 0x6b6d, 0x6b4d, 0x6b4d, 0x632c, 0x632c, 0x2a06, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x21c5, 0x5269, 0x4a69, 0x4a49, 0x4a49, 0x4a28, 0x4228, 0x4208, 0x4208, 0x41e7, 0x39e7, 0x39c7, 0x39c7, 0x39a6, 0x31a6, 
-	0x3186, 0x21c5, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8fb7, 0x10e2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x2965, 0x4a49, 0x6b4d, 0x8430, 0xa534, 0xce79, 
-	0xce59, 0xa534, 0x8430, 0x632c, 0x4a49, 0x2945, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x6dd1, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x7653, 
-	0x0861, 0x08a2, 0x08a2, 0x08a2, 0x10c2, 0x10c2, 0x10c2, 0x10c2, 0x10e3, 0x10e3, 0x10e3, 0x18e3, 0x2965, 0x3186, 0x3186, 0x31a6, 
-	0x31a6, 0x39c7, 0x39c7, 0x39e7, 0x39e7, 0x41e7, 0x4208, 0x31a6, 0x4bec, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x8715, 0x29a6, 0x5acb, 0x5acb, 0x5aeb, 0x62eb, 0x630c, 0x630c, 0x632c, 0x6b2c, 0x6b4d, 0x6b4d, 0x6b6d, 0x29c6, 0x8715, 0x8f76, 
-	0x54ae, 0x528a, 0x7bae, 0x7bcf, 0x7bcf, 0x7bef, 0x83ef, 0x8410, 0x8410, 0x8430, 0x8c30, 0x2a07, 0x97f8, 0x97f8, 0x97f8, 0x6570, 
-	0x5aeb, 0x9492, 0x9492, 0x9492, 0x632c, 0x3267, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x6550, 0x52aa, 0x8410, 0x83ef, 0x7bef, 0x7bcf, 0x7bcf, 0x7bae, 0x73ae, 0x73ae, 
-	0x738e, 0x738e, 0x6b6d, 0x6b6d, 0x6b4d, 0x6b4d, 0x6b2c, 0x632c, 0x2a06, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x21c5, 0x5269, 0x4a69, 0x4a49, 0x4a49, 0x4a28, 0x4228, 0x4208, 0x4208, 0x41e7, 0x39e7, 0x39e7, 0x39c7, 0x39c7, 0x31a6, 
-	0x2124, 0x6591, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x3b4a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x2945, 0x4a49, 0x632c, 0x8430, 0xa534, 0xce59, 
-	0xc638, 0xa514, 0x8430, 0x632c, 0x4a49, 0x2945, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x6dd1, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x7653, 
-	0x10e3, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x2104, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x31a6, 
-	0x31a6, 0x39c7, 0x39c7, 0x39e7, 0x39e7, 0x4208, 0x4208, 0x31a6, 0x4bec, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x8715, 0x29a6, 0x5acb, 0x5acb, 0x5aeb, 0x62eb, 0x630c, 0x630c, 0x632c, 0x6b2c, 0x6b4d, 0x6b4d, 0x6b6d, 0x29a5, 0x97f8, 0x97f8, 
-	0x5cef, 0x528a, 0x7bcf, 0x7bcf, 0x7bef, 0x7bef, 0x83ef, 0x8410, 0x8410, 0x8430, 0x8c30, 0x2a07, 0x97f8, 0x97f8, 0x97f8, 0x6570, 
-	0x630b, 0x9492, 0x9492, 0x9492, 0x9492, 0x52aa, 0x436a, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x6550, 0x5aaa, 0x8410, 0x83ef, 0x7bef, 0x7bef, 0x7bcf, 0x7bcf, 0x7bae, 0x73ae, 
-	0x738e, 0x738e, 0x736d, 0x6b6d, 0x6b4d, 0x6b4d, 0x6b2c, 0x632c, 0x2a06, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x21c5, 0x5269, 0x4a69, 0x4a49, 0x4a49, 0x4a28, 0x4228, 0x4228, 0x4208, 0x4208, 0x39e7, 0x39e7, 0x39c7, 0x39c7, 0x31a6, 
-	0x1923, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x6db1, 0x4c2c, 0x4c2c, 0x4c2c, 0x4c2c, 0x4c2c, 0x4c2c, 0x4c2c, 0x4c2c, 0x4c2c, 0x4c2c, 
-	0x548d, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8715, 0x08c2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x2945, 0x4a49, 0x632c, 0x8430, 0xa514, 0xce59, 
-	0xc638, 0xa514, 0x8410, 0x632c, 0x4228, 0x2945, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x6dd1, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x7633, 
-	0x10e3, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x2104, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x31a6, 
-	0x31a6, 0x39c7, 0x39c7, 0x39e7, 0x39e7, 0x4208, 0x4208, 0x31a6, 0x4bec, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x8715, 0x29a6, 0x5acb, 0x5acb, 0x5aeb, 0x62eb, 0x630c, 0x630c, 0x632c, 0x6b2c, 0x6b4d, 0x6b4d, 0x6b6d, 0x29c6, 0x97f8, 0x97f8, 
-	0x5cef, 0x528a, 0x7bcf, 0x7bcf, 0x7bef, 0x83ef, 0x8410, 0x8410, 0x8430, 0x8430, 0x8c51, 0x2a07, 0x97f8, 0x97f8, 0x97f8, 0x6570, 
-	0x630b, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x3a07, 0x5c8e, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x6550, 0x5aaa, 0x8410, 0x8410, 0x83ef, 0x7bef, 0x7bcf, 0x7bcf, 0x7bae, 0x73ae, 
-	0x738e, 0x738e, 0x736d, 0x6b6d, 0x6b4d, 0x6b4d, 0x6b2c, 0x632c, 0x2a06, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x21c5, 0x5269, 0x4a69, 0x4a69, 0x4a49, 0x4a49, 0x4228, 0x4228, 0x4208, 0x4208, 0x39e7, 0x39e7, 0x39c7, 0x39c7, 0x2144, 
-	0x4c0c, 0x97f8, 0x97f8, 0x97f8, 0x97d7, 0x1103, 0x10a2, 0x10a2, 0x1082, 0x1082, 0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x0861, 
-	0x0881, 0x6dd1, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x21e5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x2945, 0x4228, 0x632c, 0x8410, 0xa514, 0xc638, 
-	0xc618, 0xa514, 0x8410, 0x632c, 0x4228, 0x2945, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x6dd1, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x7632, 
-	0x10c3, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x2104, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x31a6, 
-	0x31a6, 0x39c7, 0x39c7, 0x39e7, 0x39e7, 0x4208, 0x4208, 0x31a6, 0x4bec, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x8715, 0x29a6, 0x5acb, 0x5acb, 0x5aeb, 0x62eb, 0x630c, 0x630c, 0x632c, 0x6b2c, 0x6b4d, 0x6b4d, 0x630c, 0x32a8, 0x97f8, 0x97f8, 
-	0x5cef, 0x528a, 0x7bcf, 0x7bcf, 0x7bef, 0x83ef, 0x8410, 0x8410, 0x8430, 0x8c30, 0x8c51, 0x2a07, 0x97f8, 0x97f8, 0x97f8, 0x6570, 
-	0x630b, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9471, 0x2985, 0x6dd1, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x6550, 0x5aaa, 0x8410, 0x8410, 0x83ef, 0x7bef, 0x7bcf, 0x7bcf, 0x7bae, 0x73ae, 
-	0x738e, 0x738e, 0x736d, 0x6b6d, 0x6b4d, 0x6b4d, 0x6b2c, 0x632c, 0x2a06, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x21c5, 0x528a, 0x4a69, 0x4a69, 0x4a49, 0x4a49, 0x4228, 0x4228, 0x4208, 0x4208, 0x39e7, 0x39e7, 0x39c7, 0x39c7, 0x1923, 
-	0x8f76, 0x97f8, 0x97f8, 0x97f8, 0x6570, 0x1903, 0x2945, 0x2124, 0x2124, 0x2104, 0x2104, 0x18e3, 0x18e3, 0x18c3, 0x18c3, 0x10a2, 
-	0x1082, 0x19a5, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x6df2, 0x0881, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x2945, 0x4228, 0x632c, 0x8410, 0xa514, 0xc638, 
-	0xc618, 0xa514, 0x8410, 0x632c, 0x4228, 0x2124, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x6dd1, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x7632, 
-	0x10c2, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x2104, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x31a6, 
-	0x31a6, 0x39c7, 0x39c7, 0x39e7, 0x39e7, 0x4208, 0x4208, 0x31a6, 0x4bec, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x8715, 0x29a6, 0x5acb, 0x5acb, 0x5aeb, 0x62eb, 0x630c, 0x630c, 0x632c, 0x6b2c, 0x6b4d, 0x6b4d, 0x3a08, 0x6550, 0x97f8, 0x97f8, 
-	0x5cef, 0x528a, 0x7bcf, 0x7bcf, 0x7bef, 0x83ef, 0x8410, 0x8410, 0x8430, 0x8c30, 0x8c51, 0x2a07, 0x97f8, 0x97f8, 0x97f8, 0x6570, 
-	0x630b, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x8c51, 0x1944, 0x7eb4, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x6550, 0x5aaa, 0x8410, 0x8410, 0x83ef, 0x7bef, 0x7bcf, 0x7bcf, 0x7bae, 0x73ae, 
-	0x738e, 0x738e, 0x736d, 0x6b6d, 0x6b4d, 0x6b4d, 0x6b2c, 0x632c, 0x2a06, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x21c5, 0x528a, 0x4a69, 0x4a69, 0x4a49, 0x4a49, 0x4228, 0x4228, 0x4208, 0x4208, 0x39e7, 0x39e7, 0x39c7, 0x2965, 0x32a8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x21c5, 0x2124, 0x2945, 0x2124, 0x2124, 0x2104, 0x2104, 0x18e3, 0x18e3, 0x18c3, 0x18c3, 0x10a2, 
-	0x10a2, 0x10e2, 0x7e94, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x1123, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x2124, 0x4228, 0x632c, 0x8410, 0xa514, 0xc618, 
-	0xbdf7, 0xa514, 0x8410, 0x630c, 0x4228, 0x2124, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x6dd1, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x7632, 
-	0x10c2, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x2104, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x31a6, 
-	0x31a6, 0x39c7, 0x39c7, 0x39e7, 0x39e7, 0x4208, 0x4208, 0x31a6, 0x4bec, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x8715, 0x29c6, 0x5acb, 0x5acb, 0x5aeb, 0x62eb, 0x630c, 0x630c, 0x632c, 0x6b2c, 0x6b4d, 0x6b2c, 0x2164, 0x97d7, 0x97f8, 0x97f8, 
-	0x5cef, 0x528a, 0x7bcf, 0x7bcf, 0x7bef, 0x83ef, 0x8410, 0x8410, 0x8430, 0x8c30, 0x8c51, 0x2a07, 0x97f8, 0x97f8, 0x97f8, 0x6570, 
-	0x630b, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x7bef, 0x1944, 0x8756, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x6550, 0x5acb, 0x8410, 0x8410, 0x83ef, 0x7bef, 0x7bcf, 0x7bcf, 0x7bae, 0x73ae, 
-	0x738e, 0x738e, 0x736d, 0x6b6d, 0x6b4d, 0x6b4d, 0x6b2c, 0x632c, 0x2a06, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x21c5, 0x528a, 0x4a69, 0x4a69, 0x4a49, 0x4a49, 0x4228, 0x4228, 0x4208, 0x4208, 0x39e7, 0x39e7, 0x39c7, 0x1923, 0x7eb4, 
-	0x97f8, 0x97f8, 0x97f8, 0x8735, 0x1923, 0x2945, 0x2945, 0x2124, 0x2124, 0x2104, 0x2104, 0x18e3, 0x18e3, 0x18c3, 0x18c3, 0x10a2, 
-	0x10a2, 0x1082, 0x32c8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x5cef, 0x0061, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x2124, 0x4228, 0x630c, 0x8410, 0xa514, 0xbdf7, 
-	0xbdf7, 0xa514, 0x8410, 0x630c, 0x4228, 0x2124, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x6dd1, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x7612, 
-	0x10c3, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x2104, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x31a6, 
-	0x31a6, 0x39c7, 0x39c7, 0x39e7, 0x39e7, 0x4208, 0x4208, 0x31a6, 0x4bec, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x8715, 0x29c6, 0x5acb, 0x5acb, 0x5aeb, 0x62eb, 0x630c, 0x630c, 0x632c, 0x6b2c, 0x6b2c, 0x2965, 0x6550, 0x97f8, 0x97f8, 0x97f8, 
-	0x5cef, 0x528a, 0x7bcf, 0x7bcf, 0x7bef, 0x83ef, 0x8410, 0x8410, 0x8430, 0x8c30, 0x8c51, 0x2a07, 0x97f8, 0x97f8, 0x97f8, 0x6570, 
-	0x630b, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x6b6d, 0x21c5, 0x97d7, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x6550, 0x5acb, 0x8410, 0x8410, 0x83ef, 0x7bef, 0x7bcf, 0x7bcf, 0x7bae, 0x73ae, 
-	0x738e, 0x738e, 0x736d, 0x6b6d, 0x6b4d, 0x6b4d, 0x6b2c, 0x632c, 0x2a06, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x21c5, 0x528a, 0x4a69, 0x4a69, 0x4a49, 0x4a49, 0x4228, 0x4228, 0x4208, 0x4208, 0x39e7, 0x39e7, 0x2945, 0x32c8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x6db1, 0x1904, 0x2945, 0x2945, 0x2124, 0x2124, 0x2104, 0x2104, 0x18e3, 0x18e3, 0x18c3, 0x18c3, 0x10a2, 
-	0x10a2, 0x1082, 0x1985, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97d8, 0x1103, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x2124, 0x4228, 0x630c, 0x8410, 0xa514, 0xbdf7, 
-	0xc618, 0xa514, 0x8410, 0x632c, 0x4228, 0x2124, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x6dd1, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x7612, 
-	0x10c2, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x2104, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x31a6, 
-	0x31a6, 0x39c7, 0x39c7, 0x39e7, 0x39e7, 0x4208, 0x4208, 0x31a6, 0x4bec, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x8715, 0x29a6, 0x5aaa, 0x52aa, 0x5aaa, 0x5acb, 0x5acb, 0x5aeb, 0x5acb, 0x4a49, 0x1903, 0x4c0c, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x5cef, 0x528a, 0x7bcf, 0x7bcf, 0x7bef, 0x83ef, 0x8410, 0x8410, 0x8430, 0x8c30, 0x8c51, 0x2a07, 0x97f8, 0x97f8, 0x97f8, 0x6570, 
-	0x630b, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x5aeb, 0x32c8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x6550, 0x5aaa, 0x8410, 0x8410, 0x83ef, 0x7bef, 0x7bcf, 0x7bcf, 0x7bae, 0x73ae, 
-	0x738e, 0x738e, 0x736d, 0x6b6d, 0x6b4d, 0x6b4d, 0x6b2c, 0x632c, 0x2a06, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x21c5, 0x528a, 0x4a69, 0x4a69, 0x4a49, 0x4a49, 0x4228, 0x4228, 0x4208, 0x39e7, 0x39c7, 0x2144, 0x1964, 0x8f97, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x7612, 0x1903, 0x2924, 0x2945, 0x2124, 0x2124, 0x2104, 0x2104, 0x18e3, 0x18e3, 0x18c3, 0x18c3, 0x10a2, 
-	0x10a2, 0x1082, 0x2206, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x6df2, 0x0881, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x2124, 0x4228, 0x632c, 0x8410, 0xa514, 0xc618, 
-	0xc618, 0xa514, 0x8410, 0x632c, 0x4228, 0x2945, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0041, 0x08a1, 0x08a1, 0x08a1, 0x08a1, 0x08a2, 0x7612, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x7653, 
-	0x08a2, 0x08a2, 0x08a2, 0x08a2, 0x08a2, 0x0020, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x31a6, 
-	0x31a6, 0x39c7, 0x10c2, 0x08a2, 0x08c2, 0x08c2, 0x08c2, 0x08c2, 0x54ae, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x8735, 0x10c2, 0x10c2, 0x10c2, 0x10c2, 0x10c2, 0x10c2, 0x1924, 0x1944, 0x3267, 0x7612, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x5cef, 0x528a, 0x7bcf, 0x7bcf, 0x7bef, 0x83ef, 0x2985, 0x10c2, 0x10c2, 0x10c2, 0x10c2, 0x3267, 0x97f8, 0x97f8, 0x97f8, 0x6db1, 
-	0x10e2, 0x10e2, 0x10e2, 0x10e2, 0x0841, 0x8c51, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x4248, 0x4c2c, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x6550, 0x5aaa, 0x8410, 0x8410, 0x83ef, 0x7bef, 0x7bcf, 0x7bcf, 0x7bae, 0x73ae, 
-	0x738e, 0x738e, 0x736d, 0x2986, 0x10c2, 0x10c2, 0x10c2, 0x10c2, 0x32c8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x2a26, 0x10c2, 0x10c2, 0x10c2, 0x08a2, 0x2165, 0x4228, 0x2965, 0x0881, 0x08c2, 0x1123, 0x3b29, 0x8f76, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97d7, 0x2a47, 0x08a2, 0x08a2, 0x10e3, 0x2124, 0x2104, 0x2104, 0x18e3, 0x18e3, 0x0020, 0x08a2, 0x08a2, 
-	0x08a2, 0x1143, 0x7e73, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x6e12, 0x1964, 0x08a1, 
-	0x08a1, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x2945, 0x4228, 0x632c, 0x8410, 0xa514, 0xc638, 
-	0xc638, 0xa514, 0x8410, 0x632c, 0x4228, 0x2945, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x1964, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x21c5, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x31a6, 
-	0x31a6, 0x39c7, 0x2184, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x5cef, 0x528a, 0x7bcf, 0x7bcf, 0x7bef, 0x83ef, 0x29c6, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x3ac8, 0x8c51, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x29a6, 0x6570, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x6550, 0x5aaa, 0x8410, 0x8410, 0x83ef, 0x7bef, 0x7bcf, 0x7bcf, 0x7bae, 0x73ae, 
-	0x738e, 0x738e, 0x736d, 0x29c6, 0x8f96, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x7eb4, 0x2985, 0x4228, 0x2965, 0x6591, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8f97, 0x1923, 0x2124, 0x2104, 0x2104, 0x18e3, 0x18e3, 0x2a26, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x3b4a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x2945, 0x4228, 0x632c, 0x8410, 0xa514, 0xc638, 
-	0xc638, 0xa514, 0x8430, 0x632c, 0x4a49, 0x2945, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x1964, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x21c5, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x31a6, 
-	0x31a6, 0x39c7, 0x2184, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x5cef, 0x528a, 0x7bcf, 0x7bcf, 0x7bef, 0x7bef, 0x29c6, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x3ac8, 0x8c51, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x8c51, 0x2144, 0x7653, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x6550, 0x5aaa, 0x8410, 0x83ef, 0x7bef, 0x7bef, 0x7bcf, 0x7bcf, 0x7bae, 0x73ae, 
-	0x738e, 0x738e, 0x736d, 0x29c6, 0x8f96, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x7eb4, 0x2985, 0x4228, 0x2965, 0x6591, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x8f97, 0x1923, 0x2124, 0x2104, 0x2104, 0x18e3, 0x18e3, 0x2a26, 0x97f8, 0x97f8, 
-	0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 0x97f8, 
-	0x97f8, 0x3b4a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x2945, 0x4a49, 0x632c, 0x8430, 0xa514, 0xce59, 
-	0xce59, 0xa534, 0x8430, 0x632c, 0x4a49, 0x2945, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x10c2, 0x436a, 0x436a, 0x436a, 0x436a, 0x436a, 0x436a, 0x436a, 0x436a, 0x436a, 0x436a, 0x436a, 0x436a, 0x436a, 0x436a, 
-	0x438a, 0x438a, 0x438a, 0x438a, 0x438a, 0x10c2, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x31a6, 
-	0x31a6, 0x39c7, 0x1923, 0x438a, 0x438a, 0x438a, 0x438a, 0x438a, 0x438a, 0x438a, 0x438a, 0x438a, 0x438a, 0x438a, 0x438a, 0x438a, 
-	0x438a, 0x438a, 0x438a, 0x438a, 0x438a, 0x438a, 0x438a, 0x438b, 0x438b, 0x438b, 0x438b, 0x438b, 0x438b, 0x438b, 0x438b, 0x438b, 
-	0x2a47, 0x528a, 0x7bae, 0x7bcf, 0x7bcf, 0x7bef, 0x29a6, 0x438b, 0x438b, 0x438b, 0x438b, 0x438b, 0x438b, 0x438b, 0x438b, 0x438b, 
-	0x438b, 0x438b, 0x438b, 0x438b, 0x1944, 0x8c51, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x8410, 0x1944, 0x438b, 
-	0x438b, 0x438b, 0x438b, 0x438b, 0x438b, 0x438b, 0x2a67, 0x52aa, 0x8410, 0x83ef, 0x7bef, 0x7bcf, 0x7bcf, 0x7bae, 0x73ae, 0x73ae, 
-	0x738e, 0x738e, 0x6b6d, 0x29c6, 0x3b4a, 0x438b, 0x438b, 0x438b, 0x438b, 0x438a, 0x438a, 0x438a, 0x438a, 0x438a, 0x438a, 0x438a, 
-	0x438a, 0x438a, 0x438a, 0x438a, 0x438a, 0x3b09, 0x2985, 0x4228, 0x2965, 0x2a67, 0x438a, 0x438a, 0x438a, 0x438a, 0x438a, 0x438a, 
-	0x438a, 0x438a, 0x438a, 0x438a, 0x438a, 0x438a, 0x3b4a, 0x1923, 0x2124, 0x2104, 0x2104, 0x18e3, 0x18c3, 0x10e2, 0x438a, 0x438a, 
-	0x436a, 0x436a, 0x436a, 0x436a, 0x436a, 0x436a, 0x436a, 0x436a, 0x436a, 0x436a, 0x436a, 0x436a, 0x436a, 0x436a, 0x436a, 0x436a, 
-	0x436a, 0x1964, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x2945, 0x4a49, 0x632c, 0x8430, 0xa534, 0xce59, 
-	0xce79, 0xa534, 0x8430, 0x6b4d, 0x4a49, 0x2965, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 
-	0x0861, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x31a6, 
-	0x31a6, 0x39a6, 0x2924, 0x2104, 0x2124, 0x2124, 0x2924, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3165, 0x3186, 0x3186, 
-	0x3186, 0x31a6, 0x31a6, 0x31a6, 0x39a6, 0x39c7, 0x39c7, 0x39c7, 0x39e7, 0x39e7, 0x39e7, 0x4208, 0x4208, 0x4208, 0x4208, 0x4228, 
-	0x4228, 0x6b2c, 0x7bae, 0x7bcf, 0x7bcf, 0x7bef, 0x5acb, 0x4a69, 0x4a69, 0x5269, 0x528a, 0x528a, 0x528a, 0x528a, 0x52aa, 0x52aa, 
-	0x52aa, 0x5aaa, 0x5acb, 0x5acb, 0x5acb, 0x9471, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x7bae, 0x52aa, 
-	0x52aa, 0x52aa, 0x528a, 0x528a, 0x528a, 0x528a, 0x5269, 0x738e, 0x8410, 0x83ef, 0x7bef, 0x7bcf, 0x7bcf, 0x7bae, 0x73ae, 0x738e, 
-	0x738e, 0x736d, 0x6b6d, 0x528a, 0x4208, 0x39e7, 0x39e7, 0x39e7, 0x39c7, 0x39c7, 0x39c7, 0x39a6, 0x31a6, 0x31a6, 0x31a6, 0x3186, 
-	0x3186, 0x3186, 0x3165, 0x2965, 0x2965, 0x2965, 0x39c7, 0x4228, 0x39c7, 0x2924, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x2104, 
-	0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18c3, 0x18c3, 0x18c3, 0x18e3, 0x2124, 0x2104, 0x2104, 0x18e3, 0x18e3, 0x1082, 0x0861, 0x0861, 
-	0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x2965, 0x4a49, 0x6b4d, 0x8430, 0xa534, 0xce79, 
-	0xd6ba, 0xa534, 0x8c51, 0x6b4d, 0x4a69, 0x2965, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0841, 0x0841, 0x0861, 0x0861, 0x1082, 0x1082, 0x10a2, 
-	0x10a2, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x2104, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x3165, 0x3186, 0x3186, 
-	0x31a6, 0x39a6, 0x39c7, 0x39c7, 0x39e7, 0x41e7, 0x4208, 0x4208, 0x4228, 0x4a28, 0x4a49, 0x4a49, 0x4a69, 0x4a69, 0x528a, 0x528a, 
-	0x52aa, 0x52aa, 0x5acb, 0x5acb, 0x5aeb, 0x5aeb, 0x630c, 0x630c, 0x630c, 0x632c, 0x6b2c, 0x6b4d, 0x6b4d, 0x6b6d, 0x736d, 0x738e, 
-	0x738e, 0x73ae, 0x7bae, 0x7bcf, 0x7bcf, 0x7bef, 0x7bef, 0x83ef, 0x8410, 0x8410, 0x8430, 0x8c30, 0x8c51, 0x8c51, 0x8c51, 0x8c71, 
-	0x9471, 0x9471, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9471, 0x9471, 
-	0x8c71, 0x8c51, 0x8c51, 0x8c51, 0x8c30, 0x8430, 0x8410, 0x8410, 0x83ef, 0x7bef, 0x7bef, 0x7bcf, 0x7bcf, 0x7bae, 0x73ae, 0x738e, 
-	0x738e, 0x736d, 0x6b6d, 0x6b4d, 0x6b4d, 0x6b2c, 0x632c, 0x630c, 0x630c, 0x630c, 0x5aeb, 0x5aeb, 0x5acb, 0x5acb, 0x52aa, 0x52aa, 
-	0x528a, 0x528a, 0x4a69, 0x4a69, 0x4a49, 0x4a49, 0x4a28, 0x4228, 0x4208, 0x4208, 0x41e7, 0x39e7, 0x39c7, 0x39c7, 0x39a6, 0x31a6, 
-	0x3186, 0x3186, 0x3165, 0x2965, 0x2965, 0x2945, 0x2945, 0x2124, 0x2124, 0x2104, 0x2104, 0x18e3, 0x18e3, 0x18c3, 0x18c3, 0x10a2, 
-	0x10a2, 0x1082, 0x1082, 0x0861, 0x0861, 0x0841, 0x0841, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x2965, 0x4a69, 0x6b4d, 0x8c51, 0xa534, 0xd6ba, 
-	0xdedb, 0xad55, 0x8c51, 0x6b6d, 0x4a69, 0x3186, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0841, 0x0841, 0x0861, 0x0861, 0x1082, 0x1082, 0x10a2, 
-	0x10a2, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x2104, 0x2104, 0x2124, 0x2124, 0x2924, 0x2945, 0x2945, 0x2965, 0x3165, 0x3186, 0x3186, 
-	0x31a6, 0x39a6, 0x39c7, 0x39c7, 0x39e7, 0x41e7, 0x4208, 0x4208, 0x4228, 0x4228, 0x4a49, 0x4a49, 0x4a69, 0x4a69, 0x528a, 0x528a, 
-	0x52aa, 0x52aa, 0x5acb, 0x5acb, 0x5acb, 0x5aeb, 0x62eb, 0x630c, 0x630c, 0x632c, 0x6b2c, 0x6b4d, 0x6b4d, 0x6b6d, 0x736d, 0x738e, 
-	0x738e, 0x73ae, 0x73ae, 0x7bae, 0x7bcf, 0x7bcf, 0x7bef, 0x83ef, 0x8410, 0x8410, 0x8430, 0x8430, 0x8c30, 0x8c51, 0x8c51, 0x8c51, 
-	0x8c71, 0x9471, 0x9471, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9471, 0x9471, 0x8c71, 
-	0x8c51, 0x8c51, 0x8c51, 0x8c30, 0x8430, 0x8430, 0x8410, 0x8410, 0x83ef, 0x7bef, 0x7bcf, 0x7bcf, 0x7bae, 0x73ae, 0x73ae, 0x738e, 
-	0x738e, 0x736d, 0x6b6d, 0x6b4d, 0x6b4d, 0x6b2c, 0x632c, 0x630c, 0x630c, 0x62eb, 0x5aeb, 0x5acb, 0x5acb, 0x5acb, 0x52aa, 0x52aa, 
-	0x528a, 0x528a, 0x4a69, 0x4a69, 0x4a49, 0x4a49, 0x4228, 0x4228, 0x4208, 0x4208, 0x41e7, 0x39e7, 0x39c7, 0x39c7, 0x39a6, 0x31a6, 
-	0x3186, 0x3186, 0x3165, 0x2965, 0x2945, 0x2945, 0x2924, 0x2124, 0x2124, 0x2104, 0x2104, 0x18e3, 0x18e3, 0x18c3, 0x18c3, 0x10a2, 
-	0x10a2, 0x1082, 0x1082, 0x0861, 0x0861, 0x0841, 0x0841, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x3186, 0x4a69, 0x6b6d, 0x8c51, 0xad55, 0xdedb, 
-	0xdefb, 0xad55, 0x8c71, 0x6b6d, 0x528a, 0x3186, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0841, 0x0841, 0x0861, 0x0861, 0x1082, 0x1082, 0x10a2, 
-	0x10a2, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x20e3, 0x2104, 0x2104, 0x2124, 0x2924, 0x2945, 0x2945, 0x2965, 0x3165, 0x3186, 0x3186, 
-	0x31a6, 0x31a6, 0x39c7, 0x39c7, 0x39e7, 0x39e7, 0x4208, 0x4208, 0x4228, 0x4228, 0x4a49, 0x4a49, 0x4a69, 0x4a69, 0x528a, 0x528a, 
-	0x528a, 0x52aa, 0x5aaa, 0x5acb, 0x5acb, 0x5aeb, 0x62eb, 0x630c, 0x630c, 0x632c, 0x6b2c, 0x6b4d, 0x6b4d, 0x6b6d, 0x6b6d, 0x736d, 
-	0x738e, 0x738e, 0x73ae, 0x7bae, 0x7bcf, 0x7bcf, 0x7bef, 0x7bef, 0x83ef, 0x8410, 0x8410, 0x8430, 0x8430, 0x8c30, 0x8c51, 0x8c51, 
-	0x8c51, 0x8c71, 0x8c71, 0x9471, 0x9471, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9471, 0x9471, 0x8c71, 0x8c71, 0x8c51, 
-	0x8c51, 0x8c51, 0x8c30, 0x8430, 0x8430, 0x8410, 0x8410, 0x83ef, 0x7bef, 0x7bef, 0x7bcf, 0x7bcf, 0x7bae, 0x73ae, 0x738e, 0x738e, 
-	0x736d, 0x6b6d, 0x6b6d, 0x6b4d, 0x6b4d, 0x6b2c, 0x632c, 0x630c, 0x630c, 0x62eb, 0x5aeb, 0x5acb, 0x5acb, 0x5aaa, 0x52aa, 0x528a, 
-	0x528a, 0x528a, 0x4a69, 0x4a69, 0x4a49, 0x4a49, 0x4228, 0x4228, 0x4208, 0x4208, 0x39e7, 0x39e7, 0x39c7, 0x39c7, 0x31a6, 0x31a6, 
-	0x3186, 0x3186, 0x3165, 0x2965, 0x2945, 0x2945, 0x2924, 0x2124, 0x2104, 0x2104, 0x20e3, 0x18e3, 0x18e3, 0x18c3, 0x18c3, 0x10a2, 
-	0x10a2, 0x1082, 0x1082, 0x0861, 0x0861, 0x0841, 0x0841, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x3186, 0x528a, 0x6b6d, 0x8c71, 0xad55, 0xdefb, 
-	0xe73c, 0xad75, 0x9492, 0x738e, 0x52aa, 0x31a6, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0841, 0x0841, 0x0861, 0x0861, 0x1082, 0x1082, 0x10a2, 
-	0x10a2, 0x18a2, 0x18c3, 0x18c3, 0x18e3, 0x20e3, 0x2104, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 
-	0x31a6, 0x31a6, 0x39c7, 0x39c7, 0x39e7, 0x39e7, 0x4208, 0x4208, 0x4228, 0x4228, 0x4a28, 0x4a49, 0x4a49, 0x4a69, 0x5269, 0x528a, 
-	0x528a, 0x52aa, 0x5aaa, 0x5acb, 0x5acb, 0x5aeb, 0x5aeb, 0x630c, 0x630c, 0x632c, 0x632c, 0x6b2c, 0x6b4d, 0x6b4d, 0x6b6d, 0x736d, 
-	0x738e, 0x738e, 0x73ae, 0x73ae, 0x7bcf, 0x7bcf, 0x7bcf, 0x7bef, 0x83ef, 0x8410, 0x8410, 0x8410, 0x8430, 0x8c30, 0x8c30, 0x8c51, 
-	0x8c51, 0x8c51, 0x8c71, 0x8c71, 0x8c71, 0x9471, 0x9471, 0x9471, 0x9471, 0x9471, 0x9471, 0x8c71, 0x8c71, 0x8c71, 0x8c51, 0x8c51, 
-	0x8c51, 0x8c30, 0x8c30, 0x8430, 0x8410, 0x8410, 0x8410, 0x83ef, 0x7bef, 0x7bcf, 0x7bcf, 0x7bcf, 0x73ae, 0x73ae, 0x738e, 0x738e, 
-	0x736d, 0x6b6d, 0x6b4d, 0x6b4d, 0x6b2c, 0x632c, 0x632c, 0x630c, 0x630c, 0x5aeb, 0x5aeb, 0x5acb, 0x5acb, 0x5aaa, 0x52aa, 0x528a, 
-	0x528a, 0x5269, 0x4a69, 0x4a49, 0x4a49, 0x4a28, 0x4228, 0x4228, 0x4208, 0x4208, 0x39e7, 0x39e7, 0x39c7, 0x39c7, 0x31a6, 0x31a6, 
-	0x3186, 0x3186, 0x2965, 0x2965, 0x2945, 0x2945, 0x2124, 0x2124, 0x2104, 0x2104, 0x20e3, 0x18e3, 0x18c3, 0x18c3, 0x18a2, 0x10a2, 
-	0x10a2, 0x1082, 0x1082, 0x0861, 0x0861, 0x0841, 0x0841, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c3, 0x31a6, 0x52aa, 0x738e, 0x9492, 0xad75, 0xe73c, 
-	0xef5d, 0xb596, 0x9492, 0x73ae, 0x52aa, 0x39c7, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0861, 0x1061, 0x1082, 0x1082, 
-	0x10a2, 0x10a2, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x2104, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 
-	0x31a6, 0x31a6, 0x39c7, 0x39c7, 0x39e7, 0x39e7, 0x41e7, 0x4208, 0x4208, 0x4228, 0x4a28, 0x4a49, 0x4a49, 0x4a69, 0x5269, 0x528a, 
-	0x528a, 0x52aa, 0x52aa, 0x5acb, 0x5acb, 0x5aeb, 0x5aeb, 0x62eb, 0x630c, 0x630c, 0x632c, 0x6b2c, 0x6b4d, 0x6b4d, 0x6b6d, 0x6b6d, 
-	0x738e, 0x738e, 0x738e, 0x73ae, 0x7bae, 0x7bcf, 0x7bcf, 0x7bcf, 0x7bef, 0x83ef, 0x8410, 0x8410, 0x8410, 0x8430, 0x8430, 0x8c30, 
-	0x8c51, 0x8c51, 0x8c51, 0x8c51, 0x8c51, 0x8c71, 0x8c71, 0x8c71, 0x8c71, 0x8c71, 0x8c71, 0x8c51, 0x8c51, 0x8c51, 0x8c51, 0x8c51, 
-	0x8c30, 0x8430, 0x8430, 0x8410, 0x8410, 0x8410, 0x83ef, 0x7bef, 0x7bcf, 0x7bcf, 0x7bcf, 0x7bae, 0x73ae, 0x738e, 0x738e, 0x738e, 
-	0x6b6d, 0x6b6d, 0x6b4d, 0x6b4d, 0x6b2c, 0x632c, 0x630c, 0x630c, 0x62eb, 0x5aeb, 0x5aeb, 0x5acb, 0x5acb, 0x52aa, 0x52aa, 0x528a, 
-	0x528a, 0x5269, 0x4a69, 0x4a49, 0x4a49, 0x4a28, 0x4228, 0x4208, 0x4208, 0x41e7, 0x39e7, 0x39e7, 0x39c7, 0x39c7, 0x31a6, 0x31a6, 
-	0x3186, 0x3186, 0x2965, 0x2965, 0x2945, 0x2945, 0x2124, 0x2124, 0x2104, 0x2104, 0x18e3, 0x18e3, 0x18c3, 0x18c3, 0x10a2, 0x10a2, 
-	0x1082, 0x1082, 0x1061, 0x0861, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c3, 0x39c7, 0x52aa, 0x73ae, 0x9492, 0xb596, 0xef5d, 
-	0xf79e, 0xb5b6, 0x94b2, 0x7bcf, 0x5acb, 0x39e7, 0x18e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0841, 0x0841, 0x0861, 0x0861, 0x1082, 0x1082, 
-	0x10a2, 0x10a2, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x2104, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 
-	0x31a6, 0x31a6, 0x39a6, 0x39c7, 0x39c7, 0x39e7, 0x41e7, 0x4208, 0x4208, 0x4228, 0x4228, 0x4a49, 0x4a49, 0x4a69, 0x4a69, 0x528a, 
-	0x528a, 0x52aa, 0x52aa, 0x5aaa, 0x5acb, 0x5acb, 0x5aeb, 0x62eb, 0x630c, 0x630c, 0x632c, 0x632c, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b6d, 
-	0x736d, 0x738e, 0x738e, 0x73ae, 0x73ae, 0x7bae, 0x7bcf, 0x7bcf, 0x7bef, 0x7bef, 0x83ef, 0x8410, 0x8410, 0x8410, 0x8430, 0x8430, 
-	0x8c30, 0x8c30, 0x8c51, 0x8c51, 0x8c51, 0x8c51, 0x8c51, 0x8c51, 0x8c51, 0x8c51, 0x8c51, 0x8c51, 0x8c51, 0x8c51, 0x8c30, 0x8c30, 
-	0x8430, 0x8430, 0x8410, 0x8410, 0x8410, 0x83ef, 0x7bef, 0x7bef, 0x7bcf, 0x7bcf, 0x7bae, 0x73ae, 0x73ae, 0x738e, 0x738e, 0x736d, 
-	0x6b6d, 0x6b4d, 0x6b4d, 0x6b4d, 0x632c, 0x632c, 0x630c, 0x630c, 0x62eb, 0x5aeb, 0x5acb, 0x5acb, 0x5aaa, 0x52aa, 0x52aa, 0x528a, 
-	0x528a, 0x4a69, 0x4a69, 0x4a49, 0x4a49, 0x4228, 0x4228, 0x4208, 0x4208, 0x41e7, 0x39e7, 0x39c7, 0x39c7, 0x39a6, 0x31a6, 0x31a6, 
-	0x3186, 0x3186, 0x2965, 0x2965, 0x2945, 0x2945, 0x2124, 0x2124, 0x2104, 0x2104, 0x18e3, 0x18e3, 0x18c3, 0x18c3, 0x10a2, 0x10a2, 
-	0x1082, 0x1082, 0x0861, 0x0861, 0x0841, 0x0841, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18e3, 0x39e7, 0x5acb, 0x7bcf, 0x94b2, 0xb5b6, 0xf79e, 
-	0xf7be, 0xb5b6, 0x9cd3, 0x7bcf, 0x5aeb, 0x39e7, 0x2104, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x4a69, 0x630c, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 
-	0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x632c, 0x8c71, 0x5acb, 0x52aa, 0x5acb, 0x5acb, 0x5acb, 0x5aeb, 0x5aeb, 0x5aeb, 0x630c, 0x630c, 
-	0x630c, 0x632c, 0x6b4d, 0x73ae, 0x4228, 0x18e3, 0x2104, 0x2104, 0x2124, 0x8430, 0x738e, 0x738e, 0x738e, 0x738e, 0x73ae, 0x73ae, 
-	0x7bae, 0x7bcf, 0x7bcf, 0x7bcf, 0x7bef, 0x7bef, 0x7bef, 0x8410, 0x8410, 0x8410, 0x9492, 0x94b2, 0x8430, 0x8c51, 0x8c51, 0x8c51, 
-	0x8c51, 0x8c71, 0x8c71, 0x9471, 0x9492, 0x9492, 0x9492, 0x94b2, 0x94b2, 0x94b2, 0x9cb2, 0x9cd3, 0xad55, 0xa514, 0x9cf3, 0x9cf3, 
-	0x9cf3, 0xa514, 0xa514, 0xa514, 0xa514, 0xa534, 0xa534, 0xa534, 0xad34, 0xad55, 0xb575, 0xb575, 0x8430, 0x8410, 0x8410, 0x8430, 
-	0x8430, 0x8430, 0x8c30, 0x9cb2, 0xb5b6, 0xb5b6, 0xb596, 0xb596, 0xb596, 0xb596, 0xb5b6, 0xb5b6, 0xbdb6, 0xb596, 0x9492, 0x8430, 
-	0x8430, 0x8410, 0x8410, 0x8410, 0x83ef, 0xb575, 0xad55, 0xad34, 0xa534, 0xa534, 0xa534, 0xa514, 0xa514, 0xad75, 0x738e, 0x6b6d, 
-	0x6b6d, 0x6b4d, 0x6b4d, 0x83ef, 0xa514, 0x9cb2, 0x94b2, 0x94b2, 0x94b2, 0x9492, 0x9492, 0x9492, 0xa514, 0x9cb2, 0x8c71, 0x8c51, 
-	0x8c51, 0x8c51, 0x8c51, 0x8430, 0x8430, 0x8430, 0x8410, 0x8410, 0x8410, 0x7bef, 0x7bef, 0x7bef, 0x7bcf, 0x7bcf, 0x9492, 0x3186, 
-	0x73ae, 0x73ae, 0x738e, 0x738e, 0x738e, 0x738e, 0x6b6d, 0x6b6d, 0x6b6d, 0x6b4d, 0x6b4d, 0x6b4d, 0x632c, 0x632c, 0x632c, 0x73ae, 
-	0x6b6d, 0x630c, 0x5aeb, 0x5aeb, 0x5aeb, 0x5acb, 0x5acb, 0x5acb, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 
-	0x52aa, 0x7bcf, 0x5acb, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x630c, 
-	0x6b4d, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x39e7, 0x5aeb, 0x7bcf, 0x9cd3, 0xb5b6, 0xf7be, 
-	0xffdf, 0xbdd7, 0x9cf3, 0x7bef, 0x630c, 0x4208, 0x2124, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0841, 0x738e, 0x39e7, 0x8c51, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 
-	0xad55, 0xad55, 0xad55, 0x2945, 0x73ae, 0x6b6d, 0x4a69, 0xad55, 0xad75, 0xad75, 0xad75, 0xad75, 0xad75, 0xad75, 0xad75, 0xb596, 
-	0xb596, 0xb596, 0xad75, 0x7bef, 0x5aeb, 0x528a, 0x2104, 0x2104, 0x5acb, 0x528a, 0xb5b6, 0xbdd7, 0xbdd7, 0xbdd7, 0xbdd7, 0xbdd7, 
-	0xbdd7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xc5f7, 0xad55, 0x738e, 0x7bcf, 0x7bcf, 0xbdf7, 0xc618, 0xc638, 0xc638, 
-	0xc638, 0xc638, 0xc638, 0xc638, 0xce38, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xc5f7, 0x8430, 0x8c71, 0x94b2, 0xc618, 0xce79, 
-	0xce79, 0xce79, 0xd679, 0xd69a, 0xd69a, 0xd69a, 0xd69a, 0xd69a, 0xd69a, 0xd69a, 0xbdf7, 0x94b2, 0xbdf7, 0x8410, 0x8410, 0x8410, 
-	0x8410, 0x9492, 0xbdd7, 0xad55, 0xad75, 0xce38, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd69a, 0xc638, 0xbdd7, 0xa514, 0xb575, 0xbdd7, 
-	0x8430, 0x8410, 0x8410, 0x83ef, 0x8c51, 0xa534, 0xce59, 0xd69a, 0xd69a, 0xd69a, 0xd69a, 0xd69a, 0xbdf7, 0xad55, 0x738e, 0x6b6d, 
-	0x6b4d, 0x6b4d, 0x83ef, 0xa514, 0xa514, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xc638, 0x6b2c, 0xa534, 0x8c51, 0xbdd7, 0xc638, 
-	0xc638, 0xc638, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc5f7, 0xbdf7, 0xbdf7, 0xbdf7, 0xb5b6, 0x5acb, 0x630c, 0x7bcf, 
-	0x632c, 0xb596, 0xbdd7, 0xbdd7, 0xbdd7, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb596, 0xb596, 0x9cf3, 0x528a, 0x4228, 
-	0x630c, 0x9cd3, 0xad75, 0xad75, 0xad75, 0xad75, 0xad75, 0xad75, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xa514, 
-	0x2965, 0x4208, 0x630c, 0x8c51, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0x94b2, 
-	0x4208, 0x7bcf, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x2124, 0x4208, 0x630c, 0x7bef, 0x9cf3, 0xbdd7, 0xffff, 
-	0xffff, 0xc618, 0xa514, 0x8410, 0x632c, 0x4228, 0x2945, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x738e, 0x4208, 0xef7d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0x8c71, 0x632c, 0x2124, 0x5acb, 0xc638, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0x8c71, 0x7bcf, 0x20e3, 0x2104, 0x7bef, 0x7bcf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0x8430, 0x736d, 0x9492, 0x7bef, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xa514, 0x9471, 0x9cf3, 0x8c71, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0x9cd3, 0xad55, 0x83ef, 0x8410, 
-	0xa514, 0xb596, 0xad75, 0xf79e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xe73c, 0x9cf3, 
-	0xbdf7, 0x83ef, 0x83ef, 0x7bef, 0xb575, 0x9cd3, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0x9492, 0x8c51, 0x6b6d, 
-	0x6b4d, 0x83ef, 0xa514, 0xad55, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xd69a, 0x9492, 0xa514, 0x7bef, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x9492, 0x73ae, 0x6b6d, 0x6b4d, 
-	0xe71c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x738e, 0x528a, 0x6b6d, 
-	0x4228, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x73ae, 
-	0x528a, 0x528a, 0x31a6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0x4208, 0x6b6d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x2945, 0x4228, 0x632c, 0x8410, 0xa514, 0xc618, 0xffff, 
-	0xffff, 0xce79, 0xa534, 0x8430, 0x6b4d, 0x4a49, 0x2965, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x528a, 0x39e7, 0xf79e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xad55, 0x528a, 0x39c7, 0x5aeb, 0x31a6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0x528a, 0x528a, 0x2965, 0x738e, 0xce79, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x9492, 0x7bef, 0x4228, 0x8c71, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xad75, 0x9cd3, 0x630c, 0xa514, 0xc618, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xbdd7, 0xad75, 0x7bef, 0xa514, 
-	0xa534, 0xce59, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf79e, 
-	0x9cd3, 0xa534, 0x7bef, 0x7bef, 0xb596, 0xce59, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x8c71, 0xa514, 0x6b4d, 
-	0x7bef, 0xa534, 0xa534, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x9492, 0x9cf3, 0x9cd3, 0xbdd7, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xa534, 0x8410, 0x5acb, 0x6b4d, 0xdedb, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x8c51, 0x630c, 0x10a2, 0x73ae, 
-	0x9cd3, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x9492, 0x5aeb, 
-	0x0000, 0x6b4d, 0x7bef, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xad55, 0x630c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x2965, 0x4a49, 0x6b4d, 0x8430, 0xa534, 0xce79, 0xffff, 
-	0xffff, 0xd6ba, 0xad55, 0x8c51, 0x6b6d, 0x4a69, 0x3186, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0020, 0x632c, 0xb596, 0xffff, 0xffff, 0xffff, 0xffff, 0xe71c, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 
-	0x9cd3, 0x4a49, 0x39e7, 0x0000, 0x6b4d, 0x8c51, 0xffff, 0xffff, 0xffff, 0xffff, 0xdefb, 0xce79, 0xce79, 0xce79, 0xce79, 0xd6ba, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x52aa, 0x73ae, 0x738e, 0x528a, 0xffff, 0xffff, 0xffff, 0xffff, 0xf79e, 0xc638, 0xce59, 
-	0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0x8430, 0x8430, 0x4208, 0x7bcf, 0x6b4d, 0xffdf, 0xffff, 0xffff, 0xffff, 0xf7be, 
-	0xd69a, 0xd69a, 0xd69a, 0xd69a, 0xd69a, 0xd69a, 0xd69a, 0xd69a, 0xa514, 0x9cf3, 0x630c, 0x8410, 0x8430, 0xf7be, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xdedb, 0xdedb, 0xdedb, 0xdedb, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc638, 0xad75, 0x8c71, 0xad75, 
-	0xce79, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf79e, 0xdefb, 0xdefb, 0xe71c, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xb5b6, 0xb596, 0x7bcf, 0x9cf3, 0x94b2, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xa534, 0xad34, 0x7bef, 
-	0xa534, 0xa514, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf79e, 0x7bcf, 0xa534, 0x7bcf, 0xf7be, 0xffff, 0xffff, 
-	0xffff, 0xffdf, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce59, 0x94b2, 0x8430, 0x39e7, 0x8410, 0x8430, 0xce59, 
-	0xce59, 0xc638, 0xce38, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc638, 0xc618, 0xc618, 0x7bef, 0x630c, 0x18c3, 0x4228, 0x4a49, 
-	0xef7d, 0xffff, 0xffff, 0xffff, 0xffdf, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdd7, 0xbdd7, 0xbdd7, 0xbdd7, 0x7bcf, 0x630c, 0x0841, 
-	0x18e3, 0x4a69, 0xdefb, 0xffff, 0xffff, 0xffff, 0xffff, 0xbdf7, 0xbdd7, 0xbdd7, 0xbdd7, 0xbdd7, 0xd6ba, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xd6ba, 0x5aeb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x3186, 0x4a69, 0x6b6d, 0x8c51, 0xad55, 0xdedb, 0xffff, 
-	0xffff, 0xe71c, 0xad75, 0x8c71, 0x738e, 0x52aa, 0x31a6, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x2965, 0x39c7, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0x18e3, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x39e7, 0x73ae, 0x632c, 
-	0x6b6d, 0x4208, 0x0000, 0x2945, 0x4208, 0xe73c, 0xffff, 0xffff, 0xffff, 0xffff, 0x31a6, 0x39c7, 0x39e7, 0x39e7, 0x39e7, 0x3186, 
-	0xdedb, 0xffff, 0xffff, 0xffff, 0xffff, 0x5acb, 0x73ae, 0x7bef, 0x94b2, 0xffff, 0xffff, 0xffff, 0xffff, 0x94b2, 0x4228, 0x4a49, 
-	0x4a69, 0x4a69, 0x5269, 0x528a, 0x528a, 0x52aa, 0xb596, 0x7bcf, 0x41e7, 0x9471, 0x94b2, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 
-	0x62eb, 0x632c, 0x6b4d, 0x6b4d, 0x6b6d, 0x6b6d, 0x6b6d, 0x738e, 0xb596, 0x9cf3, 0x62eb, 0x9cf3, 0x9cd3, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xdedb, 0x8c71, 0x9cf3, 0xa4f3, 0xa514, 0x8c51, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 0xb596, 0xad75, 0xb5b6, 0xad55, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xad75, 0xa534, 0xad55, 0xad55, 0xad55, 0x9cd3, 0xe71c, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xce59, 0xad75, 0x7bcf, 0xb596, 0xad55, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0xad75, 0xad34, 
-	0xa514, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x9cd3, 0x9cf3, 0x9492, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xc618, 0x5acb, 0x62eb, 0x5aeb, 0x5aeb, 0x5acb, 0x5acb, 0x5aaa, 0x52aa, 0x94b2, 0x94b2, 0x31a6, 0x9cf3, 0x73ae, 0x73ae, 
-	0x73ae, 0x7bcf, 0x5acb, 0xffff, 0xffff, 0xffff, 0xffff, 0xbdf7, 0x5acb, 0x6b4d, 0x6b4d, 0x632c, 0x18e3, 0x10a2, 0x73ae, 0x630c, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xb596, 0x18e3, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x738e, 0x7bef, 0x0000, 
-	0x632c, 0x4228, 0xffff, 0xffff, 0xffff, 0xffff, 0xc638, 0x10a2, 0x3186, 0x3186, 0x3186, 0x3186, 0x39c7, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xdedb, 0x5acb, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c3, 0x31a6, 0x52aa, 0x738e, 0x8c71, 0xad75, 0xe71c, 0xffff, 
-	0xffff, 0xef7d, 0xb596, 0x94b2, 0x73ae, 0x5acb, 0x39c7, 0x18e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x2104, 0x4a49, 0xef7d, 0xffff, 0xffff, 0xffff, 0xffff, 0xbdf7, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x73ae, 0x39c7, 0x6b4d, 
-	0x0000, 0x0000, 0x0000, 0x6b4d, 0x4a69, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x0841, 0x7bae, 0x8c71, 0x8c71, 0x8c71, 0xa514, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xf79e, 0x4a69, 0x73ae, 0x5acb, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0x4228, 0x73ae, 0xad55, 
-	0xad75, 0xad75, 0xad75, 0xad75, 0x738e, 0x630c, 0x8430, 0x39e7, 0x4a69, 0x83ef, 0xdedb, 0xffff, 0xffff, 0xffff, 0xffff, 0x738e, 
-	0x8410, 0xbdd7, 0xbdd7, 0xbdd7, 0xbdd7, 0xbdd7, 0x9492, 0x738e, 0xa4f3, 0x5aeb, 0x630c, 0x9cd3, 0xd6ba, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xa514, 0xad55, 0x6b4d, 0x6b6d, 0x9cd3, 0x9492, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x9492, 0xc638, 0x9cd3, 0xf79e, 
-	0xffff, 0xffff, 0xffff, 0xffdf, 0x9cd3, 0xb596, 0x8c30, 0x7bef, 0x7bef, 0x7bef, 0xb596, 0xb596, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xce79, 0xad75, 0x8410, 0xa534, 0xdefb, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xe71c, 0x7bef, 0xa4f3, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x7bcf, 0x9cf3, 0x94b2, 0xd69a, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0x7bef, 0x738e, 0xb5b6, 0xb5b6, 0xb596, 0xb596, 0xb596, 0x8c51, 0x528a, 0x9492, 0x39c7, 0x31a6, 0x3186, 0x3186, 0x3186, 
-	0x2965, 0x8430, 0xad55, 0xffff, 0xffff, 0xffff, 0xffff, 0x6b6d, 0x7bef, 0x18e3, 0x18c3, 0x18c3, 0x18a2, 0x18e3, 0x6b6d, 0xbdd7, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0x52aa, 0x39e7, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x6b4d, 0x18c3, 0x738e, 0x0020, 0x0000, 
-	0x6b4d, 0xa514, 0xffff, 0xffff, 0xffff, 0xffff, 0x632c, 0x39e7, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0xce79, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xa514, 0x632c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18e3, 0x39c7, 0x5acb, 0x73ae, 0x94b2, 0xb596, 0xef7d, 0xffff, 
-	0xffff, 0xf7be, 0xb5b6, 0x9cd3, 0x7bef, 0x5aeb, 0x4208, 0x2104, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x6b6d, 0x9cd3, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdedb, 0x31a6, 
-	0x4228, 0x0000, 0x0020, 0x632c, 0xad75, 0xffff, 0xffff, 0xffff, 0xffff, 0x632c, 0xbdd7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0x7bcf, 0x7bef, 0x7bcf, 0x630c, 0xffff, 0xffff, 0xffff, 0xffff, 0xc638, 0x8c51, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xad75, 0x6b6d, 0x7bae, 0x39c7, 0x39e7, 0x8430, 0x6b4d, 0xffff, 0xffff, 0xffff, 0xffff, 0xe71c, 0x8c51, 
-	0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xce38, 0x7bef, 0x94b2, 0x5acb, 0x5acb, 0x9492, 0x7bef, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xf7be, 0x8c71, 0x8c51, 0x6b4d, 0x738e, 0xad55, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xd69a, 0xad75, 0xb596, 0xa534, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xc618, 0xad75, 0x7bef, 0x7bcf, 0x7bcf, 0x7bcf, 0x7bcf, 0xb575, 0xb596, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xbdf7, 0xad75, 0xad55, 0x9492, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0xef7d, 0xffff, 0xffff, 0xffff, 0xffdf, 0xa514, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xe71c, 0xffff, 0xffff, 0xffff, 0xffff, 0xdefb, 0x8c71, 0x9cf3, 0x73ae, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xef7d, 0x8410, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xce59, 0x6b2c, 0x8c51, 0x39c7, 0x31a6, 0x31a6, 0x3186, 0x3186, 0x3165, 
-	0x52aa, 0x630c, 0xf79e, 0xffff, 0xffff, 0xffff, 0xef7d, 0x630c, 0x4208, 0x18e3, 0x18c3, 0x18c3, 0x10a2, 0x630c, 0x4208, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xef5d, 0x528a, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 0xbdf7, 0x31a6, 0x6b4d, 0x0000, 0x0000, 0x39e7, 
-	0x39c7, 0xf7be, 0xffff, 0xffff, 0xffff, 0xf7be, 0x52aa, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xe73c, 0x3186, 0x632c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x2104, 0x4208, 0x5aeb, 0x7bef, 0x9cd3, 0xb5b6, 0xf7be, 0xffff, 
-	0xffff, 0xffff, 0xbdf7, 0x9cf3, 0x8410, 0x630c, 0x4228, 0x2945, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x630c, 0x31a6, 0xd6ba, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x8410, 
-	0x630c, 0x0000, 0x4a69, 0x3186, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xdefb, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffdf, 0x7bef, 0x6b4d, 0x39c7, 0x73ae, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xdedb, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0x9cd3, 0x73ae, 0x6b4d, 0x39a6, 0x39c7, 0x39c7, 0x8c71, 0xad75, 0xffff, 0xffff, 0xffff, 0xffff, 0xe71c, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xbdd7, 0x8410, 0x8c51, 0x5aaa, 0x5acb, 0x5acb, 0x9cf3, 0xad75, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xc618, 0xa534, 0x6b2c, 0x73ae, 0xad55, 0x94b2, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0x9471, 0xad55, 0xad55, 0xc638, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xa514, 0xad55, 0x7bcf, 0x7bcf, 0x7bcf, 0x7bcf, 0x8c51, 0xa534, 0xd6ba, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0x9cd3, 0xad55, 0xad75, 0xc5f7, 0xffff, 0xffff, 0xffff, 0xffff, 0xc638, 0xce59, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xad75, 0xdedb, 0xffff, 0xffff, 0xffff, 0xffff, 0x9cd3, 0x9cd3, 0x9cd3, 0xad55, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xe73c, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xbdf7, 0x6b6d, 0x7bef, 0x39c7, 0x39a6, 0x31a6, 0x31a6, 0x3186, 0x3186, 0x2965, 
-	0x8410, 0x73ae, 0xffff, 0xffff, 0xffff, 0xffff, 0xa514, 0x7bef, 0x18e3, 0x18e3, 0x18c3, 0x18c3, 0x10a2, 0x73ae, 0x8410, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xdedb, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xad55, 0x39e7, 0x5acb, 0x0000, 0x0000, 0x0000, 0x6b4d, 
-	0x630c, 0xffff, 0xffff, 0xffff, 0xffff, 0xe73c, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0xa534, 
-	0x2965, 0x7bef, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x2945, 0x4228, 0x630c, 0x8410, 0x9cf3, 0xbdf7, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xce59, 0xa534, 0x8430, 0x6b4d, 0x4a69, 0x2965, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x738e, 0x39c7, 0x7bef, 0xa534, 0xad55, 0xad55, 0xad55, 0xad55, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xd69a, 
-	0x630c, 0x0841, 0x6b4d, 0x738e, 0xffff, 0xffff, 0xffff, 0xffff, 0xef5d, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 
-	0xc638, 0x8c71, 0x4a49, 0x73ae, 0x31a6, 0x5aeb, 0x4a49, 0xffdf, 0xffff, 0xffff, 0xffff, 0xf7be, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 
-	0xd6ba, 0x8410, 0x7bef, 0x5acb, 0x31a6, 0x31a6, 0x39c7, 0x630c, 0x6b4d, 0xf79e, 0xffff, 0xffff, 0xffff, 0xffff, 0xdedb, 0xdedb, 
-	0xdedb, 0xdedb, 0xdedb, 0xa534, 0x8c51, 0x7bef, 0x52aa, 0x52aa, 0x5aaa, 0x6b4d, 0x8c51, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0x8c51, 0xad75, 0x9cd3, 0x9cd3, 0xa534, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0x9cf3, 0xb596, 0x738e, 0xad55, 0xd69a, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xbdd7, 0xb575, 0x7bcf, 0x7bae, 0x7bae, 0x9492, 0xad55, 0xb596, 0xffff, 0xffff, 0xffff, 0xffff, 0xef5d, 
-	0xa4f3, 0xa514, 0x9492, 0xf79e, 0xffff, 0xffff, 0xffff, 0xffff, 0x8c71, 0xad75, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xb596, 0x7bae, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0x73ae, 0x9cd3, 0x8430, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xdedb, 0xdedb, 0xdedb, 0xdedb, 0xdedb, 0xa534, 0x73ae, 0x73ae, 0x39c7, 0x39c7, 0x31a6, 0x31a6, 0x3186, 0x3186, 0x3165, 0x3186, 
-	0x7bef, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0x5acb, 0x738e, 0x18e3, 0x18c3, 0x18c3, 0x18c3, 0x3186, 0x5acb, 0xdefb, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0x8c71, 0x4a49, 0x4a69, 0x0000, 0x0000, 0x0000, 0x0861, 0x5aeb, 
-	0xc638, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x73ae, 0x4a69, 0x31a6, 0x6b4d, 
-	0x632c, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x2965, 0x4a69, 0x6b4d, 0x8430, 0xa534, 0xce59, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xdedb, 0xad55, 0x8c71, 0x6b6d, 0x528a, 0x31a6, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0861, 0x52aa, 0x52aa, 0x7bef, 0x4208, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x0841, 0xffdf, 0xffff, 0xffff, 0xffff, 0xe73c, 
-	0x4a49, 0x31a6, 0x528a, 0xd69a, 0xffff, 0xffff, 0xffff, 0xffff, 0x39e7, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b6d, 0x6b6d, 0x6b6d, 
-	0x6b4d, 0x6b6d, 0x5aeb, 0x10a2, 0x10a2, 0x7bcf, 0x7bef, 0xffff, 0xffff, 0xffff, 0xffff, 0xa534, 0x2124, 0x2945, 0x2945, 0x2945, 
-	0x2965, 0x528a, 0x9492, 0x8430, 0x8430, 0x8430, 0xad75, 0x94b2, 0x7bef, 0xffff, 0xffff, 0xffff, 0xffff, 0xc638, 0x4228, 0x4a28, 
-	0x4a49, 0x4a49, 0x4a69, 0x630c, 0xa514, 0x94b2, 0x9cd3, 0x9cd3, 0xbdd7, 0xad55, 0x8430, 0xffff, 0xffff, 0xffff, 0xffff, 0xe73c, 
-	0x73ae, 0x9492, 0x9cd3, 0xdedb, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xbdb6, 0xa534, 0x7bef, 0x738e, 0xad55, 0xce79, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xf7be, 0x94b2, 0xad55, 0xad75, 0xad55, 0x9cb2, 0xc638, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x9cf3, 
-	0xb575, 0xad55, 0x9cf3, 0xffff, 0xffff, 0xffff, 0xffff, 0xe73c, 0x9492, 0x8c71, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xb5b6, 0x6b6d, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x9cd3, 0x9cd3, 0x8410, 0xffff, 0xffff, 0xffff, 0xffff, 0xd69a, 
-	0x4a28, 0x4228, 0x4228, 0x4208, 0x4208, 0x528a, 0x9cd3, 0x8c51, 0x8c51, 0x8c51, 0xad55, 0x528a, 0x3186, 0x3186, 0x2965, 0x6b4d, 
-	0x5acb, 0xffff, 0xffff, 0xffff, 0xffff, 0xdedb, 0x6b6d, 0x2965, 0x18e3, 0x18c3, 0x18c3, 0x10a2, 0x738e, 0x5269, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xce59, 0x0841, 0x0020, 0x0020, 0x0000, 0x0000, 0x10a2, 0x7bcf, 0x632c, 0x632c, 0x632c, 0x8c71, 0x8410, 0x31a6, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xdefb, 0x2945, 0xdefb, 0xffff, 0xffff, 0xffff, 0xffff, 0xe73c, 0x2945, 0xa534, 0x39c7, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x31a6, 0x528a, 0x6b6d, 0x8c71, 0xad55, 0xdedb, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xe73c, 0xb596, 0x9492, 0x73ae, 0x5acb, 0x39c7, 0x18e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 
-	0x528a, 0x8c51, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xb596, 
-	0x632c, 0x632c, 0x39e7, 0xffff, 0xffff, 0xffff, 0xffff, 0xd69a, 0x5acb, 0x18c3, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0861, 
-	0x0861, 0x1082, 0x1082, 0x10a2, 0x2945, 0x632c, 0xd6ba, 0xffff, 0xffff, 0xffff, 0xffff, 0xdedb, 0xc638, 0xc638, 0xc638, 0xc638, 
-	0xc638, 0xce38, 0xce59, 0xce59, 0xc638, 0x52aa, 0x8430, 0x8430, 0xce38, 0xffff, 0xffff, 0xffff, 0xffff, 0xe71c, 0xce79, 0xce79, 
-	0xce79, 0xce79, 0xce79, 0xd69a, 0xd69a, 0xd69a, 0xd69a, 0x738e, 0x9cd3, 0x9cd3, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xef7d, 
-	0xdefb, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x9cd3, 0x8c51, 0x6b6d, 0x6b6d, 0xad75, 0xb596, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xdefb, 0xdedb, 0xdedb, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xbdf7, 0xad55, 
-	0x8410, 0xa534, 0xd6ba, 0xffff, 0xffff, 0xffff, 0xffff, 0xad75, 0xc638, 0x8410, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xbdb6, 
-	0x9cd3, 0x8430, 0xef7d, 0xffff, 0xffff, 0xffff, 0xffff, 0x8410, 0x9cd3, 0x9cd3, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xe73c, 
-	0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce59, 0xce59, 0xce59, 0x632c, 0x8c51, 0x3186, 0x3186, 0x3186, 0x2965, 0x8410, 
-	0x8c71, 0xffff, 0xffff, 0xffff, 0xffff, 0x8c51, 0x7bef, 0x18e3, 0x18e3, 0x18c3, 0x18c3, 0x18a2, 0x73ae, 0xa534, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xe71c, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdd7, 0xbdd7, 0xbdd7, 0xbdd7, 0xbdd7, 0x39e7, 0x6b6d, 0x6b4d, 0x8430, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0x7bef, 0x73ae, 0x39c7, 0xce59, 0xffff, 0xffff, 0xffff, 0xffff, 0xe73c, 0x39c7, 0x738e, 0x0020, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18e3, 0x39c7, 0x5acb, 0x73ae, 0x9492, 0xb596, 0xe73c, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xf7be, 0xb5b6, 0x9cd3, 0x7bef, 0x5aeb, 0x4208, 0x2124, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4a69, 
-	0x94b2, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x4228, 
-	0x738e, 0x6b4d, 0x94b2, 0xffff, 0xffff, 0xffff, 0xffff, 0x738e, 0x6b6d, 0x0000, 0x0000, 0x0020, 0x0020, 0x0841, 0x0841, 0x0861, 
-	0x0861, 0x1082, 0x1082, 0x10a2, 0x6b6d, 0x4a69, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0x9492, 0x8c71, 0x7bef, 0x5aeb, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x9cb2, 0x8c51, 0x7bcf, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xad55, 0x9cf3, 0x9471, 0x6b4d, 0x6b4d, 0x6b6d, 0xa514, 0x8c51, 0xf79e, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xbdf7, 0x9cf3, 0x8c71, 
-	0xa514, 0x8430, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x8430, 0xa514, 0x9cb2, 0xe73c, 0xffff, 0xffff, 0xffff, 0xbdd7, 0x9471, 
-	0xce59, 0x9471, 0xffff, 0xffff, 0xffff, 0xffff, 0xe73c, 0x8430, 0x94b2, 0x73ae, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x83ef, 0x4a49, 0x3186, 0x3186, 0x3165, 0x39e7, 0x738e, 
-	0xdefb, 0xffff, 0xffff, 0xffff, 0xffff, 0x528a, 0x630c, 0x18e3, 0x18c3, 0x18c3, 0x18a2, 0x4a69, 0x4228, 0xf7be, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xad55, 0x5acb, 0x4208, 0x4228, 0xe73c, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0x3186, 0x528a, 0x6b6d, 0x4208, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xef5d, 0x39c7, 0x738e, 
-	0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x2124, 0x4208, 0x5aeb, 0x7bef, 0x9cd3, 0xb5b6, 0xf7be, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xbdf7, 0xa514, 0x8410, 0x632c, 0x4a49, 0x2945, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x4a49, 0x6b6d, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x7bcf, 0x738e, 
-	0x4a49, 0x39c7, 0xef7d, 0xffff, 0xffff, 0xffff, 0xffdf, 0x31a6, 0x4a69, 0x0000, 0x0000, 0x0020, 0x0020, 0x0841, 0x0841, 0x0861, 
-	0x0861, 0x1061, 0x1082, 0x1082, 0x73ae, 0x9cf3, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0x9cf3, 0x73ae, 0x5acb, 0x8c51, 0x94b2, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xbdd7, 0x8410, 0x7bcf, 0x9cd3, 0x94b2, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xc638, 0x8430, 0xad75, 0x8410, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b6d, 0xb5b6, 0x8c71, 
-	0xe73c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xe73c, 0x9cd3, 0xad55, 0x8c51, 0x6b6d, 
-	0xad55, 0xb596, 0xffff, 0xffff, 0xffff, 0xffff, 0xce79, 0xa534, 0x6b4d, 0xa514, 0xc638, 0xffff, 0xffff, 0xbdf7, 0x8c71, 0x8c51, 
-	0xa514, 0xce79, 0xffff, 0xffff, 0xffff, 0xffff, 0xa534, 0x9cd3, 0x9cd3, 0x94b2, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xbdf7, 0x6b6d, 0x6b4d, 0x3186, 0x3186, 0x3186, 0x2965, 0x7bae, 0x5aeb, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x73ae, 0x2104, 0x18e3, 0x18c3, 0x18c3, 0x10a2, 0x73ae, 0x6b6d, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb596, 0x4208, 0x4228, 0x632c, 0x4a49, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xc618, 0x5acb, 0x0841, 0x0000, 0x5acb, 0x4a69, 0x9cd3, 0xffff, 0xffff, 0xffff, 0xffff, 0xef5d, 0x39c7, 
-	0x738e, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x2945, 0x4a49, 0x632c, 0x8410, 0xa514, 0xbdf7, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xd69a, 0xa534, 0x8c51, 0x6b6d, 0x4a69, 0x3186, 0x10a2, 0x0000, 0x0000, 0x0000, 0x31a6, 0x2965, 0x9cf3, 
-	0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xa514, 0x4a69, 0x6b4d, 0x2945, 
-	0x6b4d, 0x3186, 0xad55, 0xad55, 0xad55, 0xad55, 0x8410, 0x632c, 0x0020, 0x0000, 0x0000, 0x0020, 0x0020, 0x0820, 0x0841, 0x0841, 
-	0x0861, 0x0861, 0x1082, 0x4208, 0x4228, 0xa514, 0xb596, 0xb596, 0xb596, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 
-	0xbdd7, 0xbdd7, 0x8430, 0x8410, 0x4a69, 0x4a49, 0x738e, 0xa514, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xc5f7, 0xc618, 0xc618, 
-	0xc618, 0xc618, 0xc618, 0xc618, 0xa514, 0x8c71, 0x6b6d, 0x5acb, 0x9471, 0xa514, 0xc638, 0xc638, 0xc638, 0xce38, 0xce59, 0xce59, 
-	0xc638, 0xbdf7, 0xad55, 0x9492, 0x8c51, 0xa534, 0xa514, 0x6b4d, 0x632c, 0x632c, 0x6b2c, 0x6b4d, 0x6b4d, 0x6b4d, 0x738e, 0xad75, 
-	0x9cd3, 0x94b2, 0xb596, 0xc618, 0xce59, 0xce79, 0xce79, 0xce79, 0xce59, 0xbdb6, 0x94b2, 0x9cf3, 0xad55, 0x73ae, 0x6b6d, 0x8410, 
-	0x9471, 0xbdd7, 0xce79, 0xce79, 0xce79, 0xce79, 0x8c51, 0xa534, 0x632c, 0xa514, 0x9492, 0xce59, 0xb596, 0x8c71, 0x8410, 0x9cd3, 
-	0x738e, 0xc638, 0xce38, 0xc638, 0xc638, 0xc638, 0x738e, 0x9492, 0x8c71, 0xa514, 0xc638, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 
-	0xc618, 0xc618, 0xc5f7, 0xbdf7, 0xbdf7, 0xbdf7, 0x9cf3, 0x7bcf, 0x630c, 0x31a6, 0x3186, 0x3186, 0x3165, 0x2965, 0x7bef, 0x73ae, 
-	0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0x5aeb, 0x7bcf, 0x18e3, 0x18c3, 0x18c3, 0x18c3, 0x2104, 0x6b4d, 0x8410, 0xb596, 0xad75, 0xad75, 
-	0xad75, 0xad75, 0xad75, 0xad75, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0x8430, 0x52aa, 0x39c7, 0x0000, 0x632c, 0x632c, 0xad55, 
-	0xad55, 0xad55, 0xad55, 0x4a69, 0x632c, 0x0000, 0x0000, 0x0000, 0x4228, 0x5acb, 0x73ae, 0xad55, 0xad55, 0xad55, 0xad55, 0x9cd3, 
-	0x1082, 0x738e, 0x0841, 0x0000, 0x0000, 0x0000, 0x10a2, 0x3186, 0x4a69, 0x6b6d, 0x8c51, 0xa534, 0xd69a, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xe71c, 0xad75, 0x9492, 0x738e, 0x52aa, 0x39c7, 0x18e3, 0x0000, 0x0000, 0x0000, 0x8c51, 0x632c, 0x632c, 
-	0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x630c, 0x630c, 0x1082, 0x0000, 
-	0x8c71, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x5aeb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0841, 0x0841, 
-	0x0861, 0x0861, 0x1082, 0x73ae, 0x738e, 0x738e, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x7bcf, 0x7bcf, 0x7bcf, 0x7bef, 0x7bef, 0x7bef, 
-	0x7bef, 0x8410, 0x7bef, 0x39c7, 0x3186, 0x7bcf, 0x8c51, 0x8430, 0x8430, 0x8c51, 0x8c51, 0x8c51, 0x8c51, 0x8c71, 0x8c71, 0x8c71, 
-	0x8c71, 0x9471, 0x9492, 0x9492, 0x9492, 0x5acb, 0x4a69, 0x83ef, 0xa514, 0x94b2, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 
-	0x9cd3, 0x9cf3, 0x9cf3, 0x9cf3, 0x83ef, 0x630c, 0x630c, 0x630c, 0x630c, 0x632c, 0x632c, 0x632c, 0x6b2c, 0x6b2c, 0x6b4d, 0x6b4d, 
-	0x7bef, 0xa514, 0xa534, 0xa514, 0xa534, 0xa534, 0xa534, 0xa534, 0xa534, 0xa534, 0xa514, 0x7bae, 0x6b4d, 0x6b4d, 0x6b4d, 0xa534, 
-	0xa534, 0xa534, 0xa534, 0xa534, 0xa514, 0xa514, 0xad55, 0x7bef, 0x630c, 0x94b2, 0xa514, 0xa4f3, 0xa514, 0x8430, 0x5aeb, 0xad75, 
-	0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0xad55, 0x8c51, 0x9cf3, 0x94b2, 0x9492, 0x9492, 0x9492, 0x9492, 0x9471, 0x8c71, 
-	0x8c71, 0x8c71, 0x8c71, 0x8c51, 0x8c51, 0x8c51, 0x8430, 0x4a49, 0x31a6, 0x3186, 0x3186, 0x3186, 0x2965, 0x4208, 0x9cf3, 0x7bef, 
-	0x7bef, 0x7bef, 0x7bef, 0x7bcf, 0x8430, 0x4228, 0x18e3, 0x18c3, 0x18c3, 0x10a2, 0x52aa, 0x7bef, 0x738e, 0x738e, 0x6b6d, 0x6b6d, 
-	0x6b6d, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x18e3, 0x0000, 0x3186, 0x7bef, 0x632c, 0x632c, 
-	0x632c, 0x632c, 0x632c, 0x6b6d, 0x31a6, 0x0000, 0x0000, 0x0000, 0x0000, 0x3186, 0x738e, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 
-	0x632c, 0x6b6d, 0x8c51, 0x0000, 0x0000, 0x0000, 0x18e3, 0x39c7, 0x52aa, 0x738e, 0x9492, 0xad75, 0xe71c, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xf79e, 0xb5b6, 0x9cd3, 0x7bcf, 0x5aeb, 0x4208, 0x2104, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0841, 0x0841, 
-	0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x10a2, 0x10a2, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x20e3, 0x2104, 0x2104, 0x2124, 0x2124, 
-	0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x31a6, 0x31a6, 0x39a6, 0x39c7, 0x39c7, 0x39e7, 0x39e7, 0x41e7, 0x4208, 
-	0x4208, 0x4228, 0x4228, 0x4a28, 0x4a49, 0x4a49, 0x4a69, 0x4a69, 0x4a69, 0x528a, 0x528a, 0x528a, 0x52aa, 0x52aa, 0x5aaa, 0x5acb, 
-	0x5acb, 0x5acb, 0x5acb, 0x5aeb, 0x5aeb, 0x62eb, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x632c, 0x632c, 0x632c, 0x6b2c, 0x6b2c, 
-	0x6b2c, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b2c, 
-	0x6b2c, 0x6b2c, 0x632c, 0x632c, 0x632c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x62eb, 0x5aeb, 0x5aeb, 0x5acb, 0x5acb, 0x5acb, 
-	0x5acb, 0x5aaa, 0x52aa, 0x52aa, 0x528a, 0x528a, 0x528a, 0x4a69, 0x4a69, 0x4a69, 0x4a49, 0x4a49, 0x4a28, 0x4228, 0x4228, 0x4208, 
-	0x4208, 0x41e7, 0x39e7, 0x39e7, 0x39c7, 0x39c7, 0x39a6, 0x31a6, 0x31a6, 0x3186, 0x3186, 0x2965, 0x2965, 0x2945, 0x2945, 0x2945, 
-	0x2124, 0x2124, 0x2104, 0x2104, 0x20e3, 0x18e3, 0x18e3, 0x18c3, 0x18c3, 0x10a2, 0x10a2, 0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 
-	0x0841, 0x0841, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x2104, 0x4208, 0x5aeb, 0x7bcf, 0x9cd3, 0xb5b6, 0xf79e, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffdf, 0xbdf7, 0x9cf3, 0x8410, 0x632c, 0x4a49, 0x2945, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0841, 
-	0x0841, 0x0861, 0x0861, 0x1082, 0x1082, 0x10a2, 0x10a2, 0x18a2, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x2104, 0x2104, 0x2104, 0x2124, 
-	0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x3165, 0x3186, 0x3186, 0x31a6, 0x31a6, 0x39c7, 0x39c7, 0x39c7, 0x39e7, 0x39e7, 0x4208, 
-	0x4208, 0x4208, 0x4228, 0x4228, 0x4a28, 0x4a49, 0x4a49, 0x4a69, 0x4a69, 0x5269, 0x528a, 0x528a, 0x528a, 0x52aa, 0x52aa, 0x52aa, 
-	0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5aeb, 0x5aeb, 0x5aeb, 0x62eb, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x632c, 0x632c, 0x632c, 
-	0x632c, 0x632c, 0x6b2c, 0x6b2c, 0x6b2c, 0x6b2c, 0x6b2c, 0x6b2c, 0x6b2c, 0x6b2c, 0x6b2c, 0x6b2c, 0x6b2c, 0x6b2c, 0x632c, 0x632c, 
-	0x632c, 0x632c, 0x632c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x62eb, 0x5aeb, 0x5aeb, 0x5aeb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 
-	0x52aa, 0x52aa, 0x52aa, 0x528a, 0x528a, 0x528a, 0x5269, 0x4a69, 0x4a69, 0x4a49, 0x4a49, 0x4a28, 0x4228, 0x4228, 0x4208, 0x4208, 
-	0x4208, 0x39e7, 0x39e7, 0x39c7, 0x39c7, 0x39c7, 0x31a6, 0x31a6, 0x3186, 0x3186, 0x3165, 0x2965, 0x2965, 0x2945, 0x2945, 0x2124, 
-	0x2124, 0x2104, 0x2104, 0x2104, 0x18e3, 0x18e3, 0x18c3, 0x18c3, 0x18a2, 0x10a2, 0x10a2, 0x1082, 0x1082, 0x0861, 0x0861, 0x0841, 
-	0x0841, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x2945, 0x4a49, 0x632c, 0x8410, 0x9cf3, 0xbdf7, 0xffdf, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xd69a, 0xa534, 0x8c51, 0x6b6d, 0x528a, 0x3186, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0841, 
-	0x0841, 0x0861, 0x0861, 0x1061, 0x1082, 0x1082, 0x10a2, 0x10a2, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x20e3, 0x2104, 0x2104, 0x2124, 
-	0x2124, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x31a6, 0x31a6, 0x39c7, 0x39c7, 0x39c7, 0x39e7, 0x39e7, 
-	0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4a28, 0x4a49, 0x4a49, 0x4a69, 0x4a69, 0x4a69, 0x528a, 0x528a, 0x528a, 0x52aa, 0x52aa, 
-	0x52aa, 0x5aaa, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5aeb, 0x5aeb, 0x5aeb, 0x62eb, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 
-	0x630c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x630c, 
-	0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x62eb, 0x5aeb, 0x5aeb, 0x5aeb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5aaa, 0x52aa, 
-	0x52aa, 0x52aa, 0x528a, 0x528a, 0x528a, 0x4a69, 0x4a69, 0x4a69, 0x4a49, 0x4a49, 0x4a28, 0x4228, 0x4228, 0x4208, 0x4208, 0x4208, 
-	0x39e7, 0x39e7, 0x39c7, 0x39c7, 0x39c7, 0x31a6, 0x31a6, 0x3186, 0x3186, 0x3186, 0x2965, 0x2965, 0x2945, 0x2945, 0x2945, 0x2124, 
-	0x2124, 0x2104, 0x2104, 0x20e3, 0x18e3, 0x18e3, 0x18c3, 0x18c3, 0x10a2, 0x10a2, 0x1082, 0x1082, 0x1061, 0x0861, 0x0861, 0x0841, 
-	0x0841, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x3186, 0x528a, 0x6b6d, 0x8c51, 0xa534, 0xd69a, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xe73c, 0xad75, 0x9492, 0x73ae, 0x5acb, 0x39e7, 0x18e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 
-	0x0841, 0x0841, 0x0861, 0x0861, 0x1082, 0x1082, 0x10a2, 0x10a2, 0x18a2, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x2104, 0x2104, 0x2104, 
-	0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x3165, 0x3186, 0x3186, 0x31a6, 0x31a6, 0x39a6, 0x39c7, 0x39c7, 0x39e7, 0x39e7, 
-	0x41e7, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4a49, 0x4a49, 0x4a49, 0x4a69, 0x4a69, 0x4a69, 0x528a, 0x528a, 0x528a, 0x528a, 
-	0x52aa, 0x52aa, 0x5aaa, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5aeb, 0x5aeb, 0x5aeb, 0x5aeb, 0x62eb, 0x62eb, 0x630c, 0x630c, 0x630c, 
-	0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 
-	0x630c, 0x630c, 0x630c, 0x62eb, 0x62eb, 0x5aeb, 0x5aeb, 0x5aeb, 0x5aeb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5aaa, 0x52aa, 0x52aa, 
-	0x528a, 0x528a, 0x528a, 0x528a, 0x4a69, 0x4a69, 0x4a69, 0x4a49, 0x4a49, 0x4a49, 0x4228, 0x4228, 0x4208, 0x4208, 0x4208, 0x41e7, 
-	0x39e7, 0x39e7, 0x39c7, 0x39c7, 0x39a6, 0x31a6, 0x31a6, 0x3186, 0x3186, 0x3165, 0x2965, 0x2965, 0x2945, 0x2945, 0x2124, 0x2124, 
-	0x2104, 0x2104, 0x2104, 0x18e3, 0x18e3, 0x18c3, 0x18c3, 0x18a2, 0x10a2, 0x10a2, 0x1082, 0x1082, 0x0861, 0x0861, 0x0841, 0x0841, 
-	0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18e3, 0x39e7, 0x5acb, 0x73ae, 0x9492, 0xad75, 0xe73c, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0xbdd7, 0x9cd3, 0x7bef, 0x630c, 0x4228, 0x2124, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 
-	0x0841, 0x0841, 0x0861, 0x0861, 0x1061, 0x1082, 0x1082, 0x10a2, 0x10a2, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x18e3, 0x2104, 0x2104, 
-	0x2124, 0x2124, 0x2924, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x31a6, 0x31a6, 0x39a6, 0x39c7, 0x39c7, 0x39e7, 
-	0x39e7, 0x41e7, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4a49, 0x4a49, 0x4a49, 0x4a69, 0x4a69, 0x4a69, 0x5269, 0x528a, 0x528a, 
-	0x528a, 0x52aa, 0x52aa, 0x52aa, 0x5aaa, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5aeb, 0x5aeb, 0x5aeb, 0x5aeb, 0x62eb, 0x62eb, 
-	0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 
-	0x62eb, 0x62eb, 0x5aeb, 0x5aeb, 0x5aeb, 0x5aeb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5aaa, 0x52aa, 0x52aa, 0x52aa, 0x528a, 
-	0x528a, 0x528a, 0x5269, 0x4a69, 0x4a69, 0x4a69, 0x4a49, 0x4a49, 0x4a49, 0x4228, 0x4228, 0x4208, 0x4208, 0x4208, 0x41e7, 0x39e7, 
-	0x39e7, 0x39c7, 0x39c7, 0x39a6, 0x31a6, 0x31a6, 0x3186, 0x3186, 0x3186, 0x2965, 0x2965, 0x2945, 0x2945, 0x2924, 0x2124, 0x2124, 
-	0x2104, 0x2104, 0x18e3, 0x18e3, 0x18e3, 0x18c3, 0x18c3, 0x10a2, 0x10a2, 0x1082, 0x1082, 0x1061, 0x0861, 0x0861, 0x0841, 0x0841, 
-	0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x2124, 0x4228, 0x630c, 0x7bef, 0x9cd3, 0xbdd7, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc638, 0xa534, 0x8430, 0x6b4d, 0x4a69, 0x3186, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 
-	0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x1082, 0x1082, 0x10a2, 0x10a2, 0x10a2, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x2104, 0x2104, 
-	0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x31a6, 0x31a6, 0x39c7, 0x39c7, 0x39c7, 
-	0x39e7, 0x39e7, 0x41e7, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4a28, 0x4a49, 0x4a49, 0x4a49, 0x4a69, 0x4a69, 0x5269, 0x528a, 
-	0x528a, 0x528a, 0x528a, 0x52aa, 0x52aa, 0x52aa, 0x5aaa, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5aeb, 0x5aeb, 0x5aeb, 0x5aeb, 
-	0x5aeb, 0x5aeb, 0x62eb, 0x62eb, 0x62eb, 0x62eb, 0x62eb, 0x62eb, 0x62eb, 0x62eb, 0x62eb, 0x62eb, 0x62eb, 0x62eb, 0x5aeb, 0x5aeb, 
-	0x5aeb, 0x5aeb, 0x5aeb, 0x5aeb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5aaa, 0x52aa, 0x52aa, 0x52aa, 0x528a, 0x528a, 0x528a, 
-	0x528a, 0x5269, 0x4a69, 0x4a69, 0x4a49, 0x4a49, 0x4a49, 0x4a28, 0x4228, 0x4228, 0x4208, 0x4208, 0x4208, 0x41e7, 0x39e7, 0x39e7, 
-	0x39c7, 0x39c7, 0x39c7, 0x31a6, 0x31a6, 0x3186, 0x3186, 0x3186, 0x2965, 0x2965, 0x2945, 0x2945, 0x2945, 0x2124, 0x2124, 0x2104, 
-	0x2104, 0x2104, 0x18e3, 0x18e3, 0x18c3, 0x18c3, 0x10a2, 0x10a2, 0x10a2, 0x1082, 0x1082, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 
-	0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x3186, 0x4a69, 0x6b4d, 0x8430, 0xa534, 0xc638, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdefb, 0xad75, 0x9492, 0x738e, 0x52aa, 0x39c7, 0x18e3, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 
-	0x0020, 0x0841, 0x0841, 0x0861, 0x0861, 0x1061, 0x1082, 0x1082, 0x10a2, 0x10a2, 0x18c3, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x2104, 
-	0x2104, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x31a6, 0x31a6, 0x39c7, 0x39c7, 
-	0x39c7, 0x39e7, 0x39e7, 0x41e7, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4a28, 0x4a49, 0x4a49, 0x4a49, 0x4a69, 0x4a69, 0x5269, 
-	0x528a, 0x528a, 0x528a, 0x528a, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x5aaa, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 
-	0x5aeb, 0x5aeb, 0x5aeb, 0x5aeb, 0x5aeb, 0x5aeb, 0x5aeb, 0x5aeb, 0x5aeb, 0x5aeb, 0x5aeb, 0x5aeb, 0x5aeb, 0x5aeb, 0x5aeb, 0x5aeb, 
-	0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5aaa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x528a, 0x528a, 0x528a, 0x528a, 
-	0x5269, 0x4a69, 0x4a69, 0x4a49, 0x4a49, 0x4a49, 0x4a28, 0x4228, 0x4228, 0x4208, 0x4208, 0x4208, 0x41e7, 0x39e7, 0x39e7, 0x39c7, 
-	0x39c7, 0x39c7, 0x31a6, 0x31a6, 0x3186, 0x3186, 0x3186, 0x2965, 0x2965, 0x2965, 0x2945, 0x2945, 0x2124, 0x2124, 0x2124, 0x2104, 
-	0x2104, 0x18e3, 0x18e3, 0x18c3, 0x18c3, 0x18c3, 0x10a2, 0x10a2, 0x1082, 0x1082, 0x1061, 0x0861, 0x0861, 0x0841, 0x0841, 0x0020, 
-	0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x18e3, 0x39c7, 0x52aa, 0x738e, 0x9492, 0xad75, 0xdefb, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf79e, 0xb5b6, 0x9cd3, 0x7bef, 0x630c, 0x4208, 0x2124, 0x0841, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 
-	0x0020, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x1082, 0x1082, 0x10a2, 0x10a2, 0x10a2, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x20e3, 
-	0x2104, 0x2104, 0x2124, 0x2124, 0x2924, 0x2945, 0x2945, 0x2965, 0x2965, 0x3165, 0x3186, 0x3186, 0x31a6, 0x31a6, 0x31a6, 0x39c7, 
-	0x39c7, 0x39c7, 0x39e7, 0x39e7, 0x41e7, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4a28, 0x4a49, 0x4a49, 0x4a49, 0x4a69, 0x4a69, 
-	0x4a69, 0x5269, 0x528a, 0x528a, 0x528a, 0x528a, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x5aaa, 0x5aaa, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 
-	0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 
-	0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5aaa, 0x5aaa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x528a, 0x528a, 0x528a, 0x528a, 0x5269, 0x4a69, 
-	0x4a69, 0x4a69, 0x4a49, 0x4a49, 0x4a49, 0x4a28, 0x4228, 0x4228, 0x4208, 0x4208, 0x4208, 0x41e7, 0x39e7, 0x39e7, 0x39c7, 0x39c7, 
-	0x39c7, 0x31a6, 0x31a6, 0x31a6, 0x3186, 0x3186, 0x3165, 0x2965, 0x2965, 0x2945, 0x2945, 0x2924, 0x2124, 0x2124, 0x2104, 0x2104, 
-	0x20e3, 0x18e3, 0x18e3, 0x18c3, 0x18c3, 0x10a2, 0x10a2, 0x10a2, 0x1082, 0x1082, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0020, 
-	0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0841, 0x2124, 0x4208, 0x630c, 0x7bef, 0x9cd3, 0xb5b6, 0xf79e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0xa514, 0x8430, 0x6b4d, 0x4a69, 0x3186, 0x10a2, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0020, 0x0020, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x10a2, 0x10a2, 0x18c3, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 
-	0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x3165, 0x3186, 0x3186, 0x31a6, 0x31a6, 0x39a6, 
-	0x39c7, 0x39c7, 0x39c7, 0x39e7, 0x39e7, 0x41e7, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4a28, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 
-	0x4a69, 0x4a69, 0x4a69, 0x5269, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x5aaa, 0x5aaa, 0x5acb, 
-	0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 
-	0x5acb, 0x5aaa, 0x5aaa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x5269, 0x4a69, 0x4a69, 0x4a69, 
-	0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a28, 0x4228, 0x4228, 0x4208, 0x4208, 0x4208, 0x41e7, 0x39e7, 0x39e7, 0x39c7, 0x39c7, 0x39c7, 
-	0x39a6, 0x31a6, 0x31a6, 0x3186, 0x3186, 0x3165, 0x2965, 0x2965, 0x2945, 0x2945, 0x2945, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 
-	0x18e3, 0x18e3, 0x18c3, 0x18c3, 0x18c3, 0x10a2, 0x10a2, 0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0020, 0x0020, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x10a2, 0x3186, 0x4a69, 0x6b4d, 0x8430, 0xa514, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdedb, 0xad75, 0x8c71, 0x738e, 0x52aa, 0x39c7, 0x18e3, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0861, 0x0861, 0x1082, 0x1082, 0x1082, 0x10a2, 0x10a2, 0x18c3, 0x18c3, 0x18c3, 0x18e3, 
-	0x18e3, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x31a6, 0x31a6, 
-	0x39a6, 0x39c7, 0x39c7, 0x39c7, 0x39e7, 0x39e7, 0x41e7, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4228, 0x4a28, 0x4a49, 0x4a49, 
-	0x4a49, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x5269, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 
-	0x52aa, 0x5aaa, 0x5aaa, 0x5aaa, 0x5aaa, 0x5aaa, 0x5aaa, 0x5acb, 0x5acb, 0x5aaa, 0x5aaa, 0x5aaa, 0x5aaa, 0x5aaa, 0x5aaa, 0x52aa, 
-	0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x5269, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a49, 
-	0x4a49, 0x4a49, 0x4a28, 0x4228, 0x4228, 0x4228, 0x4208, 0x4208, 0x4208, 0x41e7, 0x39e7, 0x39e7, 0x39c7, 0x39c7, 0x39c7, 0x39a6, 
-	0x31a6, 0x31a6, 0x3186, 0x3186, 0x3186, 0x2965, 0x2965, 0x2945, 0x2945, 0x2945, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x18e3, 
-	0x18e3, 0x18c3, 0x18c3, 0x18c3, 0x10a2, 0x10a2, 0x1082, 0x1082, 0x1082, 0x0861, 0x0861, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x18e3, 0x39c7, 0x52aa, 0x738e, 0x8c71, 0xad75, 0xdefb, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf79e, 0xb5b6, 0x9cd3, 0x7bef, 0x630c, 0x4228, 0x2945, 0x0861, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0020, 0x0020, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x10a2, 0x10a2, 0x10a2, 0x18c3, 0x18c3, 0x18e3, 
-	0x18e3, 0x20e3, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x31a6, 
-	0x31a6, 0x39a6, 0x39c7, 0x39c7, 0x39c7, 0x39e7, 0x39e7, 0x41e7, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4228, 0x4a28, 0x4a49, 
-	0x4a49, 0x4a49, 0x4a49, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x5269, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x52aa, 
-	0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 
-	0x52aa, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x5269, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a49, 0x4a49, 0x4a49, 
-	0x4a49, 0x4a28, 0x4228, 0x4228, 0x4228, 0x4208, 0x4208, 0x4208, 0x41e7, 0x39e7, 0x39e7, 0x39c7, 0x39c7, 0x39c7, 0x39a6, 0x31a6, 
-	0x31a6, 0x3186, 0x3186, 0x3186, 0x2965, 0x2965, 0x2945, 0x2945, 0x2945, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x20e3, 0x18e3, 
-	0x18e3, 0x18c3, 0x18c3, 0x10a2, 0x10a2, 0x10a2, 0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0020, 0x0020, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0861, 0x2945, 0x4228, 0x630c, 0x7bef, 0x9cd3, 0xb5b6, 0xf79e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc638, 0xa534, 0x8430, 0x6b4d, 0x4a69, 0x3186, 0x10a2, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0861, 0x0861, 0x1061, 0x1082, 0x1082, 0x10a2, 0x10a2, 0x18c3, 0x18c3, 0x18c3, 
-	0x18e3, 0x18e3, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2924, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 
-	0x31a6, 0x31a6, 0x39a6, 0x39c7, 0x39c7, 0x39c7, 0x39e7, 0x39e7, 0x39e7, 0x4208, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4228, 
-	0x4a28, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x5269, 0x5269, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 
-	0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 
-	0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x5269, 0x5269, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a28, 
-	0x4228, 0x4228, 0x4228, 0x4208, 0x4208, 0x4208, 0x4208, 0x39e7, 0x39e7, 0x39e7, 0x39c7, 0x39c7, 0x39c7, 0x39a6, 0x31a6, 0x31a6, 
-	0x3186, 0x3186, 0x3186, 0x2965, 0x2965, 0x2965, 0x2945, 0x2945, 0x2924, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x18e3, 0x18e3, 
-	0x18c3, 0x18c3, 0x18c3, 0x10a2, 0x10a2, 0x1082, 0x1082, 0x1061, 0x0861, 0x0861, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x10a2, 0x3186, 0x4a69, 0x6b4d, 0x8430, 0xa534, 0xc638, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdefb, 0xad75, 0x9492, 0x73ae, 0x5acb, 0x39e7, 0x2104, 0x0020, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x1082, 0x1082, 0x1082, 0x10a2, 0x10a2, 0x18c3, 0x18c3, 
-	0x18c3, 0x18e3, 0x18e3, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2924, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 
-	0x3186, 0x31a6, 0x31a6, 0x31a6, 0x39c7, 0x39c7, 0x39c7, 0x39e7, 0x39e7, 0x39e7, 0x41e7, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 
-	0x4228, 0x4228, 0x4a28, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x5269, 0x5269, 0x528a, 0x528a, 
-	0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 
-	0x528a, 0x528a, 0x5269, 0x5269, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a28, 0x4228, 0x4228, 
-	0x4228, 0x4228, 0x4208, 0x4208, 0x4208, 0x41e7, 0x39e7, 0x39e7, 0x39e7, 0x39c7, 0x39c7, 0x39c7, 0x31a6, 0x31a6, 0x31a6, 0x3186, 
-	0x3186, 0x3186, 0x2965, 0x2965, 0x2965, 0x2945, 0x2945, 0x2924, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x18e3, 0x18e3, 0x18c3, 
-	0x18c3, 0x18c3, 0x10a2, 0x10a2, 0x1082, 0x1082, 0x1082, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0020, 0x2104, 0x39e7, 0x5acb, 0x73ae, 0x9492, 0xad75, 0xe71c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0xbdd7, 0x9cf3, 0x8410, 0x632c, 0x4a49, 0x2965, 0x1082, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0020, 0x1082, 0x18a2, 0x2124, 0x2945, 0x39a6, 0x39c7, 0x4228, 0x4a69, 0x4a49, 0x18e3, 0x1082, 0x10a2, 0x10a2, 0x10a2, 0x18c3, 
-	0x18e3, 0x8430, 0x4208, 0x8410, 0xc638, 0xe71c, 0xbdd7, 0x6b4d, 0x528a, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186, 
-	0x3186, 0x3186, 0x31a6, 0x31a6, 0x31a6, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39e7, 0x39e7, 0x41e7, 0x4208, 0x4a49, 0x5269, 0x52aa, 
-	0x5aeb, 0x630c, 0x6b4d, 0x6b6d, 0x7bcf, 0x7bcf, 0x6b4d, 0x4a49, 0x4a49, 0x4a49, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 
-	0x4a69, 0x5269, 0x5269, 0x5269, 0x5269, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x5269, 0x5269, 0x5269, 0x5269, 0x4a69, 
-	0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a28, 0x4228, 0x4228, 0x4228, 0x4228, 
-	0x4208, 0x4208, 0x4208, 0x4208, 0x41e7, 0x39e7, 0x39e7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x31a6, 0x31a6, 0x31a6, 0x3186, 0x3186, 
-	0x3186, 0x2965, 0x2965, 0x2965, 0x2945, 0x2945, 0x2945, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x18e3, 0x18e3, 0x18e3, 0x18c3, 
-	0x18c3, 0x10a2, 0x10a2, 0x10a2, 0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x1082, 0x2965, 0x4a49, 0x632c, 0x8410, 0x9cf3, 0xbdd7, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xce79, 0xa534, 0x8c51, 0x6b6d, 0x528a, 0x31a6, 0x18e3, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x8430, 0xb5b6, 0xc618, 0xce79, 0xce79, 0xdefb, 0xdefb, 0xef7d, 0xef7d, 0xffdf, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xe71c, 0xc638, 0xdedb, 0x4228, 0x1082, 0x1082, 0x10a2, 0x10a2, 0x18a2, 
-	0x6b4d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0x3186, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 
-	0x3186, 0x738e, 0xb596, 0xce59, 0xd69a, 0xd6ba, 0xdefb, 0xe73c, 0xef5d, 0xf79e, 0xf79e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xd6ba, 0xef5d, 0xbdf7, 0x5269, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a69, 0x528a, 
-	0x73ae, 0x9cf3, 0xbdb6, 0xce79, 0xdefb, 0xdedb, 0xce59, 0xad55, 0x7bef, 0x528a, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 
-	0x4a69, 0x4a69, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a69, 0x738e, 0x9cd3, 0xb5b6, 0xce79, 0xdefb, 0xd6ba, 0xc638, 0xa514, 
-	0x738e, 0x4208, 0x41e7, 0x39e7, 0x39e7, 0x39e7, 0x39c7, 0x39c7, 0x39c7, 0x4a28, 0xc618, 0xd69a, 0xe71c, 0xad55, 0x4a69, 0x3186, 
-	0x2965, 0x2965, 0x2965, 0x31a6, 0x8430, 0x9cd3, 0x9cd3, 0x3186, 0x2104, 0x2104, 0x2104, 0x18e3, 0x18e3, 0x18e3, 0x18c3, 0x18c3, 
-	0x18a2, 0x10a2, 0x10a2, 0x7bef, 0x528a, 0x5acb, 0x1082, 0x0861, 0x0841, 0x0841, 0x0020, 0x0841, 0xad75, 0xa514, 0xa534, 0xa514, 
-	0xad55, 0xad55, 0xad55, 0xad55, 0xbdd7, 0xbdd7, 0xbdd7, 0xbdd7, 0xc638, 0xce79, 0xa534, 0x2104, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x18e3, 0x31a6, 0x528a, 0x6b6d, 0x8c51, 0xa534, 0xce79, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef5d, 0xb596, 0x94b2, 0x7bcf, 0x5aeb, 0x4208, 0x2124, 0x0841, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0xa534, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xce59, 0x10a2, 0x1082, 0x1082, 0x1082, 0x10a2, 0x10a2, 
-	0xce79, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x6b4d, 0x2124, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 
-	0x39e7, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0x94b2, 0x4228, 0x4a28, 0x4a28, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x8410, 0xad75, 
-	0xe73c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf79e, 0xad75, 0x5aeb, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 
-	0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x8410, 0xad75, 0xe73c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xf79e, 0xa514, 0x4a69, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39a6, 0x31a6, 0xf7be, 0xffff, 0xffff, 0xffff, 0xef7d, 0x39a6, 
-	0x2965, 0x2965, 0x2945, 0x7bcf, 0xffff, 0xffff, 0xffff, 0xe73c, 0x738e, 0xc638, 0x2124, 0x18e3, 0x18e3, 0x18c3, 0x18c3, 0x18c3, 
-	0x10a2, 0x10a2, 0x2945, 0xffff, 0xffff, 0xffff, 0xbdf7, 0x4a69, 0x1082, 0x0841, 0x0020, 0x2965, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xa514, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0841, 0x2124, 0x4208, 0x5aeb, 0x7bcf, 0x94b2, 0xb596, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0xa514, 0x8430, 0x6b4d, 0x4a69, 0x3186, 0x10a2, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0xad75, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xef7d, 0xbdd7, 0x9cf3, 0x8c51, 0x7bef, 0x6b4d, 0x39c7, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x1082, 0x4a69, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xa534, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2965, 
-	0x39e7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xe71c, 
-	0xc618, 0xad75, 0xa534, 0x9cb2, 0x8410, 0x52aa, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a28, 0x4a28, 0x632c, 0xe73c, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x9492, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 
-	0x4a49, 0x4a49, 0x4a28, 0x4a28, 0x4228, 0x4228, 0x632c, 0xe73c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0x8410, 0x39c7, 0x39c7, 0x39c7, 0x31a6, 0x31a6, 0x4228, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0x31a6, 
-	0x2965, 0x2945, 0x2945, 0xc638, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x73ae, 0x18e3, 0x18c3, 0x18c3, 0x18c3, 0x10a2, 
-	0x10a2, 0x1082, 0x6b6d, 0xffff, 0xffff, 0xffff, 0x7bcf, 0xbdf7, 0x10a2, 0x0020, 0x0020, 0x632c, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef5d, 0x2104, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x10a2, 0x3186, 0x4a69, 0x6b4d, 0x8430, 0xa514, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdefb, 0xad75, 0x9492, 0x73ae, 0x5acb, 0x39e7, 0x2124, 
-	0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x39e7, 0x8c51, 0x6b4d, 0x8430, 0xa534, 0x8c71, 0x738e, 0x5acb, 0x528a, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0x9492, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x52aa, 
-	0xce79, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xe73c, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 
-	0x3186, 0x8c51, 0x94b2, 0x8410, 0xb596, 0xad75, 0x9cd3, 0x8430, 0x738e, 0xb596, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x5aeb, 
-	0x39e7, 0x39e7, 0x39e7, 0x41e7, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x7bcf, 0xf7be, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xe71c, 0x630c, 0x4a28, 0x4a28, 0x4a28, 
-	0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x7bef, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xdefb, 0x528a, 0x39a6, 0x31a6, 0x31a6, 0x31a6, 0x6b4d, 0xffff, 0xffff, 0xffff, 0xffff, 0xbdd7, 0x2945, 
-	0x2945, 0x2945, 0x39e7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xe71c, 0x18e3, 0x18c3, 0x18c3, 0x10a2, 0x10a2, 
-	0x10a2, 0x1082, 0xb596, 0xffff, 0xffff, 0xffff, 0xffff, 0xd69a, 0x0020, 0x0020, 0x0020, 0x8430, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xf7be, 0x9492, 0x8c51, 0x7bef, 0x73ae, 0x6b4d, 0x632c, 0x52aa, 0x528a, 0x39e7, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 
-	0x2124, 0x39e7, 0x5acb, 0x73ae, 0x9492, 0xad75, 0xdefb, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0xbdd7, 0x9cf3, 0x8410, 0x632c, 0x4a49, 0x3186, 
-	0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x528a, 0x738e, 0x8410, 0x8c71, 0x9cd3, 0x8430, 0x8410, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0x632c, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x1061, 0x2104, 0xf79e, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x4228, 0x2104, 0x2124, 0x2124, 0x2924, 0x2945, 
-	0x2945, 0x2945, 0x41e7, 0x8410, 0x8c71, 0x9cf3, 0xad55, 0xad55, 0x94b2, 0xce59, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0x4208, 
-	0x39c7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x41e7, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x5aeb, 0x7bef, 0xffdf, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xdefb, 0x7bef, 0x6b4d, 0x5acb, 0x7bcf, 0xa514, 0xf7be, 0xffff, 0xffff, 0x8c71, 0x4a69, 0x4228, 0x4228, 0x4228, 
-	0x4228, 0x4228, 0x4228, 0x5aeb, 0x8430, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdedb, 0x73ae, 0x630c, 0x52aa, 0x73ae, 0x9cf3, 
-	0xf7be, 0xffff, 0xffff, 0x7bef, 0x39e7, 0x31a6, 0x31a6, 0x3186, 0x3186, 0x94b2, 0xffdf, 0xffff, 0xffff, 0xffff, 0x6b4d, 0x2945, 
-	0x2945, 0x2924, 0x8430, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x6b6d, 0x18c3, 0x10a2, 0x10a2, 0x10a2, 
-	0x1082, 0x18c3, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 0x73ae, 0x0020, 0x0020, 0x0020, 0x6b4d, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffdf, 0xdedb, 0xc638, 0xc618, 0x9cf3, 0x632c, 0x5aeb, 0x52aa, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 
-	0x3186, 0x4a49, 0x632c, 0x8410, 0x9cf3, 0xbdd7, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xd69a, 0xad55, 0x8c71, 0x738e, 0x5acb, 0x39e7, 
-	0x2104, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4a69, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x94b2, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffdf, 0x5aeb, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x8430, 0x2104, 0x2104, 0x2124, 0x2124, 0x2924, 
-	0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xbdf7, 0x39c7, 
-	0x39c7, 0x39c7, 0x39c7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x41e7, 0x4208, 0x738e, 0x9492, 0xffdf, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xce79, 0x5acb, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0xc618, 0xffff, 0xffff, 0xad55, 0x94b2, 0x4208, 0x4208, 0x4208, 
-	0x4208, 0x4208, 0x73ae, 0x94b2, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xce59, 0x528a, 0x39e7, 0x39e7, 0x39c7, 0x39c7, 0x39c7, 
-	0xc618, 0xffff, 0xffff, 0x9cd3, 0x8c71, 0x31a6, 0x3186, 0x3186, 0x3186, 0xa534, 0xef7d, 0xffff, 0xffff, 0xf7be, 0x2965, 0x2945, 
-	0x2924, 0x2124, 0xce79, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdedb, 0x18c3, 0x10a2, 0x10a2, 0x1082, 
-	0x1082, 0x528a, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x2104, 0x0020, 0x0000, 0x2104, 0xf79e, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0x73ae, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x2104, 
-	0x39e7, 0x5acb, 0x738e, 0x8c71, 0xad55, 0xd6ba, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf79e, 0xb5b6, 0x9cd3, 0x8410, 0x632c, 0x4a49, 
-	0x2965, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bef, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0861, 0xd6ba, 0xffff, 
-	0xffff, 0xd6ba, 0xffff, 0xa514, 0x18c3, 0xe71c, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 
-	0x2124, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3165, 0x3186, 0xe73c, 0xffff, 0xffff, 0xffff, 0xffff, 0x8c51, 0x39a6, 
-	0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39e7, 0x39e7, 0x39e7, 0x738e, 0x9cd3, 0xffff, 0xffff, 0xffff, 0xffff, 0xc638, 
-	0x8410, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0xbdf7, 0xffff, 0xffff, 0xce59, 0x8c51, 0x4208, 0x4208, 0x4208, 
-	0x4208, 0x73ae, 0x9cf3, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x7bef, 0x39e7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 
-	0xc618, 0xffff, 0xffff, 0xbdf7, 0x8410, 0x3186, 0x3186, 0x3186, 0x41e7, 0xdefb, 0xffdf, 0xffff, 0xffff, 0xc618, 0x2945, 0x2124, 
-	0x2124, 0x3186, 0xf79e, 0xffff, 0xffff, 0xffff, 0xffff, 0xd6ba, 0xffff, 0xffff, 0xffff, 0xffff, 0x630c, 0x10a2, 0x1082, 0x1082, 
-	0x1082, 0x9cd3, 0xffff, 0xffff, 0xffff, 0xffff, 0xce59, 0x0020, 0x0020, 0x0000, 0x4a49, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0x31a6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x2965, 
-	0x4a49, 0x632c, 0x8410, 0x9cd3, 0xb5b6, 0xf79e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xce79, 0xad55, 0x8c71, 0x738e, 0x52aa, 
-	0x39c7, 0x2104, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0x8c71, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x39e7, 0x7bef, 0xffff, 
-	0xffdf, 0xad55, 0xffdf, 0x3186, 0x10a2, 0x94b2, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0x2945, 0x2104, 0x2104, 0x2104, 0x2124, 
-	0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x39e7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x52aa, 0x31a6, 
-	0x31a6, 0x31a6, 0x39a6, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x5acb, 0xa514, 0xf79e, 0xffff, 0xffff, 0xffff, 0xa514, 0x41e7, 
-	0x41e7, 0x41e7, 0x41e7, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0xce59, 0xffff, 0xffff, 0xef5d, 0x4208, 0x41e7, 0x41e7, 0x41e7, 
-	0x62eb, 0xa514, 0xf7be, 0xffff, 0xffff, 0xffff, 0x9cf3, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39a6, 0x31a6, 0x31a6, 
-	0xce79, 0xffff, 0xffff, 0xdefb, 0x3186, 0x3186, 0x3165, 0x2965, 0x5aeb, 0xd69a, 0xffff, 0xffff, 0xffff, 0x8c51, 0x2124, 0x2124, 
-	0x2124, 0x6b4d, 0xa514, 0xffff, 0xffff, 0xffff, 0xf79e, 0x3186, 0xf7be, 0xffff, 0xffff, 0xffff, 0xd69a, 0x10a2, 0x1082, 0x1082, 
-	0x0861, 0xdefb, 0xffff, 0xffff, 0xffff, 0xffff, 0x8410, 0x0020, 0x0000, 0x0000, 0x738e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x2104, 0x39c7, 
-	0x52aa, 0x738e, 0x8c71, 0xad55, 0xce79, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef7d, 0xb5b6, 0x9cd3, 0x7bef, 0x630c, 
-	0x4a49, 0x2965, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe71c, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0x4a69, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x10a2, 0xe71c, 0xd6ba, 0xffff, 
-	0x738e, 0xf79e, 0xad55, 0x1082, 0x10a2, 0x4228, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x73ae, 0x39e7, 0x31a6, 0x2104, 0x2104, 
-	0x2124, 0x2124, 0x2124, 0x2924, 0x2945, 0x2945, 0x2945, 0x2965, 0x632c, 0xffff, 0xffff, 0xffff, 0xffff, 0xef7d, 0x3186, 0x3186, 
-	0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x39a6, 0x39c7, 0x39c7, 0x4208, 0xc618, 0xdedb, 0xffff, 0xce79, 0xffff, 0xd69a, 0x39e7, 0x39e7, 
-	0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x4208, 0xf79e, 0xffff, 0xffff, 0xffff, 0x738e, 0x5acb, 0x39e7, 0x4a28, 
-	0xc618, 0xe71c, 0xffff, 0xce79, 0xffff, 0xce59, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39a6, 0x31a6, 0x31a6, 0x31a6, 0x39e7, 
-	0xf7be, 0xffff, 0xffff, 0xffff, 0x6b4d, 0x4a49, 0x2965, 0x2965, 0x9492, 0xc618, 0xffff, 0xffff, 0xffff, 0x52aa, 0x2124, 0x2124, 
-	0x2104, 0xa534, 0xf7be, 0xffff, 0xffff, 0xffff, 0xc618, 0x18c3, 0x8c71, 0xffff, 0xffff, 0xffff, 0xffff, 0x5acb, 0x1082, 0x0861, 
-	0x2124, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x39c7, 0x0000, 0x0000, 0x0000, 0x9cd3, 0xffff, 0xffff, 0xffff, 0xffff, 0xf79e, 
-	0x8c51, 0x9cd3, 0xad55, 0xbdd7, 0xce59, 0xdedb, 0xef5d, 0xffdf, 0xe71c, 0x4208, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x2965, 0x4a49, 
-	0x630c, 0x7bef, 0x9cd3, 0xb5b6, 0xef7d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xce59, 0xa534, 0x8c71, 0x738e, 
-	0x52aa, 0x39c7, 0x2104, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39c7, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x7bcf, 0xbdd7, 0xffdf, 0xffdf, 
-	0xf79e, 0xffff, 0x39c7, 0x1082, 0x1082, 0x8430, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef7d, 0x7bef, 0x39e7, 0x2104, 0x2104, 
-	0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0xad75, 0xffff, 0xffff, 0xffff, 0xffff, 0xbdf7, 0x3186, 0x3186, 
-	0x3186, 0x3186, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x9cf3, 0xc618, 0xffff, 0xf7be, 0xdedb, 0xffff, 0x630c, 0x39c7, 0x39c7, 
-	0x39c7, 0x39c7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x8c51, 0xef5d, 0xffff, 0xffff, 0xffff, 0xdedb, 0x52aa, 0x39c7, 0xad34, 
-	0xc618, 0xffff, 0xf7be, 0xdedb, 0xffff, 0x5aeb, 0x39c7, 0x39c7, 0x39a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x3186, 0x8c51, 
-	0xef5d, 0xffff, 0xffff, 0xffff, 0xdedb, 0x4208, 0x2965, 0x2945, 0x8c71, 0xf7be, 0xffff, 0xffff, 0xffff, 0x2965, 0x2104, 0x2104, 
-	0x2104, 0xe71c, 0xffff, 0xffff, 0xffff, 0xffff, 0x8c71, 0x18c3, 0x2124, 0xef7d, 0xffff, 0xffff, 0xffdf, 0x94b2, 0x0861, 0x0861, 
-	0x5aeb, 0xffff, 0xffff, 0xffff, 0xffff, 0xef7d, 0x0020, 0x0000, 0x0000, 0x0000, 0x9cf3, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x8c71, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x2104, 0x39c7, 0x52aa, 
-	0x738e, 0x8c71, 0xa534, 0xce59, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef7d, 0xb5b6, 0x9cd3, 0x7bef, 
-	0x632c, 0x4a49, 0x2965, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xe71c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0xbdd7, 0xce79, 0xffff, 0xad55, 
-	0xef7d, 0xef5d, 0x8c51, 0x73ae, 0x8430, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef7d, 0xd69a, 0xc638, 0x39e7, 
-	0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2924, 0x2945, 0xd69a, 0xffff, 0xffff, 0xffff, 0xffff, 0x9492, 0x3165, 0x3186, 
-	0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x31a6, 0x4a49, 0xef7d, 0xe71c, 0xffff, 0xffff, 0xffff, 0xbdf7, 0x39c7, 0x39c7, 0x39c7, 
-	0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39e7, 0xd6ba, 0x5aeb, 0xffff, 0xf79e, 0xffff, 0xe71c, 0x39c7, 0x528a, 0xef7d, 
-	0xe73c, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x39a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x3186, 0x3186, 0x3186, 0x39a6, 0xd69a, 
-	0x5acb, 0xffff, 0xef7d, 0xffff, 0xdedb, 0x2945, 0x2945, 0x4a28, 0xce59, 0xef5d, 0xffff, 0xffff, 0xdefb, 0x2104, 0x2104, 0x2104, 
-	0x31a6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x5acb, 0x10a2, 0x10a2, 0x7bef, 0xffff, 0xffff, 0xffff, 0x8c51, 0x39e7, 0x0861, 
-	0x94b2, 0xffff, 0xffff, 0xffff, 0xffff, 0xad75, 0x0000, 0x0000, 0x0000, 0x0020, 0xdedb, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf79e, 0xc618, 0x8410, 0x2965, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x2965, 0x4a49, 0x632c, 
-	0x7bef, 0x9cd3, 0xb5b6, 0xef7d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xce59, 0xa534, 0x8c71, 
-	0x738e, 0x52aa, 0x39e7, 0x2104, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xad55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8410, 0xef7d, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xe71c, 0xdedb, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x8c51, 0x4a49, 0x2104, 0x18e3, 
-	0x20e3, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2124, 0xd69a, 0xffff, 0xffff, 0xffff, 0xffff, 0x632c, 0x2965, 0x2965, 
-	0x2965, 0x3165, 0x3186, 0x3186, 0x3186, 0x3186, 0x7bcf, 0xf79e, 0xffff, 0xffff, 0xffff, 0xffff, 0x6b4d, 0x31a6, 0x31a6, 0x39a6, 
-	0x39a6, 0x39a6, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x94b2, 0x94b2, 0xa514, 0xffff, 0xad55, 0xffff, 0x8c71, 0x39c7, 0x8430, 0xf79e, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0x630c, 0x31a6, 0x31a6, 0x31a6, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x94b2, 0x8c51, 
-	0xa534, 0xffff, 0xa514, 0xffff, 0x7bef, 0x2945, 0x2945, 0x630c, 0xf79e, 0xffff, 0xffff, 0xffff, 0xbdd7, 0x2104, 0x2104, 0x20e3, 
-	0x5acb, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x2124, 0x10a2, 0x10a2, 0x18c3, 0xe73c, 0xffff, 0xffff, 0xc638, 0x6b4d, 0x10a2, 
-	0xce59, 0xffff, 0xffff, 0xffff, 0xffff, 0x73ae, 0x0000, 0x0000, 0x0000, 0x0020, 0xce79, 0xffff, 0xffff, 0xffff, 0xd6ba, 0xbdd7, 
-	0xb5b6, 0xad55, 0x8c71, 0x6b6d, 0x632c, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x2104, 0x39e7, 0x52aa, 0x738e, 
-	0x8c71, 0xa534, 0xce59, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef7d, 0xb5b6, 0x9cd3, 
-	0x8410, 0x632c, 0x4a49, 0x3186, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0x73ae, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0xf79e, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xd6ba, 0xad75, 0xe73c, 0xffff, 0xffff, 0xffff, 0xffff, 0x8c51, 0x18c3, 0x18c3, 0x18e3, 
-	0x18e3, 0x18e3, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0xd69a, 0xffff, 0xffff, 0xffff, 0xffff, 0x39c7, 0x2945, 0x2965, 
-	0x2965, 0x2965, 0x2965, 0x3165, 0x3186, 0x3186, 0x8410, 0xbdf7, 0xffff, 0xffff, 0xffff, 0xe71c, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 
-	0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x738e, 0xe71c, 0xc638, 0xffdf, 0xffff, 0xffdf, 0xe73c, 0x39e7, 0x31a6, 0x8c71, 0xbdf7, 
-	0xffff, 0xffff, 0xffff, 0xdedb, 0x31a6, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3165, 0x73ae, 0xe71c, 0xc618, 
-	0xffdf, 0xffff, 0xffdf, 0xdefb, 0x2965, 0x2945, 0x2124, 0x738e, 0xffff, 0xffff, 0xffff, 0xffff, 0xa514, 0x2104, 0x18e3, 0x18e3, 
-	0x8410, 0xffff, 0xffff, 0xffff, 0xffff, 0xe71c, 0x10a2, 0x10a2, 0x1082, 0x1082, 0x6b6d, 0xffff, 0xffff, 0xffff, 0x6b6d, 0x632c, 
-	0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0x39c7, 0x0000, 0x0000, 0x0000, 0x3186, 0xad75, 0xffff, 0xffff, 0xffff, 0x632c, 0x8410, 
-	0x7bef, 0x630c, 0x3186, 0x39c7, 0x2965, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x3186, 0x4a49, 0x632c, 0x8410, 
-	0x9cd3, 0xb5b6, 0xef7d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xce79, 0xad55, 
-	0x8c71, 0x73ae, 0x5acb, 0x39e7, 0x2124, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0xd69a, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0x39e7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8c51, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xc638, 0x9cd3, 0x8430, 0x39e7, 0x2104, 0x18c3, 0x1082, 0xce79, 0xffff, 0xffff, 0xffff, 0xffff, 0x9492, 0x18c3, 0x18c3, 0x18c3, 
-	0x18e3, 0x18e3, 0x18e3, 0x20e3, 0x2104, 0x2104, 0x2104, 0x6b4d, 0xf7be, 0xffff, 0xffff, 0xffff, 0xdefb, 0x2945, 0x2945, 0x2945, 
-	0x2945, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x62eb, 0xc638, 0xffff, 0xffff, 0xffff, 0x9cd3, 0x3186, 0x3186, 0x3186, 0x3186, 
-	0x3186, 0x31a6, 0x31a6, 0x31a6, 0x5acb, 0xdefb, 0xdefb, 0xffff, 0xffff, 0xffff, 0xffff, 0x7bcf, 0x31a6, 0x31a6, 0x6b4d, 0xc638, 
-	0xffff, 0xffff, 0xffff, 0x9492, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3165, 0x2965, 0x2965, 0x5acb, 0xdedb, 0xe71c, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0x6b4d, 0x2924, 0x2124, 0x2124, 0x7bef, 0xffff, 0xffff, 0xffff, 0xffff, 0x8c51, 0x18e3, 0x18e3, 0x18e3, 
-	0xad55, 0xffff, 0xffff, 0xffff, 0xffff, 0xbdf7, 0x10a2, 0x1082, 0x1082, 0x1082, 0x1082, 0xdedb, 0xffff, 0xffff, 0xce59, 0x632c, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0x0020, 0x0000, 0x0000, 0x0000, 0x5aeb, 0xb596, 0xffff, 0xa514, 0xdefb, 0x0020, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x2124, 0x39e7, 0x5acb, 0x73ae, 0x8c71, 
-	0xad55, 0xce79, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf79e, 0xb5b6, 
-	0x9cf3, 0x8410, 0x6b4d, 0x4a69, 0x31a6, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4a49, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c3, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xce79, 0xf7be, 0xd6ba, 0xa514, 0x7bef, 0x2124, 0x6b4d, 0xe73c, 0xffff, 0xffff, 0xffff, 0xffff, 0x9492, 0x10a2, 0x18c3, 0x18c3, 
-	0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x18e3, 0x2104, 0x2104, 0xbdd7, 0xffff, 0xffff, 0xffff, 0xffff, 0xb596, 0x2924, 0x2945, 0x2945, 
-	0x2945, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x5acb, 0xffff, 0xffff, 0xffff, 0xffff, 0xad55, 0x3186, 0x3186, 0x3186, 0x3186, 
-	0x3186, 0x3186, 0x3186, 0x630c, 0xf79e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xd69a, 0x3186, 0x3186, 0x3186, 0x630c, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xa514, 0x3186, 0x3165, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x630c, 0xf79e, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xc638, 0x2124, 0x2124, 0x2124, 0x2104, 0x8c71, 0xffff, 0xffff, 0xffff, 0xffff, 0x73ae, 0x18e3, 0x18c3, 0x18c3, 
-	0xc638, 0xffff, 0xffff, 0xffff, 0xffff, 0x9cd3, 0x1082, 0x1082, 0x1082, 0x0861, 0x0861, 0x5aeb, 0xffff, 0xffff, 0xffff, 0xd69a, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xc638, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b6d, 0x8c71, 0xffff, 0x8c51, 0x6b4d, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c3, 0x31a6, 0x4a69, 0x6b4d, 0x8410, 0x9cf3, 
-	0xb5b6, 0xf79e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xd6ba, 
-	0xad55, 0x9492, 0x73ae, 0x5aeb, 0x4208, 0x2945, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18e3, 0x6b6d, 0xe73c, 0xffff, 0xffff, 0xd69a, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9492, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xd69a, 
-	0x630c, 0x18e3, 0x0841, 0x0841, 0x0841, 0x0861, 0x2945, 0xa514, 0xffff, 0xffff, 0xffff, 0xffff, 0x9cf3, 0x10a2, 0x10a2, 0x18c3, 
-	0x18c3, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x73ae, 0x8c51, 0xffff, 0xffff, 0xffff, 0x8410, 0x2124, 0x2124, 0x2124, 
-	0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x9cf3, 0xffff, 0xffff, 0xffff, 0xffdf, 0x528a, 0x2965, 0x3165, 0x3165, 
-	0x3165, 0x3186, 0x738e, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x630c, 0x3186, 0x3186, 0x3186, 0x3186, 0xa534, 
-	0xffff, 0xffff, 0xffff, 0xf7be, 0x4a69, 0x2965, 0x2965, 0x2965, 0x2965, 0x2945, 0x73ae, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0x528a, 0x2124, 0x2124, 0x2104, 0x2104, 0xa514, 0xffff, 0xffff, 0xffff, 0xffff, 0x630c, 0x18c3, 0x18c3, 0x18c3, 
-	0xd6ba, 0xffff, 0xffff, 0xffff, 0xffff, 0x73ae, 0x1082, 0x1061, 0x0861, 0x0861, 0x0861, 0x0841, 0xce79, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xf79e, 0x9492, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xad75, 0xffff, 0x39c7, 0x0841, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x18c3, 0x2104, 0x3186, 0x3186, 0x3186, 0x3186, 0x39e7, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x2945, 0x4208, 0x5aeb, 0x73ae, 0x9492, 0xad55, 
-	0xd6ba, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 
-	0xbdd7, 0xa514, 0x8430, 0x6b6d, 0x528a, 0x39c7, 0x18e3, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31a6, 0x8c51, 0xef7d, 0xffff, 0xffff, 0x9cf3, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18e3, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xad75, 0x0020, 
-	0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x10a2, 0x632c, 0xffdf, 0xffff, 0xffff, 0xffff, 0x7bef, 0x10a2, 0x10a2, 0x10a2, 
-	0x10a2, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18e3, 0x2104, 0xa514, 0x8c51, 0xffff, 0xffff, 0xffff, 0x528a, 0x2104, 0x2124, 0x2124, 
-	0x2124, 0x2124, 0x2924, 0x2945, 0x2945, 0x2945, 0x2945, 0x2965, 0xe71c, 0xffff, 0xffff, 0xffff, 0xef7d, 0x632c, 0x2965, 0x2965, 
-	0x528a, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xbdf7, 0x31a6, 0x2965, 0x2965, 0x2965, 0x2965, 0x3186, 
-	0xe73c, 0xffff, 0xffff, 0xffff, 0xef5d, 0x5aeb, 0x2945, 0x2945, 0x5269, 0xc638, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xb5b6, 0x2924, 0x2104, 0x2104, 0x2104, 0x2104, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0x736d, 0x18c3, 0x18c3, 0x10a2, 
-	0xe71c, 0xef5d, 0xffff, 0xffff, 0xffff, 0x528a, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x52aa, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0x8430, 0x630c, 0x0000, 0x0000, 0x0000, 0x0000, 0x4a49, 0xad55, 0xffdf, 0x7bcf, 0x9492, 0xa534, 0xbdf7, 
-	0xd69a, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdefb, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x18e3, 0x39c7, 0x528a, 0x6b6d, 0x8430, 0xa514, 0xbdd7, 
-	0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xdefb, 0xad75, 0x94b2, 0x7bef, 0x630c, 0x4a49, 0x2965, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4a69, 0x8c71, 0xffff, 0xffff, 0xffff, 0x6b4d, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9cd3, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x4208, 0x0000, 
-	0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x7bef, 0xc638, 0xffff, 0xffff, 0xffff, 0x94b2, 0x1082, 0x1082, 0x10a2, 
-	0x10a2, 0x10a2, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x2965, 0x9cd3, 0xad55, 0xffff, 0xffff, 0xffdf, 0x2945, 0x2104, 0x2104, 0x2104, 
-	0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2924, 0x2945, 0x2945, 0x630c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xce79, 0xdefb, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xa534, 0x3186, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 
-	0x6b4d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xce79, 0xe71c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0x9cf3, 0x2124, 0x2104, 0x2104, 0x2104, 0x20e3, 0x18e3, 0xe73c, 0xffff, 0xffff, 0xffff, 0xffff, 0x528a, 0x18c3, 0x10a2, 0x10a2, 
-	0xef7d, 0xa534, 0xffff, 0xffff, 0xffff, 0x2945, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0020, 0x0841, 0xd6ba, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xc618, 0x8430, 0x3186, 0x0000, 0x0000, 0x0000, 0x0000, 0xa514, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xad55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x2965, 0x4a49, 0x630c, 0x7bef, 0x94b2, 0xad75, 0xe71c, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xc638, 0xa534, 0x8c51, 0x738e, 0x5acb, 0x39e7, 0x2124, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc638, 0xa534, 0xffff, 0xd69a, 0xad75, 0x3186, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x94b2, 0xffff, 0xffff, 0xffff, 0xffff, 0xdefb, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0841, 0x4208, 0xa514, 0xffff, 0xffff, 0xce59, 0xad75, 0x1082, 0x1082, 0x1082, 
-	0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x18c3, 0x18c3, 0x4208, 0xdedb, 0xd69a, 0xffff, 0xa514, 0xc5f7, 0x18e3, 0x2104, 0x2104, 0x2104, 
-	0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x7bae, 0xffdf, 0xffff, 0xdefb, 0xdefb, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef5d, 0x738e, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 
-	0x2945, 0x7bef, 0xffff, 0xffff, 0xdedb, 0xe71c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef5d, 0x632c, 
-	0x2104, 0x2104, 0x2104, 0x18e3, 0x18e3, 0x18e3, 0x2945, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x5acb, 0x10a2, 0x10a2, 0x10a2, 
-	0xce59, 0x8c71, 0xffff, 0xffff, 0xdefb, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x6b4d, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0x73ae, 0xad55, 0x0020, 0x0000, 0x0000, 0x0000, 0x39e7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf79e, 0xb5b6, 0x9cf3, 0x4a69, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x2124, 0x39e7, 0x5acb, 0x738e, 0x8c51, 0xa534, 0xc618, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xef5d, 0xb5b6, 0x9cd3, 0x8410, 0x6b4d, 0x4a69, 0x31a6, 0x18e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xc638, 0xffff, 0x4208, 0x94b2, 0x0020, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18e3, 0xa514, 0x9cf3, 0xffff, 0xffff, 0x632c, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x4228, 0x9cd3, 0xef7d, 0xffff, 0x9cd3, 0xb596, 0x0861, 0x1082, 0x1082, 
-	0x1082, 0x1082, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x39c7, 0xb5b6, 0xffff, 0xe71c, 0x2104, 0xa514, 0x18e3, 0x18e3, 0x18e3, 0x2104, 
-	0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2124, 0x4a69, 0xc638, 0xffff, 0xe73c, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xa534, 0x31a6, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 
-	0x2924, 0x2924, 0x528a, 0xce59, 0xffff, 0xe73c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0x9cf3, 0x2965, 0x2104, 
-	0x2104, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x9492, 0xffff, 0xffff, 0xffff, 0xffff, 0x62eb, 0x10a2, 0x1082, 0x1082, 
-	0x18c3, 0x4228, 0xe71c, 0x39c7, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0000, 0x18e3, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0x2124, 0x8430, 0x0000, 0x0000, 0x0000, 0x0000, 0x8430, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xf79e, 0xd69a, 0xb596, 0x94b2, 0x7bcf, 0x2104, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18e3, 0x31a6, 0x4a69, 0x6b4d, 0x8410, 0x9cd3, 0xb5b6, 0xef5d, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xd69a, 0xad55, 0x9492, 0x7bcf, 0x5aeb, 0x4228, 0x2965, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xad55, 0xffff, 0x632c, 0xad75, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3186, 0x52aa, 0xc638, 0xef7d, 0xb596, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x10a2, 0xce79, 0xffff, 0xffff, 0xffdf, 0x5aeb, 0x0861, 0x0861, 0x1061, 
-	0x1082, 0x1082, 0x1082, 0x10a2, 0x10a2, 0x10a2, 0x4228, 0xc618, 0xef7d, 0xffdf, 0x4208, 0x94b2, 0x18c3, 0x18e3, 0x18e3, 0x18e3, 
-	0x18e3, 0x18e3, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x4228, 0x8410, 0xb596, 0xce79, 
-	0xdefb, 0xe71c, 0xd69a, 0xa534, 0x4208, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 
-	0x2124, 0x2124, 0x2124, 0x2124, 0x4228, 0x8430, 0xb596, 0xce79, 0xdefb, 0xe71c, 0xd69a, 0xa514, 0x39c7, 0x2104, 0x18e3, 0x18e3, 
-	0x18e3, 0x18e3, 0x18e3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x2104, 0xbdf7, 0xb5b6, 0xffff, 0xb596, 0x10a2, 0x1082, 0x1082, 0x1082, 
-	0x1061, 0x1061, 0x18a2, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0861, 0xffff, 0xffff, 
-	0xffff, 0xb5b6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b6d, 0xf7be, 0xffff, 0xffff, 0xe71c, 0xc618, 0xa534, 0x8430, 
-	0x6b4d, 0x4a69, 0x2965, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x2965, 0x4228, 0x5aeb, 0x7bcf, 0x9492, 0xad55, 0xd69a, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffdf, 0xbdf7, 0xa514, 0x8c51, 0x738e, 0x52aa, 0x39e7, 0x2124, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8c51, 0xffff, 0xffff, 0x8c71, 0xa514, 0x39c7, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x0841, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x4208, 0xd69a, 0xffff, 0xffff, 0x632c, 0x0861, 0x0861, 0x0861, 
-	0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x10a2, 0x18c3, 0xef5d, 0xffff, 0xffff, 0x4a49, 0xd69a, 0x18c3, 0x18c3, 0x18c3, 0x18e3, 
-	0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 
-	0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 
-	0x2124, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 
-	0x18e3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18a2, 0x4a49, 0xef7d, 0xffff, 0xdedb, 0x18c3, 0x1082, 0x1082, 0x1082, 0x0861, 
-	0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0020, 0x738e, 0x94b2, 
-	0x2965, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x18e3, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x2124, 0x39e7, 0x52aa, 0x738e, 0x8c51, 0xa514, 0xbdf7, 0xffdf, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xe73c, 0xb596, 0x9cd3, 0x8410, 0x632c, 0x4a69, 0x31a6, 0x18e3, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c3, 0xffdf, 0xffff, 0xb5b6, 0x528a, 0x8410, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x73ae, 0xffff, 0xffff, 0x9cf3, 0x0841, 0x0841, 0x0861, 
-	0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x8430, 0xffff, 0xffff, 0x62eb, 0xbdf7, 0x3186, 0x18c3, 0x18c3, 0x18c3, 
-	0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x20e3, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 
-	0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 
-	0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x20e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18c3, 0x18c3, 
-	0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x3186, 0x6b6d, 0x4228, 0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 
-	0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x18e3, 0x31a6, 0x4a69, 0x632c, 0x8410, 0x9cd3, 0xb596, 0xe73c, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xce79, 0xad55, 0x9492, 0x7bcf, 0x630c, 0x4228, 0x2965, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2945, 0x5aeb, 0xad55, 0x0000, 0x52aa, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18e3, 0xffff, 0xe71c, 0xbdf7, 0x0841, 0x0841, 0x0841, 
-	0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1082, 0x1082, 0x18e3, 0x39e7, 0xa514, 0x6b4d, 0x39e7, 0x39e7, 0x10a2, 0x18a2, 0x18c3, 
-	0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x20e3, 0x20e3, 0x2104, 
-	0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 
-	0x2104, 0x20e3, 0x20e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 
-	0x18c3, 0x18a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 
-	0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x2965, 0x4228, 0x630c, 0x7bcf, 0x9492, 0xad55, 0xce79, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0xbdf7, 0xa514, 0x8c51, 0x738e, 0x5acb, 0x4208, 0x2124, 0x0861, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa514, 0x528a, 0x2124, 0x0841, 0x0841, 0x0841, 
-	0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 
-	0x10a2, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 
-	0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 
-	0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x10a2, 
-	0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 
-	0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0861, 0x2124, 0x4208, 0x5acb, 0x738e, 0x8c51, 0xa514, 0xbdf7, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xe73c, 0xb5b6, 0x9cd3, 0x8410, 0x6b4d, 0x528a, 0x39c7, 0x2104, 0x0841, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 
-	0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10a2, 0x10a2, 
-	0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x18a2, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 
-	0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 
-	0x18e3, 0x18e3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 
-	0x10a2, 0x10a2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 
-	0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0841, 0x2104, 0x39c7, 0x528a, 0x6b4d, 0x8410, 0x9cd3, 0xb5b6, 0xe73c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xd69a, 0xad75, 0x94b2, 0x7bef, 0x630c, 0x4a49, 0x3186, 0x18c3, 0x0020, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 
-	0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 
-	0x1082, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 
-	0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 
-	0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x1082, 
-	0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 
-	0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0020, 0x18c3, 0x3186, 0x4a49, 0x630c, 0x7bef, 0x94b2, 0xad75, 0xd69a, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xc618, 0xa534, 0x8c71, 0x73ae, 0x5aeb, 0x4228, 0x2965, 0x10a2, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 
-	0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1082, 0x1082, 
-	0x1082, 0x1082, 0x1082, 0x1082, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x18a2, 0x18c3, 0x18c3, 
-	0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 
-	0x18c3, 0x18c3, 0x18a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x1082, 0x1082, 0x1082, 0x1082, 
-	0x1082, 0x1082, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 
-	0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x10a2, 0x2965, 0x4228, 0x5aeb, 0x73ae, 0x8c71, 0xa534, 0xc618, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef7d, 0xbdd7, 0xa514, 0x8c51, 0x738e, 0x5acb, 0x4208, 0x2945, 0x1082, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 
-	0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 
-	0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 
-	0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 
-	0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x1082, 0x2945, 0x4208, 0x5acb, 0x738e, 0x8c51, 0xa514, 0xbdd7, 0xef7d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdefb, 0xb596, 0x9cd3, 0x8410, 0x6b4d, 0x528a, 0x39e7, 0x2124, 
-	0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 
-	0x0861, 0x0861, 0x0861, 0x1061, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10a2, 0x10a2, 0x10a2, 
-	0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 
-	0x10a2, 0x10a2, 0x10a2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1061, 0x0861, 0x0861, 0x0861, 
-	0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 
-	0x2124, 0x39e7, 0x528a, 0x6b4d, 0x8410, 0x9cd3, 0xb596, 0xe71c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xd69a, 0xad75, 0x94b2, 0x7bef, 0x632c, 0x4a69, 0x31a6, 
-	0x2104, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 
-	0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 
-	0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 
-	0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 
-	0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x2104, 
-	0x31a6, 0x4a69, 0x632c, 0x7bef, 0x94b2, 0xad75, 0xd69a, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xc638, 0xad55, 0x9492, 0x7bcf, 0x630c, 0x4a49, 
-	0x31a6, 0x18e3, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0820, 0x0841, 0x0841, 0x0841, 
-	0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1082, 0x1082, 0x1082, 
-	0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 
-	0x1082, 0x1082, 0x1082, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 
-	0x0841, 0x0841, 0x0841, 0x0820, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x18e3, 0x31a6, 
-	0x4a49, 0x630c, 0x7bcf, 0x9492, 0xad55, 0xc638, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0xbdf7, 0xa534, 0x8c71, 0x73ae, 0x5aeb, 
-	0x4228, 0x3186, 0x18c3, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 
-	0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 
-	0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 
-	0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 
-	0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x18c3, 0x3186, 0x4228, 
-	0x5aeb, 0x73ae, 0x8c71, 0xa534, 0xbdf7, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef5d, 0xb5b6, 0xa514, 0x8c51, 0x738e, 
-	0x5acb, 0x4228, 0x2965, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 
-	0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 
-	0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 
-	0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 
-	0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c3, 0x2965, 0x4228, 0x5acb, 
-	0x738e, 0x8c51, 0xa514, 0xb5b6, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xe71c, 0xb596, 0x9cf3, 0x8430, 
-	0x6b6d, 0x5acb, 0x4208, 0x2965, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 
-	0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 
-	0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 
-	0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 
-	0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x2965, 0x4208, 0x5acb, 0x6b6d, 
-	0x8430, 0x9cf3, 0xb596, 0xdefb, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdedb, 0xb596, 0x9cd3, 
-	0x8410, 0x6b6d, 0x52aa, 0x4208, 0x2945, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 
-	0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 
-	0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x2945, 0x4208, 0x52aa, 0x6b6d, 0x8410, 
-	0x9cd3, 0xb596, 0xd6ba, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xd69a, 0xad75, 
-	0x94b2, 0x8410, 0x6b4d, 0x52aa, 0x39e7, 0x2945, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 
-	0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 
-	0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x2945, 0x39e7, 0x52aa, 0x6b4d, 0x8410, 0x94b2, 
-	0xad75, 0xd69a, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xce59, 
-	0xad75, 0x94b2, 0x8410, 0x6b4d, 0x52aa, 0x39e7, 0x2945, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 
-	0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 
-	0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x2945, 0x39e7, 0x52aa, 0x6b4d, 0x8410, 0x94b2, 0xad75, 
-	0xce59, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 
-	0xc638, 0xad55, 0x94b2, 0x7bef, 0x6b4d, 0x528a, 0x39e7, 0x2945, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x2945, 0x39e7, 0x528a, 0x6b4d, 0x7bef, 0x94b2, 0xad55, 0xc638, 
-	0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffdf, 0xc638, 0xad55, 0x94b2, 0x7bef, 0x6b4d, 0x528a, 0x39e7, 0x2945, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x2945, 0x39e7, 0x528a, 0x6b4d, 0x7bef, 0x94b2, 0xad55, 0xc638, 0xffdf, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffdf, 0xc618, 0xad55, 0x9492, 0x7bef, 0x6b4d, 0x52aa, 0x39e7, 0x2945, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x2945, 0x39e7, 0x52aa, 0x6b4d, 0x7bef, 0x9492, 0xad55, 0xc618, 0xf7be, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xf7be, 0xc618, 0xad55, 0x94b2, 0x7bef, 0x6b4d, 0x52aa, 0x4208, 0x2965, 0x18c3, 0x0020, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0020, 0x18c3, 0x2965, 0x4208, 0x52aa, 0x6b4d, 0x7bef, 0x94b2, 0xad55, 0xc618, 0xf7be, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xf7be, 0xc618, 0xad55, 0x94b2, 0x8410, 0x6b4d, 0x52aa, 0x4208, 0x2965, 0x18c3, 0x0020, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0020, 0x18c3, 0x2965, 0x4208, 0x52aa, 0x6b4d, 0x8410, 0x94b2, 0xad55, 0xc618, 0xf7be, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0xc638, 0xad55, 0x94b2, 0x8410, 0x6b6d, 0x5acb, 0x4228, 0x3186, 0x18e3, 0x0841, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0841, 0x18e3, 0x3186, 0x4228, 0x5acb, 0x6b6d, 0x8410, 0x94b2, 0xad55, 0xc638, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xc638, 0xad75, 0x94b2, 0x8410, 0x6b6d, 0x5acb, 0x4228, 0x31a6, 0x2104, 0x0861, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0861, 0x2104, 0x31a6, 0x4228, 0x5acb, 0x6b6d, 0x8410, 0x94b2, 0xad75, 0xc638, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xce59, 0xad75, 0x9cd3, 0x8430, 0x738e, 0x5aeb, 0x4a49, 0x31a6, 0x2124, 
-	0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 
-	0x2124, 0x31a6, 0x4a49, 0x5aeb, 0x738e, 0x8430, 0x9cd3, 0xad75, 0xce59, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xd69a, 0xb596, 0x9cf3, 0x8c51, 0x73ae, 0x630c, 0x4a69, 0x39e7, 
-	0x2945, 0x10a2, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x10a2, 0x2945, 
-	0x39e7, 0x4a69, 0x630c, 0x73ae, 0x8c51, 0x9cf3, 0xb596, 0xce79, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdedb, 0xb596, 0xa514, 0x8c71, 0x7bcf, 0x632c, 0x528a, 
-	0x4208, 0x2965, 0x18c3, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x18c3, 0x2965, 0x4208, 
-	0x528a, 0x632c, 0x7bcf, 0x8c71, 0xa514, 0xb596, 0xd6ba, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xe71c, 0xb5b6, 0xa534, 0x9492, 0x7bef, 0x6b4d, 
-	0x5acb, 0x4228, 0x3186, 0x2104, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x2104, 0x3186, 0x4228, 0x5acb, 
-	0x6b4d, 0x7bef, 0x9492, 0xa534, 0xb5b6, 0xe71c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef5d, 0xbdf7, 0xad55, 0x94b2, 0x8410, 
-	0x738e, 0x5aeb, 0x4a49, 0x39c7, 0x2124, 0x10a2, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x10a2, 0x2124, 0x39c7, 0x4a49, 0x5aeb, 0x738e, 
-	0x8410, 0x94b2, 0xad55, 0xbdf7, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0xc638, 0xad75, 0x9cd3, 
-	0x8c51, 0x73ae, 0x630c, 0x528a, 0x4208, 0x2965, 0x18e3, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x18e3, 0x2965, 0x4208, 0x528a, 0x630c, 0x73ae, 0x8c51, 
-	0x9cd3, 0xad75, 0xc638, 0xf79e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xd69a, 0xb596, 
-	0xa514, 0x8c71, 0x7bef, 0x6b4d, 0x5acb, 0x4228, 0x31a6, 0x2124, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x2124, 0x31a6, 0x4228, 0x5acb, 0x6b4d, 0x7bef, 0x8c71, 0xa514, 
-	0xb596, 0xd69a, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xe71c, 
-	0xbdd7, 0xa534, 0x94b2, 0x8410, 0x738e, 0x630c, 0x4a69, 0x39e7, 0x2965, 0x18e3, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x18e3, 0x2965, 0x39e7, 0x4a69, 0x630c, 0x738e, 0x8410, 0x94b2, 0xa534, 0xbdd7, 
-	0xe71c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xef7d, 0xc618, 0xad75, 0x9cd3, 0x8c51, 0x7bcf, 0x632c, 0x52aa, 0x4228, 0x31a6, 0x2124, 0x10a2, 0x0020, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0020, 0x10a2, 0x2124, 0x31a6, 0x4228, 0x52aa, 0x632c, 0x7bcf, 0x8c51, 0x9cd3, 0xad75, 0xc618, 0xef7d, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffdf, 0xd69a, 0xb5b6, 0xa514, 0x9492, 0x8410, 0x738e, 0x5aeb, 0x4a69, 0x39e7, 0x2965, 0x18e3, 0x0861, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0861, 0x18e3, 0x2965, 0x39e7, 0x4a69, 0x5aeb, 0x738e, 0x8410, 0x9492, 0xa514, 0xb5b6, 0xd69a, 0xffdf, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xef5d, 0xbdf7, 0xad55, 0x9cd3, 0x8c51, 0x7bcf, 0x6b4d, 0x5acb, 0x4a49, 0x39c7, 0x2945, 0x18c3, 0x0841, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0841, 0x18c3, 0x2945, 0x39c7, 0x4a49, 0x5acb, 0x6b4d, 0x7bcf, 0x8c51, 0x9cd3, 0xad55, 0xbdf7, 0xe73c, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0xce79, 0xb596, 0xa514, 0x9492, 0x8410, 0x738e, 0x630c, 0x528a, 0x4208, 0x31a6, 0x2124, 
-	0x10a2, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x10a2, 
-	0x2124, 0x31a6, 0x4208, 0x528a, 0x630c, 0x738e, 0x8410, 0x9492, 0xa514, 0xb596, 0xce79, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xe73c, 0xbdf7, 0xad55, 0x9cd3, 0x8c51, 0x7bef, 0x6b6d, 0x5aeb, 0x4a69, 0x39e7, 
-	0x3186, 0x2104, 0x10a2, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x10a2, 0x2104, 0x3186, 
-	0x39e7, 0x4a69, 0x5aeb, 0x6b6d, 0x7bef, 0x8c51, 0x9cd3, 0xad55, 0xbdf7, 0xe73c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xd69a, 0xb5b6, 0xa534, 0x94b2, 0x8430, 0x73ae, 0x6b4d, 0x5acb, 
-	0x4a49, 0x39e7, 0x2965, 0x2104, 0x1082, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1082, 0x2104, 0x2965, 0x39e7, 0x4a49, 
-	0x5acb, 0x6b4d, 0x73ae, 0x8430, 0x94b2, 0xa534, 0xb5b6, 0xd69a, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef5d, 0xc638, 0xad75, 0xa514, 0x9492, 0x8410, 0x73ae, 
-	0x632c, 0x52aa, 0x4a49, 0x39c7, 0x2965, 0x2104, 0x1082, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1082, 0x2104, 0x2965, 0x39c7, 0x4a49, 0x52aa, 0x632c, 
-	0x73ae, 0x8410, 0x9492, 0xa514, 0xad75, 0xc618, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xe71c, 0xbdd7, 0xad55, 0x9cf3, 0x8c71, 
-	0x8410, 0x738e, 0x632c, 0x52aa, 0x4a49, 0x39c7, 0x2965, 0x2104, 0x10a2, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x10a2, 0x2104, 0x2965, 0x39c7, 0x4a49, 0x52aa, 0x632c, 0x738e, 0x8410, 
-	0x8c71, 0x9cf3, 0xad55, 0xbdd7, 0xdefb, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0xd6ba, 0xb5b6, 0xad55, 
-	0x9cd3, 0x8c71, 0x7bef, 0x738e, 0x630c, 0x52aa, 0x4a49, 0x39e7, 0x3186, 0x2124, 0x10a2, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x10a2, 0x2124, 0x3186, 0x39e7, 0x4a49, 0x52aa, 0x630c, 0x738e, 0x7bef, 0x8c71, 0x9cd3, 
-	0xad55, 0xb5b6, 0xd6ba, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf79e, 0xce79, 
-	0xb5b6, 0xa534, 0x9cd3, 0x8c71, 0x7bef, 0x738e, 0x632c, 0x5acb, 0x4a49, 0x39e7, 0x3186, 0x2124, 0x18e3, 0x1082, 0x0020, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0020, 0x1082, 0x18e3, 0x2124, 0x3186, 0x39e7, 0x4a49, 0x5acb, 0x632c, 0x738e, 0x7bef, 0x8c71, 0x9cd3, 0xa534, 0xb5b6, 
-	0xce79, 0xf79e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xef7d, 0xce59, 0xb5b6, 0xa534, 0x9cd3, 0x8c71, 0x8410, 0x738e, 0x632c, 0x5acb, 0x4a69, 0x4208, 0x31a6, 0x2965, 0x2104, 0x10a2, 
-	0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 
-	0x10a2, 0x2104, 0x2965, 0x31a6, 0x4208, 0x4a69, 0x5acb, 0x632c, 0x738e, 0x8410, 0x8c71, 0x9cd3, 0xa534, 0xb5b6, 0xce59, 0xef7d, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xef7d, 0xce59, 0xb5b6, 0xad55, 0x9cd3, 0x8c71, 0x8410, 0x73ae, 0x6b4d, 0x5aeb, 0x528a, 0x4a49, 0x39e7, 0x3186, 
-	0x2945, 0x18e3, 0x10a2, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x10a2, 0x18e3, 0x2945, 
-	0x3186, 0x39e7, 0x4a49, 0x528a, 0x5aeb, 0x6b4d, 0x73ae, 0x8410, 0x8c71, 0x9cd3, 0xad55, 0xb5b6, 0xce59, 0xef5d, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xef7d, 0xce79, 0xb5b6, 0xad55, 0x9cf3, 0x9492, 0x8430, 0x7bcf, 0x6b6d, 0x632c, 0x5acb, 0x4a69, 
-	0x4228, 0x39c7, 0x3186, 0x2124, 0x18e3, 0x10a2, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x10a2, 0x18e3, 0x2124, 0x3186, 0x39c7, 0x4228, 
-	0x4a69, 0x5acb, 0x632c, 0x6b6d, 0x7bcf, 0x8430, 0x9492, 0x9cf3, 0xad55, 0xb5b6, 0xce79, 0xef7d, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf79e, 0xd6ba, 0xbdd7, 0xad75, 0xa514, 0x94b2, 0x8c51, 0x8410, 0x73ae, 0x6b4d, 
-	0x630c, 0x52aa, 0x4a69, 0x4208, 0x39c7, 0x3186, 0x2124, 0x18e3, 0x10a2, 0x0861, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0861, 0x10a2, 0x18e3, 0x2124, 0x3186, 0x39c7, 0x4208, 0x4a69, 0x52aa, 0x630c, 
-	0x6b4d, 0x73ae, 0x8410, 0x8c51, 0x94b2, 0xa514, 0xad75, 0xbdd7, 0xd6ba, 0xf79e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0xdefb, 0xc618, 0xb596, 0xa534, 0x9cf3, 0x9492, 0x8430, 
-	0x7bef, 0x738e, 0x6b4d, 0x630c, 0x52aa, 0x4a69, 0x4228, 0x39e7, 0x3186, 0x2945, 0x2104, 0x18e3, 0x10a2, 0x0861, 0x0020, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0020, 0x0861, 0x10a2, 0x18e3, 0x2104, 0x2945, 0x3186, 0x39e7, 0x4228, 0x4a69, 0x52aa, 0x630c, 0x6b4d, 0x738e, 0x7bef, 
-	0x8430, 0x9492, 0x9cf3, 0xa534, 0xb596, 0xc618, 0xdefb, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef5d, 0xce79, 0xbdd7, 0xad75, 0xa534, 
-	0x9cd3, 0x8c71, 0x8430, 0x7bef, 0x738e, 0x6b4d, 0x630c, 0x5acb, 0x528a, 0x4a49, 0x4208, 0x39c7, 0x3186, 0x2945, 0x2124, 0x18e3, 
-	0x10a2, 0x1082, 0x0841, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0841, 0x1082, 0x10a2, 
-	0x18e3, 0x2124, 0x2945, 0x3186, 0x39c7, 0x4208, 0x4a49, 0x528a, 0x5acb, 0x630c, 0x6b4d, 0x738e, 0x7bef, 0x8430, 0x8c71, 0x9cd3, 
-	0xa534, 0xad75, 0xbdd7, 0xce79, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0xdefb, 0xc638, 
-	0xb5b6, 0xad75, 0xa514, 0x9cd3, 0x9492, 0x8430, 0x7bef, 0x73ae, 0x6b6d, 0x632c, 0x5aeb, 0x52aa, 0x4a69, 0x4a49, 0x4208, 0x39c7, 
-	0x31a6, 0x2965, 0x2945, 0x2104, 0x18e3, 0x18c3, 0x10a2, 0x0861, 0x0841, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0841, 0x0861, 0x10a2, 0x18c3, 0x18e3, 0x2104, 0x2945, 0x2965, 0x31a6, 
-	0x39c7, 0x4208, 0x4a49, 0x4a69, 0x52aa, 0x5aeb, 0x632c, 0x6b6d, 0x73ae, 0x7bef, 0x8430, 0x9492, 0x9cd3, 0xa514, 0xad75, 0xb5b6, 
-	0xc638, 0xe71c, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xf79e, 0xdefb, 0xc638, 0xb5b6, 0xad75, 0xa534, 0x9cd3, 0x9492, 0x8c51, 0x8410, 0x7bcf, 0x738e, 0x6b6d, 0x632c, 0x5aeb, 0x5acb, 
-	0x528a, 0x4a69, 0x4228, 0x4208, 0x39c7, 0x31a6, 0x3186, 0x2965, 0x2945, 0x2124, 0x2104, 0x18e3, 0x18c3, 0x18c3, 0x10a2, 0x1082, 
-	0x1082, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x1082, 
-	0x1082, 0x10a2, 0x18c3, 0x18c3, 0x18e3, 0x2104, 0x2124, 0x2945, 0x2965, 0x3186, 0x31a6, 0x39c7, 0x4208, 0x4228, 0x4a69, 0x528a, 
-	0x5acb, 0x5aeb, 0x632c, 0x6b6d, 0x738e, 0x7bcf, 0x8410, 0x8c51, 0x9492, 0x9cd3, 0xa534, 0xad75, 0xb5b6, 0xc618, 0xdedb, 0xef7d, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xf79e, 0xdefb, 0xc638, 0xbdd7, 0xad75, 0xa534, 0x9cf3, 0x9cd3, 0x9492, 0x8c51, 0x8410, 0x7bef, 0x73ae, 
-	0x6b6d, 0x6b4d, 0x630c, 0x5aeb, 0x5acb, 0x52aa, 0x4a69, 0x4a49, 0x4228, 0x4208, 0x39e7, 0x39e7, 0x39c7, 0x31a6, 0x3186, 0x3186, 
-	0x2965, 0x2965, 0x2945, 0x2945, 0x2945, 0x2945, 0x2124, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 
-	0x3186, 0x3186, 0x31a6, 0x39c7, 0x39e7, 0x39e7, 0x4208, 0x4228, 0x4a49, 0x4a69, 0x52aa, 0x5acb, 0x5aeb, 0x630c, 0x6b4d, 0x6b6d, 
-	0x73ae, 0x7bef, 0x8410, 0x8c51, 0x9492, 0x9cd3, 0x9cf3, 0xa534, 0xad75, 0xbdd7, 0xc638, 0xdefb, 0xf79e, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0xef5d, 0xd6ba, 0xbdf7, 0xb5b6, 0xad75, 0xa534, 0xa514, 0x9cd3, 0x9492, 
-	0x8c71, 0x8430, 0x8410, 0x7bef, 0x73ae, 0x738e, 0x6b6d, 0x6b4d, 0x632c, 0x630c, 0x5aeb, 0x5acb, 0x52aa, 0x52aa, 0x528a, 0x4a69, 
-	0x4a69, 0x4a49, 0x4a49, 0x4a49, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a49, 0x4a49, 0x4a49, 0x4a69, 
-	0x4a69, 0x528a, 0x52aa, 0x52aa, 0x5acb, 0x5aeb, 0x630c, 0x632c, 0x6b4d, 0x6b6d, 0x738e, 0x73ae, 0x7bef, 0x8410, 0x8430, 0x8c71, 
-	0x9492, 0x9cd3, 0xa514, 0xa534, 0xad75, 0xb5b6, 0xbdf7, 0xd69a, 0xe73c, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf79e, 0xe71c, 0xd69a, 0xbdf7, 0xb5b6, 0xb596, 
-	0xad55, 0xa534, 0x9cf3, 0x9cd3, 0x94b2, 0x8c71, 0x8c51, 0x8430, 0x8410, 0x7bef, 0x7bcf, 0x7bcf, 0x73ae, 0x738e, 0x6b6d, 0x6b6d, 
-	0x6b4d, 0x6b4d, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x630c, 0x630c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x6b4d, 0x6b4d, 
-	0x6b6d, 0x6b6d, 0x738e, 0x73ae, 0x7bcf, 0x7bcf, 0x7bef, 0x8410, 0x8430, 0x8c51, 0x8c71, 0x94b2, 0x9cd3, 0x9cf3, 0xa534, 0xad55, 
-	0xb596, 0xb5b6, 0xbdf7, 0xd69a, 0xe71c, 0xf79e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0xef5d, 
-	0xdedb, 0xce59, 0xbdf7, 0xb5b6, 0xb596, 0xad75, 0xad55, 0xa534, 0xa514, 0x9cf3, 0x9cd3, 0x94b2, 0x9492, 0x9492, 0x8c71, 0x8c51, 
-	0x8c51, 0x8430, 0x8430, 0x8430, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8430, 0x8430, 0x8430, 0x8c51, 
-	0x8c51, 0x8c71, 0x9492, 0x9492, 0x94b2, 0x9cd3, 0x9cf3, 0xa514, 0xa534, 0xad55, 0xad75, 0xb596, 0xb5b6, 0xbdf7, 0xce59, 0xdedb, 
-	0xef5d, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xf7be, 0xef7d, 0xe71c, 0xd6ba, 0xce79, 0xc618, 0xbdd7, 0xb5b6, 0xb5b6, 0xb596, 0xad75, 0xad55, 0xad55, 
-	0xa534, 0xa534, 0xa534, 0xa514, 0xa514, 0xa514, 0xa514, 0xa514, 0xa514, 0xa514, 0xa514, 0xa514, 0xa514, 0xa534, 0xa534, 0xa534, 
-	0xad55, 0xad55, 0xad75, 0xb596, 0xb5b6, 0xb5b6, 0xbdd7, 0xc618, 0xce79, 0xdedb, 0xe71c, 0xef7d, 0xf7be, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xf7be, 0xf79e, 0xef5d, 0xe73c, 0xdefb, 0xdedb, 
-	0xd6ba, 0xce79, 0xce59, 0xce59, 0xc638, 0xc638, 0xc618, 0xbdf7, 0xbdf7, 0xc618, 0xc638, 0xc638, 0xce59, 0xce59, 0xce79, 0xd6ba, 
-	0xdedb, 0xdefb, 0xe73c, 0xef5d, 0xef7d, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff
-};
-
-// Array of all bitmaps for convenience. (Total bytes used to store images in PROGMEM = 57616)
-const int _allArray_LEN = 1;
-const uint16_t* _allArray[1] = {
-	_startscreen
-};
-
@@ -1,1223 +0,0 @@
-const uint8_t airstrikeb3d26pt7bBitmaps[] PROGMEM = {
-  0x00, 0x00, 0xFF, 0xE0, 0x08, 0x01, 0x80, 0x40, 0x0E, 0x02, 0x00, 0xF0,
-  0x20, 0x07, 0x01, 0x00, 0x38, 0x08, 0x03, 0xC0, 0x80, 0x1C, 0x04, 0x00,
-  0xE0, 0x20, 0x0F, 0x02, 0x00, 0x70, 0x10, 0x03, 0x80, 0x80, 0x3C, 0x08,
-  0x01, 0xC0, 0x40, 0x1E, 0x02, 0x00, 0xE0, 0x20, 0x07, 0x01, 0x00, 0x78,
-  0x08, 0x03, 0x80, 0x80, 0x1C, 0x03, 0xFF, 0xE0, 0x08, 0x7E, 0x00, 0x81,
-  0x00, 0x08, 0x0C, 0x00, 0x80, 0x60, 0x04, 0x03, 0x00, 0x20, 0x38, 0x01,
-  0x03, 0xC0, 0x04, 0x3C, 0x00, 0x1F, 0xC0, 0x00, 0x7C, 0x00, 0x00, 0x0F,
-  0x1E, 0x0C, 0x48, 0x42, 0x0C, 0x19, 0x02, 0x07, 0x40, 0x81, 0xE0, 0x40,
-  0x78, 0x10, 0x3E, 0x0C, 0x0E, 0x83, 0x07, 0xA1, 0xC3, 0xED, 0xFB, 0xF0,
-  0xF9, 0xF8, 0x1C, 0x3C, 0x02, 0x04, 0x00, 0x00, 0x00, 0xFF, 0xF7, 0xFF,
-  0x80, 0x00, 0x01, 0x00, 0x34, 0x00, 0xC0, 0x00, 0x01, 0x00, 0x3C, 0x01,
-  0xE0, 0x00, 0x01, 0x00, 0x78, 0x01, 0xE0, 0x00, 0x02, 0x00, 0x78, 0x01,
-  0xC0, 0x00, 0x02, 0x00, 0x78, 0x03, 0xC0, 0x00, 0x0E, 0x00, 0xF0, 0x03,
-  0xFC, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x1F, 0x00, 0x40, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x80, 0x00, 0x00, 0x00,
-  0xF8, 0x01, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x02, 0x00, 0x00, 0x00, 0x03,
-  0xE0, 0x04, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x0F, 0xF0, 0x07, 0x80, 0x1F,
-  0x80, 0x07, 0xE0, 0x07, 0x80, 0x1F, 0xE0, 0x00, 0x80, 0x00, 0x00, 0x00,
-  0xE0, 0x01, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x06, 0x00, 0x00, 0x00, 0x03,
-  0xE0, 0x0C, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x18, 0x00, 0x00, 0x00, 0x0F,
-  0x80, 0x30, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x60, 0x00, 0x00, 0x00, 0x3E,
-  0x00, 0xFF, 0x00, 0x3C, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x3C, 0x01, 0xF0,
-  0x00, 0x03, 0x00, 0x78, 0x01, 0xC0, 0x00, 0x02, 0x00, 0x78, 0x01, 0xC0,
-  0x00, 0x02, 0x00, 0x78, 0x03, 0xC0, 0x00, 0x02, 0x00, 0xF0, 0x03, 0x80,
-  0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xE7, 0xFF, 0x80,
-  0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0x07, 0x00,
-  0x00, 0x00, 0x00, 0x10, 0x38, 0x00, 0x00, 0x00, 0x01, 0x01, 0xC0, 0x00,
-  0x00, 0x00, 0x08, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0x00, 0x00,
-  0x00, 0x04, 0x0F, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x7F, 0xFE, 0x00, 0x0C,
-  0x00, 0x00, 0x00, 0x38, 0x00, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x0C, 0x00,
-  0x00, 0x00, 0x3E, 0x00, 0xC0, 0x00, 0x00, 0x01, 0xE0, 0x04, 0x00, 0x00,
-  0x00, 0x1E, 0x00, 0x40, 0x00, 0x00, 0x01, 0xF0, 0x02, 0x00, 0x00, 0x00,
-  0x1F, 0x00, 0x30, 0x00, 0x00, 0x01, 0xF0, 0x01, 0x00, 0x38, 0x1F, 0xFF,
-  0x00, 0x08, 0x01, 0x80, 0xFF, 0xF0, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00,
-  0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x04, 0x00, 0x00,
-  0x80, 0x00, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x20,
-  0x00, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x18, 0x00, 0x04, 0x00,
-  0x00, 0x00, 0xC0, 0x00, 0x10, 0x00, 0x00, 0x07, 0x00, 0x00, 0x7F, 0x03,
-  0x80, 0x38, 0x00, 0x3F, 0xF8, 0x18, 0x01, 0xC0, 0x01, 0x00, 0x00, 0x00,
-  0x1E, 0x00, 0x10, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x00, 0x07,
-  0x00, 0x10, 0x00, 0x00, 0x00, 0x78, 0x01, 0x00, 0x00, 0x00, 0x07, 0xC0,
-  0x08, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x80, 0x00, 0x00, 0x07, 0xC0, 0x07,
-  0xFF, 0xC0, 0xFF, 0xFC, 0x00, 0x1F, 0xFC, 0x07, 0xFF, 0x80, 0x00, 0x00,
-  0x20, 0x70, 0x00, 0x00, 0x00, 0x02, 0x03, 0x80, 0x00, 0x00, 0x00, 0x10,
-  0x3C, 0x00, 0x00, 0x00, 0x00, 0x81, 0xC0, 0x00, 0x00, 0x00, 0x08, 0x0E,
-  0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x18, 0x06,
-  0x00, 0x60, 0x1E, 0x00, 0x60, 0x01, 0x00, 0x80, 0x3F, 0x00, 0xC0, 0x00,
-  0x81, 0x00, 0x7C, 0x00, 0x80, 0x00, 0xC2, 0x00, 0xF8, 0x01, 0x03, 0xC0,
-  0xEC, 0x01, 0xF0, 0x03, 0x07, 0xC0, 0xF8, 0x07, 0xE0, 0x02, 0x07, 0xC0,
-  0xF0, 0x0F, 0xC0, 0x02, 0x07, 0x40, 0xC0, 0x1F, 0x80, 0x02, 0x07, 0x80,
-  0x80, 0x3E, 0x00, 0x02, 0x00, 0x01, 0x00, 0x7C, 0x00, 0x02, 0x00, 0x02,
-  0x00, 0xF8, 0x00, 0x02, 0x00, 0x04, 0x03, 0xF0, 0x00, 0x01, 0x00, 0x08,
-  0x07, 0xE0, 0x00, 0x00, 0xC0, 0x30, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xC0,
-  0x10, 0x06, 0x00, 0x00, 0x1F, 0x80, 0x60, 0x01, 0x00, 0x00, 0x03, 0x00,
-  0x80, 0x01, 0x80, 0x00, 0x06, 0x01, 0x00, 0x00, 0xC0, 0x00, 0x0C, 0x03,
-  0x03, 0xC0, 0xC0, 0x00, 0x30, 0x06, 0x07, 0xC0, 0xC0, 0x00, 0x60, 0x0E,
-  0x0F, 0x40, 0xC0, 0x00, 0xC0, 0x1C, 0x0E, 0x81, 0xC0, 0x01, 0x80, 0x3C,
-  0x07, 0x01, 0xC0, 0x03, 0x00, 0xFC, 0x00, 0x03, 0xC0, 0x06, 0x01, 0xF4,
-  0x00, 0x03, 0xC0, 0x08, 0x03, 0xE2, 0x00, 0x07, 0x80, 0x10, 0x07, 0xC1,
-  0x00, 0x0F, 0x00, 0x20, 0x0F, 0x80, 0x80, 0x3E, 0x00, 0xFF, 0xFE, 0x00,
-  0x7F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFF,
-  0xFF, 0xFE, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0x00, 0x00, 0x60, 0x00,
-  0x00, 0x0F, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x1E, 0x00, 0x01, 0x80, 0x00,
-  0x00, 0x3C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x03, 0x00, 0x00,
-  0x00, 0xF8, 0x00, 0x02, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x02, 0x00, 0x7F,
-  0xFF, 0xE0, 0x00, 0x04, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x04, 0x00, 0x7F,
-  0xFF, 0xFF, 0xFC, 0x04, 0x00, 0xF8, 0x00, 0x00, 0x0E, 0x04, 0x00, 0xF0,
-  0x00, 0x00, 0x1F, 0x04, 0x00, 0xE0, 0x00, 0x00, 0x3E, 0x04, 0x01, 0xC0,
-  0x00, 0x00, 0x7C, 0x06, 0x01, 0x80, 0x00, 0x00, 0xF8, 0x1C, 0x01, 0x00,
-  0x00, 0x01, 0xF0, 0x10, 0x02, 0x00, 0x00, 0x03, 0xE0, 0x20, 0x00, 0x00,
-  0x00, 0x07, 0xC0, 0x20, 0x03, 0xFF, 0x80, 0x1F, 0x80, 0x40, 0x07, 0xFF,
-  0x00, 0x1E, 0x00, 0x40, 0x00, 0x00, 0x00, 0x3C, 0x00, 0xC0, 0x00, 0x00,
-  0x00, 0x38, 0x00, 0x80, 0x00, 0x00, 0x00, 0x38, 0x00, 0x80, 0x00, 0x00,
-  0x00, 0x78, 0x00, 0x80, 0x00, 0x00, 0x00, 0x70, 0x00, 0x80, 0x00, 0x00,
-  0x00, 0xF0, 0x00, 0x40, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x20, 0x00, 0x00,
-  0x0F, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF,
-  0xFC, 0x00, 0x00, 0x0F, 0x06, 0x30, 0x83, 0x20, 0x74, 0x0F, 0x03, 0xE0,
-  0x7C, 0x1E, 0x83, 0xD0, 0xF1, 0x7E, 0x1F, 0x81, 0xE0, 0x10, 0x00, 0x00,
-  0x07, 0xFF, 0x80, 0x07, 0x00, 0x18, 0x01, 0x80, 0x07, 0x80, 0x40, 0x01,
-  0xF0, 0x10, 0x00, 0x7C, 0x04, 0x00, 0x1F, 0x01, 0x00, 0x07, 0xC0, 0x40,
-  0x01, 0xF0, 0x08, 0x01, 0xFC, 0x02, 0x00, 0x7F, 0x00, 0x80, 0x1F, 0xC0,
-  0x10, 0x07, 0xC0, 0x06, 0x00, 0xF0, 0x00, 0x80, 0x3E, 0x00, 0x10, 0x07,
-  0x80, 0x04, 0x00, 0xE0, 0x00, 0x80, 0x3C, 0x00, 0x10, 0x07, 0x80, 0x02,
-  0x00, 0xE0, 0x00, 0x40, 0x1C, 0x00, 0x08, 0x01, 0x80, 0x01, 0x00, 0x10,
-  0x00, 0x20, 0x01, 0x00, 0x02, 0x00, 0x10, 0x00, 0x40, 0x01, 0x00, 0x04,
-  0x00, 0x30, 0x00, 0xC0, 0x07, 0x00, 0x0C, 0x00, 0xE0, 0x00, 0xC0, 0x3C,
-  0x00, 0x0E, 0x07, 0x80, 0x00, 0x70, 0xE0, 0x00, 0x07, 0xFC, 0x00, 0x00,
-  0x3F, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x02, 0x38,
-  0x00, 0x00, 0x80, 0x80, 0x00, 0x10, 0x0C, 0x00, 0x04, 0x00, 0x40, 0x00,
-  0x80, 0x0C, 0x00, 0x10, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x01,
-  0x80, 0x03, 0x00, 0x38, 0x00, 0x10, 0x03, 0x00, 0x02, 0x00, 0x70, 0x00,
-  0x20, 0x0E, 0x00, 0x04, 0x01, 0xC0, 0x00, 0x80, 0x38, 0x00, 0x10, 0x07,
-  0x00, 0x04, 0x00, 0xE0, 0x00, 0x80, 0x3C, 0x00, 0x30, 0x07, 0x80, 0x04,
-  0x00, 0xE0, 0x01, 0x00, 0x3C, 0x00, 0x20, 0x07, 0x80, 0x08, 0x01, 0xE0,
-  0x0E, 0x00, 0x3C, 0x02, 0x00, 0x0F, 0x00, 0x80, 0x03, 0xE0, 0x20, 0x00,
-  0x78, 0x08, 0x00, 0x1E, 0x03, 0x00, 0x07, 0x80, 0xC0, 0x01, 0xE0, 0x10,
-  0x00, 0xF8, 0x06, 0x00, 0x7E, 0x00, 0x7F, 0xFF, 0x80, 0x07, 0xFF, 0xC0,
-  0x00, 0x07, 0xF0, 0x18, 0x70, 0x50, 0xB1, 0x00, 0x74, 0x00, 0xE8, 0x01,
-  0xF8, 0x0F, 0xA0, 0x1F, 0x80, 0x3E, 0x88, 0xF0, 0xB7, 0xE0, 0xFF, 0x80,
-  0xFC, 0x00, 0xB0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x10, 0x38, 0x00,
-  0x00, 0x80, 0xE0, 0x00, 0x02, 0x03, 0x80, 0x00, 0x10, 0x1E, 0x00, 0x03,
-  0xC0, 0x7F, 0xC0, 0x18, 0x00, 0x07, 0x00, 0xC0, 0x00, 0x1E, 0x06, 0x00,
-  0x00, 0xF8, 0x10, 0x00, 0x07, 0xC0, 0x80, 0x00, 0x3E, 0x04, 0x00, 0x01,
-  0xF0, 0x20, 0x00, 0x0F, 0x81, 0x00, 0x00, 0x7C, 0x0F, 0xF8, 0x0F, 0xE0,
-  0x0F, 0xE0, 0x3E, 0x00, 0x01, 0x01, 0xC0, 0x00, 0x04, 0x07, 0x00, 0x00,
-  0x10, 0x1C, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x07,
-  0x80, 0xC2, 0x08, 0x18, 0x80, 0xE4, 0x07, 0x40, 0x3A, 0x01, 0xD0, 0x1E,
-  0x81, 0xF4, 0x0F, 0x21, 0xF0, 0x9F, 0x83, 0xF8, 0x0F, 0x00, 0x00, 0x00,
-  0x00, 0xFF, 0xFE, 0x01, 0x80, 0x0E, 0x03, 0x00, 0x1F, 0x06, 0x00, 0x3F,
-  0x0C, 0x00, 0x7E, 0x08, 0x00, 0x7C, 0x10, 0x00, 0xF8, 0x20, 0x01, 0xE0,
-  0x40, 0x03, 0xC0, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0x00, 0x0F, 0x03, 0x08,
-  0x60, 0x44, 0x06, 0x80, 0x68, 0x07, 0x80, 0xE8, 0x1E, 0x43, 0xC3, 0xF8,
-  0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x02,
-  0x00, 0x38, 0x00, 0x00, 0x00, 0x08, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x20,
-  0x03, 0xE0, 0x00, 0x00, 0x01, 0x80, 0x0F, 0x80, 0x00, 0x00, 0x06, 0x00,
-  0x3E, 0x00, 0x00, 0x00, 0x18, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x60, 0x07,
-  0xE0, 0x00, 0x00, 0x01, 0x80, 0x1F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x7C,
-  0x00, 0x00, 0x00, 0x10, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x40, 0x07, 0xC0,
-  0x00, 0x00, 0x01, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x04, 0x00, 0x7C, 0x00,
-  0x00, 0x00, 0x10, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xC0, 0x07, 0xC0, 0x00,
-  0x00, 0x03, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x7C, 0x00, 0x00,
-  0x00, 0x30, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xC0, 0x0F, 0x80, 0x00, 0x00,
-  0x02, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x08, 0x00, 0xF8, 0x00, 0x00, 0x00,
-  0x20, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x80, 0x0F, 0x80, 0x00, 0x00, 0x02,
-  0x00, 0x3E, 0x00, 0x00, 0x00, 0x08, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x60,
-  0x03, 0xC0, 0x00, 0x00, 0x01, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x06, 0x00,
-  0x3C, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-  0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x38,
-  0x00, 0x1E, 0x00, 0x01, 0x80, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x02,
-  0x00, 0x10, 0x00, 0x00, 0x02, 0x00, 0x40, 0x00, 0x00, 0x02, 0x01, 0x00,
-  0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x00, 0x0E, 0x18, 0x00, 0xFF, 0x00,
-  0x0C, 0x20, 0x07, 0xFF, 0x00, 0x1C, 0x80, 0x1F, 0x01, 0x00, 0x3B, 0x00,
-  0x7C, 0x02, 0x00, 0x74, 0x01, 0xE0, 0x04, 0x00, 0xE8, 0x03, 0xC0, 0x08,
-  0x01, 0xF0, 0x07, 0x00, 0x10, 0x03, 0xC0, 0x0E, 0x00, 0x40, 0x0F, 0x80,
-  0x18, 0x01, 0x80, 0x1F, 0x00, 0x30, 0x06, 0x00, 0x3A, 0x00, 0x60, 0x18,
-  0x00, 0xF4, 0x00, 0x60, 0x60, 0x01, 0xC8, 0x00, 0x7F, 0x00, 0x07, 0x90,
-  0x00, 0x00, 0x00, 0x1E, 0x20, 0x00, 0x00, 0x00, 0x7C, 0x20, 0x00, 0x00,
-  0x00, 0xF0, 0x40, 0x00, 0x00, 0x03, 0xC0, 0x40, 0x00, 0x00, 0x1F, 0x00,
-  0x40, 0x00, 0x00, 0x7C, 0x00, 0x60, 0x00, 0x03, 0xF0, 0x00, 0x38, 0x00,
-  0x1F, 0x80, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00,
-  0x00, 0x00, 0x3F, 0xFC, 0x00, 0x40, 0x06, 0x00, 0x80, 0x07, 0x01, 0x00,
-  0x0F, 0x02, 0x00, 0x0E, 0x02, 0x00, 0x0E, 0x04, 0x00, 0x1E, 0x08, 0x00,
-  0x1C, 0x0F, 0x80, 0x1C, 0x07, 0x00, 0x3C, 0x01, 0x00, 0x38, 0x01, 0x00,
-  0x78, 0x02, 0x00, 0x70, 0x02, 0x00, 0x70, 0x02, 0x00, 0xF0, 0x04, 0x00,
-  0xE0, 0x04, 0x00, 0xE0, 0x04, 0x01, 0xE0, 0x08, 0x01, 0xC0, 0x08, 0x01,
-  0xC0, 0x08, 0x03, 0xC0, 0x10, 0x03, 0x80, 0x10, 0x03, 0x80, 0x10, 0x07,
-  0x80, 0x20, 0x07, 0x00, 0x20, 0x07, 0x00, 0x40, 0x0E, 0x00, 0x40, 0x0E,
-  0x00, 0x40, 0x0E, 0x00, 0x7F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x0F,
-  0xFF, 0xFF, 0xF8, 0x00, 0x08, 0x00, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00,
-  0x01, 0x80, 0x08, 0x00, 0x00, 0x00, 0x60, 0x0C, 0x00, 0x00, 0x00, 0x38,
-  0x04, 0x00, 0x00, 0x00, 0x1C, 0x04, 0x00, 0x00, 0x00, 0x0E, 0x04, 0x00,
-  0x00, 0x00, 0x07, 0x03, 0xFF, 0xFF, 0xE0, 0x07, 0x80, 0xFF, 0xFF, 0xF0,
-  0x03, 0xC0, 0x03, 0xFF, 0xE0, 0x03, 0xC0, 0x06, 0x00, 0x00, 0x03, 0xE0,
-  0x04, 0x00, 0x00, 0x03, 0xE0, 0x0C, 0x00, 0x00, 0x03, 0xF0, 0x08, 0x00,
-  0x00, 0x03, 0xF0, 0x08, 0x00, 0x00, 0x03, 0xF0, 0x08, 0x00, 0x00, 0x07,
-  0xF0, 0x08, 0x00, 0x00, 0x0F, 0xE0, 0x0C, 0x01, 0xFF, 0xFF, 0xE0, 0x04,
-  0x01, 0xFF, 0xFF, 0xE0, 0x04, 0x00, 0xFF, 0xFF, 0xC0, 0x02, 0x00, 0x7F,
-  0xFF, 0xFE, 0x02, 0x00, 0x00, 0x00, 0x03, 0x81, 0x00, 0x00, 0x00, 0x03,
-  0xC0, 0x80, 0x00, 0x00, 0x03, 0xC0, 0x40, 0x00, 0x00, 0x01, 0xC0, 0x20,
-  0x00, 0x00, 0x01, 0xE0, 0x10, 0x00, 0x00, 0x01, 0xE0, 0x04, 0x00, 0x00,
-  0x01, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xE0,
-  0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00,
-  0x00, 0x80, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x08, 0x00, 0x10,
-  0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x00, 0x00, 0x60, 0x04, 0x00, 0x00,
-  0x00, 0x18, 0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0xFF, 0xFF, 0xF8, 0x01,
-  0xC0, 0x0F, 0xFF, 0xFE, 0x00, 0x70, 0x00, 0x01, 0xFF, 0x80, 0x1C, 0x00,
-  0x00, 0x80, 0x00, 0x07, 0x00, 0x00, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x20,
-  0x00, 0x01, 0xE0, 0x00, 0x10, 0x00, 0x01, 0xF8, 0x00, 0x08, 0x00, 0x00,
-  0x3C, 0x00, 0x04, 0x00, 0x00, 0x0E, 0x00, 0x02, 0x00, 0x00, 0x03, 0x80,
-  0x03, 0xFF, 0xFC, 0x00, 0xE0, 0x00, 0x3F, 0xFF, 0x00, 0x3C, 0x03, 0xFF,
-  0xFF, 0x80, 0x0E, 0x00, 0x80, 0x00, 0x00, 0x07, 0x80, 0x40, 0x00, 0x00,
-  0x01, 0xE0, 0x20, 0x00, 0x00, 0x00, 0x70, 0x08, 0x00, 0x00, 0x00, 0x3C,
-  0x04, 0x00, 0x00, 0x00, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x07, 0x80, 0x80,
-  0x00, 0x00, 0x03, 0xE0, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x1F, 0xFF, 0xFF,
-  0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xE0, 0x1F,
-  0xFE, 0x01, 0x00, 0x38, 0x08, 0x01, 0x80, 0x80, 0x1C, 0x04, 0x01, 0xE0,
-  0x40, 0x1E, 0x04, 0x00, 0xE0, 0x40, 0x0E, 0x02, 0x00, 0x70, 0x20, 0x07,
-  0x01, 0x00, 0x78, 0x10, 0x07, 0x81, 0x00, 0x38, 0x10, 0x03, 0x80, 0x80,
-  0x1C, 0x08, 0x01, 0xC0, 0x40, 0x1E, 0x08, 0x01, 0xE0, 0x40, 0x0E, 0x04,
-  0x00, 0xE0, 0x20, 0x07, 0x02, 0x00, 0xFF, 0xF0, 0x07, 0x82, 0x00, 0x00,
-  0x00, 0x03, 0x81, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x80, 0x00, 0x08, 0x01,
-  0xC0, 0x80, 0x00, 0x04, 0x00, 0xE0, 0x40, 0x00, 0x06, 0x00, 0xF0, 0x20,
-  0x00, 0x06, 0x00, 0x70, 0x20, 0x00, 0x07, 0x00, 0x38, 0x1F, 0xFF, 0xFF,
-  0x80, 0x3C, 0x03, 0xFF, 0xFF, 0x80, 0x1C, 0x00, 0x00, 0x00, 0x40, 0x0E,
-  0x00, 0x00, 0x00, 0x20, 0x0F, 0x00, 0x00, 0x00, 0x20, 0x07, 0x00, 0x00,
-  0x00, 0x10, 0x03, 0x80, 0x00, 0x00, 0x08, 0x03, 0xC0, 0x00, 0x00, 0x08,
-  0x01, 0xC0, 0x00, 0x00, 0x04, 0x00, 0xE0, 0x00, 0x00, 0x02, 0x00, 0xE0,
-  0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00,
-  0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40,
-  0x00, 0x00, 0x00, 0xF0, 0x08, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x80, 0x00,
-  0x00, 0x03, 0xE0, 0x08, 0x00, 0x00, 0x00, 0x7C, 0x01, 0x00, 0x00, 0x00,
-  0x0F, 0x80, 0x10, 0x00, 0x00, 0x01, 0xF0, 0x01, 0x00, 0x7F, 0xFF, 0xFE,
-  0x00, 0x20, 0x07, 0xFF, 0xFF, 0xC0, 0x02, 0x00, 0x3F, 0xFC, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x30, 0x00, 0x02, 0x00, 0x00, 0x01, 0x80, 0x00, 0x30,
-  0x00, 0x00, 0x08, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x08, 0x00,
-  0x00, 0x06, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x70, 0x00, 0x06, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x38, 0x00, 0x00, 0xFF, 0xF8, 0x03,
-  0x80, 0x00, 0x07, 0xFF, 0x00, 0x38, 0x00, 0x3F, 0xFF, 0xF0, 0x03, 0x80,
-  0x04, 0x00, 0x00, 0x00, 0x78, 0x00, 0x80, 0x00, 0x00, 0x07, 0x80, 0x10,
-  0x00, 0x00, 0x00, 0x70, 0x02, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x40, 0x00,
-  0x00, 0x01, 0xE0, 0x04, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x80, 0x00, 0x00,
-  0x07, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xFE,
-  0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x01, 0x80, 0x00, 0x00, 0x60,
-  0x18, 0x00, 0x00, 0x03, 0xC0, 0x80, 0x00, 0x00, 0x1F, 0x04, 0x00, 0x00,
-  0x00, 0xF8, 0x20, 0x00, 0x00, 0x07, 0xC1, 0x00, 0x00, 0x00, 0x3E, 0x0C,
-  0x00, 0x00, 0x01, 0xF0, 0x20, 0x03, 0xFF, 0xFF, 0x81, 0x80, 0x1F, 0xFF,
-  0xFC, 0x04, 0x00, 0xFF, 0xFE, 0x00, 0x10, 0x00, 0x00, 0x06, 0x00, 0x80,
-  0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x00,
-  0x60, 0x20, 0x00, 0x00, 0x01, 0xC0, 0x80, 0x00, 0x00, 0x07, 0x02, 0x00,
-  0x00, 0x00, 0x1C, 0x08, 0x00, 0x00, 0x00, 0x70, 0x20, 0x03, 0xF8, 0x01,
-  0xC0, 0x40, 0x07, 0xE0, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x38, 0x04, 0x00,
-  0x00, 0x01, 0xE0, 0x08, 0x00, 0x00, 0x0F, 0x00, 0x10, 0x00, 0x00, 0x38,
-  0x00, 0x20, 0x00, 0x01, 0xE0, 0x00, 0x40, 0x00, 0x0F, 0x00, 0x00, 0xC0,
-  0x00, 0xF8, 0x00, 0x00, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0xFF, 0xFC, 0x00,
-  0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80,
-  0x01, 0x00, 0x00, 0x00, 0x38, 0x00, 0x40, 0x00, 0x00, 0x0F, 0x80, 0x10,
-  0x00, 0x00, 0x03, 0xE0, 0x04, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x80, 0x00,
-  0x00, 0x3E, 0x00, 0x60, 0x00, 0x00, 0x0F, 0x80, 0x08, 0x00, 0x00, 0x03,
-  0xE0, 0x00, 0xFF, 0xF8, 0x00, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x3E, 0x00,
-  0x00, 0x01, 0x80, 0x0F, 0x80, 0x00, 0x00, 0x60, 0x03, 0xE0, 0x00, 0x00,
-  0x08, 0x00, 0xF8, 0x00, 0x00, 0x02, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x80,
-  0x0F, 0x80, 0x00, 0x00, 0x30, 0x03, 0xE0, 0x00, 0x00, 0x0C, 0x00, 0xF8,
-  0x00, 0x00, 0x03, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xC0, 0x0F, 0x80, 0x00,
-  0x00, 0x30, 0x03, 0xE0, 0x00, 0x00, 0x0C, 0x00, 0x78, 0x00, 0x00, 0x03,
-  0x00, 0x1E, 0x00, 0x00, 0x00, 0x40, 0x07, 0x80, 0x00, 0x00, 0x10, 0x01,
-  0xE0, 0x00, 0x00, 0x04, 0x00, 0x78, 0x00, 0x00, 0x01, 0x00, 0x1E, 0x00,
-  0x00, 0x00, 0x40, 0x07, 0x80, 0x00, 0x00, 0x10, 0x01, 0xE0, 0x00, 0x00,
-  0x06, 0x00, 0x78, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F,
-  0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x1E,
-  0x00, 0x00, 0x08, 0x00, 0x18, 0x00, 0x00, 0x02, 0x00, 0x18, 0x00, 0x00,
-  0x00, 0x80, 0x18, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x00, 0x00, 0x18,
-  0x0C, 0x00, 0x00, 0x00, 0x0C, 0x04, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00,
-  0x00, 0x00, 0x01, 0x83, 0x00, 0x1F, 0xFC, 0x00, 0xC1, 0x00, 0x1F, 0xFC,
-  0x00, 0xE0, 0x80, 0x0F, 0x00, 0x00, 0x70, 0x40, 0x0F, 0x00, 0x00, 0x38,
-  0x20, 0x07, 0x00, 0x00, 0x3C, 0x10, 0x03, 0x00, 0x00, 0x3C, 0x0C, 0x03,
-  0x00, 0x00, 0x3E, 0x1C, 0x01, 0x00, 0x00, 0x1E, 0x08, 0x01, 0x00, 0x00,
-  0x07, 0x0C, 0x00, 0x00, 0x00, 0x03, 0x04, 0x00, 0x7F, 0xF8, 0x01, 0x84,
-  0x00, 0x7F, 0xF8, 0x00, 0xE2, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x00, 0x00,
-  0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x00, 0x78, 0x80, 0x00, 0x00, 0x00,
-  0x3C, 0x40, 0x00, 0x00, 0x00, 0x3C, 0x20, 0x00, 0x00, 0x00, 0x1E, 0x10,
-  0x00, 0x00, 0x00, 0x3E, 0x02, 0x00, 0x00, 0x00, 0x7E, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xE0,
-  0x00, 0x00, 0x0C, 0x00, 0xF8, 0x00, 0x00, 0xC0, 0x00, 0x30, 0x00, 0x04,
-  0x00, 0x00, 0x30, 0x00, 0x20, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x01,
-  0x80, 0x0C, 0x00, 0x00, 0x03, 0x00, 0x20, 0x00, 0x00, 0x0E, 0x01, 0x00,
-  0x00, 0x00, 0x18, 0x04, 0x00, 0xF8, 0x00, 0x60, 0x20, 0x07, 0xF0, 0x01,
-  0xC0, 0x80, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0x00, 0x1C, 0x08, 0x00,
-  0x00, 0x00, 0x70, 0x20, 0x00, 0x00, 0x01, 0xC0, 0x40, 0x00, 0x00, 0x07,
-  0x01, 0x80, 0x00, 0x00, 0x1C, 0x03, 0xFF, 0xFE, 0x00, 0xF0, 0x07, 0xFF,
-  0xF0, 0x03, 0xC0, 0x07, 0xFF, 0x80, 0x0E, 0x01, 0xFF, 0xFC, 0x00, 0x78,
-  0x08, 0x00, 0x00, 0x01, 0xE0, 0x40, 0x00, 0x00, 0x0F, 0x02, 0x00, 0x00,
-  0x00, 0x7C, 0x10, 0x00, 0x00, 0x01, 0xE0, 0xC0, 0x00, 0x00, 0x0F, 0x02,
-  0x00, 0x00, 0x00, 0xF8, 0x10, 0x00, 0x00, 0x07, 0xC0, 0x80, 0x00, 0x00,
-  0x7E, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-  0x00, 0x78, 0x00, 0xC2, 0x00, 0xC0, 0x80, 0xC0, 0x60, 0x40, 0x30, 0x20,
-  0x38, 0x10, 0x3C, 0x04, 0x3C, 0x01, 0xFE, 0x00, 0x7C, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0xC2, 0x00, 0xC0, 0x80, 0x40, 0x60,
-  0x40, 0x30, 0x20, 0x1C, 0x10, 0x1C, 0x08, 0x1E, 0x02, 0x1E, 0x00, 0xFE,
-  0x00, 0x1E, 0x00, 0x00, 0x7C, 0x00, 0xC3, 0x00, 0xC0, 0xC0, 0xC0, 0x70,
-  0x40, 0x38, 0x20, 0x1C, 0x10, 0x1E, 0x04, 0x3E, 0x01, 0xFE, 0x00, 0x3C,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x61, 0x00, 0x40,
-  0xC0, 0x40, 0x70, 0x20, 0x38, 0x20, 0x1C, 0x10, 0x0E, 0x08, 0x0F, 0x04,
-  0x0F, 0x82, 0x07, 0x81, 0x0F, 0x80, 0x4F, 0xC0, 0x1F, 0xC0, 0x07, 0x80,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x06, 0x00, 0x38, 0x00,
-  0x18, 0x00, 0xF8, 0x00, 0x60, 0x07, 0xE0, 0x01, 0x00, 0x1F, 0x80, 0x04,
-  0x00, 0x7E, 0x00, 0x10, 0x01, 0xF8, 0x00, 0x40, 0x07, 0xE0, 0x01, 0x00,
-  0x1F, 0x00, 0x04, 0x00, 0x7C, 0x00, 0x10, 0x01, 0xF0, 0x00, 0x40, 0x07,
-  0xC0, 0x01, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x7C, 0x00, 0x30, 0x03, 0xF0,
-  0x00, 0x40, 0x07, 0xC0, 0x00, 0x40, 0x07, 0x00, 0x00, 0x80, 0x0C, 0x00,
-  0x01, 0x00, 0x18, 0x00, 0x01, 0x00, 0x18, 0x00, 0x02, 0x00, 0x30, 0x00,
-  0x02, 0x00, 0x20, 0x00, 0x04, 0x00, 0x60, 0x00, 0x08, 0x00, 0xC0, 0x00,
-  0x08, 0x00, 0xC0, 0x00, 0x10, 0x01, 0x80, 0x00, 0x10, 0x03, 0x80, 0x00,
-  0x20, 0x03, 0x00, 0x00, 0x40, 0x06, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00,
-  0x3F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x10, 0x00, 0x0E,
-  0x00, 0x20, 0x00, 0x3F, 0x00, 0x40, 0x00, 0x7E, 0x00, 0x80, 0x00, 0xF8,
-  0x03, 0x00, 0x01, 0xF0, 0x04, 0x00, 0x03, 0xE0, 0x0F, 0xFF, 0xFF, 0xC0,
-  0x07, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x80, 0x00, 0xE0,
-  0x01, 0x00, 0x01, 0xF0, 0x02, 0x00, 0x03, 0xF0, 0x04, 0x00, 0x03, 0xC0,
-  0x08, 0x00, 0x07, 0x80, 0x10, 0x00, 0x0F, 0x00, 0x20, 0x00, 0x1E, 0x00,
-  0x60, 0x00, 0x3C, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xF0, 0x00,
-  0x00, 0x1F, 0xFF, 0x00, 0x00, 0x20, 0x03, 0x00, 0x00, 0x20, 0x06, 0x00,
-  0x00, 0x40, 0x06, 0x00, 0x00, 0x80, 0x0C, 0x00, 0x00, 0x80, 0x0C, 0x00,
-  0x01, 0x00, 0x18, 0x00, 0x01, 0x00, 0x30, 0x00, 0x02, 0x00, 0x30, 0x00,
-  0x04, 0x00, 0x60, 0x00, 0x04, 0x00, 0x60, 0x00, 0x08, 0x00, 0xC0, 0x00,
-  0x08, 0x01, 0x80, 0x00, 0x10, 0x01, 0x80, 0x00, 0x20, 0x03, 0x00, 0x00,
-  0x40, 0x07, 0x00, 0x01, 0x00, 0x1E, 0x00, 0x04, 0x00, 0x7C, 0x00, 0x30,
-  0x03, 0xF0, 0x00, 0xC0, 0x0F, 0xC0, 0x02, 0x00, 0x3E, 0x00, 0x08, 0x00,
-  0xF8, 0x00, 0x20, 0x03, 0xE0, 0x00, 0x80, 0x0F, 0x80, 0x02, 0x00, 0x3E,
-  0x00, 0x08, 0x00, 0xF8, 0x00, 0x20, 0x03, 0xE0, 0x01, 0x80, 0x0F, 0x00,
-  0x06, 0x00, 0x3C, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xC0, 0x00,
-  0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x80, 0x00, 0x00, 0x20, 0x02,
-  0x00, 0x00, 0x00, 0x60, 0x08, 0x00, 0x00, 0x00, 0x60, 0x30, 0x00, 0x00,
-  0x00, 0xE0, 0x40, 0x00, 0x00, 0x01, 0xC1, 0x00, 0x00, 0x00, 0x03, 0x84,
-  0x00, 0x00, 0x00, 0x07, 0x0F, 0xFF, 0xFF, 0x80, 0x1E, 0x0F, 0xFF, 0xFF,
-  0x00, 0x3C, 0x00, 0x1F, 0xF8, 0x00, 0xF0, 0x00, 0xC0, 0x00, 0x01, 0xE0,
-  0x02, 0x00, 0x00, 0x07, 0x80, 0x10, 0x00, 0x00, 0x1E, 0x00, 0x40, 0x00,
-  0x00, 0x7C, 0x01, 0x00, 0x00, 0x01, 0xF0, 0x04, 0x00, 0x00, 0x0F, 0xC0,
-  0x10, 0x00, 0x00, 0x3E, 0x00, 0x20, 0x00, 0x03, 0xF8, 0x00, 0x80, 0x7F,
-  0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0x1F, 0xC0, 0x00, 0x00,
-  0x08, 0x10, 0x00, 0x00, 0x00, 0x20, 0x30, 0x00, 0x00, 0x00, 0x80, 0x70,
-  0x00, 0x00, 0x01, 0x00, 0xE0, 0x00, 0x00, 0x02, 0x03, 0xC0, 0x00, 0x00,
-  0x04, 0x0F, 0x00, 0x00, 0x00, 0x04, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xF8,
-  0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-  0xF0, 0x00, 0x00, 0x38, 0x00, 0x0F, 0x00, 0x00, 0x60, 0x00, 0x00, 0xC0,
-  0x00, 0x80, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00, 0x00, 0x10, 0x02, 0x00,
-  0x00, 0x00, 0x08, 0x04, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x00, 0x00, 0x00,
-  0x06, 0x08, 0x01, 0xFF, 0x80, 0x06, 0x10, 0x03, 0xFF, 0xE0, 0x07, 0x30,
-  0x07, 0xC2, 0x20, 0x07, 0x20, 0x07, 0x01, 0x10, 0x07, 0x60, 0x0E, 0x01,
-  0x10, 0x07, 0x40, 0x1C, 0x01, 0x90, 0x07, 0x40, 0x18, 0x01, 0xF0, 0x0F,
-  0xC0, 0x18, 0x31, 0xE0, 0x0F, 0x80, 0x18, 0x60, 0x00, 0x0E, 0x80, 0x38,
-  0x00, 0x00, 0x1E, 0x80, 0x38, 0x00, 0x00, 0x3E, 0x80, 0x3C, 0x00, 0x00,
-  0x7C, 0x80, 0x12, 0x00, 0x03, 0xF8, 0x80, 0x19, 0xFF, 0xFF, 0xF0, 0x80,
-  0x08, 0x7F, 0xFF, 0x80, 0x40, 0x04, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00,
-  0x00, 0x00, 0x40, 0x01, 0xF0, 0x00, 0x00, 0x20, 0x00, 0x18, 0x00, 0x00,
-  0x10, 0x00, 0x1C, 0x00, 0x00, 0x08, 0x00, 0x3C, 0x00, 0x00, 0x04, 0x00,
-  0x38, 0x00, 0x00, 0x03, 0x00, 0x38, 0x00, 0x00, 0x00, 0xC0, 0x78, 0x00,
-  0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-  0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x04, 0x00, 0x80, 0x00, 0x00, 0x08,
-  0x00, 0x40, 0x00, 0x00, 0x10, 0x00, 0x60, 0x00, 0x00, 0x20, 0x00, 0x30,
-  0x00, 0x00, 0x40, 0x00, 0x30, 0x00, 0x00, 0x40, 0x00, 0x30, 0x00, 0x00,
-  0x80, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x38, 0x00, 0x02, 0x00, 0x00,
-  0x18, 0x00, 0x02, 0x00, 0x40, 0x18, 0x00, 0x04, 0x00, 0xC0, 0x18, 0x00,
-  0x08, 0x00, 0xC0, 0x1C, 0x00, 0x10, 0x01, 0xC0, 0x1C, 0x00, 0x10, 0x03,
-  0xC0, 0x1C, 0x00, 0x20, 0x07, 0xC0, 0x1C, 0x00, 0x40, 0x07, 0xA0, 0x0C,
-  0x00, 0x80, 0x0F, 0x20, 0x0C, 0x00, 0x80, 0x1E, 0x20, 0x0C, 0x01, 0x00,
-  0x3E, 0x20, 0x0E, 0x02, 0x00, 0x3C, 0x20, 0x0E, 0x04, 0x00, 0x7F, 0xE0,
-  0x0E, 0x04, 0x00, 0x00, 0x00, 0x06, 0x08, 0x00, 0x00, 0x00, 0x06, 0x10,
-  0x00, 0x00, 0x30, 0x06, 0x20, 0x00, 0x00, 0x30, 0x06, 0x20, 0x00, 0x00,
-  0x70, 0x07, 0xC0, 0x00, 0x00, 0xF0, 0x07, 0x80, 0x00, 0x01, 0xF0, 0x07,
-  0x7F, 0xFF, 0xFF, 0xEF, 0xFF, 0x3F, 0xFF, 0xFF, 0xC7, 0xFF, 0x00, 0x3F,
-  0xFF, 0xFF, 0xF8, 0x00, 0x10, 0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00,
-  0x00, 0x60, 0x01, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x80, 0x00, 0x00, 0x03,
-  0x00, 0x20, 0x00, 0x00, 0x00, 0x60, 0x08, 0x00, 0x00, 0x00, 0x18, 0x04,
-  0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x40, 0x0F,
-  0xFE, 0x00, 0x70, 0x20, 0x07, 0xFF, 0x80, 0x1C, 0x08, 0x01, 0x80, 0x00,
-  0x0F, 0x02, 0x00, 0xE0, 0x00, 0x03, 0xC1, 0x00, 0x30, 0x00, 0x01, 0xF0,
-  0x40, 0x08, 0x00, 0x00, 0xF8, 0x20, 0x04, 0x00, 0x00, 0x7C, 0x08, 0x00,
-  0x00, 0x00, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x03, 0x81, 0x00, 0x00, 0x00,
-  0x00, 0xC0, 0x40, 0x0F, 0xFF, 0x00, 0x38, 0x10, 0x07, 0xFF, 0x80, 0x0E,
-  0x08, 0x00, 0x00, 0x00, 0x03, 0x82, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x80,
-  0x00, 0x00, 0x00, 0x70, 0x40, 0x00, 0x00, 0x00, 0x3C, 0x10, 0x00, 0x00,
-  0x00, 0x0E, 0x04, 0x00, 0x00, 0x00, 0x07, 0x82, 0x00, 0x00, 0x00, 0x07,
-  0xC0, 0x80, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x07,
-  0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0xC0,
-  0x00, 0x00, 0x38, 0x06, 0x00, 0x00, 0x00, 0xF8, 0x18, 0x00, 0x00, 0x03,
-  0xE0, 0x40, 0x00, 0x00, 0x0F, 0x81, 0x00, 0x00, 0x00, 0x3E, 0x06, 0x00,
-  0x00, 0x00, 0xF8, 0x18, 0x00, 0x00, 0x03, 0xE0, 0x20, 0x03, 0xFF, 0xFF,
-  0x80, 0xC0, 0x0F, 0xFF, 0xFE, 0x01, 0x00, 0x3C, 0x00, 0x00, 0x02, 0x00,
-  0xF0, 0x00, 0x00, 0x08, 0x01, 0xC0, 0x00, 0x00, 0x10, 0x07, 0x80, 0x00,
-  0x00, 0x20, 0x0E, 0x00, 0x00, 0x00, 0x40, 0x1C, 0x00, 0x00, 0x00, 0x80,
-  0x38, 0x00, 0x00, 0x01, 0x00, 0x30, 0x00, 0x00, 0x02, 0x00, 0x60, 0x00,
-  0x00, 0x04, 0x00, 0x60, 0x00, 0x00, 0x04, 0x00, 0x3F, 0xFF, 0x80, 0x08,
-  0x00, 0x00, 0x03, 0x80, 0x10, 0x00, 0x00, 0x07, 0x80, 0x10, 0x00, 0x00,
-  0x1F, 0x00, 0x10, 0x00, 0x00, 0x3C, 0x00, 0x10, 0x00, 0x00, 0xF0, 0x00,
-  0x10, 0x00, 0x03, 0xC0, 0x00, 0x18, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x00,
-  0x3E, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00,
-  0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x08, 0x00, 0x00, 0x03, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x60, 0x01, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x40,
-  0x00, 0x00, 0x01, 0x80, 0x10, 0x00, 0x00, 0x00, 0x60, 0x08, 0x00, 0x00,
-  0x00, 0x1C, 0x02, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x3F, 0xF0, 0x01,
-  0xC0, 0x40, 0x0F, 0xFC, 0x00, 0x70, 0x10, 0x03, 0x81, 0x00, 0x1C, 0x08,
-  0x01, 0xE0, 0x40, 0x0F, 0x02, 0x00, 0x70, 0x10, 0x03, 0x80, 0x80, 0x1C,
-  0x08, 0x01, 0xE0, 0x40, 0x0E, 0x06, 0x00, 0x78, 0x10, 0x03, 0x81, 0x00,
-  0x3C, 0x04, 0x01, 0xE0, 0x80, 0x0F, 0x02, 0x00, 0x70, 0x40, 0x07, 0x80,
-  0x80, 0x1C, 0x60, 0x03, 0xE0, 0x20, 0x0F, 0x60, 0x00, 0xF0, 0x10, 0x03,
-  0xE0, 0x00, 0x78, 0x04, 0x00, 0x80, 0x00, 0x3C, 0x01, 0x00, 0x00, 0x00,
-  0x1F, 0x00, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x20, 0x00, 0x00, 0x07, 0xC0,
-  0x08, 0x00, 0x00, 0x03, 0xE0, 0x04, 0x00, 0x00, 0x03, 0xF0, 0x01, 0x00,
-  0x00, 0x03, 0xF0, 0x00, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xFF, 0xFF,
-  0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-  0xFF, 0x80, 0x08, 0x00, 0x00, 0x00, 0x38, 0x01, 0x00, 0x00, 0x00, 0x07,
-  0x80, 0x20, 0x00, 0x00, 0x01, 0xE0, 0x08, 0x00, 0x00, 0x00, 0x78, 0x01,
-  0x00, 0x00, 0x00, 0x1E, 0x00, 0x20, 0x00, 0x00, 0x07, 0xC0, 0x08, 0x00,
-  0x00, 0x01, 0xF0, 0x01, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x20, 0x0F, 0xFF,
-  0xFF, 0x00, 0x08, 0x01, 0xFF, 0xFE, 0x00, 0x01, 0x00, 0x70, 0x01, 0xE0,
-  0x00, 0x40, 0x0C, 0x00, 0x7E, 0x00, 0x08, 0x01, 0x00, 0x1F, 0x80, 0x01,
-  0x00, 0x40, 0x07, 0xE0, 0x00, 0x40, 0x00, 0x01, 0xF8, 0x00, 0x08, 0x00,
-  0x00, 0x7E, 0x00, 0x01, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x40, 0x0F, 0xFF,
-  0xC0, 0x00, 0x08, 0x03, 0xFF, 0xF0, 0x00, 0x01, 0x00, 0x7F, 0xFF, 0xFC,
-  0x00, 0x40, 0x00, 0x00, 0x01, 0x80, 0x08, 0x00, 0x00, 0x00, 0x38, 0x01,
-  0x00, 0x00, 0x00, 0x0F, 0x00, 0x40, 0x00, 0x00, 0x03, 0xC0, 0x08, 0x00,
-  0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x40, 0x00, 0x00,
-  0x07, 0x80, 0x08, 0x00, 0x00, 0x01, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xF8,
-  0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-  0x80, 0x08, 0x00, 0x00, 0x00, 0x38, 0x01, 0x00, 0x00, 0x00, 0x07, 0x80,
-  0x20, 0x00, 0x00, 0x01, 0xE0, 0x08, 0x00, 0x00, 0x00, 0x78, 0x01, 0x00,
-  0x00, 0x00, 0x1E, 0x00, 0x20, 0x00, 0x00, 0x07, 0xC0, 0x08, 0x00, 0x00,
-  0x01, 0xF0, 0x01, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x20, 0x0F, 0xFF, 0xFF,
-  0x00, 0x08, 0x01, 0xFF, 0xFE, 0x00, 0x01, 0x00, 0x70, 0x00, 0xE0, 0x00,
-  0x40, 0x0C, 0x00, 0x3E, 0x00, 0x08, 0x01, 0x00, 0x0F, 0x80, 0x01, 0x00,
-  0x40, 0x03, 0xE0, 0x00, 0x40, 0x08, 0x00, 0xF8, 0x00, 0x08, 0x00, 0x00,
-  0x3E, 0x00, 0x01, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x40, 0x00, 0x01, 0xE0,
-  0x00, 0x08, 0x01, 0xFF, 0xF8, 0x00, 0x01, 0x00, 0x7F, 0xFE, 0x00, 0x00,
-  0x40, 0x0E, 0x00, 0x00, 0x00, 0x08, 0x01, 0xC0, 0x00, 0x00, 0x01, 0x00,
-  0x78, 0x00, 0x00, 0x00, 0x40, 0x0E, 0x00, 0x00, 0x00, 0x08, 0x01, 0xC0,
-  0x00, 0x00, 0x03, 0x00, 0x78, 0x00, 0x00, 0x00, 0x40, 0x0E, 0x00, 0x00,
-  0x00, 0x08, 0x01, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-  0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00,
-  0xC0, 0x00, 0x00, 0x38, 0x06, 0x00, 0x00, 0x00, 0xF8, 0x18, 0x00, 0x00,
-  0x03, 0xE0, 0x40, 0x00, 0x00, 0x07, 0x81, 0x00, 0x00, 0x00, 0x1E, 0x06,
-  0x00, 0x00, 0x00, 0x78, 0x08, 0x00, 0x00, 0x01, 0xE0, 0x20, 0x03, 0xFF,
-  0xFF, 0x80, 0xC0, 0x1F, 0xFF, 0xFE, 0x01, 0x00, 0x3C, 0x7F, 0xFE, 0x02,
-  0x00, 0xF1, 0x00, 0x06, 0x0C, 0x01, 0xE4, 0x00, 0x1E, 0x10, 0x07, 0x90,
-  0x00, 0x38, 0x20, 0x0E, 0x20, 0x00, 0xF0, 0x40, 0x1C, 0x80, 0x01, 0xE0,
-  0x80, 0x39, 0x00, 0x03, 0x81, 0x00, 0x34, 0x00, 0x0F, 0x02, 0x00, 0x70,
-  0x00, 0x1E, 0x04, 0x00, 0x7F, 0x80, 0x38, 0x04, 0x00, 0x3E, 0x00, 0xF0,
-  0x08, 0x00, 0x00, 0x01, 0xC0, 0x10, 0x00, 0x00, 0x03, 0x80, 0x10, 0x00,
-  0x00, 0x0F, 0x00, 0x10, 0x00, 0x00, 0x1C, 0x00, 0x10, 0x00, 0x00, 0x38,
-  0x00, 0x10, 0x00, 0x00, 0xF0, 0x00, 0x1C, 0x00, 0x01, 0xC0, 0x00, 0x0F,
-  0x00, 0x03, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFC,
-  0x00, 0x00, 0x00, 0x3F, 0xF8, 0x01, 0xFF, 0xC0, 0x04, 0x00, 0xC0, 0x20,
-  0x06, 0x00, 0x40, 0x0E, 0x02, 0x00, 0xF0, 0x04, 0x01, 0xE0, 0x40, 0x0E,
-  0x00, 0x80, 0x1E, 0x04, 0x00, 0xE0, 0x08, 0x01, 0xC0, 0x40, 0x1E, 0x00,
-  0x80, 0x3C, 0x08, 0x01, 0xC0, 0x10, 0x03, 0x80, 0x80, 0x1C, 0x01, 0x00,
-  0x38, 0x08, 0x03, 0xC0, 0x10, 0x07, 0x81, 0x00, 0x38, 0x02, 0x00, 0x70,
-  0x10, 0x03, 0x80, 0x20, 0x07, 0xFF, 0x00, 0x78, 0x04, 0x00, 0xE0, 0x00,
-  0x07, 0x00, 0x40, 0x0C, 0x00, 0x00, 0x70, 0x04, 0x00, 0x80, 0x00, 0x0F,
-  0x00, 0x80, 0x10, 0x00, 0x00, 0xE0, 0x08, 0x02, 0x00, 0x00, 0x1E, 0x00,
-  0x80, 0x00, 0x00, 0x01, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1C, 0x01, 0x00,
-  0x3F, 0xF8, 0x03, 0xC0, 0x10, 0x07, 0xFF, 0x00, 0x38, 0x02, 0x00, 0x70,
-  0x10, 0x03, 0x80, 0x20, 0x07, 0x01, 0x00, 0x78, 0x02, 0x00, 0xF0, 0x20,
-  0x07, 0x00, 0x40, 0x0E, 0x02, 0x00, 0x70, 0x04, 0x00, 0xE0, 0x20, 0x0F,
-  0x00, 0xC0, 0x1E, 0x04, 0x00, 0xE0, 0x08, 0x01, 0xC0, 0x40, 0x0E, 0x00,
-  0x80, 0x1C, 0x04, 0x01, 0xE0, 0x0F, 0xFF, 0x80, 0xFF, 0xFC, 0x00, 0x7F,
-  0xF8, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x02,
-  0x00, 0x00, 0x00, 0x60, 0x01, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x80, 0x00,
-  0x00, 0x0F, 0x00, 0x40, 0x00, 0x00, 0x07, 0x80, 0x10, 0x00, 0x00, 0x03,
-  0xC0, 0x08, 0x00, 0x00, 0x01, 0xE0, 0x04, 0x00, 0x00, 0x00, 0xF0, 0x01,
-  0xFF, 0x80, 0x1F, 0xF8, 0x00, 0x1F, 0xE0, 0x07, 0xFC, 0x00, 0x00, 0x10,
-  0x03, 0x80, 0x00, 0x00, 0x04, 0x00, 0xE0, 0x00, 0x00, 0x01, 0x00, 0x78,
-  0x00, 0x00, 0x00, 0x80, 0x1C, 0x00, 0x00, 0x00, 0x20, 0x07, 0x00, 0x00,
-  0x00, 0x08, 0x03, 0xC0, 0x00, 0x00, 0x04, 0x00, 0xE0, 0x00, 0x00, 0x01,
-  0x00, 0x38, 0x00, 0x00, 0x00, 0x80, 0x1E, 0x00, 0x00, 0x00, 0x20, 0x07,
-  0x00, 0x00, 0x03, 0xF8, 0x03, 0xFF, 0x80, 0x01, 0x00, 0x00, 0x00, 0x30,
-  0x00, 0x80, 0x00, 0x00, 0x1E, 0x00, 0x40, 0x00, 0x00, 0x0F, 0x80, 0x20,
-  0x00, 0x00, 0x03, 0xC0, 0x08, 0x00, 0x00, 0x01, 0xE0, 0x04, 0x00, 0x00,
-  0x00, 0xF0, 0x02, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x80, 0x00, 0x00, 0x1E,
-  0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-  0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x08, 0x01, 0x80, 0x00,
-  0x00, 0x04, 0x01, 0xE0, 0x00, 0x00, 0x04, 0x00, 0xE0, 0x00, 0x00, 0x02,
-  0x00, 0x70, 0x00, 0x00, 0x02, 0x00, 0x78, 0x00, 0x00, 0x01, 0x00, 0x38,
-  0x00, 0x00, 0x00, 0x80, 0x3C, 0x00, 0x00, 0x00, 0x80, 0x1E, 0x00, 0x00,
-  0x00, 0x40, 0x0E, 0x00, 0x00, 0x00, 0x20, 0x0F, 0x00, 0x00, 0x00, 0x20,
-  0x07, 0x00, 0x00, 0x00, 0x10, 0x03, 0x80, 0x00, 0x00, 0x08, 0x03, 0xC0,
-  0x00, 0x00, 0x08, 0x01, 0xC0, 0x00, 0x00, 0x04, 0x00, 0xE0, 0x00, 0x00,
-  0x04, 0x00, 0xF0, 0x00, 0x00, 0x02, 0x00, 0x70, 0x00, 0x00, 0x02, 0x00,
-  0x38, 0x00, 0x00, 0x06, 0x00, 0x3C, 0x00, 0x3F, 0xFE, 0x00, 0x1C, 0x00,
-  0x20, 0x00, 0x00, 0x1E, 0x00, 0x20, 0x00, 0x00, 0x0E, 0x00, 0x10, 0x00,
-  0x00, 0x0F, 0x00, 0x10, 0x00, 0x00, 0x0F, 0x00, 0x10, 0x00, 0x00, 0x07,
-  0x80, 0x08, 0x00, 0x00, 0x07, 0x80, 0x08, 0x00, 0x00, 0x0F, 0x80, 0x04,
-  0x00, 0x00, 0x1F, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF,
-  0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0xFF, 0xFC, 0x00, 0x40, 0x0C,
-  0x03, 0x00, 0x1E, 0x00, 0x40, 0x0E, 0x06, 0x00, 0x3E, 0x00, 0x40, 0x1E,
-  0x08, 0x00, 0xFC, 0x00, 0x80, 0x1C, 0x30, 0x01, 0xF8, 0x00, 0x80, 0x1C,
-  0x60, 0x03, 0xF0, 0x00, 0x80, 0x3C, 0x80, 0x07, 0xE0, 0x01, 0x00, 0x3B,
-  0x00, 0x1F, 0x80, 0x01, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x01, 0x00, 0x78,
-  0x00, 0x7E, 0x00, 0x02, 0x00, 0x70, 0x00, 0xFC, 0x00, 0x02, 0x00, 0x60,
-  0x03, 0xF0, 0x00, 0x04, 0x00, 0x80, 0x07, 0xE0, 0x00, 0x04, 0x00, 0x00,
-  0x0F, 0xC0, 0x00, 0x04, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x08, 0x00, 0x00,
-  0x3E, 0x00, 0x00, 0x08, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x08, 0x03, 0x00,
-  0x08, 0x00, 0x00, 0x10, 0x03, 0x80, 0x0C, 0x00, 0x00, 0x10, 0x03, 0x80,
-  0x06, 0x00, 0x00, 0x10, 0x07, 0xC0, 0x02, 0x00, 0x00, 0x20, 0x07, 0xA0,
-  0x03, 0x00, 0x00, 0x20, 0x07, 0x10, 0x01, 0x80, 0x00, 0x20, 0x0F, 0x10,
-  0x00, 0x80, 0x00, 0x40, 0x0E, 0x08, 0x00, 0x40, 0x00, 0x40, 0x0E, 0x04,
-  0x00, 0x60, 0x00, 0xC0, 0x1E, 0x02, 0x00, 0x30, 0x00, 0x80, 0x1C, 0x01,
-  0x00, 0x10, 0x00, 0x80, 0x1C, 0x01, 0x00, 0x18, 0x00, 0xFF, 0xFC, 0x00,
-  0xFF, 0xFC, 0x00, 0x7F, 0xF8, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x3F, 0xFC,
-  0x00, 0x00, 0x80, 0x18, 0x00, 0x01, 0x00, 0x38, 0x00, 0x02, 0x00, 0xF0,
-  0x00, 0x08, 0x01, 0xC0, 0x00, 0x10, 0x03, 0x80, 0x00, 0x20, 0x0F, 0x00,
-  0x00, 0x80, 0x1C, 0x00, 0x01, 0x00, 0x38, 0x00, 0x04, 0x00, 0xF0, 0x00,
-  0x08, 0x01, 0xC0, 0x00, 0x10, 0x03, 0x80, 0x00, 0x40, 0x0F, 0x00, 0x00,
-  0x80, 0x1C, 0x00, 0x01, 0x00, 0x78, 0x00, 0x04, 0x00, 0xF0, 0x00, 0x08,
-  0x01, 0xC0, 0x00, 0x10, 0x07, 0x80, 0x00, 0x40, 0x0F, 0x00, 0x00, 0x80,
-  0x1C, 0x00, 0x01, 0x00, 0x78, 0x00, 0x04, 0x00, 0xFF, 0xFF, 0x88, 0x00,
-  0x00, 0x01, 0x90, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x1C, 0x80, 0x00,
-  0x00, 0x7B, 0x00, 0x00, 0x01, 0xE4, 0x00, 0x00, 0x03, 0x88, 0x00, 0x00,
-  0x0F, 0x1F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F,
-  0xFF, 0x00, 0x07, 0xFF, 0xE0, 0x02, 0x00, 0x0C, 0x00, 0x40, 0x01, 0x80,
-  0x10, 0x00, 0x60, 0x06, 0x00, 0x0E, 0x00, 0x80, 0x03, 0x80, 0x60, 0x00,
-  0xF0, 0x08, 0x00, 0x1C, 0x02, 0x00, 0x07, 0x00, 0x40, 0x00, 0x60, 0x20,
-  0x00, 0x38, 0x02, 0x00, 0x03, 0x02, 0x00, 0x03, 0xC0, 0x20, 0x00, 0x18,
-  0x20, 0x00, 0x1C, 0x01, 0x00, 0x00, 0xC2, 0x00, 0x00, 0xE0, 0x08, 0x00,
-  0x07, 0x20, 0x00, 0x0F, 0x00, 0x80, 0x00, 0x1A, 0x00, 0x00, 0x70, 0x04,
-  0x00, 0x00, 0xD0, 0x00, 0x07, 0x80, 0x40, 0x00, 0x07, 0x00, 0x00, 0x38,
-  0x02, 0x00, 0x00, 0x30, 0x00, 0x01, 0xC0, 0x10, 0x04, 0x01, 0x00, 0x40,
-  0x1E, 0x01, 0x00, 0x20, 0x00, 0x04, 0x00, 0xE0, 0x08, 0x01, 0x80, 0x00,
-  0x60, 0x07, 0x00, 0x40, 0x1C, 0x00, 0x07, 0x00, 0x78, 0x04, 0x00, 0xE0,
-  0x00, 0x70, 0x03, 0x80, 0x20, 0x07, 0x00, 0x03, 0x80, 0x1C, 0x01, 0x00,
-  0x78, 0x00, 0x3C, 0x01, 0xE0, 0x10, 0x03, 0xC0, 0x03, 0xC0, 0x0E, 0x00,
-  0x80, 0x1D, 0x00, 0x3E, 0x00, 0x70, 0x04, 0x01, 0xE8, 0x03, 0xF0, 0x07,
-  0x80, 0x40, 0x0E, 0x40, 0x3F, 0x00, 0x38, 0x02, 0x00, 0x72, 0x03, 0xE8,
-  0x01, 0xC0, 0x30, 0x07, 0x90, 0x3E, 0x80, 0x1C, 0x01, 0x00, 0x38, 0x81,
-  0xE4, 0x00, 0xE0, 0x08, 0x01, 0xC2, 0x1E, 0x20, 0x07, 0x00, 0x7F, 0xFC,
-  0x0F, 0xE1, 0xFF, 0xF0, 0x01, 0xFF, 0xE0, 0x3E, 0x07, 0xFF, 0x80, 0x00,
-  0x00, 0x3F, 0xFF, 0x01, 0xFF, 0xC0, 0x04, 0x00, 0x18, 0x20, 0x06, 0x00,
-  0x40, 0x01, 0x82, 0x00, 0xF0, 0x04, 0x00, 0x1C, 0x40, 0x0E, 0x00, 0x80,
-  0x01, 0xC4, 0x00, 0xE0, 0x08, 0x00, 0x0C, 0x40, 0x1E, 0x00, 0x80, 0x00,
-  0xC8, 0x01, 0xC0, 0x10, 0x00, 0x0C, 0x80, 0x1C, 0x01, 0x00, 0x00, 0xC8,
-  0x03, 0xC0, 0x10, 0x00, 0x0F, 0x00, 0x38, 0x02, 0x00, 0x00, 0x70, 0x03,
-  0x80, 0x20, 0x00, 0x07, 0x00, 0x78, 0x04, 0x00, 0x00, 0x60, 0x07, 0x00,
-  0x40, 0x00, 0x06, 0x00, 0x70, 0x04, 0x01, 0x00, 0x60, 0x0F, 0x00, 0x80,
-  0x10, 0x04, 0x00, 0xE0, 0x08, 0x01, 0x80, 0x00, 0x1E, 0x00, 0x80, 0x38,
-  0x00, 0x01, 0xC0, 0x10, 0x03, 0x80, 0x00, 0x1C, 0x01, 0x00, 0x38, 0x00,
-  0x03, 0xC0, 0x10, 0x07, 0x80, 0x00, 0x38, 0x02, 0x00, 0x78, 0x00, 0x03,
-  0x80, 0x20, 0x07, 0x40, 0x00, 0x78, 0x02, 0x00, 0xF4, 0x00, 0x07, 0x00,
-  0x40, 0x0E, 0x40, 0x00, 0x70, 0x04, 0x00, 0xE4, 0x00, 0x0F, 0x00, 0xC0,
-  0x1E, 0x40, 0x00, 0xE0, 0x08, 0x01, 0xC2, 0x00, 0x0E, 0x00, 0x80, 0x1C,
-  0x20, 0x01, 0xE0, 0x0F, 0xFF, 0xC1, 0xFF, 0xFC, 0x00, 0x7F, 0xF8, 0x0F,
-  0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x38, 0x00, 0x0E,
-  0x00, 0x01, 0x80, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x30,
-  0x00, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00,
-  0x06, 0x04, 0x00, 0x00, 0x00, 0x06, 0x10, 0x00, 0xFF, 0x00, 0x0C, 0x60,
-  0x07, 0xFF, 0x00, 0x1C, 0x80, 0x1F, 0x01, 0x00, 0x3B, 0x00, 0x7C, 0x02,
-  0x00, 0x74, 0x01, 0xE0, 0x04, 0x00, 0xE8, 0x03, 0xC0, 0x08, 0x01, 0xF0,
-  0x07, 0x00, 0x10, 0x03, 0xC0, 0x0E, 0x00, 0x40, 0x0F, 0x80, 0x18, 0x01,
-  0x80, 0x1F, 0x00, 0x30, 0x06, 0x00, 0x3A, 0x00, 0x60, 0x18, 0x00, 0xF4,
-  0x00, 0x60, 0x60, 0x01, 0xE8, 0x00, 0x7F, 0x00, 0x07, 0x90, 0x00, 0x00,
-  0x00, 0x0F, 0x20, 0x00, 0x00, 0x00, 0x3C, 0x20, 0x00, 0x00, 0x00, 0xF0,
-  0x40, 0x00, 0x00, 0x03, 0xE0, 0x40, 0x00, 0x00, 0x0F, 0x80, 0x40, 0x00,
-  0x00, 0x7E, 0x00, 0x60, 0x00, 0x01, 0xF0, 0x00, 0x38, 0x00, 0x1F, 0xC0,
-  0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-  0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x10, 0x00, 0x00, 0x03, 0x00, 0x04, 0x00,
-  0x00, 0x00, 0x60, 0x01, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x80, 0x00, 0x00,
-  0x03, 0x00, 0x20, 0x00, 0x00, 0x00, 0x60, 0x08, 0x00, 0x00, 0x00, 0x18,
-  0x04, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x40,
-  0x0F, 0xFE, 0x00, 0x70, 0x20, 0x07, 0xFF, 0x80, 0x1C, 0x08, 0x01, 0x80,
-  0x00, 0x07, 0x04, 0x00, 0xC0, 0x00, 0x03, 0xC1, 0x00, 0x20, 0x00, 0x00,
-  0xE0, 0x40, 0x10, 0x00, 0x00, 0x78, 0x20, 0x00, 0x00, 0x00, 0x3C, 0x08,
-  0x00, 0x00, 0x00, 0x1F, 0x02, 0x00, 0x00, 0x00, 0x1F, 0x81, 0x00, 0x00,
-  0x00, 0x1F, 0xC0, 0x40, 0x0F, 0xFF, 0xFF, 0xC0, 0x10, 0x07, 0xFF, 0xFF,
-  0xC0, 0x08, 0x01, 0xC0, 0x00, 0x00, 0x02, 0x00, 0x70, 0x00, 0x00, 0x00,
-  0x80, 0x3C, 0x00, 0x00, 0x00, 0x40, 0x0E, 0x00, 0x00, 0x00, 0x10, 0x03,
-  0x80, 0x00, 0x00, 0x0C, 0x01, 0xE0, 0x00, 0x00, 0x02, 0x00, 0x70, 0x00,
-  0x00, 0x00, 0x80, 0x1C, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00,
-  0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00,
-  0xE0, 0x00, 0x78, 0x00, 0x06, 0x00, 0x00, 0x30, 0x00, 0x60, 0x00, 0x00,
-  0x20, 0x03, 0x00, 0x00, 0x00, 0x40, 0x18, 0x00, 0x00, 0x01, 0x80, 0xC0,
-  0x00, 0x00, 0x03, 0x06, 0x00, 0x00, 0x00, 0x0E, 0x10, 0x00, 0xFF, 0x00,
-  0x18, 0x80, 0x0F, 0xFE, 0x00, 0x72, 0x00, 0x7C, 0x04, 0x01, 0xD0, 0x03,
-  0xE0, 0x10, 0x07, 0x40, 0x0F, 0x00, 0x40, 0x1D, 0x00, 0x78, 0x01, 0x00,
-  0x78, 0x01, 0xFF, 0xF4, 0x01, 0xE0, 0x06, 0x00, 0x20, 0x0F, 0x80, 0x1C,
-  0x00, 0x80, 0x3E, 0x00, 0x70, 0x00, 0x00, 0xE8, 0x01, 0xC0, 0x00, 0x07,
-  0xA0, 0x02, 0x80, 0x00, 0x1E, 0x80, 0x06, 0x00, 0x00, 0xF2, 0x00, 0x00,
-  0x00, 0x07, 0xC4, 0x00, 0x00, 0x00, 0x3E, 0x10, 0x00, 0x00, 0x00, 0xF0,
-  0x20, 0x00, 0x00, 0x07, 0x80, 0x40, 0x00, 0x00, 0x3E, 0x00, 0x80, 0x00,
-  0x00, 0x70, 0x01, 0xC0, 0x00, 0x01, 0x80, 0x03, 0xFE, 0x00, 0x02, 0x00,
-  0x03, 0xFF, 0xC0, 0x0C, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x01,
-  0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xF0,
-  0x00, 0x10, 0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0x01,
-  0x00, 0x00, 0x00, 0x08, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x20, 0x00,
-  0x00, 0x00, 0x60, 0x08, 0x00, 0x00, 0x00, 0x18, 0x04, 0x00, 0x00, 0x00,
-  0x07, 0x01, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x40, 0x0F, 0xFE, 0x00, 0x70,
-  0x20, 0x07, 0xFF, 0x80, 0x1C, 0x08, 0x01, 0x80, 0x00, 0x07, 0x02, 0x00,
-  0xC0, 0x00, 0x03, 0xC1, 0x00, 0x20, 0x00, 0x01, 0xF0, 0x40, 0x10, 0x00,
-  0x00, 0x78, 0x20, 0x00, 0x00, 0x00, 0x7E, 0x08, 0x00, 0x00, 0x00, 0x7F,
-  0x02, 0x00, 0x00, 0x00, 0xFF, 0x81, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x40,
-  0x08, 0x00, 0x7F, 0xC0, 0x10, 0x07, 0x00, 0x0F, 0x00, 0x08, 0x01, 0xE0,
-  0x01, 0x00, 0x02, 0x00, 0x74, 0x00, 0x20, 0x00, 0x80, 0x3C, 0x80, 0x04,
-  0x00, 0x40, 0x0E, 0x10, 0x00, 0x80, 0x10, 0x03, 0x82, 0x00, 0x10, 0x04,
-  0x01, 0xE0, 0x40, 0x02, 0x02, 0x00, 0x70, 0x08, 0x00, 0x40, 0x80, 0x1C,
-  0x01, 0x00, 0x18, 0x1F, 0xFF, 0x00, 0x3F, 0xFF, 0x07, 0xFF, 0x80, 0x03,
-  0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x60, 0x00, 0x00,
-  0x01, 0xC0, 0x04, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x40, 0x00, 0x00, 0x01,
-  0xF0, 0x04, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x00, 0x01, 0xF0,
-  0x02, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x10, 0x00, 0x00, 0x01, 0xF0, 0x01,
-  0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x08, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x40,
-  0x07, 0xFF, 0xC0, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x10, 0x00,
-  0x00, 0x04, 0x00, 0x00, 0x40, 0x00, 0x00, 0x30, 0x00, 0x02, 0x00, 0x00,
-  0x00, 0xC0, 0x00, 0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x00,
-  0x18, 0x00, 0x01, 0x80, 0x00, 0x00, 0xC0, 0x00, 0x07, 0xFF, 0xE0, 0x07,
-  0x00, 0x00, 0x1F, 0xFF, 0x80, 0x38, 0x00, 0x00, 0x3F, 0xF8, 0x01, 0xC0,
-  0x01, 0xFF, 0xFF, 0xC0, 0x0E, 0x00, 0x10, 0x00, 0x00, 0x00, 0xF0, 0x00,
-  0x80, 0x00, 0x00, 0x07, 0x80, 0x08, 0x00, 0x00, 0x00, 0x38, 0x00, 0x80,
-  0x00, 0x00, 0x03, 0xC0, 0x08, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x40, 0x00,
-  0x00, 0x03, 0xE0, 0x04, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x7F, 0xFF, 0xFF,
-  0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-  0xFF, 0xC0, 0x80, 0x00, 0x00, 0x18, 0x20, 0x00, 0x00, 0x07, 0x88, 0x00,
-  0x00, 0x00, 0xF2, 0x00, 0x00, 0x00, 0x3C, 0xC0, 0x00, 0x00, 0x0F, 0x30,
-  0x00, 0x00, 0x03, 0xC4, 0x00, 0x00, 0x00, 0xF0, 0x7F, 0xC0, 0x0F, 0xFC,
-  0x07, 0xF8, 0x01, 0xFF, 0x00, 0x02, 0x00, 0x70, 0x00, 0x00, 0x40, 0x0E,
-  0x00, 0x00, 0x08, 0x01, 0xC0, 0x00, 0x02, 0x00, 0x70, 0x00, 0x00, 0x40,
-  0x0E, 0x00, 0x00, 0x08, 0x03, 0xC0, 0x00, 0x02, 0x00, 0x70, 0x00, 0x00,
-  0x40, 0x0E, 0x00, 0x00, 0x08, 0x03, 0xC0, 0x00, 0x02, 0x00, 0x70, 0x00,
-  0x00, 0x40, 0x0E, 0x00, 0x00, 0x08, 0x03, 0xC0, 0x00, 0x02, 0x00, 0x70,
-  0x00, 0x00, 0x40, 0x0E, 0x00, 0x00, 0x08, 0x03, 0xC0, 0x00, 0x02, 0x00,
-  0x70, 0x00, 0x00, 0x40, 0x0E, 0x00, 0x00, 0x08, 0x03, 0xC0, 0x00, 0x02,
-  0x00, 0x70, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00,
-  0x00, 0x03, 0xFF, 0x80, 0x0F, 0xFF, 0x02, 0x00, 0x60, 0x08, 0x01, 0xC1,
-  0x00, 0x38, 0x04, 0x00, 0xE0, 0x80, 0x3C, 0x02, 0x00, 0xF0, 0x80, 0x1C,
-  0x02, 0x00, 0x70, 0x40, 0x0E, 0x01, 0x00, 0x38, 0x20, 0x0F, 0x00, 0x80,
-  0x3C, 0x20, 0x07, 0x00, 0x80, 0x1C, 0x10, 0x07, 0x80, 0x40, 0x0E, 0x08,
-  0x03, 0xC0, 0x20, 0x0F, 0x08, 0x01, 0xC0, 0x20, 0x07, 0x04, 0x01, 0xE0,
-  0x10, 0x03, 0x82, 0x00, 0xF0, 0x10, 0x03, 0xC3, 0x00, 0x70, 0x08, 0x01,
-  0xC1, 0x00, 0x38, 0x04, 0x00, 0xE0, 0x80, 0x38, 0x04, 0x00, 0xF0, 0x40,
-  0x1C, 0x02, 0x00, 0x70, 0x40, 0x0E, 0x02, 0x00, 0x78, 0x20, 0x07, 0x02,
-  0x00, 0x38, 0x10, 0x03, 0x82, 0x00, 0x1C, 0x08, 0x00, 0xFE, 0x00, 0x1E,
-  0x04, 0x00, 0x00, 0x00, 0x0E, 0x02, 0x00, 0x00, 0x00, 0x0F, 0x01, 0x00,
-  0x00, 0x00, 0x0F, 0x00, 0x80, 0x00, 0x00, 0x07, 0x80, 0x20, 0x00, 0x00,
-  0x07, 0x80, 0x08, 0x00, 0x00, 0x07, 0x80, 0x02, 0x00, 0x00, 0x0F, 0x80,
-  0x00, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x01,
-  0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x3F, 0xFC, 0x80, 0x30, 0x00,
-  0x40, 0x0E, 0x80, 0x30, 0x00, 0x80, 0x0F, 0x80, 0x38, 0x01, 0x80, 0x1E,
-  0x80, 0x38, 0x01, 0x00, 0x3E, 0x40, 0x38, 0x02, 0x00, 0x3C, 0x40, 0x18,
-  0x04, 0x00, 0x78, 0x40, 0x18, 0x04, 0x00, 0xF0, 0x40, 0x18, 0x08, 0x01,
-  0xF0, 0x40, 0x18, 0x10, 0x01, 0xE0, 0x40, 0x18, 0x20, 0x03, 0xC0, 0x40,
-  0x1C, 0x20, 0x07, 0x80, 0x20, 0x1C, 0x40, 0x0F, 0x80, 0x20, 0x1C, 0x80,
-  0x0F, 0x00, 0x20, 0x0D, 0x00, 0x1E, 0x00, 0x20, 0x0D, 0x00, 0x3C, 0x00,
-  0x20, 0x0E, 0x00, 0x3C, 0x00, 0x20, 0x0C, 0x00, 0x78, 0x00, 0x20, 0x08,
-  0x00, 0xF0, 0x00, 0x10, 0x08, 0x01, 0xE0, 0x00, 0x10, 0x00, 0x01, 0xE0,
-  0x00, 0x10, 0x00, 0x03, 0xC0, 0x00, 0x10, 0x00, 0x07, 0x80, 0x00, 0x10,
-  0x00, 0x0F, 0x00, 0x00, 0x10, 0x00, 0x0F, 0x00, 0x00, 0x08, 0x00, 0x1E,
-  0x00, 0x00, 0x08, 0x00, 0x3C, 0x00, 0x00, 0x08, 0x00, 0x78, 0x00, 0x00,
-  0x04, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF,
-  0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x3F, 0xF9, 0x00, 0xC1, 0x80,
-  0x60, 0x40, 0x1A, 0x01, 0xC2, 0x00, 0xE1, 0x00, 0x7C, 0x03, 0x88, 0x01,
-  0xC4, 0x01, 0xE8, 0x07, 0x10, 0x03, 0x88, 0x03, 0xD0, 0x0E, 0x40, 0x07,
-  0x20, 0x0F, 0x20, 0x1D, 0x00, 0x0E, 0x80, 0x3C, 0x40, 0x3A, 0x00, 0x1E,
-  0x00, 0x78, 0x80, 0x78, 0x00, 0x3C, 0x01, 0xE1, 0x00, 0xE0, 0x00, 0x70,
-  0x07, 0x82, 0x01, 0xC0, 0x00, 0xC0, 0x0F, 0x04, 0x03, 0x00, 0x01, 0x80,
-  0x3C, 0x08, 0x06, 0x00, 0x02, 0x00, 0xF8, 0x10, 0x08, 0x00, 0x00, 0x01,
-  0xE0, 0x20, 0x00, 0x00, 0x00, 0x07, 0x80, 0x40, 0x00, 0x00, 0x00, 0x0F,
-  0x00, 0x80, 0x00, 0x00, 0x00, 0x3C, 0x01, 0x00, 0x01, 0x00, 0x00, 0xF0,
-  0x02, 0x00, 0x02, 0x00, 0x01, 0xE0, 0x04, 0x00, 0x0C, 0x00, 0x07, 0x80,
-  0x08, 0x00, 0x38, 0x00, 0x1E, 0x00, 0x10, 0x00, 0x70, 0x00, 0x3C, 0x00,
-  0x20, 0x01, 0xF0, 0x00, 0xF0, 0x00, 0x40, 0x07, 0xE0, 0x03, 0xC0, 0x00,
-  0x80, 0x0F, 0x40, 0x07, 0x80, 0x01, 0x00, 0x3C, 0x80, 0x1E, 0x00, 0x02,
-  0x00, 0xF9, 0x00, 0x78, 0x00, 0x04, 0x01, 0xE2, 0x00, 0xF0, 0x00, 0x08,
-  0x07, 0x84, 0x03, 0xC0, 0x00, 0x0F, 0xFE, 0x03, 0xFF, 0x00, 0x00, 0x07,
-  0xF8, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0xFF, 0xF8,
-  0x00, 0x20, 0x03, 0x02, 0x00, 0x38, 0x00, 0x20, 0x06, 0x08, 0x00, 0xF8,
-  0x00, 0x40, 0x06, 0x20, 0x03, 0xE0, 0x00, 0x80, 0x0C, 0x80, 0x0F, 0x80,
-  0x00, 0x80, 0x0E, 0x00, 0x3E, 0x00, 0x01, 0x00, 0x18, 0x00, 0xF8, 0x00,
-  0x01, 0x00, 0x20, 0x07, 0xE0, 0x00, 0x02, 0x00, 0x00, 0x1F, 0x80, 0x00,
-  0x04, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x04, 0x00, 0x01, 0xF8, 0x00, 0x00,
-  0x08, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x08, 0x00, 0x1F, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x01, 0xF0, 0x00, 0x00, 0x00,
-  0x40, 0x03, 0xC0, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x00, 0x00, 0x04,
-  0x00, 0x0C, 0x00, 0x00, 0x00, 0x30, 0x00, 0x0C, 0x00, 0x00, 0x00, 0xC0,
-  0x00, 0x18, 0x00, 0x00, 0x02, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00,
-  0x00, 0x30, 0x00, 0x00, 0x20, 0x00, 0x00, 0x60, 0x00, 0x00, 0x80, 0x0C,
-  0x00, 0x60, 0x00, 0x02, 0x00, 0x38, 0x00, 0xC0, 0x00, 0x08, 0x00, 0xF8,
-  0x01, 0xC0, 0x00, 0x60, 0x03, 0xD0, 0x01, 0x80, 0x01, 0x80, 0x0F, 0x20,
-  0x03, 0x00, 0x06, 0x00, 0x3C, 0x20, 0x03, 0x00, 0x1F, 0xFF, 0xF0, 0x3F,
-  0xFE, 0x00, 0x0F, 0xFF, 0xC0, 0x3F, 0xFE, 0x00, 0x00, 0xFF, 0xF8, 0x07,
-  0xFF, 0xC8, 0x00, 0x80, 0x80, 0x0E, 0x40, 0x0C, 0x10, 0x01, 0xF4, 0x00,
-  0x62, 0x00, 0x3E, 0x40, 0x06, 0x40, 0x07, 0xC2, 0x00, 0x38, 0x00, 0xF8,
-  0x20, 0x03, 0x00, 0x1F, 0x01, 0x00, 0x20, 0x07, 0xE0, 0x10, 0x00, 0x00,
-  0xF8, 0x01, 0x00, 0x00, 0x1F, 0x00, 0x08, 0x00, 0x03, 0xE0, 0x00, 0x80,
-  0x00, 0x7C, 0x00, 0x08, 0x00, 0x0F, 0x80, 0x00, 0x40, 0x01, 0xF0, 0x00,
-  0x04, 0x00, 0x3E, 0x00, 0x00, 0x20, 0x07, 0xC0, 0x00, 0x04, 0x00, 0xF0,
-  0x00, 0x00, 0x40, 0x0E, 0x00, 0x00, 0x04, 0x01, 0xE0, 0x00, 0x00, 0x80,
-  0x1C, 0x00, 0x00, 0x08, 0x01, 0xC0, 0x00, 0x00, 0x80, 0x3C, 0x00, 0x00,
-  0x10, 0x03, 0x80, 0x00, 0x01, 0x00, 0x38, 0x00, 0x00, 0x10, 0x07, 0x80,
-  0x00, 0x02, 0x00, 0x70, 0x00, 0x00, 0x20, 0x07, 0x00, 0x00, 0x02, 0x00,
-  0xF0, 0x00, 0x00, 0x40, 0x0E, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00,
-  0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-  0x40, 0x00, 0x00, 0x0E, 0x00, 0x08, 0x00, 0x00, 0x01, 0xF0, 0x01, 0x00,
-  0x00, 0x00, 0x3E, 0x00, 0x20, 0x00, 0x00, 0x07, 0xC0, 0x02, 0x00, 0x00,
-  0x00, 0xF8, 0x00, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x08, 0x00, 0x00, 0x07,
-  0xE0, 0x00, 0xFF, 0xFC, 0x00, 0xF8, 0x00, 0x07, 0xFF, 0x80, 0x1F, 0x00,
-  0x00, 0x00, 0x30, 0x03, 0xE0, 0x00, 0x00, 0x06, 0x00, 0x7C, 0x00, 0x00,
-  0x00, 0xC0, 0x0F, 0x80, 0x00, 0x00, 0x18, 0x01, 0xF0, 0x00, 0x00, 0x03,
-  0x00, 0x3E, 0x00, 0x00, 0x00, 0x60, 0x07, 0xC0, 0x00, 0x00, 0x0C, 0x00,
-  0xF8, 0x00, 0x00, 0x01, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x30, 0x03, 0xE0,
-  0x00, 0x00, 0x06, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xC0, 0x0F, 0xFF, 0xC0,
-  0x00, 0x18, 0x00, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0xF0, 0x00,
-  0x60, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x00, 0x01, 0xE0, 0x01, 0x80,
-  0x00, 0x00, 0x3C, 0x00, 0x30, 0x00, 0x00, 0x07, 0x80, 0x06, 0x00, 0x00,
-  0x00, 0x78, 0x00, 0x40, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-  0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-  0x00, 0x02, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x3C, 0x00, 0x40, 0x00,
-  0x1E, 0x00, 0x20, 0x00, 0x0F, 0x00, 0x08, 0x00, 0x07, 0x80, 0x02, 0x00,
-  0x03, 0xE0, 0x01, 0x00, 0x01, 0xF0, 0x00, 0x40, 0x0F, 0xF8, 0x00, 0x10,
-  0x07, 0xFC, 0x00, 0x08, 0x01, 0xC0, 0x00, 0x02, 0x00, 0x70, 0x00, 0x00,
-  0x80, 0x3C, 0x00, 0x00, 0x40, 0x0E, 0x00, 0x00, 0x10, 0x07, 0x80, 0x00,
-  0x04, 0x01, 0xC0, 0x00, 0x02, 0x00, 0x70, 0x00, 0x00, 0x80, 0x3C, 0x00,
-  0x00, 0x20, 0x0E, 0x00, 0x00, 0x10, 0x03, 0x80, 0x00, 0x04, 0x01, 0xE0,
-  0x00, 0x02, 0x00, 0x70, 0x00, 0x00, 0x80, 0x1C, 0x00, 0x00, 0x20, 0x0F,
-  0x00, 0x00, 0x10, 0x03, 0x80, 0x00, 0x04, 0x01, 0xE0, 0x00, 0x01, 0x00,
-  0x7F, 0xC0, 0x00, 0x80, 0x00, 0x18, 0x00, 0x20, 0x00, 0x0F, 0x00, 0x08,
-  0x00, 0x03, 0xC0, 0x04, 0x00, 0x01, 0xE0, 0x01, 0x00, 0x00, 0xF8, 0x00,
-  0xC0, 0x00, 0x7C, 0x00, 0x20, 0x00, 0x1E, 0x00, 0x08, 0x00, 0x0F, 0x00,
-  0x03, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF8,
-  0x00, 0x20, 0x03, 0x00, 0x04, 0x00, 0xC0, 0x01, 0x00, 0x18, 0x00, 0x40,
-  0x06, 0x00, 0x08, 0x00, 0xC0, 0x02, 0x00, 0x30, 0x00, 0x40, 0x0C, 0x00,
-  0x10, 0x01, 0x80, 0x04, 0x00, 0x60, 0x00, 0x80, 0x0C, 0x00, 0x20, 0x03,
-  0x00, 0x08, 0x00, 0xC0, 0x01, 0x00, 0x18, 0x00, 0x40, 0x06, 0x00, 0x08,
-  0x00, 0xC0, 0x02, 0x00, 0x30, 0x00, 0x80, 0x0C, 0x00, 0x10, 0x01, 0x80,
-  0x04, 0x00, 0x60, 0x00, 0x80, 0x1C, 0x00, 0x20, 0x03, 0x00, 0x08, 0x00,
-  0xC0, 0x01, 0x00, 0x18, 0x00, 0x40, 0x06, 0x00, 0x08, 0x01, 0xC0, 0x02,
-  0x00, 0x30, 0x00, 0x80, 0x0C, 0x00, 0x10, 0x01, 0x80, 0x03, 0xFF, 0xE0,
-  0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x40, 0x00, 0x60,
-  0x00, 0x20, 0x00, 0x1C, 0x00, 0x30, 0x00, 0x0F, 0x00, 0x08, 0x00, 0x03,
-  0x80, 0x04, 0x00, 0x00, 0xE0, 0x02, 0x00, 0x00, 0x78, 0x00, 0x80, 0x00,
-  0x1C, 0x00, 0x3F, 0xE0, 0x0F, 0x00, 0x07, 0xF0, 0x03, 0xC0, 0x00, 0x04,
-  0x00, 0xE0, 0x00, 0x01, 0x00, 0x78, 0x00, 0x00, 0x80, 0x1C, 0x00, 0x00,
-  0x20, 0x07, 0x00, 0x00, 0x08, 0x03, 0xC0, 0x00, 0x04, 0x00, 0xE0, 0x00,
-  0x01, 0x00, 0x38, 0x00, 0x00, 0x80, 0x1E, 0x00, 0x00, 0x20, 0x07, 0x00,
-  0x00, 0x08, 0x01, 0xC0, 0x00, 0x04, 0x00, 0xF0, 0x00, 0x01, 0x00, 0x38,
-  0x00, 0x00, 0x40, 0x1E, 0x00, 0x00, 0x20, 0x07, 0x00, 0x00, 0x08, 0x01,
-  0xC0, 0x00, 0x04, 0x00, 0xF0, 0x00, 0x3F, 0x00, 0x38, 0x00, 0x10, 0x00,
-  0x0E, 0x00, 0x08, 0x00, 0x07, 0x80, 0x06, 0x00, 0x01, 0xC0, 0x01, 0x00,
-  0x00, 0x70, 0x00, 0x80, 0x00, 0x3C, 0x00, 0x60, 0x00, 0x0E, 0x00, 0x10,
-  0x00, 0x03, 0x80, 0x08, 0x00, 0x01, 0xC0, 0x03, 0xFF, 0xFF, 0xF0, 0x00,
-  0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00,
-  0x02, 0x00, 0x20, 0x00, 0x00, 0x02, 0x00, 0x18, 0x00, 0x00, 0x02, 0x00,
-  0x06, 0x00, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x01, 0x80,
-  0x00, 0x01, 0x00, 0x00, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x30, 0x00, 0x01,
-  0x00, 0x00, 0x18, 0x00, 0x00, 0x80, 0x00, 0x0C, 0x00, 0x00, 0x80, 0x10,
-  0x06, 0x00, 0x00, 0x80, 0x18, 0x03, 0x80, 0x00, 0x80, 0x0C, 0x01, 0xC0,
-  0x00, 0x40, 0x0E, 0x00, 0xE0, 0x00, 0x40, 0x0F, 0x80, 0x30, 0x00, 0x40,
-  0x07, 0xC0, 0x18, 0x00, 0x40, 0x07, 0xA0, 0x0C, 0x00, 0x20, 0x07, 0x90,
-  0x07, 0x00, 0x20, 0x07, 0xC8, 0x03, 0x80, 0x20, 0x03, 0xC4, 0x01, 0xC0,
-  0x20, 0x03, 0xC2, 0x00, 0xE0, 0x10, 0x03, 0xE0, 0x80, 0x30, 0x10, 0x01,
-  0xE0, 0x40, 0x18, 0x10, 0x01, 0xE0, 0x20, 0x0C, 0x10, 0x01, 0xE0, 0x10,
-  0x07, 0x08, 0x00, 0xF0, 0x08, 0x03, 0x88, 0x00, 0xF0, 0x04, 0x01, 0xC8,
-  0x00, 0xF0, 0x02, 0x00, 0x68, 0x00, 0xF0, 0x00, 0x80, 0x37, 0xFF, 0xF8,
-  0x00, 0x3F, 0xF8, 0xFF, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xFF, 0xF0,
-  0x02, 0x00, 0x00, 0xE0, 0x10, 0x00, 0x07, 0xC0, 0x80, 0x00, 0x3E, 0x04,
-  0x00, 0x01, 0xF0, 0x20, 0x00, 0x0F, 0x81, 0x00, 0x00, 0x7C, 0x08, 0x00,
-  0x03, 0xE0, 0x40, 0x00, 0x1F, 0x01, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF,
-  0xC0, 0x00, 0x38, 0x32, 0x30, 0x90, 0x68, 0x34, 0x1D, 0x0E, 0x4F, 0x1F,
-  0x87, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x04, 0x00,
-  0x80, 0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x10, 0x00, 0x60, 0x00,
-  0x00, 0x20, 0x00, 0x30, 0x00, 0x00, 0x40, 0x00, 0x30, 0x00, 0x00, 0x40,
-  0x00, 0x30, 0x00, 0x00, 0x80, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x38,
-  0x00, 0x02, 0x00, 0x00, 0x18, 0x00, 0x02, 0x00, 0x40, 0x18, 0x00, 0x04,
-  0x00, 0xC0, 0x18, 0x00, 0x08, 0x00, 0xC0, 0x1C, 0x00, 0x10, 0x01, 0xC0,
-  0x1C, 0x00, 0x10, 0x03, 0xC0, 0x1C, 0x00, 0x20, 0x07, 0xC0, 0x1C, 0x00,
-  0x40, 0x07, 0xA0, 0x0C, 0x00, 0x80, 0x0F, 0x20, 0x0C, 0x00, 0x80, 0x1E,
-  0x20, 0x0C, 0x01, 0x00, 0x3E, 0x20, 0x0E, 0x02, 0x00, 0x3C, 0x20, 0x0E,
-  0x04, 0x00, 0x7F, 0xE0, 0x0E, 0x04, 0x00, 0x00, 0x00, 0x06, 0x08, 0x00,
-  0x00, 0x00, 0x06, 0x10, 0x00, 0x00, 0x30, 0x06, 0x20, 0x00, 0x00, 0x30,
-  0x06, 0x20, 0x00, 0x00, 0x70, 0x07, 0xC0, 0x00, 0x00, 0xF0, 0x07, 0x80,
-  0x00, 0x01, 0xF0, 0x07, 0x7F, 0xFF, 0xFF, 0xEF, 0xFF, 0x3F, 0xFF, 0xFF,
-  0xC7, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x10, 0x00, 0x00, 0x03,
-  0x00, 0x04, 0x00, 0x00, 0x00, 0x60, 0x01, 0x00, 0x00, 0x00, 0x0C, 0x00,
-  0x80, 0x00, 0x00, 0x03, 0x00, 0x20, 0x00, 0x00, 0x00, 0x60, 0x08, 0x00,
-  0x00, 0x00, 0x18, 0x04, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0xC0, 0x40, 0x0F, 0xFE, 0x00, 0x70, 0x20, 0x07, 0xFF, 0x80, 0x1C,
-  0x08, 0x01, 0x80, 0x00, 0x0F, 0x02, 0x00, 0xE0, 0x00, 0x03, 0xC1, 0x00,
-  0x30, 0x00, 0x01, 0xF0, 0x40, 0x08, 0x00, 0x00, 0xF8, 0x20, 0x04, 0x00,
-  0x00, 0x7C, 0x08, 0x00, 0x00, 0x00, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x03,
-  0x81, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x40, 0x0F, 0xFF, 0x00, 0x38, 0x10,
-  0x07, 0xFF, 0x80, 0x0E, 0x08, 0x00, 0x00, 0x00, 0x03, 0x82, 0x00, 0x00,
-  0x00, 0x01, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x70, 0x40, 0x00, 0x00, 0x00,
-  0x3C, 0x10, 0x00, 0x00, 0x00, 0x0E, 0x04, 0x00, 0x00, 0x00, 0x07, 0x82,
-  0x00, 0x00, 0x00, 0x07, 0xC0, 0x80, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0xFF,
-  0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF,
-  0xFF, 0xF8, 0x00, 0xC0, 0x00, 0x00, 0x38, 0x06, 0x00, 0x00, 0x00, 0xF8,
-  0x18, 0x00, 0x00, 0x03, 0xE0, 0x40, 0x00, 0x00, 0x0F, 0x81, 0x00, 0x00,
-  0x00, 0x3E, 0x06, 0x00, 0x00, 0x00, 0xF8, 0x18, 0x00, 0x00, 0x03, 0xE0,
-  0x20, 0x03, 0xFF, 0xFF, 0x80, 0xC0, 0x0F, 0xFF, 0xFE, 0x01, 0x00, 0x3C,
-  0x00, 0x00, 0x02, 0x00, 0xF0, 0x00, 0x00, 0x08, 0x01, 0xC0, 0x00, 0x00,
-  0x10, 0x07, 0x80, 0x00, 0x00, 0x20, 0x0E, 0x00, 0x00, 0x00, 0x40, 0x1C,
-  0x00, 0x00, 0x00, 0x80, 0x38, 0x00, 0x00, 0x01, 0x00, 0x30, 0x00, 0x00,
-  0x02, 0x00, 0x60, 0x00, 0x00, 0x04, 0x00, 0x60, 0x00, 0x00, 0x04, 0x00,
-  0x3F, 0xFF, 0x80, 0x08, 0x00, 0x00, 0x03, 0x80, 0x10, 0x00, 0x00, 0x07,
-  0x80, 0x10, 0x00, 0x00, 0x1F, 0x00, 0x10, 0x00, 0x00, 0x3C, 0x00, 0x10,
-  0x00, 0x00, 0xF0, 0x00, 0x10, 0x00, 0x03, 0xC0, 0x00, 0x18, 0x00, 0x0F,
-  0x80, 0x00, 0x0F, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00,
-  0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x08,
-  0x00, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0x60, 0x01, 0x00, 0x00,
-  0x00, 0x0C, 0x00, 0x40, 0x00, 0x00, 0x01, 0x80, 0x10, 0x00, 0x00, 0x00,
-  0x60, 0x08, 0x00, 0x00, 0x00, 0x1C, 0x02, 0x00, 0x00, 0x00, 0x07, 0x01,
-  0x00, 0x3F, 0xF0, 0x01, 0xC0, 0x40, 0x0F, 0xFC, 0x00, 0x70, 0x10, 0x03,
-  0x81, 0x00, 0x1C, 0x08, 0x01, 0xE0, 0x40, 0x0F, 0x02, 0x00, 0x70, 0x10,
-  0x03, 0x80, 0x80, 0x1C, 0x08, 0x01, 0xE0, 0x40, 0x0E, 0x02, 0x00, 0x78,
-  0x10, 0x03, 0x81, 0x00, 0x3C, 0x04, 0x01, 0xE0, 0x80, 0x0F, 0x02, 0x00,
-  0x70, 0x40, 0x07, 0x80, 0x80, 0x1C, 0x60, 0x03, 0xE0, 0x20, 0x0F, 0x60,
-  0x00, 0xF0, 0x10, 0x03, 0xE0, 0x00, 0x78, 0x04, 0x00, 0xC0, 0x00, 0x3C,
-  0x01, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x20,
-  0x00, 0x00, 0x07, 0xC0, 0x08, 0x00, 0x00, 0x03, 0xE0, 0x04, 0x00, 0x00,
-  0x03, 0xF0, 0x01, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x80, 0x00, 0x0F, 0xF8,
-  0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-  0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x08, 0x00, 0x00, 0x00, 0x38, 0x01,
-  0x00, 0x00, 0x00, 0x07, 0x80, 0x20, 0x00, 0x00, 0x01, 0xE0, 0x08, 0x00,
-  0x00, 0x00, 0x78, 0x01, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x20, 0x00, 0x00,
-  0x07, 0xC0, 0x08, 0x00, 0x00, 0x01, 0xF0, 0x01, 0x00, 0x7F, 0xFF, 0xFC,
-  0x00, 0x20, 0x0F, 0xFF, 0xFF, 0x00, 0x08, 0x01, 0xFF, 0xFE, 0x00, 0x01,
-  0x00, 0x70, 0x01, 0xE0, 0x00, 0x40, 0x0C, 0x00, 0x7E, 0x00, 0x08, 0x01,
-  0x00, 0x1F, 0x80, 0x01, 0x00, 0x40, 0x07, 0xE0, 0x00, 0x40, 0x00, 0x01,
-  0xF8, 0x00, 0x08, 0x00, 0x00, 0x7E, 0x00, 0x01, 0x00, 0x00, 0x1F, 0x00,
-  0x00, 0x40, 0x0F, 0xFF, 0xC0, 0x00, 0x08, 0x03, 0xFF, 0xF0, 0x00, 0x01,
-  0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x40, 0x00, 0x00, 0x01, 0x80, 0x08, 0x00,
-  0x00, 0x00, 0x38, 0x01, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x40, 0x00, 0x00,
-  0x03, 0xC0, 0x08, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x1E,
-  0x00, 0x40, 0x00, 0x00, 0x07, 0x80, 0x08, 0x00, 0x00, 0x01, 0xE0, 0x01,
-  0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-  0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x08, 0x00, 0x00, 0x00, 0x38, 0x01, 0x00,
-  0x00, 0x00, 0x07, 0x80, 0x20, 0x00, 0x00, 0x01, 0xE0, 0x08, 0x00, 0x00,
-  0x00, 0x78, 0x01, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x20, 0x00, 0x00, 0x07,
-  0xC0, 0x08, 0x00, 0x00, 0x01, 0xF0, 0x01, 0x00, 0x3F, 0xFF, 0xFC, 0x00,
-  0x20, 0x0F, 0xFF, 0xFF, 0x00, 0x08, 0x01, 0xFF, 0xFE, 0x00, 0x01, 0x00,
-  0x70, 0x00, 0xE0, 0x00, 0x40, 0x0C, 0x00, 0x3E, 0x00, 0x08, 0x01, 0x00,
-  0x0F, 0x80, 0x01, 0x00, 0x40, 0x03, 0xE0, 0x00, 0x40, 0x08, 0x00, 0xF8,
-  0x00, 0x08, 0x00, 0x00, 0x3E, 0x00, 0x01, 0x00, 0x00, 0x0F, 0x80, 0x00,
-  0x40, 0x00, 0x01, 0xE0, 0x00, 0x08, 0x01, 0xFF, 0xF8, 0x00, 0x01, 0x00,
-  0x7F, 0xFE, 0x00, 0x00, 0x40, 0x0E, 0x00, 0x00, 0x00, 0x08, 0x01, 0xC0,
-  0x00, 0x00, 0x01, 0x00, 0x78, 0x00, 0x00, 0x00, 0x40, 0x0E, 0x00, 0x00,
-  0x00, 0x08, 0x01, 0xC0, 0x00, 0x00, 0x03, 0x00, 0x78, 0x00, 0x00, 0x00,
-  0x40, 0x0E, 0x00, 0x00, 0x00, 0x08, 0x01, 0xC0, 0x00, 0x00, 0x01, 0xFF,
-  0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-  0xFF, 0xFF, 0xF8, 0x00, 0xC0, 0x00, 0x00, 0x38, 0x06, 0x00, 0x00, 0x00,
-  0xF8, 0x18, 0x00, 0x00, 0x03, 0xE0, 0x40, 0x00, 0x00, 0x07, 0x81, 0x00,
-  0x00, 0x00, 0x1E, 0x06, 0x00, 0x00, 0x00, 0x78, 0x08, 0x00, 0x00, 0x01,
-  0xE0, 0x20, 0x03, 0xFF, 0xFF, 0x80, 0xC0, 0x1F, 0xFF, 0xFE, 0x01, 0x00,
-  0x3C, 0x7F, 0xFE, 0x02, 0x00, 0xF1, 0x00, 0x06, 0x0C, 0x01, 0xE4, 0x00,
-  0x1E, 0x10, 0x07, 0x90, 0x00, 0x38, 0x20, 0x0E, 0x20, 0x00, 0xF0, 0x40,
-  0x1C, 0x80, 0x01, 0xE0, 0x80, 0x39, 0x00, 0x03, 0x81, 0x00, 0x34, 0x00,
-  0x0F, 0x02, 0x00, 0x70, 0x00, 0x1E, 0x04, 0x00, 0x7F, 0x80, 0x38, 0x04,
-  0x00, 0x3E, 0x00, 0xF0, 0x08, 0x00, 0x00, 0x01, 0xC0, 0x10, 0x00, 0x00,
-  0x03, 0x80, 0x10, 0x00, 0x00, 0x0F, 0x00, 0x10, 0x00, 0x00, 0x1C, 0x00,
-  0x10, 0x00, 0x00, 0x38, 0x00, 0x10, 0x00, 0x00, 0xF0, 0x00, 0x1C, 0x00,
-  0x01, 0xC0, 0x00, 0x0F, 0x00, 0x03, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0x00,
-  0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x01, 0xFF, 0xC0,
-  0x04, 0x00, 0xC0, 0x20, 0x06, 0x00, 0x40, 0x0E, 0x02, 0x00, 0xF0, 0x04,
-  0x01, 0xE0, 0x40, 0x0E, 0x00, 0x80, 0x1E, 0x04, 0x00, 0xE0, 0x08, 0x01,
-  0xC0, 0x40, 0x1E, 0x00, 0x80, 0x3C, 0x08, 0x01, 0xC0, 0x10, 0x03, 0x80,
-  0x80, 0x1C, 0x01, 0x00, 0x38, 0x08, 0x03, 0xC0, 0x10, 0x07, 0x81, 0x00,
-  0x38, 0x02, 0x00, 0x70, 0x10, 0x03, 0x80, 0x20, 0x07, 0xFF, 0x00, 0x78,
-  0x04, 0x00, 0xE0, 0x00, 0x07, 0x00, 0x40, 0x0C, 0x00, 0x00, 0x70, 0x04,
-  0x00, 0x80, 0x00, 0x0F, 0x00, 0x80, 0x10, 0x00, 0x00, 0xE0, 0x08, 0x02,
-  0x00, 0x00, 0x1E, 0x00, 0x80, 0x00, 0x00, 0x01, 0xC0, 0x10, 0x00, 0x00,
-  0x00, 0x1C, 0x01, 0x00, 0x3F, 0xF8, 0x03, 0xC0, 0x10, 0x07, 0xFF, 0x00,
-  0x38, 0x02, 0x00, 0x70, 0x10, 0x03, 0x80, 0x20, 0x07, 0x01, 0x00, 0x78,
-  0x02, 0x00, 0xF0, 0x20, 0x07, 0x00, 0x40, 0x0E, 0x02, 0x00, 0x70, 0x04,
-  0x00, 0xE0, 0x20, 0x0F, 0x00, 0xC0, 0x1E, 0x04, 0x00, 0xE0, 0x08, 0x01,
-  0xC0, 0x40, 0x0E, 0x00, 0x80, 0x1C, 0x04, 0x01, 0xE0, 0x0F, 0xFF, 0x80,
-  0xFF, 0xFC, 0x00, 0x7F, 0xF8, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFC,
-  0x00, 0x80, 0x1C, 0x01, 0x00, 0x38, 0x02, 0x00, 0xF0, 0x08, 0x01, 0xE0,
-  0x10, 0x03, 0x80, 0x20, 0x0F, 0x00, 0x80, 0x1C, 0x01, 0x00, 0x38, 0x02,
-  0x00, 0xF0, 0x08, 0x01, 0xC0, 0x10, 0x03, 0x80, 0x20, 0x0F, 0x00, 0x80,
-  0x1C, 0x01, 0x00, 0x38, 0x02, 0x00, 0xF0, 0x08, 0x01, 0xC0, 0x10, 0x03,
-  0x80, 0x40, 0x0F, 0x00, 0x80, 0x1C, 0x01, 0x00, 0x78, 0x04, 0x00, 0xE0,
-  0x08, 0x01, 0xC0, 0x10, 0x07, 0x80, 0x40, 0x0E, 0x00, 0x80, 0x1C, 0x01,
-  0x00, 0x78, 0x04, 0x00, 0xE0, 0x08, 0x01, 0xC0, 0x0F, 0xFF, 0x80, 0x1F,
-  0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x08,
-  0x01, 0x80, 0x00, 0x00, 0x04, 0x01, 0xE0, 0x00, 0x00, 0x04, 0x00, 0xE0,
-  0x00, 0x00, 0x02, 0x00, 0x70, 0x00, 0x00, 0x02, 0x00, 0x78, 0x00, 0x00,
-  0x01, 0x00, 0x38, 0x00, 0x00, 0x00, 0x80, 0x3C, 0x00, 0x00, 0x00, 0x80,
-  0x1E, 0x00, 0x00, 0x00, 0x40, 0x0E, 0x00, 0x00, 0x00, 0x20, 0x0F, 0x00,
-  0x00, 0x00, 0x20, 0x07, 0x00, 0x00, 0x00, 0x10, 0x03, 0x80, 0x00, 0x00,
-  0x08, 0x03, 0xC0, 0x00, 0x00, 0x08, 0x01, 0xC0, 0x00, 0x00, 0x04, 0x00,
-  0xE0, 0x00, 0x00, 0x04, 0x00, 0xF0, 0x00, 0x00, 0x02, 0x00, 0x70, 0x00,
-  0x00, 0x02, 0x00, 0x38, 0x00, 0x00, 0x06, 0x00, 0x3C, 0x00, 0x3F, 0xFE,
-  0x00, 0x1C, 0x00, 0x20, 0x00, 0x00, 0x1E, 0x00, 0x20, 0x00, 0x00, 0x0E,
-  0x00, 0x10, 0x00, 0x00, 0x0F, 0x00, 0x10, 0x00, 0x00, 0x0F, 0x00, 0x10,
-  0x00, 0x00, 0x07, 0x80, 0x08, 0x00, 0x00, 0x07, 0x80, 0x08, 0x00, 0x00,
-  0x0F, 0x80, 0x04, 0x00, 0x00, 0x1F, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0x80,
-  0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0xFF, 0xFC,
-  0x00, 0x40, 0x0C, 0x03, 0x00, 0x1E, 0x00, 0x40, 0x0E, 0x06, 0x00, 0x3E,
-  0x00, 0x40, 0x1E, 0x08, 0x00, 0xFC, 0x00, 0x80, 0x1C, 0x30, 0x01, 0xF8,
-  0x00, 0x80, 0x1C, 0x60, 0x03, 0xF0, 0x00, 0x80, 0x3C, 0x80, 0x07, 0xE0,
-  0x01, 0x00, 0x3B, 0x00, 0x1F, 0x80, 0x01, 0x00, 0x3E, 0x00, 0x3F, 0x00,
-  0x01, 0x00, 0x78, 0x00, 0x7E, 0x00, 0x02, 0x00, 0x70, 0x00, 0xFC, 0x00,
-  0x02, 0x00, 0x60, 0x03, 0xF0, 0x00, 0x04, 0x00, 0x80, 0x07, 0xE0, 0x00,
-  0x04, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x04, 0x00, 0x00, 0x1F, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x08, 0x00, 0x00, 0x1C, 0x00, 0x00,
-  0x08, 0x03, 0x00, 0x08, 0x00, 0x00, 0x10, 0x03, 0x80, 0x0C, 0x00, 0x00,
-  0x10, 0x03, 0x80, 0x06, 0x00, 0x00, 0x10, 0x07, 0xC0, 0x02, 0x00, 0x00,
-  0x20, 0x07, 0xA0, 0x03, 0x00, 0x00, 0x20, 0x07, 0x10, 0x01, 0x80, 0x00,
-  0x20, 0x0F, 0x10, 0x00, 0x80, 0x00, 0x40, 0x0E, 0x08, 0x00, 0x40, 0x00,
-  0x40, 0x0E, 0x04, 0x00, 0x60, 0x00, 0xC0, 0x1E, 0x02, 0x00, 0x30, 0x00,
-  0x80, 0x1C, 0x01, 0x00, 0x10, 0x00, 0x80, 0x1C, 0x01, 0x00, 0x18, 0x00,
-  0xFF, 0xFC, 0x00, 0xFF, 0xFC, 0x00, 0x7F, 0xF8, 0x00, 0x3F, 0xFE, 0x00,
-  0x00, 0x3F, 0xFC, 0x00, 0x00, 0x80, 0x18, 0x00, 0x01, 0x00, 0x38, 0x00,
-  0x02, 0x00, 0xF0, 0x00, 0x08, 0x01, 0xC0, 0x00, 0x10, 0x03, 0x80, 0x00,
-  0x20, 0x0F, 0x00, 0x00, 0x80, 0x1C, 0x00, 0x01, 0x00, 0x38, 0x00, 0x04,
-  0x00, 0xF0, 0x00, 0x08, 0x01, 0xC0, 0x00, 0x10, 0x03, 0x80, 0x00, 0x40,
-  0x0F, 0x00, 0x00, 0x80, 0x1C, 0x00, 0x01, 0x00, 0x78, 0x00, 0x04, 0x00,
-  0xF0, 0x00, 0x08, 0x01, 0xC0, 0x00, 0x10, 0x07, 0x80, 0x00, 0x40, 0x0F,
-  0x00, 0x00, 0x80, 0x1C, 0x00, 0x01, 0x00, 0x78, 0x00, 0x04, 0x00, 0xFF,
-  0xFF, 0x88, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00,
-  0x1C, 0x80, 0x00, 0x00, 0x7B, 0x00, 0x00, 0x01, 0xE4, 0x00, 0x00, 0x03,
-  0x88, 0x00, 0x00, 0x0F, 0x1F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xF0,
-  0x00, 0x00, 0x3F, 0xFF, 0x00, 0x07, 0xFF, 0xE0, 0x02, 0x00, 0x0C, 0x00,
-  0x40, 0x01, 0x80, 0x10, 0x00, 0x60, 0x06, 0x00, 0x0E, 0x00, 0x80, 0x03,
-  0x80, 0x60, 0x00, 0xF0, 0x08, 0x00, 0x1C, 0x02, 0x00, 0x07, 0x00, 0x40,
-  0x00, 0x60, 0x20, 0x00, 0x38, 0x02, 0x00, 0x03, 0x02, 0x00, 0x03, 0xC0,
-  0x20, 0x00, 0x18, 0x20, 0x00, 0x1C, 0x01, 0x00, 0x00, 0xC2, 0x00, 0x00,
-  0xE0, 0x08, 0x00, 0x07, 0x20, 0x00, 0x0F, 0x00, 0x80, 0x00, 0x1A, 0x00,
-  0x00, 0x70, 0x04, 0x00, 0x00, 0xD0, 0x00, 0x07, 0x80, 0x40, 0x00, 0x07,
-  0x00, 0x00, 0x38, 0x02, 0x00, 0x00, 0x30, 0x00, 0x01, 0xC0, 0x10, 0x04,
-  0x01, 0x00, 0x40, 0x1E, 0x01, 0x00, 0x20, 0x00, 0x04, 0x00, 0xE0, 0x08,
-  0x01, 0x80, 0x00, 0x60, 0x07, 0x00, 0x40, 0x1C, 0x00, 0x07, 0x00, 0x78,
-  0x04, 0x00, 0xE0, 0x00, 0x70, 0x03, 0x80, 0x20, 0x07, 0x00, 0x03, 0x80,
-  0x1C, 0x01, 0x00, 0x78, 0x00, 0x3C, 0x01, 0xE0, 0x10, 0x03, 0xC0, 0x03,
-  0xC0, 0x0E, 0x00, 0x80, 0x1D, 0x00, 0x3E, 0x00, 0x70, 0x04, 0x01, 0xE8,
-  0x03, 0xF0, 0x07, 0x80, 0x40, 0x0E, 0x40, 0x3F, 0x00, 0x38, 0x02, 0x00,
-  0x72, 0x03, 0xE8, 0x01, 0xC0, 0x30, 0x07, 0x90, 0x3E, 0x80, 0x1C, 0x01,
-  0x00, 0x38, 0x81, 0xE4, 0x00, 0xE0, 0x08, 0x01, 0xC2, 0x1E, 0x20, 0x07,
-  0x00, 0x7F, 0xFC, 0x0F, 0xE1, 0xFF, 0xF0, 0x01, 0xFF, 0xE0, 0x3E, 0x07,
-  0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0x01, 0xFF, 0xC0, 0x04, 0x00, 0x18,
-  0x20, 0x06, 0x00, 0x40, 0x01, 0x82, 0x00, 0xF0, 0x04, 0x00, 0x1C, 0x40,
-  0x0E, 0x00, 0x80, 0x01, 0xC4, 0x00, 0xE0, 0x08, 0x00, 0x0C, 0x40, 0x1E,
-  0x00, 0x80, 0x00, 0xC8, 0x01, 0xC0, 0x10, 0x00, 0x0C, 0x80, 0x1C, 0x01,
-  0x00, 0x00, 0xC8, 0x03, 0xC0, 0x10, 0x00, 0x0F, 0x00, 0x38, 0x02, 0x00,
-  0x00, 0x70, 0x03, 0x80, 0x20, 0x00, 0x07, 0x00, 0x78, 0x04, 0x00, 0x00,
-  0x60, 0x07, 0x00, 0x40, 0x00, 0x06, 0x00, 0x70, 0x04, 0x01, 0x00, 0x60,
-  0x0F, 0x00, 0x80, 0x10, 0x04, 0x00, 0xE0, 0x08, 0x01, 0x80, 0x00, 0x1E,
-  0x00, 0x80, 0x38, 0x00, 0x01, 0xC0, 0x10, 0x03, 0x80, 0x00, 0x1C, 0x01,
-  0x00, 0x38, 0x00, 0x03, 0xC0, 0x10, 0x07, 0x80, 0x00, 0x38, 0x02, 0x00,
-  0x78, 0x00, 0x03, 0x80, 0x20, 0x07, 0x40, 0x00, 0x78, 0x02, 0x00, 0xF4,
-  0x00, 0x07, 0x00, 0x40, 0x0E, 0x40, 0x00, 0x70, 0x04, 0x00, 0xE4, 0x00,
-  0x0F, 0x00, 0xC0, 0x1E, 0x40, 0x00, 0xE0, 0x08, 0x01, 0xC2, 0x00, 0x0E,
-  0x00, 0x80, 0x1C, 0x20, 0x01, 0xE0, 0x0F, 0xFF, 0xC1, 0xFF, 0xFC, 0x00,
-  0x7F, 0xF8, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00,
-  0x1C, 0x00, 0x07, 0x80, 0x00, 0x60, 0x00, 0x00, 0xE0, 0x00, 0xC0, 0x00,
-  0x00, 0x30, 0x03, 0x00, 0x00, 0x00, 0x10, 0x06, 0x00, 0x00, 0x00, 0x08,
-  0x0C, 0x00, 0x00, 0x00, 0x0C, 0x08, 0x00, 0x00, 0x00, 0x06, 0x10, 0x00,
-  0xFF, 0x80, 0x06, 0x30, 0x03, 0xFF, 0xC0, 0x07, 0x20, 0x07, 0xC0, 0x20,
-  0x07, 0x60, 0x0F, 0x80, 0x20, 0x07, 0x40, 0x0F, 0x00, 0x20, 0x07, 0x40,
-  0x1E, 0x00, 0x20, 0x07, 0xC0, 0x1C, 0x00, 0x20, 0x07, 0x80, 0x1C, 0x00,
-  0x40, 0x0F, 0x80, 0x18, 0x00, 0xC0, 0x0F, 0x80, 0x18, 0x01, 0x80, 0x0E,
-  0x80, 0x18, 0x03, 0x00, 0x1E, 0x80, 0x0C, 0x0E, 0x00, 0x1E, 0x80, 0x07,
-  0xF8, 0x00, 0x3C, 0x80, 0x00, 0x00, 0x00, 0x3C, 0x80, 0x00, 0x00, 0x00,
-  0x78, 0x40, 0x00, 0x00, 0x00, 0xF0, 0x40, 0x00, 0x00, 0x01, 0xF0, 0x20,
-  0x00, 0x00, 0x03, 0xE0, 0x10, 0x00, 0x00, 0x0F, 0xC0, 0x0C, 0x00, 0x00,
-  0x3F, 0x00, 0x03, 0x80, 0x00, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00,
-  0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x10,
-  0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00,
-  0x00, 0x08, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0xE0, 0x08, 0x00, 0x00, 0x00, 0x18, 0x04, 0x00, 0x00, 0x00, 0x07, 0x01,
-  0x00, 0x00, 0x00, 0x01, 0xC0, 0x40, 0x0F, 0xFE, 0x00, 0x70, 0x20, 0x07,
-  0xFF, 0x80, 0x1C, 0x08, 0x01, 0x80, 0x00, 0x07, 0x04, 0x00, 0xC0, 0x00,
-  0x03, 0xC1, 0x00, 0x20, 0x00, 0x00, 0xE0, 0x40, 0x10, 0x00, 0x00, 0x78,
-  0x20, 0x00, 0x00, 0x00, 0x3C, 0x08, 0x00, 0x00, 0x00, 0x1F, 0x02, 0x00,
-  0x00, 0x00, 0x1F, 0x81, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x40, 0x0F, 0xFF,
-  0xFF, 0xC0, 0x10, 0x07, 0xFF, 0xFF, 0xC0, 0x08, 0x01, 0xC0, 0x00, 0x00,
-  0x02, 0x00, 0x70, 0x00, 0x00, 0x00, 0x80, 0x3C, 0x00, 0x00, 0x00, 0x40,
-  0x0E, 0x00, 0x00, 0x00, 0x10, 0x03, 0x80, 0x00, 0x00, 0x0C, 0x01, 0xE0,
-  0x00, 0x00, 0x02, 0x00, 0x70, 0x00, 0x00, 0x00, 0x80, 0x1C, 0x00, 0x00,
-  0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00,
-  0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x60, 0x00, 0x78, 0x00, 0x06, 0x00,
-  0x00, 0x30, 0x00, 0x60, 0x00, 0x00, 0x20, 0x03, 0x00, 0x00, 0x00, 0x40,
-  0x18, 0x00, 0x00, 0x01, 0x80, 0xC0, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00,
-  0x00, 0x0E, 0x10, 0x00, 0xFF, 0x00, 0x18, 0x80, 0x0F, 0xFE, 0x00, 0x72,
-  0x00, 0x7C, 0x04, 0x01, 0xD0, 0x03, 0xE0, 0x10, 0x07, 0x40, 0x0F, 0x00,
-  0x40, 0x1D, 0x00, 0x78, 0x01, 0x00, 0x78, 0x01, 0xFF, 0xF4, 0x01, 0xE0,
-  0x06, 0x00, 0x20, 0x0F, 0x80, 0x1C, 0x00, 0x80, 0x3E, 0x00, 0x70, 0x00,
-  0x00, 0xE8, 0x01, 0xC0, 0x00, 0x07, 0xA0, 0x02, 0x80, 0x00, 0x1E, 0x80,
-  0x06, 0x00, 0x00, 0xF2, 0x00, 0x00, 0x00, 0x07, 0xC4, 0x00, 0x00, 0x00,
-  0x3E, 0x10, 0x00, 0x00, 0x00, 0xF0, 0x20, 0x00, 0x00, 0x07, 0x80, 0x40,
-  0x00, 0x00, 0x3E, 0x00, 0x80, 0x00, 0x00, 0x70, 0x01, 0xC0, 0x00, 0x01,
-  0x80, 0x03, 0xFE, 0x00, 0x02, 0x00, 0x03, 0xFF, 0xC0, 0x0C, 0x00, 0x00,
-  0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF,
-  0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x10, 0x00, 0x00, 0x03, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x60, 0x01, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x80,
-  0x00, 0x00, 0x03, 0x00, 0x20, 0x00, 0x00, 0x00, 0x60, 0x08, 0x00, 0x00,
-  0x00, 0x18, 0x04, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x01,
-  0xC0, 0x40, 0x0F, 0xFE, 0x00, 0x70, 0x20, 0x07, 0xFF, 0x80, 0x1C, 0x08,
-  0x01, 0x80, 0x00, 0x07, 0x02, 0x00, 0xC0, 0x00, 0x03, 0xC1, 0x00, 0x20,
-  0x00, 0x01, 0xF0, 0x40, 0x10, 0x00, 0x00, 0x78, 0x20, 0x00, 0x00, 0x00,
-  0x7E, 0x08, 0x00, 0x00, 0x00, 0x7F, 0x02, 0x00, 0x00, 0x00, 0xFF, 0x81,
-  0x00, 0x00, 0x03, 0xFF, 0xC0, 0x40, 0x08, 0x00, 0x7F, 0xC0, 0x10, 0x07,
-  0x00, 0x0F, 0x00, 0x08, 0x01, 0xE0, 0x01, 0x00, 0x02, 0x00, 0x74, 0x00,
-  0x20, 0x00, 0x80, 0x3C, 0x80, 0x04, 0x00, 0x40, 0x0E, 0x10, 0x00, 0x80,
-  0x10, 0x03, 0x82, 0x00, 0x10, 0x04, 0x01, 0xE0, 0x40, 0x02, 0x02, 0x00,
-  0x70, 0x08, 0x00, 0x40, 0x80, 0x1C, 0x01, 0x00, 0x18, 0x1F, 0xFF, 0x00,
-  0x3F, 0xFF, 0x07, 0xFF, 0x80, 0x03, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF,
-  0xFF, 0xF0, 0x00, 0x60, 0x00, 0x00, 0x01, 0xC0, 0x04, 0x00, 0x00, 0x00,
-  0x1E, 0x00, 0x40, 0x00, 0x00, 0x01, 0xF0, 0x04, 0x00, 0x00, 0x00, 0x1F,
-  0x00, 0x20, 0x00, 0x00, 0x01, 0xF0, 0x02, 0x00, 0x00, 0x00, 0x1F, 0x00,
-  0x10, 0x00, 0x00, 0x01, 0xF0, 0x01, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x08,
-  0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x40, 0x07, 0xFF, 0xC0, 0x00, 0x02, 0x00,
-  0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x04, 0x00, 0x00, 0x40, 0x00,
-  0x00, 0x30, 0x00, 0x02, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x08, 0x00, 0x00,
-  0x07, 0x00, 0x00, 0x60, 0x00, 0x00, 0x18, 0x00, 0x01, 0x80, 0x00, 0x00,
-  0xC0, 0x00, 0x07, 0xFF, 0xE0, 0x07, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x38,
-  0x00, 0x00, 0x3F, 0xF8, 0x01, 0xC0, 0x01, 0xFF, 0xFF, 0xC0, 0x0E, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x80, 0x00, 0x00, 0x07, 0x80, 0x08,
-  0x00, 0x00, 0x00, 0x38, 0x00, 0x80, 0x00, 0x00, 0x03, 0xC0, 0x08, 0x00,
-  0x00, 0x00, 0x3C, 0x00, 0x40, 0x00, 0x00, 0x03, 0xE0, 0x04, 0x00, 0x00,
-  0x00, 0x3E, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x80, 0x00, 0x00, 0x18,
-  0x20, 0x00, 0x00, 0x07, 0x88, 0x00, 0x00, 0x00, 0xF2, 0x00, 0x00, 0x00,
-  0x3C, 0xC0, 0x00, 0x00, 0x0F, 0x30, 0x00, 0x00, 0x03, 0xC4, 0x00, 0x00,
-  0x00, 0xF0, 0x7F, 0xC0, 0x0F, 0xFC, 0x07, 0xF8, 0x01, 0xFF, 0x00, 0x02,
-  0x00, 0x70, 0x00, 0x00, 0x40, 0x0E, 0x00, 0x00, 0x08, 0x01, 0xC0, 0x00,
-  0x02, 0x00, 0x70, 0x00, 0x00, 0x40, 0x0E, 0x00, 0x00, 0x08, 0x03, 0xC0,
-  0x00, 0x02, 0x00, 0x70, 0x00, 0x00, 0x40, 0x0E, 0x00, 0x00, 0x08, 0x03,
-  0xC0, 0x00, 0x02, 0x00, 0x70, 0x00, 0x00, 0x40, 0x0E, 0x00, 0x00, 0x08,
-  0x03, 0xC0, 0x00, 0x02, 0x00, 0x70, 0x00, 0x00, 0x40, 0x0E, 0x00, 0x00,
-  0x08, 0x03, 0xC0, 0x00, 0x02, 0x00, 0x70, 0x00, 0x00, 0x40, 0x0E, 0x00,
-  0x00, 0x08, 0x03, 0xC0, 0x00, 0x02, 0x00, 0x70, 0x00, 0x00, 0x7F, 0xFE,
-  0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x0F, 0xFF,
-  0x02, 0x00, 0x60, 0x08, 0x01, 0xC1, 0x00, 0x38, 0x04, 0x00, 0xE0, 0x80,
-  0x3C, 0x02, 0x00, 0xF0, 0x80, 0x1C, 0x02, 0x00, 0x70, 0x40, 0x0E, 0x01,
-  0x00, 0x38, 0x20, 0x0F, 0x00, 0x80, 0x3C, 0x30, 0x07, 0x00, 0x80, 0x1C,
-  0x10, 0x07, 0x80, 0x40, 0x0E, 0x08, 0x03, 0xC0, 0x20, 0x0F, 0x0C, 0x01,
-  0xC0, 0x20, 0x07, 0x04, 0x01, 0xE0, 0x10, 0x03, 0x82, 0x00, 0xF0, 0x10,
-  0x03, 0xC3, 0x00, 0x70, 0x08, 0x01, 0xC1, 0x00, 0x38, 0x04, 0x00, 0xE0,
-  0x80, 0x38, 0x04, 0x00, 0xF0, 0x40, 0x1C, 0x02, 0x00, 0x70, 0x40, 0x0E,
-  0x02, 0x00, 0x38, 0x20, 0x07, 0x02, 0x00, 0x38, 0x10, 0x01, 0x82, 0x00,
-  0x1C, 0x08, 0x00, 0x7E, 0x00, 0x1E, 0x04, 0x00, 0x00, 0x00, 0x0E, 0x02,
-  0x00, 0x00, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x40, 0x00,
-  0x00, 0x07, 0x80, 0x20, 0x00, 0x00, 0x07, 0x80, 0x08, 0x00, 0x00, 0x07,
-  0x80, 0x02, 0x00, 0x00, 0x0F, 0x80, 0x00, 0xE0, 0x00, 0x1F, 0x80, 0x00,
-  0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xE0,
-  0x00, 0x3F, 0xFC, 0x80, 0x30, 0x00, 0x40, 0x0E, 0x80, 0x30, 0x00, 0x80,
-  0x0F, 0x80, 0x38, 0x01, 0x80, 0x1E, 0x80, 0x38, 0x01, 0x00, 0x3E, 0x40,
-  0x38, 0x02, 0x00, 0x3C, 0x40, 0x18, 0x04, 0x00, 0x78, 0x40, 0x18, 0x04,
-  0x00, 0xF0, 0x40, 0x18, 0x08, 0x01, 0xF0, 0x40, 0x18, 0x10, 0x01, 0xE0,
-  0x40, 0x18, 0x20, 0x03, 0xC0, 0x40, 0x1C, 0x20, 0x07, 0x80, 0x20, 0x1C,
-  0x40, 0x0F, 0x80, 0x20, 0x1C, 0x80, 0x0F, 0x00, 0x20, 0x0D, 0x00, 0x1E,
-  0x00, 0x20, 0x0D, 0x00, 0x3C, 0x00, 0x20, 0x0E, 0x00, 0x3C, 0x00, 0x20,
-  0x0C, 0x00, 0x78, 0x00, 0x20, 0x08, 0x00, 0xF0, 0x00, 0x10, 0x08, 0x01,
-  0xE0, 0x00, 0x10, 0x00, 0x01, 0xE0, 0x00, 0x10, 0x00, 0x03, 0xC0, 0x00,
-  0x10, 0x00, 0x07, 0x80, 0x00, 0x10, 0x00, 0x0F, 0x00, 0x00, 0x10, 0x00,
-  0x0F, 0x00, 0x00, 0x08, 0x00, 0x1E, 0x00, 0x00, 0x08, 0x00, 0x3C, 0x00,
-  0x00, 0x08, 0x00, 0x78, 0x00, 0x00, 0x04, 0x00, 0xF8, 0x00, 0x00, 0x03,
-  0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xC1,
-  0xFF, 0xC1, 0xFF, 0xC0, 0x10, 0x06, 0x20, 0x06, 0x20, 0x06, 0x02, 0x00,
-  0x72, 0x00, 0x72, 0x00, 0x70, 0x20, 0x0F, 0x20, 0x0F, 0x20, 0x0F, 0x02,
-  0x00, 0xE4, 0x00, 0xF4, 0x00, 0xE0, 0x40, 0x0E, 0x40, 0x0E, 0x40, 0x0E,
-  0x04, 0x01, 0xE4, 0x01, 0xE4, 0x01, 0xE0, 0x80, 0x1C, 0x80, 0x1C, 0x80,
-  0x1C, 0x08, 0x01, 0xC8, 0x01, 0xC8, 0x03, 0xC0, 0x80, 0x3C, 0x80, 0x3D,
-  0x00, 0x3C, 0x10, 0x03, 0xD0, 0x03, 0x90, 0x03, 0x81, 0x00, 0x39, 0x00,
-  0x39, 0x00, 0x78, 0x10, 0x07, 0x90, 0x07, 0xA0, 0x07, 0x02, 0x00, 0x7A,
-  0x00, 0x72, 0x00, 0x70, 0x20, 0x07, 0x20, 0x07, 0x20, 0x0F, 0x02, 0x00,
-  0x72, 0x00, 0xF4, 0x00, 0xE0, 0x40, 0x0F, 0x40, 0x0E, 0x40, 0x0E, 0x04,
-  0x00, 0xE4, 0x00, 0xE4, 0x01, 0xE0, 0xC0, 0x0E, 0x80, 0x1E, 0x80, 0x1C,
-  0x08, 0x00, 0xE8, 0x01, 0xC8, 0x01, 0xC0, 0x80, 0x06, 0x80, 0x3C, 0x80,
-  0x3C, 0x08, 0x00, 0x10, 0x03, 0xF0, 0x03, 0x80, 0x80, 0x00, 0x00, 0x00,
-  0x00, 0x38, 0x08, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x80, 0x00, 0x00,
-  0x00, 0x00, 0x70, 0x04, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x20, 0x00,
-  0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0E,
-  0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-  0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0xFF,
-  0xF8, 0x00, 0x20, 0x03, 0x02, 0x00, 0x38, 0x00, 0x20, 0x06, 0x08, 0x00,
-  0xF8, 0x00, 0x40, 0x06, 0x20, 0x03, 0xE0, 0x00, 0x80, 0x0C, 0x80, 0x0F,
-  0x80, 0x00, 0x80, 0x0E, 0x00, 0x3E, 0x00, 0x01, 0x00, 0x18, 0x00, 0xF8,
-  0x00, 0x01, 0x00, 0x20, 0x07, 0xE0, 0x00, 0x02, 0x00, 0x00, 0x1F, 0x80,
-  0x00, 0x04, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x04, 0x00, 0x01, 0xF8, 0x00,
-  0x00, 0x08, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x08, 0x00, 0x1F, 0x00, 0x00,
-  0x00, 0x10, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x01, 0xF0, 0x00, 0x00,
-  0x00, 0x40, 0x03, 0xC0, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x30, 0x00, 0x0C, 0x00, 0x00, 0x00,
-  0xC0, 0x00, 0x18, 0x00, 0x00, 0x02, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08,
-  0x00, 0x00, 0x30, 0x00, 0x00, 0x20, 0x00, 0x00, 0x60, 0x00, 0x00, 0x80,
-  0x0C, 0x00, 0x60, 0x00, 0x02, 0x00, 0x38, 0x00, 0xC0, 0x00, 0x08, 0x00,
-  0xF8, 0x01, 0xC0, 0x00, 0x60, 0x03, 0xD0, 0x01, 0x80, 0x01, 0x80, 0x0F,
-  0x20, 0x03, 0x00, 0x06, 0x00, 0x3C, 0x20, 0x03, 0x00, 0x1F, 0xFF, 0xF0,
-  0x3F, 0xFE, 0x00, 0x0F, 0xFF, 0xC0, 0x3F, 0xFE, 0x00, 0x00, 0xFF, 0xF8,
-  0x07, 0xFF, 0xC8, 0x00, 0x80, 0x80, 0x0E, 0x40, 0x0C, 0x10, 0x01, 0xF4,
-  0x00, 0x62, 0x00, 0x3E, 0x40, 0x06, 0x40, 0x07, 0xC2, 0x00, 0x38, 0x00,
-  0xF8, 0x20, 0x03, 0x00, 0x1F, 0x01, 0x00, 0x20, 0x07, 0xE0, 0x10, 0x00,
-  0x00, 0xF8, 0x01, 0x00, 0x00, 0x1F, 0x00, 0x08, 0x00, 0x03, 0xE0, 0x00,
-  0x80, 0x00, 0x7C, 0x00, 0x08, 0x00, 0x0F, 0x80, 0x00, 0x40, 0x01, 0xF0,
-  0x00, 0x04, 0x00, 0x3E, 0x00, 0x00, 0x20, 0x07, 0xC0, 0x00, 0x04, 0x00,
-  0xF0, 0x00, 0x00, 0x40, 0x0E, 0x00, 0x00, 0x04, 0x01, 0xE0, 0x00, 0x00,
-  0x80, 0x1C, 0x00, 0x00, 0x08, 0x01, 0xC0, 0x00, 0x00, 0x80, 0x3C, 0x00,
-  0x00, 0x10, 0x03, 0x80, 0x00, 0x01, 0x00, 0x38, 0x00, 0x00, 0x10, 0x07,
-  0x80, 0x00, 0x02, 0x00, 0x70, 0x00, 0x00, 0x20, 0x07, 0x00, 0x00, 0x02,
-  0x00, 0xF0, 0x00, 0x00, 0x40, 0x0E, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00,
-  0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0,
-  0x00, 0x40, 0x00, 0x00, 0x0E, 0x00, 0x08, 0x00, 0x00, 0x01, 0xF0, 0x01,
-  0x00, 0x00, 0x00, 0x3E, 0x00, 0x20, 0x00, 0x00, 0x07, 0xC0, 0x02, 0x00,
-  0x00, 0x00, 0xF8, 0x00, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x08, 0x00, 0x00,
-  0x07, 0xE0, 0x00, 0xFF, 0xFC, 0x00, 0xF8, 0x00, 0x07, 0xFF, 0x80, 0x1F,
-  0x00, 0x00, 0x00, 0x30, 0x03, 0xE0, 0x00, 0x00, 0x06, 0x00, 0x7C, 0x00,
-  0x00, 0x00, 0xC0, 0x0F, 0x80, 0x00, 0x00, 0x18, 0x01, 0xF0, 0x00, 0x00,
-  0x03, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x60, 0x07, 0xC0, 0x00, 0x00, 0x0C,
-  0x00, 0xF8, 0x00, 0x00, 0x01, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x30, 0x03,
-  0xE0, 0x00, 0x00, 0x06, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xC0, 0x0F, 0xFF,
-  0xC0, 0x00, 0x18, 0x00, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0xF0,
-  0x00, 0x60, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x00, 0x01, 0xE0, 0x01,
-  0x80, 0x00, 0x00, 0x3C, 0x00, 0x30, 0x00, 0x00, 0x07, 0x80, 0x06, 0x00,
-  0x00, 0x00, 0x78, 0x00, 0x40, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0xFF, 0xFF,
-  0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF,
-  0xFF, 0xF0, 0x00, 0x02, 0x00, 0x00, 0x60, 0x00, 0x10, 0x00, 0x03, 0xC0,
-  0x00, 0x40, 0x00, 0x1E, 0x00, 0x01, 0x00, 0x00, 0xF8, 0x00, 0x08, 0x00,
-  0x03, 0xC0, 0x00, 0x20, 0x00, 0x1E, 0x00, 0x00, 0x80, 0x00, 0xF0, 0x00,
-  0x04, 0x00, 0xFF, 0x80, 0x00, 0x10, 0x03, 0xFC, 0x00, 0x00, 0x40, 0x1E,
-  0x00, 0x00, 0x02, 0x00, 0x70, 0x00, 0x00, 0x08, 0x01, 0xC0, 0x00, 0x00,
-  0x20, 0x0E, 0x00, 0x00, 0x0F, 0x00, 0x38, 0x00, 0x00, 0x60, 0x01, 0xE0,
-  0x00, 0x02, 0x00, 0x07, 0x00, 0x00, 0x10, 0x00, 0x1C, 0x00, 0x00, 0x80,
-  0x00, 0xF0, 0x00, 0x04, 0x00, 0x03, 0x80, 0x00, 0x20, 0x00, 0x0E, 0x00,
-  0x01, 0x00, 0x00, 0x78, 0x00, 0x0F, 0xF8, 0x01, 0xC0, 0x00, 0x0F, 0xE0,
-  0x0F, 0x00, 0x00, 0x00, 0x80, 0x38, 0x00, 0x00, 0x04, 0x00, 0xE0, 0x00,
-  0x00, 0x10, 0x07, 0xFE, 0x00, 0x00, 0x40, 0x00, 0x1C, 0x00, 0x02, 0x00,
-  0x00, 0x78, 0x00, 0x08, 0x00, 0x03, 0xC0, 0x00, 0x20, 0x00, 0x1E, 0x00,
-  0x01, 0x00, 0x00, 0x78, 0x00, 0x04, 0x00, 0x03, 0xC0, 0x00, 0x20, 0x00,
-  0x1E, 0x00, 0x00, 0x80, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
-  0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x08, 0x01,
-  0x80, 0x00, 0x40, 0x1E, 0x00, 0x04, 0x00, 0xE0, 0x00, 0x20, 0x07, 0x00,
-  0x02, 0x00, 0x78, 0x00, 0x10, 0x03, 0x80, 0x00, 0x80, 0x3C, 0x00, 0x08,
-  0x01, 0xE0, 0x00, 0x40, 0x0E, 0x00, 0x02, 0x00, 0xF0, 0x00, 0x20, 0x07,
-  0x00, 0x01, 0x00, 0x38, 0x00, 0x08, 0x03, 0xC0, 0x00, 0x80, 0x1C, 0x00,
-  0x04, 0x00, 0xE0, 0x00, 0x20, 0x0F, 0x00, 0x02, 0x00, 0x70, 0x00, 0x10,
-  0x03, 0x80, 0x01, 0x00, 0x3C, 0x00, 0x08, 0x01, 0xC0, 0x00, 0x40, 0x1E,
-  0x00, 0x04, 0x00, 0xE0, 0x00, 0x20, 0x07, 0x00, 0x01, 0x00, 0x78, 0x00,
-  0x10, 0x03, 0x80, 0x00, 0x80, 0x1C, 0x00, 0x04, 0x01, 0xE0, 0x00, 0x40,
-  0x0E, 0x00, 0x02, 0x00, 0x70, 0x00, 0x10, 0x07, 0x80, 0x01, 0x00, 0x38,
-  0x00, 0x08, 0x01, 0xC0, 0x00, 0x80, 0x1C, 0x00, 0x04, 0x00, 0xE0, 0x00,
-  0x20, 0x0F, 0x00, 0x02, 0x00, 0x70, 0x00, 0x10, 0x03, 0x80, 0x00, 0x80,
-  0x3C, 0x00, 0x08, 0x01, 0xC0, 0x00, 0x40, 0x0E, 0x00, 0x02, 0x00, 0xF0,
-  0x00, 0x20, 0x07, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-  0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x03, 0x00, 0x01, 0x80, 0x00,
-  0x0C, 0x00, 0x07, 0x80, 0x00, 0x30, 0x00, 0x0E, 0x00, 0x00, 0xC0, 0x00,
-  0x1C, 0x00, 0x01, 0x00, 0x00, 0x78, 0x00, 0x04, 0x00, 0x00, 0xE0, 0x00,
-  0x10, 0x00, 0x01, 0xC0, 0x00, 0x1F, 0xE0, 0x07, 0x80, 0x00, 0x1F, 0xC0,
-  0x0E, 0x00, 0x00, 0x00, 0x80, 0x3C, 0x00, 0x00, 0x02, 0x00, 0x70, 0x00,
-  0x00, 0x04, 0x00, 0xE0, 0x00, 0x00, 0x08, 0x03, 0xFF, 0x00, 0x00, 0x20,
-  0x00, 0x0F, 0x00, 0x00, 0x40, 0x00, 0x3F, 0x00, 0x01, 0x00, 0x00, 0xF8,
-  0x00, 0x02, 0x00, 0x03, 0xE0, 0x00, 0x04, 0x00, 0x0F, 0x80, 0x00, 0x10,
-  0x00, 0x3E, 0x00, 0x00, 0x20, 0x00, 0xF8, 0x00, 0x00, 0x40, 0x1F, 0xE0,
-  0x00, 0x01, 0x00, 0x3F, 0x80, 0x00, 0x02, 0x00, 0x70, 0x00, 0x00, 0x08,
-  0x01, 0xE0, 0x00, 0x00, 0x10, 0x03, 0x80, 0x00, 0x07, 0xE0, 0x07, 0x00,
-  0x00, 0x10, 0x00, 0x1E, 0x00, 0x00, 0x40, 0x00, 0x38, 0x00, 0x01, 0x00,
-  0x00, 0x70, 0x00, 0x02, 0x00, 0x01, 0xE0, 0x00, 0x08, 0x00, 0x03, 0x80,
-  0x00, 0x20, 0x00, 0x07, 0x00, 0x00, 0x40, 0x00, 0x1C, 0x00, 0x01, 0x00,
-  0x00, 0x38, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xC0,
-  0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x40, 0x90, 0x60, 0x20, 0x38, 0x3C,
-  0x10, 0x04, 0x1E, 0x08, 0x00, 0x0F, 0x84, 0x18, 0x07, 0xC2, 0x0E, 0x03,
-  0xE1, 0x07, 0xC1, 0xF0, 0x7F, 0xEF, 0xF8, 0x0F, 0xF1, 0xF8, 0x00 };
-
-const GFXglyph airstrikeb3d26pt7bGlyphs[] PROGMEM = {
-  {     0,   1,   1,  14,    0,    0 },   // 0x20 ' '
-  {     1,  21,  31,  15,    4,  -27 },   // 0x21 '!'
-  {    83,  18,  14,  19,   10,  -27 },   // 0x22 '"'
-  {   115,  48,  31,  40,    2,  -27 },   // 0x23 '#'
-  {   301,  45,  45,  36,    1,  -34 },   // 0x24 '$'
-  {   555,  48,  31,  43,    3,  -27 },   // 0x25 '%'
-  {   741,  48,  31,  44,    4,  -27 },   // 0x26 '&'
-  {   927,  11,  14,  12,   10,  -27 },   // 0x27 '''
-  {   947,  27,  34,  24,    7,  -28 },   // 0x28 '('
-  {  1062,  27,  34,  23,    1,  -28 },   // 0x29 ')'
-  {  1177,  15,  14,  15,   10,  -30 },   // 0x2A '*'
-  {  1204,  30,  21,  26,    4,  -22 },   // 0x2B '+'
-  {  1283,  13,  15,  13,    2,   -7 },   // 0x2C ','
-  {  1308,  24,  11,  21,    4,  -17 },   // 0x2D '-'
-  {  1341,  12,  11,  13,    3,   -7 },   // 0x2E '.'
-  {  1358,  47,  31,  36,    0,  -27 },   // 0x2F '/'
-  {  1541,  39,  31,  40,    6,  -27 },   // 0x30 '0'
-  {  1693,  24,  31,  19,    5,  -27 },   // 0x31 '1'
-  {  1786,  41,  31,  36,    3,  -27 },   // 0x32 '2'
-  {  1945,  42,  31,  37,    1,  -27 },   // 0x33 '3'
-  {  2108,  41,  31,  36,    5,  -27 },   // 0x34 '4'
-  {  2267,  44,  31,  36,    2,  -27 },   // 0x35 '5'
-  {  2438,  38,  31,  35,    7,  -27 },   // 0x36 '6'
-  {  2586,  43,  31,  34,    2,  -27 },   // 0x37 '7'
-  {  2753,  41,  31,  39,    4,  -27 },   // 0x38 '8'
-  {  2912,  38,  31,  35,    2,  -27 },   // 0x39 '9'
-  {  3060,  17,  24,  13,    3,  -20 },   // 0x3A ':'
-  {  3111,  17,  28,  13,    2,  -20 },   // 0x3B ';'
-  {  3171,  31,  31,  26,    6,  -27 },   // 0x3C '<'
-  {  3292,  32,  20,  24,    2,  -22 },   // 0x3D '='
-  {  3372,  31,  31,  26,    0,  -27 },   // 0x3E '>'
-  {  3493,  39,  31,  36,    5,  -27 },   // 0x3F '?'
-  {  3645,  40,  34,  40,    6,  -28 },   // 0x40 '@'
-  {  3815,  40,  31,  41,    1,  -27 },   // 0x41 'A'
-  {  3970,  42,  31,  38,    2,  -27 },   // 0x42 'B'
-  {  4133,  39,  31,  35,    7,  -27 },   // 0x43 'C'
-  {  4285,  42,  31,  36,    1,  -27 },   // 0x44 'D'
-  {  4448,  43,  31,  34,    2,  -27 },   // 0x45 'E'
-  {  4615,  43,  31,  34,    2,  -27 },   // 0x46 'F'
-  {  4782,  39,  31,  35,    7,  -27 },   // 0x47 'G'
-  {  4934,  44,  31,  36,    2,  -27 },   // 0x48 'H'
-  {  5105,  42,  31,  34,    2,  -27 },   // 0x49 'I'
-  {  5268,  41,  31,  32,    1,  -27 },   // 0x4A 'J'
-  {  5427,  48,  31,  38,    2,  -27 },   // 0x4B 'K'
-  {  5613,  31,  31,  31,    2,  -27 },   // 0x4C 'L'
-  {  5734,  53,  31,  45,    2,  -27 },   // 0x4D 'M'
-  {  5940,  44,  31,  36,    2,  -27 },   // 0x4E 'N'
-  {  6111,  39,  31,  39,    6,  -27 },   // 0x4F 'O'
-  {  6263,  42,  31,  37,    2,  -27 },   // 0x50 'P'
-  {  6426,  38,  33,  38,    6,  -27 },   // 0x51 'Q'
-  {  6583,  42,  31,  38,    2,  -27 },   // 0x52 'R'
-  {  6746,  45,  31,  36,    1,  -27 },   // 0x53 'S'
-  {  6921,  35,  31,  34,    9,  -27 },   // 0x54 'T'
-  {  7057,  41,  31,  37,    6,  -27 },   // 0x55 'U'
-  {  7216,  40,  31,  40,   11,  -27 },   // 0x56 'V'
-  {  7371,  47,  31,  47,   11,  -27 },   // 0x57 'W'
-  {  7554,  47,  31,  36,    0,  -27 },   // 0x58 'X'
-  {  7737,  36,  31,  36,   11,  -27 },   // 0x59 'Y'
-  {  7877,  44,  31,  34,    1,  -27 },   // 0x5A 'Z'
-  {  8048,  34,  37,  23,    1,  -30 },   // 0x5B '['
-  {  8206,  26,  31,  36,   11,  -27 },   // 0x5C '\'
-  {  8307,  34,  37,  23,    1,  -30 },   // 0x5D ']'
-  {  8465,  41,  31,  41,    1,  -27 },   // 0x5E '^'
-  {  8624,  30,  11,  26,    0,   -7 },   // 0x5F '_'
-  {  8666,   9,  11,  12,   11,  -27 },   // 0x60 '`'
-  {  8679,  40,  31,  41,    1,  -27 },   // 0x61 'a'
-  {  8834,  42,  31,  38,    2,  -27 },   // 0x62 'b'
-  {  8997,  39,  31,  35,    7,  -27 },   // 0x63 'c'
-  {  9149,  42,  31,  36,    1,  -27 },   // 0x64 'd'
-  {  9312,  43,  31,  34,    2,  -27 },   // 0x65 'e'
-  {  9479,  43,  31,  34,    2,  -27 },   // 0x66 'f'
-  {  9646,  39,  31,  35,    7,  -27 },   // 0x67 'g'
-  {  9798,  44,  31,  36,    2,  -27 },   // 0x68 'h'
-  {  9969,  23,  31,  15,    2,  -27 },   // 0x69 'i'
-  { 10059,  41,  31,  32,    1,  -27 },   // 0x6A 'j'
-  { 10218,  48,  31,  38,    2,  -27 },   // 0x6B 'k'
-  { 10404,  31,  31,  31,    2,  -27 },   // 0x6C 'l'
-  { 10525,  53,  31,  45,    2,  -27 },   // 0x6D 'm'
-  { 10731,  44,  31,  36,    2,  -27 },   // 0x6E 'n'
-  { 10902,  40,  31,  41,    6,  -27 },   // 0x6F 'o'
-  { 11057,  42,  31,  37,    2,  -27 },   // 0x70 'p'
-  { 11220,  38,  33,  38,    6,  -27 },   // 0x71 'q'
-  { 11377,  42,  31,  39,    2,  -27 },   // 0x72 'r'
-  { 11540,  45,  31,  36,    1,  -27 },   // 0x73 's'
-  { 11715,  35,  31,  34,    9,  -27 },   // 0x74 't'
-  { 11851,  41,  31,  37,    6,  -27 },   // 0x75 'u'
-  { 12010,  40,  31,  40,   11,  -27 },   // 0x76 'v'
-  { 12165,  52,  31,  47,    5,  -27 },   // 0x77 'w'
-  { 12367,  47,  31,  36,    0,  -27 },   // 0x78 'x'
-  { 12550,  36,  31,  36,   11,  -27 },   // 0x79 'y'
-  { 12690,  44,  31,  34,    1,  -27 },   // 0x7A 'z'
-  { 12861,  38,  37,  31,    4,  -30 },   // 0x7B '{'
-  { 13037,  29,  45,  15,   -1,  -34 },   // 0x7C '|'
-  { 13201,  39,  37,  31,    0,  -30 },   // 0x7D '}'
-  { 13382,  26,  10,  23,    4,  -16 } }; // 0x7E '~'
-
-const GFXfont airstrikeb3d26pt7b PROGMEM = {
-  (uint8_t  *)airstrikeb3d26pt7bBitmaps,
-  (GFXglyph *)airstrikeb3d26pt7bGlyphs,
-  0x20, 0x7E, 48 };
-
-// Approx. 14087 bytes
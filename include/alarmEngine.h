@@ -0,0 +1,155 @@
+/*!
+ * \file alarmEngine.h
+ * \brief Table driven engine alarms
+ *
+ * This file contains the alarms of the engine. The alarms are declared
+ * once in \ref ALARM_LIST, either as a threshold on a signal with
+ * hysteresis and delay, or as a bit of the engine discrete status.
+ *
+ * The alarms are evaluated in the N2K task right after the signals are
+ * written. A raised or cleared alarm of a displayed engine wakes the
+ * display task at once, so the alarm does not wait for the next frame
+ * tick. The time from raising the alarm till it is on screen is
+ * recorded by the latency monitor.
+ *
+ * \author Matthias Werner
+ * \date   October 2026
+ * \version 0.1
+ *
+ *
+ */
+
+#ifndef _ALARMENGINE_H_
+#define _ALARMENGINE_H_
+
+#include <hardwareDef.h>
+#include <signalRegistry.h>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+/*! ******************************************************************
+  @enum   tAlarmCondition
+  @brief  Condition raising an alarm
+ */
+typedef enum
+{
+  /// Raised above the threshold, cleared below threshold - hysteresis
+  ALARM_ABOVE = 0,
+  /// Raised below the threshold, cleared above threshold + hysteresis
+  ALARM_BELOW,
+  /// Raised while the bits of the threshold are set in the value
+  ALARM_BIT_SET
+} tAlarmCondition;
+
+/// Raw value of a coolant temperature [C]
+#define ALARM_RAW_CELSIUS(c) ((c) * 100 + 27315)
+/// Raw value of a coolant temperature difference [C]
+#define ALARM_RAW_CELSIUS_DIFF(c) ((c) * 100)
+/// Raw value of a pressure [kPa]
+#define ALARM_RAW_KPA(kpa) ((kpa) * 10)
+/// Raw value of a voltage [0.1 V]
+#define ALARM_RAW_DECIVOLT(dv) ((dv) * 10)
+
+/*! ******************************************************************
+  @brief  List of all alarms
+
+  One entry per alarm: X(Name, Signal, Condition, Threshold, Hysteresis,
+  DelayMs, WhenRunning). The threshold is given in the raw unit of the
+  signal or as bit mask for \ref ALARM_BIT_SET. Alarms with WhenRunning
+  are only active while the engine runs, e.g. the oil pressure is low
+  with a stopped engine. The entry generates the ID ALARM_ID_<Name>.
+ */
+#define ALARM_LIST(X)                                                                                         \
+  X(CoolantHigh, EngineCoolantTemperature, ALARM_ABOVE, ALARM_RAW_CELSIUS(ALARM_COOLANT_HIGH),                  \
+    ALARM_RAW_CELSIUS_DIFF(ALARM_COOLANT_HYSTERESIS), ALARM_THRESHOLD_DELAY, false)                             \
+  X(OilPressureLow, EngineOilPressure, ALARM_BELOW, ALARM_RAW_KPA(ALARM_OIL_PRESSURE_LOW),                      \
+    ALARM_RAW_KPA(ALARM_OIL_PRESSURE_HYSTERESIS), ALARM_THRESHOLD_DELAY, true)                                  \
+  X(VoltageLow, EngineAlternatorVoltage, ALARM_BELOW, ALARM_RAW_DECIVOLT(ALARM_VOLTAGE_LOW),                    \
+    ALARM_RAW_DECIVOLT(ALARM_VOLTAGE_HYSTERESIS), ALARM_THRESHOLD_DELAY, true)                                  \
+  X(VoltageHigh, EngineAlternatorVoltage, ALARM_ABOVE, ALARM_RAW_DECIVOLT(ALARM_VOLTAGE_HIGH),                  \
+    ALARM_RAW_DECIVOLT(ALARM_VOLTAGE_HYSTERESIS), ALARM_THRESHOLD_DELAY, false)                                 \
+  X(CheckEngine, EngineDiscreteStatus1, ALARM_BIT_SET, 1 << 0, 0, ALARM_STATUS_DELAY, false)                    \
+  X(OverTemperature, EngineDiscreteStatus1, ALARM_BIT_SET, 1 << 1, 0, ALARM_STATUS_DELAY, false)                \
+  X(LowOilPressure, EngineDiscreteStatus1, ALARM_BIT_SET, 1 << 2, 0, ALARM_STATUS_DELAY, false)                 \
+  X(LowOilLevel, EngineDiscreteStatus1, ALARM_BIT_SET, 1 << 3, 0, ALARM_STATUS_DELAY, false)                    \
+  X(LowFuelPressure, EngineDiscreteStatus1, ALARM_BIT_SET, 1 << 4, 0, ALARM_STATUS_DELAY, false)                \
+  X(LowSystemVoltage, EngineDiscreteStatus1, ALARM_BIT_SET, 1 << 5, 0, ALARM_STATUS_DELAY, false)               \
+  X(LowCoolantLevel, EngineDiscreteStatus1, ALARM_BIT_SET, 1 << 6, 0, ALARM_STATUS_DELAY, false)                \
+  X(WaterFlow, EngineDiscreteStatus1, ALARM_BIT_SET, 1 << 7, 0, ALARM_STATUS_DELAY, false)                      \
+  X(WaterInFuel, EngineDiscreteStatus1, ALARM_BIT_SET, 1 << 8, 0, ALARM_STATUS_DELAY, false)                    \
+  X(ChargeIndicator, EngineDiscreteStatus1, ALARM_BIT_SET, 1 << 9, 0, ALARM_STATUS_DELAY, false)                \
+  X(PreheatIndicator, EngineDiscreteStatus1, ALARM_BIT_SET, 1 << 10, 0, ALARM_STATUS_DELAY, false)              \
+  X(HighBoostPressure, EngineDiscreteStatus1, ALARM_BIT_SET, 1 << 11, 0, ALARM_STATUS_DELAY, false)             \
+  X(RevLimitExceeded, EngineDiscreteStatus1, ALARM_BIT_SET, 1 << 12, 0, ALARM_STATUS_DELAY, false)              \
+  X(EGRSystem, EngineDiscreteStatus1, ALARM_BIT_SET, 1 << 13, 0, ALARM_STATUS_DELAY, false)                     \
+  X(ThrottlePositionSensor, EngineDiscreteStatus1, ALARM_BIT_SET, 1 << 14, 0, ALARM_STATUS_DELAY, false)        \
+  X(EmergencyStopMode, EngineDiscreteStatus1, ALARM_BIT_SET, 1 << 15, 0, ALARM_STATUS_DELAY, false)             \
+  X(WarningLevel1, EngineDiscreteStatus2, ALARM_BIT_SET, 1 << 0, 0, ALARM_STATUS_DELAY, false)                  \
+  X(WarningLevel2, EngineDiscreteStatus2, ALARM_BIT_SET, 1 << 1, 0, ALARM_STATUS_DELAY, false)                  \
+  X(PowerReduction, EngineDiscreteStatus2, ALARM_BIT_SET, 1 << 2, 0, ALARM_STATUS_DELAY, false)                 \
+  X(MaintenanceNeeded, EngineDiscreteStatus2, ALARM_BIT_SET, 1 << 3, 0, ALARM_STATUS_DELAY, false)              \
+  X(EngineCommError, EngineDiscreteStatus2, ALARM_BIT_SET, 1 << 4, 0, ALARM_STATUS_DELAY, false)                \
+  X(SubThrottle, EngineDiscreteStatus2, ALARM_BIT_SET, 1 << 5, 0, ALARM_STATUS_DELAY, false)                    \
+  X(NeutralStartProtect, EngineDiscreteStatus2, ALARM_BIT_SET, 1 << 6, 0, ALARM_STATUS_DELAY, false)            \
+  X(EngineShuttingDown, EngineDiscreteStatus2, ALARM_BIT_SET, 1 << 7, 0, ALARM_STATUS_DELAY, false)
+
+/*! ******************************************************************
+  @enum   tAlarmId
+  @brief  ID of an alarm, generated from \ref ALARM_LIST
+ */
+typedef enum
+{
+#define ALARM_ID(Name, Signal, Condition, Threshold, Hysteresis, DelayMs, WhenRunning) ALARM_ID_##Name,
+  ALARM_LIST(ALARM_ID)
+#undef ALARM_ID
+  /// Number of alarms
+  ALARM_COUNT
+} tAlarmId;
+
+static_assert(ALARM_COUNT <= 32, "Active bits of all alarms have to fit into 32 bits");
+
+/// Active bit of an alarm
+#define ALARM_BIT(Id) (1UL << (Id))
+
+/// Alarms shown with the oil pressure warning
+#define ALARM_OIL_PRESSURE_MASK (ALARM_BIT(ALARM_ID_OilPressureLow) | ALARM_BIT(ALARM_ID_LowOilPressure))
+
+/*! ******************************************************************
+  @brief    Init the alarms
+  @details  All alarms are cleared.
+  @param    NotifyTask Task to wake up if an alarm of a displayed
+            engine changes, nullptr for none
+ */
+void alarmInit(TaskHandle_t NotifyTask);
+
+/*! ******************************************************************
+  @brief    Evaluate the alarms of an engine instance
+  @details  Only to be called from the N2K task, after the signals of
+            a message are written and periodically for the delays.
+  @param    Instance Engine instance
+  @param    now Current time [us]
+ */
+void alarmEvaluate(uint8_t Instance, uint64_t now);
+
+/*! ******************************************************************
+  @brief    Get the active alarms of an engine instance
+  @param    Instance Engine instance
+  @return   uint32_t active bits, see \ref ALARM_BIT
+ */
+uint32_t alarmGetActive(uint8_t Instance);
+
+/*! ******************************************************************
+  @brief    Get the name of an alarm
+  @param    Id ID of the alarm
+  @return   const char* name
+ */
+const char *alarmGetName(tAlarmId Id);
+
+/*! ******************************************************************
+  @brief    Show the active alarms via Serial
+  @details  Has to be called with the serial output mutex taken.
+ */
+void alarmShow(void);
+
+#endif // _ALARMENGINE_H_
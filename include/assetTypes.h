@@ -0,0 +1,123 @@
+/*!
+ * \file assetTypes.h
+ * \brief Types of the images and fonts generated from graphics/
+ *
+ * This file contains the formats of the images and fonts which are
+ * converted from the files in graphics/ by scripts/assetCompiler.py
+ * at build time. The compiler writes one source with the data and one
+ * header with the dimensions, the format and the extern declaration
+ * per asset, see graphics/assets.json for the list of assets.
+ *
+ * \author Matthias Werner
+ * \date   October 2026
+ * \version 0.1
+ *
+ *
+ */
+
+#ifndef _ASSETTYPES_H_
+#define _ASSETTYPES_H_
+
+#include <Arduino.h>
+#include <imageCodec.h>
+
+/// RGB565 pixels, one uint16_t per pixel
+#define ASSET_FORMAT_RAW 0
+/// Palette of RGB565 colours and one uint8_t index per pixel
+#define ASSET_FORMAT_PALETTE 1
+/// Compressed RGB565 image, see \ref tCompressedImage
+#define ASSET_FORMAT_COMPRESSED 2
+/// Icons with 4 bits per pixel, see \ref tLampIcon
+#define ASSET_FORMAT_ATLAS4 3
+/// Subset of a GFX font with run length glyphs, see \ref tRunFont
+#define ASSET_FORMAT_RUN_FONT 4
+
+/// Transparent pixel of an icon atlas
+#define LAMP_ATLAS_TRANSPARENT 15
+
+/// Full brightness of the lamp colour
+#define LAMP_ATLAS_FULL 14
+
+/*! ******************************************************************
+  @struct tPalettedImage
+  @brief  Structure for a palettized image in flash
+ */
+typedef struct
+{
+  /// RGB565 colours of the palette
+  const uint16_t *Palette;
+  /// Palette index of every pixel
+  const uint8_t *Pixels;
+  /// Number of colours of the palette
+  uint16_t Colors;
+  /// Width of the image [px]
+  uint16_t Width;
+  /// Height of the image [px]
+  uint16_t Height;
+} tPalettedImage;
+
+/*! ******************************************************************
+  @struct tLampIcon
+  @brief  Structure for the position of an icon in an icon atlas
+  @details  Each pixel is stored with 4 bits: 0..14 is the brightness
+            of the lamp colour from black to full, 15 is transparent
+            and keeps the image below. Two pixels share one byte, the
+            left pixel in the high nibble.
+ */
+typedef struct
+{
+  /// Offset of the first byte in the atlas
+  uint16_t Offset;
+  /// Width of the icon [px], always even
+  uint8_t Width;
+  /// Height of the icon [px]
+  uint8_t Height;
+} tLampIcon;
+
+/*! ******************************************************************
+  @struct tRunGlyph
+  @brief  Structure for a glyph of a run length font
+  @details  The pixels of a glyph are stored row by row as alternating
+            runs of background and foreground pixels, starting with
+            background. A run is one byte, a longer run is continued
+            after a run of 0 pixels. Metrics as in the GFX fonts.
+ */
+typedef struct
+{
+  /// Offset of the first run in the runs of the font
+  uint16_t Offset;
+  /// Width of the glyph [px]
+  uint8_t Width;
+  /// Height of the glyph [px]
+  uint8_t Height;
+  /// Distance to the next glyph [px]
+  uint8_t XAdvance;
+  /// Distance of the left edge from the cursor [px]
+  int8_t XOffset;
+  /// Distance of the top edge from the baseline [px]
+  int8_t YOffset;
+} tRunGlyph;
+
+/*! ******************************************************************
+  @struct tRunFont
+  @brief  Structure for a run length font in flash
+ */
+typedef struct
+{
+  /// Runs of all glyphs
+  const uint8_t *Runs;
+  /// Glyphs in the order of the characters
+  const tRunGlyph *Glyphs;
+  /// Characters of the font, sorted
+  const char *Chars;
+  /// Number of glyphs
+  uint8_t Count;
+  /// Largest height above the baseline of the full font [px]
+  uint8_t Ascent;
+  /// Largest depth below the baseline of the full font [px]
+  uint8_t Descent;
+  /// Distance between two lines [px]
+  uint8_t YAdvance;
+} tRunFont;
+
+#endif // _ASSETTYPES_H_
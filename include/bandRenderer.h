@@ -0,0 +1,184 @@
+/*!
+ * \file bandRenderer.h
+ * \brief Composition of the frame in horizontal bands
+ *
+ * This file contains a renderer which keeps no frame in RAM. The frame
+ * is described by a display list of the images, needles, arcs, texts
+ * and icons in the order they are drawn. To render it, every band of a
+ * few lines is cleared, the commands touching the band are drawn onto
+ * the palette canvas of the band and the band is pushed to the display.
+ * With DMA the push of one band overlaps the composition of the next
+ * one, see \ref PaletteCanvas::PushSprite.
+ *
+ * \author Matthias Werner
+ * \date   October 2026
+ * \version 0.1
+ *
+ *
+ */
+
+#ifndef _BANDRENDERER_H_
+#define _BANDRENDERER_H_
+
+#include <hardwareDef.h>
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include <assetTypes.h>
+#include <paletteCanvas.h>
+
+/// Maximum number of commands of the display list
+#define BAND_RENDERER_COMMANDS 16
+
+/// Maximum length of a text of the display list, including the terminator
+#define BAND_RENDERER_TEXT_LENGTH 12
+
+/// Copy a rectangle of a palettized image
+#define BAND_COMMAND_IMAGE 0
+/// Draw a palettized image rotated around its pivot
+#define BAND_COMMAND_ROTATED 1
+/// Draw an anti aliased arc
+#define BAND_COMMAND_ARC 2
+/// Draw a text with a run length font
+#define BAND_COMMAND_TEXT 3
+/// Draw an icon of an icon atlas
+#define BAND_COMMAND_ICON 4
+
+/*! ******************************************************************
+  @struct tBandCommand
+  @brief  Structure for one command of the display list
+ */
+typedef struct
+{
+  /// Type of the command, BAND_COMMAND_IMAGE to BAND_COMMAND_ICON
+  uint8_t Type;
+  /// First line of the frame touched by the command [px]
+  int16_t Top;
+  /// Last line of the frame touched by the command [px]
+  int16_t Bottom;
+  /// Position of the command [px], see the parameters of the Add functions
+  int16_t x;
+  /// Position of the command [px], see the parameters of the Add functions
+  int16_t y;
+  /// Parameters depending on the type
+  union
+  {
+    struct
+    {
+      const tPalettedImage *Image;
+      int16_t sx, sy, w, h;
+    } Image;
+    struct
+    {
+      const tPalettedImage *Image;
+      int16_t PivotX, PivotY, Angle;
+      uint8_t Transparent;
+    } Rotated;
+    struct
+    {
+      int16_t r, ir;
+      uint16_t StartAngle, EndAngle;
+      uint8_t Ramp, Levels;
+    } Arc;
+    struct
+    {
+      const tRunFont *Font;
+      char Text[BAND_RENDERER_TEXT_LENGTH];
+      uint8_t Datum, Index;
+    } Text;
+    struct
+    {
+      const tLampIcon *Icon;
+      const uint8_t *Atlas;
+      uint8_t Ramp;
+    } Icon;
+  };
+} tBandCommand;
+
+/*! ******************************************************************
+  @class  BandRenderer
+  @brief  Class for the composition of the frame in horizontal bands
+
+  The display list is kept after \ref Render, so a part of the frame
+  can be rendered again after changing the list, e.g. only the lamps.
+ */
+class BandRenderer
+{
+public:
+  /*! ******************************************************************
+    @brief Constructor
+    @param Tft Display the frame is rendered to
+    @param Canvas Canvas of one band with the palette of the frame
+   */
+  BandRenderer(TFT_eSPI *Tft, PaletteCanvas *Canvas);
+
+  /// Remove all commands of the display list
+  void Clear(void);
+
+  /*! ******************************************************************
+    @brief Add a rectangle of a palettized image
+    @details See \ref PaletteCanvas::PushImage for the parameters.
+    @return bool false if the display list is full
+   */
+  bool AddImage(const tPalettedImage &Image, int16_t x, int16_t y, int16_t sx, int16_t sy, int16_t w, int16_t h);
+
+  /*! ******************************************************************
+    @brief Add a palettized image rotated around its pivot
+    @details See \ref PaletteCanvas::PushRotated for the parameters.
+    @return bool false if the display list is full
+   */
+  bool AddRotated(const tPalettedImage &Image, int16_t PivotX, int16_t PivotY, int16_t x, int16_t y, int16_t Angle,
+                  uint8_t Transparent);
+
+  /*! ******************************************************************
+    @brief Add an anti aliased arc with round ends
+    @details See \ref PaletteCanvas::DrawSmoothArc for the parameters.
+    @return bool false if the display list is full
+   */
+  bool AddArc(int16_t x, int16_t y, int16_t r, int16_t ir, uint16_t StartAngle, uint16_t EndAngle, uint8_t Ramp,
+              uint8_t Levels);
+
+  /*! ******************************************************************
+    @brief Add a text
+    @details See \ref runFontDrawString for the parameters. The text is
+             copied and cut after BAND_RENDERER_TEXT_LENGTH - 1
+             characters.
+    @return bool false if the display list is full
+   */
+  bool AddText(const tRunFont &Font, const char *Text, int16_t x, int16_t y, uint8_t Datum, uint8_t Index);
+
+  /*! ******************************************************************
+    @brief Add an icon of an icon atlas
+    @details See \ref PaletteCanvas::PushIcon for the parameters.
+    @return bool false if the display list is full
+   */
+  bool AddIcon(const tLampIcon &Icon, const uint8_t *Atlas, int16_t x, int16_t y, uint8_t Ramp);
+
+  /*! ******************************************************************
+    @brief Render a rectangle of the frame to the display
+    @details The rectangle is composed band by band from the display
+             list and pushed to the same position on the display.
+    @param x X position of the rectangle [px]
+    @param y Y position of the rectangle [px]
+    @param w Width of the rectangle [px]
+    @param h Height of the rectangle [px]
+   */
+  void Render(int32_t x, int32_t y, int32_t w, int32_t h);
+
+private:
+  /// Get the next free command, nullptr if the display list is full
+  tBandCommand *NextCommand(uint8_t Type, int16_t x, int16_t y, int16_t Top, int16_t Bottom);
+
+  /// Draw one command onto the band of the canvas
+  void Draw(const tBandCommand &Command);
+
+  /// Display the frame is rendered to
+  TFT_eSPI *Tft;
+  /// Canvas of one band
+  PaletteCanvas *Canvas;
+  /// Display list
+  tBandCommand Commands[BAND_RENDERER_COMMANDS];
+  /// Number of commands of the display list
+  uint8_t Count;
+};
+
+#endif // _BANDRENDERER_H_
@@ -17,34 +17,49 @@
 
 #include <Arduino.h>
 #include <TFT_eSPI.h> // Include the graphics library (this includes the sprite functions)
-
-// Images used for the display
+#include <displaySignal.h>
+#include <alarmEngine.h>
+#include <paletteCanvas.h>
+#include <bandRenderer.h>
+#include <gaugeScale.h>
+#include <displayWidget.h>
+
+// Images used for the display, generated from graphics/ at build time
+#include <imageCodec.h>
 #include <startscreen.h>
-#include <scale.h>
+#include <dial.h>
+#include <lampAtlas.h>
 
-// Special Fonts for the display
-#include <airstrikeb3d26pt7b.h>
-#include <airstrikeb3d18pt7b.h>
-#include <White_On_Black10pt7b.h>
-#include <G7_Segment_7a32pt7b.h>
+// Special Fonts for the display, subset from graphics/fonts/ at build time
+#include <runFont.h>
+#include <speedFont.h>
+#include <textFont.h>
+#include <smallFont.h>
 
 /// Create object "tft" for the display interaction
 extern TFT_eSPI tft;
 
-/// Create Sprite object "needle" with pointer to "tft" object the pointer 
-/// is used by pushSprite() to push it onto the TFT
-extern TFT_eSprite needle;
-/// Create Sprite object "background" with pointer to "tft" object the pointer
-/// is used by pushSprite() to push it onto the TFT
-extern TFT_eSprite background;
-/// Create Sprite object "textSprite" with pointer to "tft" object the pointer
-/// is used by pushSprite() to push it onto the TFT
-extern TFT_eSprite textSprite;
+/// Create the palette canvas "background" for one band of the frame with
+/// pointer to "tft" object the pointer is used by PushSprite() to push it
+/// onto the TFT, it holds the palette of the frame
+extern PaletteCanvas background;
+/// Create the renderer "frame" composing the frame band by band from its
+/// display list on the "background" canvas
+extern BandRenderer frame;
 
 // Size of the Display
 #define IWIDTH 240
 #define IHEIGHT 240
 
+// Lines of one band of the frame, composed and pushed at a time
+#define FRAME_BAND_LINES 24
+
+// Define the colour for stale values
+#define STALE_VALUE_COLOR 0x7bef
+
+// Define the colour white is shown in at night, all colours become shades of it
+#define NIGHT_MODE_COLOR 0xf800
+
 // Define the colours for the arc segments
 #define COOLANT_ARC_COLOR_OK 0x0d00
 #define COOLANT_ARC_COLOR_PASSIV 0x528a
@@ -65,20 +80,61 @@ extern TFT_eSprite textSprite;
 #define SPEEDTEXT_WIDTH 136
 #define SPEEDTEXT_HEIGHT 54
 
-// Define Speedometer needle Spritesize
-#define NEEDLE_WIDTH 20
-#define NEEDLE_HEIGHT 100
-
-// Define Standard Text Spritesize
-#define STD_TEXT_WIDTH 136
-#define STD_TEXT_HEIGHT 54
-
 // Define Engine Hours Spritesize
 #define ENGINEHOURS_TEXT_WIDTH 91
 #define ENGINEHOURS_TEXT_HEIGHT 28
 #define ENGINEHOURS_POSITION_X 49
 #define ENGINEHOURS_POSITION_Y 185
 
+// Define Speedometer needle Spritesize
+#define NEEDLE_WIDTH ASSET_NEEDLE_WIDTH
+#define NEEDLE_HEIGHT ASSET_NEEDLE_HEIGHT
+
+// Define the scale of the engine speed, the range is set in hardwareDef.h
+#define SCALE_ANGLE_START 226
+#define SCALE_ANGLE_END 386
+#define SCALE_MINOR_COLOR 0xbf1e
+#define SCALE_MAJOR_COLOR 0xffff
+#define SCALE_REDLINE_COLOR 0xf803
+#define SCALE_MINOR_INNER 89
+#define SCALE_MINOR_OUTER 107
+#define SCALE_MINOR_WIDTH 3
+#define SCALE_MAJOR_INNER 95
+#define SCALE_MAJOR_OUTER 115
+#define SCALE_MAJOR_WIDTH 4
+#define SCALE_REDLINE_INNER 89
+#define SCALE_REDLINE_OUTER 108
+#define SCALE_LABEL_RADIUS 80
+
+// Define the colours of the warning lamps
+#define LAMP_COLOR_RED 0xf805
+#define LAMP_COLOR_AMBER 0xfd20
+
+// Define the palette of the background, the colours of the dial first
+#define PALETTE_WHITE (ASSET_DIAL_COLORS + 0)
+#define PALETTE_STALE (ASSET_DIAL_COLORS + 1)
+#define PALETTE_GREEN (ASSET_DIAL_COLORS + 2)
+#define PALETTE_RED (ASSET_DIAL_COLORS + 3)
+// Ramps from black to the colour for the anti aliased arc and the lamps
+#define ARC_RAMP_LEVELS 8
+#define PALETTE_ARC_OK (ASSET_DIAL_COLORS + 4)
+#define PALETTE_ARC_PASSIV (PALETTE_ARC_OK + ARC_RAMP_LEVELS)
+#define PALETTE_ARC_CRITICAL (PALETTE_ARC_PASSIV + ARC_RAMP_LEVELS)
+#define PALETTE_LAMP_RED (PALETTE_ARC_CRITICAL + ARC_RAMP_LEVELS)
+#define PALETTE_LAMP_AMBER (PALETTE_LAMP_RED + LAMP_ATLAS_FULL)
+#define PALETTE_SCALE_MINOR (PALETTE_LAMP_AMBER + LAMP_ATLAS_FULL)
+#define PALETTE_SCALE_MAJOR (PALETTE_SCALE_MINOR + ARC_RAMP_LEVELS)
+#define PALETTE_SCALE_REDLINE (PALETTE_SCALE_MAJOR + ARC_RAMP_LEVELS)
+#define PALETTE_USED (PALETTE_SCALE_REDLINE + ARC_RAMP_LEVELS)
+
+#if PALETTE_USED > PALETTE_CANVAS_COLORS
+#error "Too many colours for the palette of the background, reduce the colours of the dial"
+#endif
+
+/// Engine speed needle or readout pushed by \ref updateDisplay
+#define DISPLAY_PUSHED_SPEED 0x01
+/// Warning lamps pushed by \ref updateDisplay
+#define DISPLAY_PUSHED_LAMPS 0x02
 
 /*! ******************************************************************
   @brief    Init the display and images
@@ -92,61 +148,47 @@ void initDisplay();
 
 
 /*! ******************************************************************
-  @brief    Show the engine speed on the screen
-  @details  This function will show the engine speed on the screen.
-          The engine speed will be shown as a number in a box.
-  @param    speed <double> The engine speed in RPM
-  @return   void
-*/
-void updateDspEngineSpeed(double speed);
-
-void showText(double speed);
-
-/*! ******************************************************************
-  @brief    Show the engine Hours on the screen
-  @details  This function will show the engine hours on the screen.
-          The engine hours will be shown as a number in a box.
-  @param    engineHours <double> The engine hours
-  @return   void
-*/
-void updateDspEngineHours(double engineHours);
-
-/*! ******************************************************************
-  @brief    Show a needle on the screen at a given engine speed
-  @details  This function will show a needle on the screen at a given
-          engine speed. The needle will be rotated to the correct
-          angle to represent the engine speed.
+  @brief    Request the night colours
+  @details  This function may be called from any task, the colours are
+          changed by \ref updateDspNightMode in the display task.
 
-  @param    speed  The engine speed in RPM
+  @param    night <bool> true for the night colours
+  @return   bool true if the request changed
 */
-void updateDspNeedlePosition(int speed);
+bool requestDspNightMode(bool night);
 
 /*! ******************************************************************
-  @brief    Show coolant temperature on the screen
-  @details  This function will show the coolant temperature on the
-          screen. The temperature will be shown as a arc with
-          five segments. The arc will be filled with a colour to
-          represent the temperature.
-
-  @param    tCoolant <double> The temperature in degrees
-  @return   void
+  @brief    Apply the requested night colours
+  @details  This function will switch the palette to the shades of
+          @ref NIGHT_MODE_COLOR or back to the day colours, if the
+          request changed. The next \ref updateDisplay renders the whole
+          frame then.
 
+  @return   bool true if the colours changed
 */
-void updateDspCoolantTemperatur(double tCoolant);
+bool updateDspNightMode();
 
 /*! ******************************************************************
   @brief    update the whole display
-  @details  This function will update the display with the given
-          values for speed, coolant temperature and engine hours.
-
-  @param    speed <double> The engine speed in RPM
-  @param    tCoolant <double> The coolant temperature in degrees
-  @param    engineHours <double> The engine hours
-  @param    oilPressureWarningActive <bool> True if the oil pressure
-          warning is active
-  @return   void
+  @details  This function will update the widgets of the engine page
+          with the given values for speed, coolant temperature, engine
+          hours and alarms. Only the rectangles of the widgets whose
+          shown state changed are rendered and pushed, nothing if none
+          changed. The second needle is only shown for a valid speed,
+          the first one for any value.
+          The result tells which widgets reached the screen, so the
+          latency is only measured for pixels which were pushed.
+
+  @param    speed <tSignalValue> The engine speed in RPM
+  @param    secondSpeed <tSignalValue> The engine speed of the second
+          engine in RPM, no data for a single engine
+  @param    tCoolant <tSignalValue> The coolant temperature in degrees
+  @param    engineHours <tSignalValue> The engine hours
+  @param    alarms <uint32_t> The active alarms, see \ref ALARM_BIT
+  @return   uint8_t pushed widgets, see \ref DISPLAY_PUSHED_SPEED and
+          \ref DISPLAY_PUSHED_LAMPS
 
 */
-void updateDisplay(double speed, double tCoolant, double engineHours, bool oilPressureWarningActive);
+uint8_t updateDisplay(tSignalValue speed, tSignalValue secondSpeed, tSignalValue tCoolant, tSignalValue engineHours, uint32_t alarms);
 
 #endif // _DISPLAYCTL_H_
\ No newline at end of file
@@ -0,0 +1,96 @@
+/*!
+ * \file displaySignal.h
+ * \brief Value and quality of a displayed signal
+ *
+ * This file contains the quality state which travels with each value
+ * from the NMEA2000 handlers to the display, so the display can show
+ * missing, not available and stale values distinctly.
+ *
+ * The values stay integers in the resolution of the NMEA2000 field
+ * together with their unit. They are converted to display units only
+ * at display time, in integer math, as the FPU of the ESP32-S3 has no
+ * double precision.
+ *
+ * \author Matthias Werner
+ * \date   October 2026
+ * \version 0.1
+ *
+ *
+ */
+
+#ifndef _DISPLAYSIGNAL_H_
+#define _DISPLAYSIGNAL_H_
+
+#include <Arduino.h>
+
+/*! ******************************************************************
+  @enum   tSignalQuality
+  @brief  Quality of a displayed signal
+ */
+typedef enum
+{
+  /// Nothing received so far
+  SIGNAL_NO_DATA = 0,
+  /// Value received within the timeout
+  SIGNAL_VALID,
+  /// The sender reported the value as not available
+  SIGNAL_NOT_AVAILABLE,
+  /// Last value is older than the timeout
+  SIGNAL_STALE
+} tSignalQuality;
+
+/*! ******************************************************************
+  @enum   tSignalUnit
+  @brief  Unit and resolution of the raw value of a signal
+ */
+typedef enum
+{
+  /// Speed [0.25 rpm], displayed in rpm
+  SIGNAL_UNIT_RPM_0_25 = 0,
+  /// Temperature [0.01 K], displayed in degrees Celsius
+  SIGNAL_UNIT_KELVIN_0_01,
+  /// Pressure [100 Pa], displayed in mbar
+  SIGNAL_UNIT_PASCAL_100,
+  /// Voltage [0.01 V], displayed in V
+  SIGNAL_UNIT_VOLT_0_01,
+  /// Duration [1 s], displayed in hours
+  SIGNAL_UNIT_SECOND,
+  /// Flags and counts without unit
+  SIGNAL_UNIT_NONE
+} tSignalUnit;
+
+/*! ******************************************************************
+  @struct tSignalValue
+  @brief  Structure for a value and its quality handed to the display
+ */
+typedef struct
+{
+  /// Raw value in the resolution of the unit, only meaningful if valid or stale
+  int32_t Raw;
+  /// Unit and resolution of the raw value
+  tSignalUnit Unit;
+  /// Quality of the value
+  tSignalQuality Quality;
+} tSignalValue;
+
+/*! ******************************************************************
+  @brief    Check if a signal has a value to show
+  @param    Signal Signal to check
+  @return   bool true if the signal is valid or stale
+ */
+inline bool signalHasValue(const tSignalValue &Signal)
+{
+  return (Signal.Quality == SIGNAL_VALID) || (Signal.Quality == SIGNAL_STALE);
+}
+
+/*! ******************************************************************
+  @brief    Convert a signal to display units
+  @details  The conversion is done in integer math and rounded to the
+            nearest step of 1/Scale display units.
+  @param    Signal Signal to convert
+  @param    Scale Factor of the result, e.g. 10 for one decimal place
+  @return   int32_t value in display units multiplied by Scale
+ */
+int32_t signalToDisplayUnit(const tSignalValue &Signal, int32_t Scale = 1);
+
+#endif // _DISPLAYSIGNAL_H_
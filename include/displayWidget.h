@@ -0,0 +1,383 @@
+/*!
+ * \file displayWidget.h
+ * \brief Retained widgets of the display
+ *
+ * This file contains the widgets a page of the display is built from,
+ * a needle of a gauge, an arc bar, a numeric readout and the warning
+ * lamps. Every widget is laid out from a constant layout structure and
+ * keeps the state it was drawn with last, quantized to what is visible
+ * on the screen, e.g. the text of a readout or the angle of a needle
+ * in whole degrees. Only if this state changes, the widget adds its old
+ * and its new bounding box to a \ref DamageList, so only the damaged
+ * rectangles of the frame are rendered and pushed again.
+ *
+ * The widgets have no common base class and no virtual functions, a
+ * page calls the widgets of its layout one by one.
+ *
+ * \author Matthias Werner
+ * \date   October 2026
+ * \version 0.1
+ *
+ *
+ */
+
+#ifndef _DISPLAYWIDGET_H_
+#define _DISPLAYWIDGET_H_
+
+#include <hardwareDef.h>
+#include <Arduino.h>
+#include <displaySignal.h>
+#include <assetTypes.h>
+#include <runFont.h>
+#include <gaugeScale.h>
+#include <bandRenderer.h>
+
+/// Maximum number of separate damaged rectangles of one frame
+#define DAMAGE_LIST_BOXES 8
+
+/*! ******************************************************************
+  @struct tWidgetBox
+  @brief  Structure for a rectangle of the frame
+ */
+typedef struct
+{
+  /// X position of the upper left corner [px]
+  int16_t x;
+  /// Y position of the upper left corner [px]
+  int16_t y;
+  /// Width [px], 0 for an empty rectangle
+  int16_t w;
+  /// Height [px], 0 for an empty rectangle
+  int16_t h;
+} tWidgetBox;
+
+/*! ******************************************************************
+  @brief    Get the union of two rectangles
+  @details  An empty rectangle is ignored.
+  @param    a First rectangle
+  @param    b Second rectangle
+  @return   tWidgetBox smallest rectangle holding both
+ */
+tWidgetBox widgetBoxUnion(const tWidgetBox &a, const tWidgetBox &b);
+
+/*! ******************************************************************
+  @class  DamageList
+  @brief  Class for the damaged rectangles of a frame
+
+  Overlapping rectangles are merged when added, so no part of the
+  frame is rendered twice. If the list is full, the rectangle is
+  merged into the last one.
+ */
+class DamageList
+{
+public:
+  /*! ******************************************************************
+    @brief Constructor
+    @param Width Width of the frame [px], rectangles are clipped to it
+    @param Height Height of the frame [px], rectangles are clipped to it
+   */
+  DamageList(int16_t Width, int16_t Height);
+
+  /// Remove all rectangles
+  void Clear(void);
+
+  /*! ******************************************************************
+    @brief Add a damaged rectangle
+    @param Box Damaged rectangle, nothing happens if it is empty
+   */
+  void Add(const tWidgetBox &Box);
+
+  /// Check if nothing is damaged
+  bool IsEmpty(void) const;
+
+  /*! ******************************************************************
+    @brief Render the damaged rectangles and remove them
+    @param Frame Renderer holding the display list of the whole frame
+   */
+  void Render(BandRenderer &Frame);
+
+private:
+  /// Width of the frame [px]
+  int16_t Width;
+  /// Height of the frame [px]
+  int16_t Height;
+  /// Damaged rectangles
+  tWidgetBox Boxes[DAMAGE_LIST_BOXES];
+  /// Number of damaged rectangles
+  uint8_t Count;
+};
+
+/*! ******************************************************************
+  @struct tNeedleGaugeLayout
+  @brief  Structure for the layout of the needle of a gauge
+ */
+typedef struct
+{
+  /// Scale the needle points at, the needle turns around its centre
+  const tGaugeScale *Scale;
+  /// Image of the needle pointing to 12 o'clock
+  const tPalettedImage *Needle;
+  /// X position of the pivot in the needle image [px]
+  int16_t PivotX;
+  /// Y position of the pivot in the needle image [px]
+  int16_t PivotY;
+  /// Palette index of the needle image which is transparent
+  uint8_t Transparent;
+} tNeedleGaugeLayout;
+
+/*! ******************************************************************
+  @class  NeedleGauge
+  @brief  Class for the needle of a gauge, quantized to whole degrees
+ */
+class NeedleGauge
+{
+public:
+  /*! ******************************************************************
+    @brief Constructor
+    @param Layout Layout of the needle, has to exist as long as the widget
+   */
+  NeedleGauge(const tNeedleGaugeLayout &Layout);
+
+  /*! ******************************************************************
+    @brief Update the needle
+    @param Damage List the old and the new area are added to if changed
+    @param Value Value to point at in the units of the scale
+    @param Shown false to hide the needle
+    @return bool true if the needle changed
+   */
+  bool Update(DamageList &Damage, int32_t Value, bool Shown);
+
+  /// Add the needle to the display list
+  void Draw(BandRenderer &Frame) const;
+
+private:
+  /// Area covered by the needle at an angle
+  tWidgetBox Bounds(int16_t Angle) const;
+
+  /// Layout of the needle
+  const tNeedleGaugeLayout *Layout;
+  /// Shown angle [deg]
+  int16_t Angle;
+  /// Needle is shown
+  bool Shown;
+};
+
+/*! ******************************************************************
+  @struct tArcBarLayout
+  @brief  Structure for the layout of an anti aliased arc bar
+  @details  The angles count clockwise from 6 o'clock as for
+            \ref PaletteCanvas::DrawSmoothArc. The bar grows from the
+            start angle towards the end angle, which may be smaller.
+ */
+typedef struct
+{
+  /// X position of the centre [px]
+  int16_t x;
+  /// Y position of the centre [px]
+  int16_t y;
+  /// Outer radius [px]
+  int16_t r;
+  /// Inner radius [px]
+  int16_t ir;
+  /// Angle of the minimum value [deg]
+  uint16_t StartAngle;
+  /// Angle of the maximum value [deg]
+  uint16_t EndAngle;
+  /// Value at the start angle in display units
+  int32_t MinValue;
+  /// Value at the end angle in display units
+  int32_t MaxValue;
+  /// Values above are shown in the critical ramp
+  int32_t CriticalValue;
+  /// First palette index of the ramp of a valid value
+  uint8_t Ramp;
+  /// First palette index of the ramp of a stale or too low value
+  uint8_t PassivRamp;
+  /// First palette index of the ramp of a critical value
+  uint8_t CriticalRamp;
+  /// Number of entries of the ramps
+  uint8_t Levels;
+} tArcBarLayout;
+
+/*! ******************************************************************
+  @class  ArcBar
+  @brief  Class for an arc bar, quantized to whole degrees
+ */
+class ArcBar
+{
+public:
+  /*! ******************************************************************
+    @brief Constructor
+    @param Layout Layout of the bar, has to exist as long as the widget
+   */
+  ArcBar(const tArcBarLayout &Layout);
+
+  /*! ******************************************************************
+    @brief Update the bar
+    @details A stale value is shown passive, without a value the bar
+             is hidden.
+    @param Damage List the area of the bar is added to if changed
+    @param Value Value to show
+    @return bool true if the bar changed
+   */
+  bool Update(DamageList &Damage, const tSignalValue &Value);
+
+  /// Add the bar to the display list
+  void Draw(BandRenderer &Frame) const;
+
+private:
+  /// Area covered by the whole range of the bar
+  tWidgetBox Bounds(void) const;
+
+  /// Layout of the bar
+  const tArcBarLayout *Layout;
+  /// Shown angle of the end of the bar [deg]
+  uint16_t Angle;
+  /// Shown ramp
+  uint8_t Ramp;
+  /// Bar is shown
+  bool Shown;
+};
+
+/*! ******************************************************************
+  @struct tNumericReadoutLayout
+  @brief  Structure for the layout of a numeric readout
+ */
+typedef struct
+{
+  /// Font of the readout
+  const tRunFont *Font;
+  /// Area of the readout, rendered again on a change, widened to the text
+  tWidgetBox Box;
+  /// X position of the text [px], aligned by Datum
+  int16_t TextX;
+  /// Y position of the text [px], aligned by Datum
+  int16_t TextY;
+  /// Alignment of the text, e.g. MR_DATUM
+  uint8_t Datum;
+  /// Number of decimal places, 0 or 1
+  uint8_t Decimals;
+  /// Text shown without a value, without the suffix
+  const char *Missing;
+  /// Text appended to the value, e.g. the unit
+  const char *Suffix;
+  /// Palette index of a valid value
+  uint8_t Index;
+  /// Palette index of a stale or missing value
+  uint8_t StaleIndex;
+  /// Palette index of a valid value above CriticalValue
+  uint8_t CriticalIndex;
+  /// Values above are shown in CriticalIndex, INT32_MAX for none
+  int32_t CriticalValue;
+} tNumericReadoutLayout;
+
+/*! ******************************************************************
+  @class  NumericReadout
+  @brief  Class for a numeric readout, quantized to its text and colour
+ */
+class NumericReadout
+{
+public:
+  /*! ******************************************************************
+    @brief Constructor
+    @param Layout Layout of the readout, has to exist as long as the widget
+   */
+  NumericReadout(const tNumericReadoutLayout &Layout);
+
+  /*! ******************************************************************
+    @brief Update the readout
+    @details A stale value is shown in StaleIndex, without a value the
+             missing text is shown.
+    @param Damage List the box of the readout is added to if changed
+    @param Value Value to show
+    @return bool true if the readout changed
+   */
+  bool Update(DamageList &Damage, const tSignalValue &Value);
+
+  /// Add the readout to the display list
+  void Draw(BandRenderer &Frame) const;
+
+private:
+  /// Area of the box widened to a text
+  tWidgetBox Bounds(const char *Text) const;
+
+  /// Layout of the readout
+  const tNumericReadoutLayout *Layout;
+  /// Shown text
+  char Text[BAND_RENDERER_TEXT_LENGTH];
+  /// Shown palette index
+  uint8_t Index;
+};
+
+/*! ******************************************************************
+  @struct tLampDefinition
+  @brief  Structure for a warning lamp shown for a group of alarms
+ */
+typedef struct
+{
+  /// Icon of the lamp in the lamp atlas
+  const tLampIcon *Icon;
+  /// Alarms switching the lamp on, see \ref ALARM_BIT
+  uint32_t Alarms;
+  /// First palette index of the ramp of the lamp colour
+  uint8_t Ramp;
+} tLampDefinition;
+
+/*! ******************************************************************
+  @struct tLampLayout
+  @brief  Structure for the layout of warning lamps sharing slots
+ */
+typedef struct
+{
+  /// Lamps, highest priority first, at most 32
+  const tLampDefinition *Lamps;
+  /// Number of lamps
+  uint8_t Count;
+  /// Icon atlas of the lamps
+  const uint8_t *Atlas;
+  /// X position of the first slot [px]
+  int16_t x;
+  /// Y position of the slots [px]
+  int16_t y;
+  /// Number of slots in a row
+  uint8_t Slots;
+  /// Distance of the slots [px]
+  int16_t SlotDistance;
+} tLampLayout;
+
+/*! ******************************************************************
+  @class  Lamp
+  @brief  Class for warning lamps, quantized to the lamps shown
+ */
+class Lamp
+{
+public:
+  /*! ******************************************************************
+    @brief Constructor
+    @param Layout Layout of the lamps, has to exist as long as the widget
+   */
+  Lamp(const tLampLayout &Layout);
+
+  /*! ******************************************************************
+    @brief Update the lamps
+    @details The active lamps fill the slots in the order of the layout.
+    @param Damage List the area of the slots is added to if changed
+    @param Alarms Active alarms, see \ref ALARM_BIT
+    @return bool true if the lamps changed
+   */
+  bool Update(DamageList &Damage, uint32_t Alarms);
+
+  /// Add the lamps to the display list
+  void Draw(BandRenderer &Frame) const;
+
+private:
+  /// Area of all slots
+  tWidgetBox Bounds(void) const;
+
+  /// Layout of the lamps
+  const tLampLayout *Layout;
+  /// Shown lamps, one bit per lamp of the layout
+  uint32_t Shown;
+};
+
+#endif // _DISPLAYWIDGET_H_
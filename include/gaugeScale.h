@@ -0,0 +1,110 @@
+/*!
+ * \file gaugeScale.h
+ * \brief Scale of a round gauge generated from its description
+ *
+ * This file contains the description of the scale of a round gauge, the
+ * range, the ticks, the redline and the labels, see \ref tGaugeScale.
+ * The scale is rendered once at boot over the face of the gauge into a
+ * cached layer, which is copied as the first layer of every frame. So
+ * one firmware shows different ranges without another bitmap and the
+ * needle angle is calculated from the same description.
+ *
+ * \author Matthias Werner
+ * \date   October 2026
+ * \version 0.1
+ *
+ *
+ */
+
+#ifndef _GAUGESCALE_H_
+#define _GAUGESCALE_H_
+
+#include <hardwareDef.h>
+#include <Arduino.h>
+#include <assetTypes.h>
+#include <paletteCanvas.h>
+
+/*! ******************************************************************
+  @struct tGaugeScale
+  @brief  Structure for the description of the scale of a round gauge
+  @details  The angles are needle angles, clockwise from 12 o'clock and
+            may exceed 360 deg. The ticks are drawn at the multiples of
+            the steps inside the range, the ends of the range get no
+            tick. The labels are drawn upright at the major ticks,
+            divided by LabelDivider.
+ */
+typedef struct
+{
+  /// Value at the start of the scale
+  int32_t MinValue;
+  /// Value at the end of the scale
+  int32_t MaxValue;
+  /// Needle angle at the start of the scale [deg]
+  int16_t StartAngle;
+  /// Needle angle at the end of the scale [deg]
+  int16_t EndAngle;
+  /// Distance of the minor ticks
+  int32_t MinorStep;
+  /// Distance of the major ticks with a label
+  int32_t MajorStep;
+  /// Start of the redline up to the end of the scale, MaxValue for none
+  int32_t RedlineValue;
+  /// Divider of the values shown as labels
+  int32_t LabelDivider;
+  /// X position of the centre [px]
+  int16_t CenterX;
+  /// Y position of the centre [px]
+  int16_t CenterY;
+  /// Inner radius of the minor ticks [px]
+  uint8_t MinorInner;
+  /// Outer radius of the minor ticks [px]
+  uint8_t MinorOuter;
+  /// Width of the minor ticks [px]
+  uint8_t MinorWidth;
+  /// Inner radius of the major ticks [px]
+  uint8_t MajorInner;
+  /// Outer radius of the major ticks [px]
+  uint8_t MajorOuter;
+  /// Width of the major ticks [px]
+  uint8_t MajorWidth;
+  /// Inner radius of the redline [px]
+  uint8_t RedlineInner;
+  /// Outer radius of the redline [px]
+  uint8_t RedlineOuter;
+  /// Radius of the centre of the labels [px]
+  uint8_t LabelRadius;
+  /// Font of the labels
+  const tRunFont *LabelFont;
+  /// Palette index of the labels
+  uint8_t LabelIndex;
+  /// First palette index of the ramp of the minor ticks
+  uint8_t MinorRamp;
+  /// First palette index of the ramp of the major ticks
+  uint8_t MajorRamp;
+  /// First palette index of the ramp of the redline
+  uint8_t RedlineRamp;
+  /// Number of entries of the ramps
+  uint8_t Levels;
+} tGaugeScale;
+
+/*! ******************************************************************
+  @brief    Get the needle angle of a value
+  @details  Values outside of the range are limited to the range.
+  @param    Scale Description of the scale
+  @param    Value Value to point at
+  @return   int16_t needle angle 0..359 [deg], clockwise from 12 o'clock
+ */
+int16_t gaugeScaleAngle(const tGaugeScale &Scale, int32_t Value);
+
+/*! ******************************************************************
+  @brief    Render the scale over the face into a layer
+  @details  The face is copied into the layer first, then the redline,
+            the ticks and the labels are drawn. The layer has to be a
+            canvas of the size of the face holding all of its lines.
+  @param    Layer Canvas the scale is rendered into
+  @param    Face Face of the gauge without the scale
+  @param    Scale Description of the scale
+ */
+void gaugeScaleRender(PaletteCanvas &Layer, const tPalettedImage &Face, const tGaugeScale &Scale);
+
+#endif // _GAUGESCALE_H_
@@ -35,12 +35,117 @@
 /// Define if N2k Message Statistics should be printed true/false
 #define DEBUG_N2K_MSG_STATISTICS true
 
+/// Define if task runtime statistics should be printed true/false
+#define DEBUG_TASK_STATISTICS true
+
+/// Define ticks of the FreeRTOS run time counter per microsecond, 1 for the esp_timer as source
+#define TASK_RUN_TIME_COUNTER_PER_US 1
+
+/// Define if latency statistics should be printed true/false
+#define DEBUG_LATENCY_STATISTICS true
+
+// --------> Task Configuration <-------------------
+/// Define period [ms] of the task updating the NMEA2000 messages
+#define TASK_UPDATE_N2K_PERIOD 50
+/// Define period [ms] of the task updating the display
+#define TASK_UPDATE_DISPLAY_PERIOD 100
+/// Define period [ms] of the task setting the display brightness
+#define TASK_SET_DISPLAY_BRIGHTNESS_PERIOD 250
+/// Define period [ms] of the task showing the statistics
+#define TASK_SHOW_N2K_STATISTICS_PERIOD 2000
+
+/// Define target budget [ms] from CAN frame arrival till pixels on screen
+#define LATENCY_BUDGET_MS 150
+/// Define target budget [ms] from raising an alarm till pixels on screen
+#define ALARM_LATENCY_BUDGET_MS 50
+
 // --------> Config N2K Message Engine ID  <--------------
 /// Define Engine Instance to be displayed
 #define DISPLAY_ENGINE_INSTANCE 0
 
+/// Number of tracked engine instances, instance 0 .. N-1
+#define N2K_MAX_ENGINE_INSTANCES 2
+/// Define if a second engine should be shown with its own needle true/false
+#define DISPLAY_TWIN_ENGINE false
+/// Define Engine Instance shown with the second needle
+#define DISPLAY_SECOND_ENGINE_INSTANCE 1
+
 /// Define Time out [ms] for Engine Rapid Message
 #define N2K_MSG_ENGINE_RAPID_TIMEOUT 10000
+/// Define Time out [ms] for the signals of the Engine Dynamic Message
+#define N2K_MSG_ENGINE_DYNAMIC_TIMEOUT 5000
+
+/// Define policy to select one of several senders of the same engine data
+/// 0 = preferred source, 1 = most recent source, 2 = highest message rate
+#define N2K_ARBITER_POLICY 1
+/// Define preferred source address for policy 0
+#define N2K_ARBITER_PREFERRED_SOURCE 0
+/// Maximum number of tracked senders per message and engine instance
+#define N2K_ARBITER_MAX_SOURCES 4
+/// Define nominal interval [ms] of the Engine Rapid Message
+#define N2K_ARBITER_ENGINE_RAPID_INTERVAL 100
+/// Define nominal interval [ms] of the Engine Dynamic Message, slowest rate
+#define N2K_ARBITER_ENGINE_DYNAMIC_INTERVAL 1000
+/// Define number of missed nominal intervals after which a sender is switched over
+#define N2K_ARBITER_TIMEOUT_INTERVALS 3
+/// Define interval [ms] for the message rate of the senders
+#define N2K_ARBITER_RATE_INTERVAL 2000
+
+/// Define if the N2K decoders should be benchmarked at startup true/false
+#define N2K_DECODE_BENCHMARK false
+
+/// Define the filters of the signals {type, parameter 1, parameter 2}
+/// see tSignalFilterType, SIGNAL_FILTER_NONE to show the raw values
+/// Engine speed: alpha-beta tracker, alpha 0.375 beta 0.0625
+#define FILTER_ENGINE_SPEED {SIGNAL_FILTER_ALPHA_BETA, 96, 16}
+/// Coolant temperature: moving average with weight 1/8
+#define FILTER_COOLANT_TEMPERATURE {SIGNAL_FILTER_EWMA, 3, 0}
+/// Alternator voltage: median of 5 samples
+#define FILTER_ALTERNATOR_VOLTAGE {SIGNAL_FILTER_MEDIAN, 5, 0}
+
+/// Define if the signal filters should be benchmarked at startup true/false
+#define SIGNAL_FILTER_BENCHMARK false
+
+/// Define if the image decoder should be benchmarked at startup true/false
+#define IMAGE_CODEC_BENCHMARK false
+
+/// Define if the run length fonts should be benchmarked at startup true/false
+#define FONT_BENCHMARK false
+
+// --------> Engine Alarms <-----------------------
+/// Define coolant temperature [C] raising the high temperature alarm
+#define ALARM_COOLANT_HIGH 95
+/// Define hysteresis [C] of the coolant temperature alarm
+#define ALARM_COOLANT_HYSTERESIS 3
+/// Define oil pressure [kPa] raising the low oil pressure alarm
+#define ALARM_OIL_PRESSURE_LOW 100
+/// Define hysteresis [kPa] of the oil pressure alarm
+#define ALARM_OIL_PRESSURE_HYSTERESIS 20
+/// Define alternator voltage [0.1 V] raising the low voltage alarm
+#define ALARM_VOLTAGE_LOW 125
+/// Define alternator voltage [0.1 V] raising the high voltage alarm
+#define ALARM_VOLTAGE_HIGH 150
+/// Define hysteresis [0.1 V] of the voltage alarms
+#define ALARM_VOLTAGE_HYSTERESIS 3
+/// Define delay [ms] a threshold has to be exceeded till the alarm is raised
+#define ALARM_THRESHOLD_DELAY 2000
+/// Define delay [ms] a status bit has to be set till the alarm is raised
+#define ALARM_STATUS_DELAY 0
+/// Define engine speed [rpm] above which the engine is running
+#define ALARM_ENGINE_RUNNING_RPM 400
+
+
+// --------> Engine Speed Gauge <-------------------
+/// Define engine speed [rpm] at the end of the scale
+#define GAUGE_RPM_MAX 4000
+/// Define distance [rpm] of the minor ticks
+#define GAUGE_RPM_MINOR_STEP 250
+/// Define distance [rpm] of the major ticks with a label
+#define GAUGE_RPM_MAJOR_STEP 1000
+/// Define engine speed [rpm] at the start of the redline
+#define GAUGE_RPM_REDLINE 2800
+/// Define divider of the labels, matching the "X 1000" of the face
+#define GAUGE_RPM_LABEL_DIVIDER 1000
 
 
 // --------> Display Brightness<---------------------
@@ -65,6 +170,9 @@
 /// Define Brightness Output Value for Night
 #define BRIGHTNESS_OUTPUT_NIGHT 20
 
+/// Enable the red night colours of the display with the night brightness
+#define DISPLAY_NIGHT_MODE true
+
 
 
 // --------> NMEA2000 <---------------------
@@ -73,5 +181,27 @@
 /// GPIO where the CAN-RX is connected
 #define ESP32_CAN_RX_PIN (gpio_num_t)5
 
+/// Length of the receive queue of the TWAI driver [frames]
+#define N2K_CAN_RX_QUEUE_LEN 32
+/// Define if the receive queue should grow with the observed load true/false
+#define N2K_CAN_RX_QUEUE_ADAPTIVE true
+/// Maximum length of the receive queue if adaptive [frames]
+#define N2K_CAN_RX_QUEUE_MAX_LEN 128
+/// Reporting interval [ms] of the receive statistics
+#define N2K_CAN_RX_STATISTICS_INTERVAL 2000
+/// Length of the transmit queue of the TWAI driver [frames]
+#define N2K_CAN_TX_QUEUE_LEN 10
+
+/// Number of slots for the fast-packet reassembly
+#define N2K_FAST_PACKET_SLOTS 4
+/// Define Time out [ms] for an incomplete fast-packet message
+#define N2K_FAST_PACKET_TIMEOUT 250
+
+/// Source address to accept N2K messages from, -1 for any source
+#define N2K_ACCEPTED_SOURCE_ADDRESS -1
+
+/// Define if Engine Rapid of the displayed engine should be decoded in the CAN driver true/false
+#define N2K_ENGINE_RAPID_FAST_PATH true
+
 
 #endif // _HARDWAREDEF_H_
\ No newline at end of file
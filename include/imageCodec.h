@@ -0,0 +1,80 @@
+/*!
+ * \file imageCodec.h
+ * \brief Lossless codec for the RGB565 images
+ *
+ * This file contains the decoder of the compressed images. The images
+ * are encoded at build time by scripts/rgb565Codec.py, called by the
+ * asset compiler scripts/assetCompiler.py, with runs, a table of
+ * recently seen pixels and small colour differences, which suits the
+ * large flat areas of the scales well.
+ *
+ * An image is split into strips of @ref IMAGE_STRIP_LINES lines and
+ * every strip starts with a fresh decoder state. So the images are
+ * decoded strip by strip into a small buffer and pushed on to a
+ * sprite or the display, no full frame buffer is needed, and a single
+ * strip can be decoded to restore a part of the image.
+ *
+ * \author Matthias Werner
+ * \date   October 2026
+ * \version 0.1
+ *
+ *
+ */
+
+#ifndef _IMAGECODEC_H_
+#define _IMAGECODEC_H_
+
+#include <hardwareDef.h>
+#include <Arduino.h>
+
+/// Number of lines of a strip, has to match the encoder
+#define IMAGE_STRIP_LINES 16
+
+/*! ******************************************************************
+  @struct tCompressedImage
+  @brief  Structure for a compressed image in flash
+ */
+typedef struct
+{
+  /// Encoded stream of all strips
+  const uint8_t *Data;
+  /// Offset of every strip in the stream
+  const uint32_t *Strips;
+  /// Size of the stream [bytes]
+  uint32_t Size;
+  /// Width of the image [px]
+  uint16_t Width;
+  /// Height of the image [px]
+  uint16_t Height;
+} tCompressedImage;
+
+/*! ******************************************************************
+  @brief    Get the number of strips of an image
+  @param    Image Compressed image
+  @return   uint16_t number of strips
+ */
+uint16_t imageStripCount(const tCompressedImage &Image);
+
+/*! ******************************************************************
+  @brief    Decode one strip of an image
+  @details  The strip is decoded line by line into the buffer, the
+            buffer has to hold Width * @ref IMAGE_STRIP_LINES pixels.
+  @param    Image Compressed image
+  @param    Strip Number of the strip
+  @param    Pixels Buffer for the RGB565 pixels
+  @return   uint16_t number of decoded lines, 0 if the strip does not
+            exist or the stream is corrupt
+ */
+uint16_t imageDecodeStrip(const tCompressedImage &Image, uint16_t Strip, uint16_t *Pixels);
+
+/*! ******************************************************************
+  @brief    Benchmark the decoder
+  @details  This function will decode the image and copy the same
+            number of bytes from flash with memcpy and print the time
+            for a full image via Serial. Only compiled in if
+            @ref IMAGE_CODEC_BENCHMARK is enabled.
+  @param    Image Compressed image
+ */
+void benchmarkImageCodec(const tCompressedImage &Image);
+
+#endif // _IMAGECODEC_H_
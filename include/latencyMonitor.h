@@ -0,0 +1,162 @@
+/*!
+ * \file latencyMonitor.h
+ * \brief End-to-end latency from CAN frame to pixels on screen
+ *
+ * This file contains the latency histograms for the path of an engine
+ * speed value from the arrival of the Engine Rapid message via
+ * the signal registry and \ref updateDisplay till the sprite is pushed to
+ * the display. Every Engine Rapid message for the displayed engine
+ * gets a frame ID, the display task records the latency the first time
+ * a frame ID is shown on screen.
+ *
+ * \author Matthias Werner
+ * \date   October 2026
+ * \version 0.1
+ *
+ *
+ */
+
+#ifndef _LATENCYMONITOR_H_
+#define _LATENCYMONITOR_H_
+
+#include <hardwareDef.h>
+#include <sysClock.h>
+
+/// Number of buckets of the latency histogram
+#define LATENCY_HISTOGRAM_BUCKETS 20
+
+/// Width of one bucket of the latency histogram [ms]
+#define LATENCY_HISTOGRAM_BUCKET_WIDTH 10
+
+/*! ******************************************************************
+  @class  LatencyHistogram
+  @brief  Class for a latency histogram
+
+  This class records latency samples in fixed buckets of
+  @ref LATENCY_HISTOGRAM_BUCKET_WIDTH ms. The last bucket collects all
+  samples above the range. Samples above the budget are counted
+  separately.
+ */
+class LatencyHistogram
+{
+public:
+  /*! ******************************************************************
+    @brief Constructor
+    @param Name Name of the histogram for the Serial output
+    @param BudgetMs Target budget of the latency [ms]
+   */
+  LatencyHistogram(const char *Name, uint32_t BudgetMs);
+
+  /*! ******************************************************************
+    @brief Add a latency sample
+    @param Latency Latency [us]
+   */
+  void AddSample(uint64_t Latency);
+
+  /*! ******************************************************************
+    @brief Clear all samples
+   */
+  void Reset(void);
+
+  /*! ******************************************************************
+    @brief Get the number of samples
+    @return uint32_t number of samples
+   */
+  uint32_t GetCount(void);
+
+  /*! ******************************************************************
+    @brief Get the number of samples above the budget
+    @return uint32_t number of samples above the budget
+   */
+  uint32_t GetOverBudgetCnt(void);
+
+  /*! ******************************************************************
+    @brief Get the maximum latency
+    @return uint32_t maximum latency [us]
+   */
+  uint32_t GetMax(void);
+
+  /*! ******************************************************************
+    @brief Get a percentile of the latency
+    @details The percentile is estimated from the upper limit of the
+             bucket in which the percentile falls.
+    @param Percent Percentile 0..100
+    @return uint32_t latency [ms]
+   */
+  uint32_t GetPercentile(uint8_t Percent);
+
+  /*! ******************************************************************
+    @brief Show the histogram via Serial
+    @details The caller has to hold the Serial output mutex.
+   */
+  void Show(void);
+
+private:
+  /// Name of the histogram
+  const char *Name;
+  /// Target budget [ms]
+  uint32_t BudgetMs;
+  /// Number of samples per bucket
+  uint32_t Buckets[LATENCY_HISTOGRAM_BUCKETS];
+  /// Number of samples
+  uint32_t Count;
+  /// Number of samples above the budget
+  uint32_t OverBudgetCnt;
+  /// Sum of all samples [us]
+  uint64_t Sum;
+  /// Minimum latency [us]
+  uint32_t Min;
+  /// Maximum latency [us]
+  uint32_t Max;
+};
+
+/// Latency from the arrival of the message till the display task starts
+extern LatencyHistogram DisplayWaitLatency;
+
+/// Latency from the arrival of the message till the frame is on screen
+extern LatencyHistogram EndToEndLatency;
+
+/// Latency from raising an alarm till it is on screen
+extern LatencyHistogram AlarmLatency;
+
+/*! ******************************************************************
+  @brief    Stamp a newly arrived frame
+  @details  This function will assign the next frame ID to an arrived
+            Engine Rapid message and remember its arrival time.
+  @param    arrivalTime Arrival time of the message [us]
+ */
+void latencyFrameArrived(uint64_t arrivalTime);
+
+/*! ******************************************************************
+  @brief    Stamp a raised alarm
+  @details  This function will remember the time of the first alarm
+            raised since the last display update.
+  @param    raiseTime Time the alarm was raised [us]
+ */
+void latencyAlarmRaised(uint64_t raiseTime);
+
+/*! ******************************************************************
+  @brief    Mark the start of a display update
+  @details  This function will take the latest frame stamp for the
+            display update which is about to start.
+ */
+void latencyRenderStart(void);
+
+/*! ******************************************************************
+  @brief    Mark the end of a display update
+  @details  This function has to be called after the frame was pushed
+            to the display. The latency is only recorded the first time
+            a frame ID or a raised alarm reaches the screen, and only if
+            the update pushed the widgets showing it. A frame or an
+            alarm which changed no pixels is dropped without a sample.
+  @param    framePushed true if the engine speed widgets were pushed
+  @param    alarmPushed true if the warning lamps were pushed
+ */
+void latencyRenderDone(bool framePushed, bool alarmPushed);
+
+/*! ******************************************************************
+  @brief    Show the latency statistics via Serial
+ */
+void showLatencyStatistics(void);
+
+#endif // _LATENCYMONITOR_H_
@@ -0,0 +1,424 @@
+/*!
+ * \file n2kCanDriver.h
+ * \brief NMEA2000 CAN driver for the ESP32-S3 TWAI controller
+ *
+ * This file contains the CAN driver for the NMEA2000 library based on
+ * the ESP-IDF TWAI driver. In contrast to the generic driver it only
+ * lets the subscribed PGNs pass. The acceptance filter of the TWAI
+ * controller is programmed from the subscribed PGN set, everything
+ * the hardware filter cannot express is rejected by a software filter
+ * before the frame reaches the library.
+ *
+ * \author Matthias Werner
+ * \date   October 2026
+ * \version 0.1
+ *
+ *
+ */
+
+#ifndef _N2KCANDRIVER_H_
+#define _N2KCANDRIVER_H_
+
+#include <hardwareDef.h>
+
+#include <NMEA2000.h>
+#include <driver/twai.h>
+
+/// Maximum number of subscribed PGNs
+#define N2K_CAN_MAX_SUBSCRIBED_PGNS 8
+
+/// Maximum length of a fast-packet message [bytes]
+#define N2K_FAST_PACKET_MAX_LEN 223
+
+/// Number of frames in the staging buffer for priority ordering
+#define N2K_CAN_STAGING_LEN 32
+
+/// Accept messages from any source address
+#define N2K_CAN_ANY_SOURCE -1
+
+/*! ******************************************************************
+  @struct tN2kCanFilter
+  @brief  Structure for the acceptance filter of the TWAI controller
+ */
+typedef struct
+{
+  /// Acceptance code register value
+  uint32_t AcceptanceCode;
+  /// Acceptance mask register value, a set bit means "don't care"
+  uint32_t AcceptanceMask;
+  /// true for single filter mode, false for dual filter mode
+  bool SingleFilter;
+  /// Number of PGNs the filter lets pass
+  uint32_t AcceptedPGNs;
+} tN2kCanFilter;
+
+/*! ******************************************************************
+  @struct tN2kCanFrame
+  @brief  Structure for a received frame waiting in the staging buffer
+ */
+typedef struct
+{
+  /// 29-bit CAN identifier
+  unsigned long Id;
+  /// Receive sequence number, used to keep the order within a priority
+  uint32_t Sequence;
+  /// Length of the frame [bytes]
+  unsigned char Len;
+  /// Data of the frame
+  unsigned char Data[8];
+} tN2kCanFrame;
+
+/*! ******************************************************************
+  @struct tN2kCanRxStatistics
+  @brief  Structure for the receive statistics of one reporting interval
+ */
+typedef struct
+{
+  /// Length of the receive queue [frames]
+  uint32_t QueueLen;
+  /// Number of frames received from the controller
+  uint32_t FrameCnt;
+  /// Maximum number of frames waiting in the receive queue
+  uint32_t MaxQueueDepth;
+  /// Number of frames lost because the receive queue was full
+  uint32_t QueueFullCnt;
+  /// Number of frames lost because the controller FIFO overran
+  uint32_t OverrunCnt;
+  /// Number of frames estimated lost while the driver was installed again
+  uint32_t ReinstallCnt;
+} tN2kCanRxStatistics;
+
+/*! ******************************************************************
+  @struct tN2kFastPacketSlot
+  @brief  Structure for one fast-packet reassembly slot
+ */
+typedef struct
+{
+  /// true if a message is being reassembled in this slot
+  bool InUse;
+  /// Source address of the message
+  uint8_t Source;
+  /// Priority of the message
+  uint8_t Priority;
+  /// Sequence ID of the message (bit 7-5 of the frame counter byte)
+  uint8_t SequenceId;
+  /// Frame counter expected next
+  uint8_t NextFrame;
+  /// PGN of the message
+  unsigned long PGN;
+  /// Total length of the message [bytes]
+  uint8_t Length;
+  /// Received length of the message [bytes]
+  uint8_t Received;
+  /// Time the first frame was received [us]
+  uint64_t StartTime;
+  /// Payload of the message
+  unsigned char Data[N2K_FAST_PACKET_MAX_LEN];
+} tN2kFastPacketSlot;
+
+/*! ******************************************************************
+  @class  N2kFastPacketPool
+  @brief  Class for the fast-packet reassembly
+
+  This class reassembles NMEA2000 fast-packet messages in a fixed
+  pool of @ref N2K_FAST_PACKET_SLOTS slots, so the memory use is
+  strictly bounded. A slot is keyed by source address, PGN and
+  sequence ID, so interleaved messages of several engines or senders
+  are reassembled independently. If the pool is full the oldest slot
+  is evicted, slots older than @ref N2K_FAST_PACKET_TIMEOUT are
+  dropped as incomplete.
+ */
+class N2kFastPacketPool
+{
+public:
+  /// Constructor
+  N2kFastPacketPool();
+
+  /*! ******************************************************************
+    @brief Add a frame of a fast-packet message
+    @param id 29-bit CAN identifier
+    @param len Length of the frame [bytes]
+    @param buf Data of the frame
+    @param now Receive time of the frame [us]
+    @param N2kMsg Reassembled message, only valid if true is returned
+    @return bool true if the message is complete
+   */
+  bool AddFrame(unsigned long id, unsigned char len, const unsigned char *buf, uint64_t now, tN2kMsg &N2kMsg);
+
+  /*! ******************************************************************
+    @brief Drop all slots older than @ref N2K_FAST_PACKET_TIMEOUT
+    @param now Current time [us]
+   */
+  void ExpireSlots(uint64_t now);
+
+  /// Get the number of reassembled messages
+  uint32_t GetCompletedCnt(void);
+  /// Get the number of messages dropped incomplete
+  uint32_t GetIncompleteCnt(void);
+  /// Get the number of messages evicted because the pool was full
+  uint32_t GetEvictedCnt(void);
+  /// Get the number of frames received out of order
+  uint32_t GetOutOfOrderCnt(void);
+
+private:
+  /// Find the slot of a running message
+  tN2kFastPacketSlot *FindSlot(uint8_t Source, unsigned long PGN, uint8_t SequenceId);
+  /// Allocate a slot, evict the oldest if the pool is full
+  tN2kFastPacketSlot *AllocSlot(void);
+
+  /// Reassembly slots
+  tN2kFastPacketSlot Slots[N2K_FAST_PACKET_SLOTS];
+  /// Number of reassembled messages
+  uint32_t CompletedCnt;
+  /// Number of messages dropped incomplete
+  uint32_t IncompleteCnt;
+  /// Number of messages evicted because the pool was full
+  uint32_t EvictedCnt;
+  /// Number of frames received out of order
+  uint32_t OutOfOrderCnt;
+};
+
+/*! ******************************************************************
+  @class  tNMEA2000_twai
+  @brief  Class for the NMEA2000 CAN driver using the TWAI controller
+
+  This class implements the CAN interface of the NMEA2000 library
+  with the ESP-IDF TWAI driver and filters the incoming frames by the
+  subscribed PGNs and optionally by the source address. Subscribed
+  fast-packet messages are reassembled in a \ref N2kFastPacketPool and
+  handed to the fast-packet handler directly, they do not pass the
+  reassembly buffers of the library.
+
+  Received single frames are collected in a staging buffer and handed
+  to the library ordered by their 3-bit N2K priority, so Engine Rapid
+  (priority 2) is served before a backlog of low priority traffic. For
+  the single frame PGNs with an instance byte, e.g. Engine Rapid, a
+  frame of the same PGN, source and instance replaces an older one
+  still waiting, so only the newest value is decoded.
+
+  One PGN can be handed to an early frame handler as soon as the frame
+  leaves the receive queue. If the handler consumes the frame it does
+  not pass the staging buffer, the library and its message handlers.
+ */
+class tNMEA2000_twai : public tNMEA2000
+{
+public:
+  /*! ******************************************************************
+    @brief Constructor
+    @param TxPin GPIO of the CAN-TX signal
+    @param RxPin GPIO of the CAN-RX signal
+   */
+  tNMEA2000_twai(gpio_num_t TxPin, gpio_num_t RxPin);
+
+  /*! ******************************************************************
+    @brief Subscribe a PGN
+    @details All subscribed PGNs pass the acceptance filter. Has to be
+             called before Open().
+    @param PGN PGN to subscribe
+    @param FastPacket true if the PGN is a fast-packet message
+    @return bool true if subscribed, false if the list is full
+   */
+  bool SubscribePGN(unsigned long PGN, bool FastPacket = false);
+
+  /*! ******************************************************************
+    @brief Set the handler for reassembled fast-packet messages
+    @param Handler Handler function for the message
+   */
+  void SetFastPacketHandler(void (*Handler)(const tN2kMsg &N2kMsg));
+
+  /*! ******************************************************************
+    @brief Set the early frame handler for one single-frame PGN
+    @details The handler is called for each subscribed frame of the PGN
+             while the receive queue is drained. If it returns true the
+             frame is consumed, otherwise it takes the normal way.
+    @param PGN PGN to hand to the handler
+    @param Handler Handler function for the frame
+   */
+  void SetEarlyFrameHandler(unsigned long PGN, bool (*Handler)(unsigned long id, unsigned char len, const unsigned char *buf, uint64_t now));
+
+  /*! ******************************************************************
+    @brief Wait for received frames
+    @details Blocks until the TWAI driver reports received data or the
+             timeout elapses. Without an installed driver it returns at
+             once.
+    @param TimeoutMs Maximum time to wait [ms]
+    @return bool true if frames were received, false on timeout or error
+   */
+  bool WaitRxData(uint32_t TimeoutMs);
+
+  /*! ******************************************************************
+    @brief Get the fast-packet reassembly pool
+    @return N2kFastPacketPool& reassembly pool
+   */
+  N2kFastPacketPool &GetFastPacketPool(void);
+
+  /*! ******************************************************************
+    @brief Set the length of the receive queue
+    @details Has to be called before Open(). If
+             @ref N2K_CAN_RX_QUEUE_ADAPTIVE is enabled the queue grows
+             up to @ref N2K_CAN_RX_QUEUE_MAX_LEN when the high-water
+             mark of a reporting interval comes close to the length or
+             frames are lost. The controller does not receive while the
+             driver is installed again, the frames expected at the rate
+             of the last reporting interval are counted as lost.
+    @param Len Length of the receive queue [frames]
+   */
+  void SetRxQueueLen(uint32_t Len);
+
+  /*! ******************************************************************
+    @brief Get the receive statistics of the last reporting interval
+    @details A reporting interval lasts @ref N2K_CAN_RX_STATISTICS_INTERVAL.
+    @return const tN2kCanRxStatistics& receive statistics
+   */
+  const tN2kCanRxStatistics &GetRxStatistics(void);
+
+  /*! ******************************************************************
+    @brief Get the number of frames replaced by a newer one
+    @return uint32_t number of coalesced frames
+   */
+  uint32_t GetRxCoalescedCnt(void);
+
+  /*! ******************************************************************
+    @brief Get the number of frames consumed by the early frame handler
+    @return uint32_t number of frames
+   */
+  uint32_t GetRxEarlyCnt(void);
+
+  /*! ******************************************************************
+    @brief Get the number of frames lost since start
+    @return uint32_t number of lost frames, queue full and overruns
+   */
+  uint32_t GetRxLostCnt(void);
+
+  /*! ******************************************************************
+    @brief Set the accepted source address
+    @details Has to be called before Open().
+    @param Source Source address or @ref N2K_CAN_ANY_SOURCE
+   */
+  void SetAcceptedSource(int16_t Source);
+
+  /*! ******************************************************************
+    @brief Get the programmed acceptance filter
+    @return const tN2kCanFilter& acceptance filter
+   */
+  const tN2kCanFilter &GetFilter(void);
+
+  /*! ******************************************************************
+    @brief Get the number of frames received from the controller
+    @return uint32_t number of frames
+   */
+  uint32_t GetRxFrameCnt(void);
+
+  /*! ******************************************************************
+    @brief Get the number of frames rejected by the software filter
+    @return uint32_t number of frames
+   */
+  uint32_t GetRxRejectedCnt(void);
+
+  /*! ******************************************************************
+    @brief Check if a frame passes the software filter
+    @param id 29-bit CAN identifier
+    @return bool true if the frame is subscribed
+   */
+  bool IsSubscribed(unsigned long id);
+
+  /*! ******************************************************************
+    @brief Get the PGN of a CAN identifier
+    @param id 29-bit CAN identifier
+    @return unsigned long PGN
+   */
+  static unsigned long GetPGN(unsigned long id);
+
+protected:
+  /// Send a frame via the TWAI driver
+  bool CANSendFrame(unsigned long id, unsigned char len, const unsigned char *buf, bool wait_sent = true) override;
+  /// Install and start the TWAI driver
+  bool CANOpen() override;
+  /// Get the next subscribed frame from the TWAI driver
+  bool CANGetFrame(unsigned long &id, unsigned char &len, unsigned char *buf) override;
+
+  /// Calculate the acceptance filter from the subscribed PGNs
+  void CalcFilter(void);
+
+  /// Check if a subscribed PGN is a fast-packet message
+  bool IsFastPacket(unsigned long PGN);
+
+  /// Install and start the TWAI driver with the current settings
+  bool InstallDriver(void);
+
+  /// Update the receive statistics and decide on a longer receive queue
+  void UpdateRxStatistics(uint64_t now);
+
+  /// Install the driver with the longer receive queue once it is empty
+  void GrowRxQueue(void);
+
+  /// Drain the TWAI receive queue into the staging buffer
+  void DrainRxQueue(uint64_t now);
+
+  /// Stage a received frame, coalesce it with an older one of the same signal
+  void StageFrame(const twai_message_t &message);
+
+private:
+  /// GPIO of the CAN-TX signal
+  gpio_num_t TxPin;
+  /// GPIO of the CAN-RX signal
+  gpio_num_t RxPin;
+  /// Subscribed PGNs
+  unsigned long SubscribedPGNs[N2K_CAN_MAX_SUBSCRIBED_PGNS];
+  /// Fast-packet flag of the subscribed PGNs
+  bool SubscribedFastPacket[N2K_CAN_MAX_SUBSCRIBED_PGNS];
+  /// Number of subscribed PGNs
+  uint8_t SubscribedPGNCnt;
+  /// Reassembly pool for the subscribed fast-packet messages
+  N2kFastPacketPool FastPacketPool;
+  /// Handler for reassembled fast-packet messages
+  void (*FastPacketHandler)(const tN2kMsg &N2kMsg);
+  /// Reassembled fast-packet message
+  tN2kMsg FastPacketMsg;
+  /// PGN handed to the early frame handler
+  unsigned long EarlyPGN;
+  /// Handler for frames decoded while the receive queue is drained
+  bool (*EarlyFrameHandler)(unsigned long id, unsigned char len, const unsigned char *buf, uint64_t now);
+  /// Number of frames consumed by the early frame handler
+  uint32_t RxEarlyCnt;
+  /// Accepted source address or N2K_CAN_ANY_SOURCE
+  int16_t AcceptedSource;
+  /// Programmed acceptance filter
+  tN2kCanFilter Filter;
+  /// Number of frames received from the controller
+  uint32_t RxFrameCnt;
+  /// Number of frames rejected by the software filter
+  uint32_t RxRejectedCnt;
+  /// Number of frames lost since start
+  uint32_t RxLostCnt;
+  /// Number of frames replaced by a newer frame of the same signal
+  uint32_t RxCoalescedCnt;
+  /// Staging buffer for the received frames
+  tN2kCanFrame StagedFrames[N2K_CAN_STAGING_LEN];
+  /// Number of frames in the staging buffer
+  uint8_t StagedFrameCnt;
+  /// Receive sequence number of the next staged frame
+  uint32_t StageSequence;
+  /// Length of the receive queue [frames]
+  uint32_t RxQueueLen;
+  /// Length the receive queue grows to when it is empty, 0 for none
+  uint32_t RxQueueGrowLen;
+  /// Receive statistics of the running reporting interval
+  tN2kCanRxStatistics RxStatistics;
+  /// Receive statistics of the last reporting interval
+  tN2kCanRxStatistics RxStatisticsLast;
+  /// Start of the running reporting interval [us]
+  uint64_t RxStatisticsStart;
+  /// Last queue full counter of the TWAI driver
+  uint32_t LastMissedCount;
+  /// Last overrun counter of the TWAI driver
+  uint32_t LastOverrunCount;
+};
+
+/// CAN driver object used by the NMEA2000 library
+extern tNMEA2000_twai N2kCanDriver;
+
+/// NMEA2000 library object
+extern tNMEA2000 &NMEA2000;
+
+#endif // _N2KCANDRIVER_H_
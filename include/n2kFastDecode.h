@@ -0,0 +1,135 @@
+/*!
+ * \file n2kFastDecode.h
+ * \brief Specialized decoders for the displayed NMEA2000 messages
+ *
+ * This file contains decoders which extract only the fields used for
+ * the display straight from the payload bytes. In contrast to the
+ * ParseN2k* functions of the NMEA2000 library no field is converted to
+ * double, the values stay in the raw integer resolution of the PGN and
+ * are handed on as \ref tSignalValue till display time.
+ * The library parsers are still used for the debug output.
+ *
+ * \author Matthias Werner
+ * \date   October 2026
+ * \version 0.1
+ *
+ *
+ */
+
+#ifndef _N2KFASTDECODE_H_
+#define _N2KFASTDECODE_H_
+
+#include <hardwareDef.h>
+
+#include <N2kMessages.h>
+
+/*! ******************************************************************
+  @struct tN2kFastEngineRapid
+  @brief  Displayed fields of PGN 127488 Engine Rapid
+ */
+typedef struct
+{
+  /// Engine instance
+  uint8_t EngineInstance;
+  /// Engine speed [0.25 rpm], N2kUInt16NA if not available
+  uint16_t EngineSpeed;
+} tN2kFastEngineRapid;
+
+/*! ******************************************************************
+  @struct tN2kFastEngineDynamic
+  @brief  Displayed fields of PGN 127489 Engine Dynamic Parameters
+ */
+typedef struct
+{
+  /// Engine instance
+  uint8_t EngineInstance;
+  /// Oil pressure [100 Pa], N2kUInt16NA if not available
+  uint16_t OilPressure;
+  /// Coolant temperature [0.01 K], N2kUInt16NA if not available
+  uint16_t CoolantTemperature;
+  /// Alternator voltage [0.01 V], N2kInt16NA if not available
+  int16_t AlternatorVoltage;
+  /// Engine hours [s], N2kUInt32NA if not available
+  uint32_t EngineHours;
+  /// Engine discrete status 1
+  tN2kEngineDiscreteStatus1 Status1;
+  /// Engine discrete status 2
+  tN2kEngineDiscreteStatus2 Status2;
+} tN2kFastEngineDynamic;
+
+/*! ******************************************************************
+  @struct tN2kFastTransmission
+  @brief  Used fields of PGN 127493 Transmission Parameters
+ */
+typedef struct
+{
+  /// Engine instance
+  uint8_t EngineInstance;
+  /// Transmission gear
+  tN2kTransmissionGear TransmissionGear;
+} tN2kFastTransmission;
+
+/*! ******************************************************************
+  @struct tN2kFastSystemTime
+  @brief  Used fields of PGN 126992 System Time
+ */
+typedef struct
+{
+  /// Days since 1.1.1970, N2kUInt16NA if not available
+  uint16_t SystemDate;
+  /// Time since midnight [0.0001 s], N2kUInt32NA if not available
+  uint32_t SystemTime;
+} tN2kFastSystemTime;
+
+/*! ******************************************************************
+  @brief    Decode PGN 127488 Engine Rapid
+  @param    N2kMsg NMEA2000 message
+  @param    Data Decoded fields
+  @return   bool true if decoded, false if PGN or length do not match
+ */
+bool FastParseN2kEngineRapid(const tN2kMsg &N2kMsg, tN2kFastEngineRapid &Data);
+
+/*! ******************************************************************
+  @brief    Decode PGN 127488 Engine Rapid from a raw CAN frame
+  @details  Used by the CAN driver before a \ref tN2kMsg is built.
+  @param    len Length of the frame [bytes]
+  @param    buf Data of the frame
+  @param    Data Decoded fields
+  @return   bool true if decoded, false if the frame is too short
+ */
+bool FastParseN2kEngineRapidFrame(unsigned char len, const unsigned char *buf, tN2kFastEngineRapid &Data);
+
+/*! ******************************************************************
+  @brief    Decode PGN 127489 Engine Dynamic Parameters
+  @param    N2kMsg NMEA2000 message
+  @param    Data Decoded fields
+  @return   bool true if decoded, false if PGN or length do not match
+ */
+bool FastParseN2kEngineDynamic(const tN2kMsg &N2kMsg, tN2kFastEngineDynamic &Data);
+
+/*! ******************************************************************
+  @brief    Decode PGN 127493 Transmission Parameters
+  @param    N2kMsg NMEA2000 message
+  @param    Data Decoded fields
+  @return   bool true if decoded, false if PGN or length do not match
+ */
+bool FastParseN2kTransmission(const tN2kMsg &N2kMsg, tN2kFastTransmission &Data);
+
+/*! ******************************************************************
+  @brief    Decode PGN 126992 System Time
+  @param    N2kMsg NMEA2000 message
+  @param    Data Decoded fields
+  @return   bool true if decoded, false if PGN or length do not match
+ */
+bool FastParseN2kSystemTime(const tN2kMsg &N2kMsg, tN2kFastSystemTime &Data);
+
+/*! ******************************************************************
+  @brief    Benchmark the decoders
+  @details  This function will decode a set of sample messages with the
+            library parsers and with the specialized decoders and print
+            the time per decode via Serial. Only compiled in if
+            @ref N2K_DECODE_BENCHMARK is enabled.
+ */
+void benchmarkN2kDecoders(void);
+
+#endif // _N2KFASTDECODE_H_
@@ -0,0 +1,147 @@
+/*!
+ * \file n2kSourceArbiter.h
+ * \brief Arbitration between several senders of the same engine data
+ *
+ * This file contains the source arbitration for NMEA2000 messages
+ * which are sent by more than one device, e.g. two gateways both
+ * sending Engine Rapid for instance 0. For each message and instance
+ * the source addresses are tracked in a fixed table and only the
+ * messages of one selected source are used for the display. If the
+ * selected source times out the arbiter fails over to another one.
+ *
+ * \author Matthias Werner
+ * \date   October 2026
+ * \version 0.1
+ *
+ *
+ */
+
+#ifndef _N2KSOURCEARBITER_H_
+#define _N2KSOURCEARBITER_H_
+
+#include <hardwareDef.h>
+#include <sysClock.h>
+
+/// Marker for "no source selected"
+#define N2K_ARBITER_NO_SOURCE 0xFF
+
+/*! ******************************************************************
+  @enum   tN2kArbiterPolicy
+  @brief  Policy for the selection of the source
+ */
+typedef enum
+{
+  /// Use @ref N2K_ARBITER_PREFERRED_SOURCE while it is alive
+  N2K_ARBITER_PREFERRED = 0,
+  /// Keep the selected source, fail over to the most recent one
+  N2K_ARBITER_MOST_RECENT,
+  /// Use the source with the highest message rate
+  N2K_ARBITER_HIGHEST_RATE
+} tN2kArbiterPolicy;
+
+/*! ******************************************************************
+  @struct tN2kSourceEntry
+  @brief  Structure for one tracked source address
+ */
+typedef struct
+{
+  /// true if the entry is used
+  bool InUse;
+  /// Source address
+  uint8_t Source;
+  /// Number of messages since start
+  uint32_t MsgCnt;
+  /// Number of messages in the running rate interval
+  uint32_t IntervalCnt;
+  /// Message rate of the last rate interval [messages/10s]
+  uint32_t Rate;
+  /// Timestamp of the last message [us]
+  uint64_t LastTimestamp;
+} tN2kSourceEntry;
+
+/*! ******************************************************************
+  @class  N2kSourceArbiter
+  @brief  Class for the arbitration of one message and instance
+
+  This class tracks up to @ref N2K_ARBITER_MAX_SOURCES source
+  addresses in a fixed table and selects one of them with the
+  configured \ref tN2kArbiterPolicy. A source without a message for
+  @ref N2K_ARBITER_TIMEOUT_INTERVALS nominal intervals of the message
+  is dead, if it was selected another alive source is selected and the
+  failover is counted.
+ */
+class N2kSourceArbiter
+{
+public:
+  /*! ******************************************************************
+    @brief Constructor
+    @param Policy Policy for the selection of the source
+   */
+  N2kSourceArbiter(tN2kArbiterPolicy Policy = (tN2kArbiterPolicy)N2K_ARBITER_POLICY);
+
+  /*! ******************************************************************
+    @brief Set the nominal interval of the message
+    @details The source timeout is @ref N2K_ARBITER_TIMEOUT_INTERVALS
+             times the interval, so the jitter of a slow message does
+             not switch the source. Without a call the interval of the
+             slowest message @ref N2K_ARBITER_ENGINE_DYNAMIC_INTERVAL
+             is used.
+    @param Interval Nominal interval of the message [ms]
+   */
+  void SetInterval(uint32_t Interval);
+
+  /*! ******************************************************************
+    @brief Record a message and check if its source is selected
+    @param Source Source address of the message
+    @param now Receive time of the message [us]
+    @return bool true if the message should be used
+   */
+  bool Accept(uint8_t Source, uint64_t now);
+
+  /*! ******************************************************************
+    @brief Get the selected source address
+    @return uint8_t source address or @ref N2K_ARBITER_NO_SOURCE
+   */
+  uint8_t GetSelectedSource(void);
+
+  /// Get the number of failovers
+  uint32_t GetFailoverCnt(void);
+  /// Get the number of messages dropped from not selected sources
+  uint32_t GetRejectedCnt(void);
+
+  /*! ******************************************************************
+    @brief Show the tracked sources via Serial
+    @details The caller has to hold the Serial output mutex. Nothing is
+             printed if no source was seen.
+    @param Label Label of the message
+    @param Instance Instance of the message
+   */
+  void Show(const char *Label, uint8_t Instance);
+
+private:
+  /// Find the entry of a source, allocate one if not tracked yet
+  tN2kSourceEntry *GetEntry(uint8_t Source, uint64_t now);
+  /// Check if an entry received a message within the timeout
+  bool IsAlive(const tN2kSourceEntry *Entry, uint64_t now);
+  /// Close the rate interval if it is over
+  void UpdateRates(uint64_t now);
+  /// Select the source according to the policy
+  void SelectSource(uint64_t now);
+
+  /// Policy for the selection of the source
+  tN2kArbiterPolicy Policy;
+  /// Tracked sources
+  tN2kSourceEntry Sources[N2K_ARBITER_MAX_SOURCES];
+  /// Selected entry, nullptr if none
+  tN2kSourceEntry *Selected;
+  /// Time out after which a source is dead [us]
+  uint64_t Timeout;
+  /// Start of the running rate interval [us]
+  uint64_t IntervalStart;
+  /// Number of failovers
+  uint32_t FailoverCnt;
+  /// Number of messages dropped from not selected sources
+  uint32_t RejectedCnt;
+};
+
+#endif // _N2KSOURCEARBITER_H_
@@ -0,0 +1,286 @@
+/*!
+ * \file paletteCanvas.h
+ * \brief Canvas with 8-bit palette indices for the display composition
+ *
+ * This file contains a canvas which stores one palette index per pixel
+ * instead of the RGB565 colour. The scale, the needles, the text, the
+ * arc and the lamps are drawn as indices and expanded to RGB565 with
+ * the palette of 256 colours only while they are pushed to the display,
+ * a few lines at a time. This halves the RAM of the frame and the
+ * memory traffic of the composition, and an effect on the colours,
+ * e.g. the night mode, only changes the palette, see \ref SetNightColor.
+ *
+ * The canvas may hold only a band of lines of the frame, see
+ * \ref SetBand. All positions are given in the frame, everything
+ * outside of the band is clipped, so the same drawing calls compose
+ * the frame band by band.
+ *
+ * \author Matthias Werner
+ * \date   October 2026
+ * \version 0.1
+ *
+ *
+ */
+
+#ifndef _PALETTECANVAS_H_
+#define _PALETTECANVAS_H_
+
+#include <hardwareDef.h>
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include <assetTypes.h>
+
+/// Number of entries of the palette
+#define PALETTE_CANVAS_COLORS 256
+
+/// Lines expanded to RGB565 at a time while pushing to the display,
+/// two buffers of this size are used in turn for the DMA
+#define PALETTE_CANVAS_PUSH_LINES 8
+
+/// Fraction bits of the source position while rotating an image
+#define PALETTE_CANVAS_ROTATE_FRACTION_BITS 10
+
+/*! ******************************************************************
+  @class  PaletteCanvas
+  @brief  Class for a canvas of palette indices
+
+  All drawing functions take a palette index instead of a colour, the
+  colour is looked up in the palette by \ref PushSprite. Everything
+  outside of the canvas is clipped.
+ */
+class PaletteCanvas
+{
+public:
+  /*! ******************************************************************
+    @brief Constructor
+    @param Tft Display the canvas is pushed to
+   */
+  PaletteCanvas(TFT_eSPI *Tft);
+
+  /*! ******************************************************************
+    @brief Allocate the pixels and the line buffers
+    @details A canvas which is never pushed, e.g. a cached layer, gets
+             no line buffers and takes its pixels from the PSRAM if
+             there is one. It is used as image with \ref GetImage.
+    @param Width Width of the canvas [px]
+    @param Height Height of the canvas or of one band [px]
+    @param Push false if the canvas is never pushed to the display
+    @return bool true if the memory could be allocated
+   */
+  bool CreateSprite(int16_t Width, int16_t Height, bool Push = true);
+
+  /// Free the pixels and the line buffers
+  void DeleteSprite(void);
+
+  /*! ******************************************************************
+    @brief Push with DMA
+    @details The lines are expanded into one line buffer while the other
+             one is sent by DMA. Without DMA they are pushed blocking.
+    @return bool true if the DMA of the display could be initialised
+   */
+  bool InitDma(void);
+
+  /*! ******************************************************************
+    @brief Move the canvas to a band of the frame
+    @details The canvas holds the lines Top to Top + Height - 1 of the
+             frame afterwards, the pixels are kept.
+    @param Top First line of the band in the frame [px]
+   */
+  void SetBand(int16_t Top);
+
+  /// Get the first line of the band in the frame [px]
+  int16_t GetBandTop(void) const;
+
+  /// Get the number of lines of the band [px]
+  int16_t GetBandHeight(void) const;
+
+  /*! ******************************************************************
+    @brief Get the pixels as palettized image
+    @details The image is valid until the canvas is deleted and can be
+             drawn onto another canvas with the same palette, e.g. with
+             \ref PushImage or \ref PushRotated.
+    @return tPalettedImage image of the band
+   */
+  tPalettedImage GetImage(void) const;
+
+  /*! ******************************************************************
+    @brief Set one colour of the palette
+    @param Index Palette index
+    @param Color RGB565 colour
+   */
+  void SetPaletteColor(uint8_t Index, uint16_t Color);
+
+  /*! ******************************************************************
+    @brief Copy colours from flash to the palette
+    @param First First palette index
+    @param Colors RGB565 colours in flash
+    @param Count Number of colours
+   */
+  void SetPalette(uint8_t First, const uint16_t *Colors, uint16_t Count);
+
+  /*! ******************************************************************
+    @brief Set a ramp from black to a colour
+    @details Entry First + l - 1 gets the colour scaled by l / Levels,
+             so the last entry has the full colour. The ramps are
+             used for anti aliased edges and dimmed icons.
+    @param First First palette index of the ramp
+    @param Color RGB565 colour of the last entry
+    @param Levels Number of entries of the ramp
+   */
+  void SetPaletteRamp(uint8_t First, uint16_t Color, uint8_t Levels);
+
+  /*! ******************************************************************
+    @brief Get one colour of the palette
+    @param Index Palette index
+    @return uint16_t RGB565 colour as set, without the night colour
+   */
+  uint16_t GetPaletteColor(uint8_t Index) const;
+
+  /*! ******************************************************************
+    @brief Show all colours in shades of one night colour
+    @details Every colour of the palette is replaced by the night colour
+             scaled by its luminance, so white becomes the night colour
+             and black stays black. Only the 256 entries are converted,
+             the push costs the same with and without.
+    @param Color RGB565 night colour, 0 shows the colours as set
+   */
+  void SetNightColor(uint16_t Color);
+
+  /// Fill the whole canvas with one palette index
+  void FillSprite(uint8_t Index);
+
+  /// Set one pixel
+  void DrawPixel(int32_t x, int32_t y, uint8_t Index);
+
+  /// Draw a horizontal line of w pixels
+  void DrawFastHLine(int32_t x, int32_t y, int32_t w, uint8_t Index);
+
+  /// Fill a rectangle
+  void FillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint8_t Index);
+
+  /*! ******************************************************************
+    @brief Copy a rectangle of a palettized image
+    @details The indices are copied unchanged, the image has to use the
+             palette of the canvas.
+    @param x X position on the canvas [px]
+    @param y Y position on the canvas [px]
+    @param Image Palettized image in flash
+    @param sx X position in the image [px]
+    @param sy Y position in the image [px]
+    @param w Width of the rectangle [px]
+    @param h Height of the rectangle [px]
+   */
+  void PushImage(int32_t x, int32_t y, const tPalettedImage &Image, int32_t sx, int32_t sy, int32_t w, int32_t h);
+
+  /*! ******************************************************************
+    @brief Draw a palettized image rotated around its pivot
+    @details Every pixel of the canvas is taken from the nearest pixel
+             of the image, as TFT_eSprite::pushRotated() does.
+    @param Image Palettized image in flash
+    @param PivotX X position of the pivot in the image [px]
+    @param PivotY Y position of the pivot in the image [px]
+    @param x X position of the pivot on the canvas [px]
+    @param y Y position of the pivot on the canvas [px]
+    @param Angle Clockwise rotation [deg]
+    @param Transparent Index of the image which is not drawn
+   */
+  void PushRotated(const tPalettedImage &Image, int16_t PivotX, int16_t PivotY, int32_t x, int32_t y, int16_t Angle,
+                   uint8_t Transparent);
+
+  /*! ******************************************************************
+    @brief Draw an icon of an icon atlas with a ramp
+    @details The brightness 1 to 14 of a pixel takes the entry of the
+             ramp, 0 is black and 15 keeps the pixel, see \ref tLampIcon.
+    @param Icon Position of the icon in the atlas
+    @param Atlas Icon atlas in flash
+    @param x X position on the canvas [px]
+    @param y Y position on the canvas [px]
+    @param Ramp First palette index of the ramp with LAMP_ATLAS_FULL
+           entries, see \ref SetPaletteRamp
+   */
+  void PushIcon(const tLampIcon &Icon, const uint8_t *Atlas, int32_t x, int32_t y, uint8_t Ramp);
+
+  /*! ******************************************************************
+    @brief Draw an anti aliased line with round ends
+    @details The edge pixels take an entry of the ramp by their
+             coverage, see \ref SetPaletteRamp.
+    @param x0 X position of the start [px]
+    @param y0 Y position of the start [px]
+    @param x1 X position of the end [px]
+    @param y1 Y position of the end [px]
+    @param LineWidth Width of the line [px]
+    @param Ramp First palette index of the ramp
+    @param Levels Number of entries of the ramp
+   */
+  void DrawSmoothLine(float x0, float y0, float x1, float y1, float LineWidth, uint8_t Ramp, uint8_t Levels);
+
+  /*! ******************************************************************
+    @brief Draw an anti aliased arc with round ends
+    @details The angles are counted clockwise from 6 o'clock as with
+             TFT_eSPI::drawSmoothArc(). The edge pixels take an entry
+             of the ramp by their coverage, see \ref SetPaletteRamp.
+    @param x X position of the centre [px]
+    @param y Y position of the centre [px]
+    @param r Outer radius [px]
+    @param ir Inner radius [px]
+    @param StartAngle Start of the arc [deg]
+    @param EndAngle End of the arc [deg]
+    @param Ramp First palette index of the ramp
+    @param Levels Number of entries of the ramp
+   */
+  void DrawSmoothArc(int32_t x, int32_t y, int32_t r, int32_t ir, uint32_t StartAngle, uint32_t EndAngle, uint8_t Ramp,
+                     uint8_t Levels);
+
+  /*! ******************************************************************
+    @brief Push a rectangle of the canvas to the display
+    @details The indices are expanded to RGB565 in the line buffers,
+             @ref PALETTE_CANVAS_PUSH_LINES lines at a time. With DMA
+             the last lines may still be sent on return, so the next
+             band can be drawn meanwhile. Has to be called between
+             TFT_eSPI::startWrite() and endWrite(), with dmaWait()
+             before endWrite().
+    @param tx X position on the display [px]
+    @param ty Y position on the display [px]
+    @param sx X position in the frame [px]
+    @param sy Y position in the frame [px]
+    @param sw Width of the rectangle [px]
+    @param sh Height of the rectangle [px]
+   */
+  void PushSprite(int32_t tx, int32_t ty, int32_t sx, int32_t sy, int32_t sw, int32_t sh);
+
+  /// Push the whole band to the display, x and y are the position of
+  /// the frame on the display, as \ref PushSprite above
+  void PushSprite(int32_t x, int32_t y);
+
+private:
+  /// Clip a rectangle to the band, false if nothing is left
+  bool Clip(int32_t &x, int32_t &y, int32_t &w, int32_t &h) const;
+
+  /// Display the canvas is pushed to
+  TFT_eSPI *Tft;
+  /// Palette index of every pixel of the band
+  uint8_t *Pixels;
+  /// Buffers for the expanded lines, used in turn
+  uint16_t *LineBuffer[2];
+  /// Line buffer to be filled next
+  uint8_t NextBuffer;
+  /// Push with DMA
+  bool Dma;
+  /// Width of the canvas [px]
+  int16_t Width;
+  /// Height of the band [px]
+  int16_t Height;
+  /// First line of the band in the frame [px]
+  int16_t Top;
+  /// Convert a colour of the palette for the output
+  uint16_t OutputColor(uint16_t Color) const;
+
+  /// RGB565 colours of the palette as set
+  uint16_t Palette[PALETTE_CANVAS_COLORS];
+  /// RGB565 colours pushed to the display
+  uint16_t Output[PALETTE_CANVAS_COLORS];
+  /// Night colour, 0 if the colours are shown as set
+  uint16_t NightColor;
+};
+
+#endif // _PALETTECANVAS_H_
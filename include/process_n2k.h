@@ -15,6 +15,9 @@
 #define _PROCESS_N2K_H_
 
 #include <hardwareDef.h>
+#include <sysClock.h>
+#include <taskMonitor.h>
+#include <signalRegistry.h>
 
 #include <N2kMessages.h>
 
@@ -32,35 +35,10 @@ typedef struct
   unsigned long PGN;
   /// Handler function for the message
   void (*Handler)(const tN2kMsg &N2kMsg);
+  /// true if the message is a fast-packet message
+  bool FastPacket;
 } tNMEA2000Handler;
 
-/*! ******************************************************************
-  @struct tDisplayData
-  @brief  Structure for the data which will be displayed
-
-  This structure contains the data which will be displayed on the
-  screen.
- */
-typedef struct
-{
-  /// Engine Speed
-  double EngineSpeed;
-  /// Engine Hours
-  double EngineHours;
-  /// Coolant Temperature
-  double EngineCoolantTemperature;
-  /// Engine Oil Pressure
-  double EngineOilPressure;
-  /// Engine Alternator Voltage
-  double EngineAlternatorVoltage;
-  /// Low Oil Pressure Warning
-  bool LowOilPressureWarning;
-  /// Engine Discrete Status 1
-  tN2kEngineDiscreteStatus1 EngineDiscreteStatus1;
-  /// Engine Discrete Status 2
-  tN2kEngineDiscreteStatus2 EngineDiscreteStatus2;
-} tDisplayData;
-
 /*! ******************************************************************
   @class  N2kMsgStatistics
   @brief  Class for the NMEA2000 message statistics
@@ -84,6 +62,8 @@ public:
     for the given PGN.
 
     @param PGN PGN of the message
+    @param Instance Engine instance of an engine message, only the
+           displayed instance is counted
    */
   void UpdateMsgCnt(uint32_t PGN, uint8_t Instance = 0);
 
@@ -148,14 +128,14 @@ private:
   uint32_t TransmissionParametersCnt;
   /// Number of messages failed parse Transmission Parameters
   uint32_t TransmissionParametersFailedCnt; 
-  /// Timestamp of the last received message System Time
-  uint32_t SystemTimeLastTimestamp;
-  /// Timestamp of the last received message Engine Rapid
-  uint32_t EngineRapidLastTimestamp;
-  /// Timestamp of the last received message Engine Dynamic
-  uint32_t EngineDynamicLastTimestamp;
-  /// Timestamp of the last received message Transmission Parameters
-  uint32_t TransmissionParametersLastTimestamp;
+  /// Timestamp of the last received message System Time [us]
+  uint64_t SystemTimeLastTimestamp;
+  /// Timestamp of the last received message Engine Rapid [us]
+  uint64_t EngineRapidLastTimestamp;
+  /// Timestamp of the last received message Engine Dynamic [us]
+  uint64_t EngineDynamicLastTimestamp;
+  /// Timestamp of the last received message Transmission Parameters [us]
+  uint64_t TransmissionParametersLastTimestamp;
 
 };
 
@@ -168,12 +148,6 @@ extern Stream *OutputStream;
 
 #endif // End of DEBUG_LEVEL > 0
 
-/// Global Structure for the display data
-extern tDisplayData DisplayData;
-
-/// Mutex to protect the Serial output for tread safety
-extern SemaphoreHandle_t SerialOutputMutex;
-
 /// Object for the N2K message statistics
 extern N2kMsgStatistics N2kMessageStatistics;
 
@@ -189,8 +163,8 @@ int8_t initN2K(void);
 /*! ******************************************************************
   @brief    Evaluate System Time Message
   @details  This function will evaluate the system time message and
-            store the data in the display data structure.
-            \ref DisplayData
+            store the data in the signal registry.
+            \ref SIGNAL_LIST
 
   @param    N2kMsg NMEA2000 message
  */
@@ -199,18 +173,34 @@ void SystemTime(const tN2kMsg &N2kMsg);
 /*! ******************************************************************
   @brief    Evaluate EngineRapid Message
   @details  This function will evaluate the engine rapid message and
-            store the data in the display data structure.
-            \ref DisplayData
+            store the data in the signal registry.
+            \ref SIGNAL_LIST
 
   @param    N2kMsg NMEA2000 message
  */
 void EngineRapid(const tN2kMsg &N2kMsg);
 
+/*! ******************************************************************
+  @brief    Decode an EngineRapid frame in the CAN driver
+  @details  This function is the early frame handler of the CAN driver.
+            It decodes the engine speed of all tracked instances
+            straight from the frame and publishes it to the signal
+            registry. Frames of other instances
+            are left to \ref EngineRapid.
+
+  @param    id 29-bit CAN identifier
+  @param    len Length of the frame [bytes]
+  @param    buf Data of the frame
+  @param    now Receive time of the frame [us]
+  @return   bool true if the frame was consumed
+ */
+bool EngineRapidFrame(unsigned long id, unsigned char len, const unsigned char *buf, uint64_t now);
+
 /*! ******************************************************************
   @brief    Evaluate EngineDynamic Message
   @details  This function will evaluate the engine dynamic message and
-            store the data in the display data structure.
-            \ref DisplayData
+            store the data in the signal registry.
+            \ref SIGNAL_LIST
 
   @param    N2kMsg NMEA2000 message
  */
@@ -219,8 +209,8 @@ void EngineDynamicParameters(const tN2kMsg &N2kMsg);
 /*! ******************************************************************
   @brief    Evaluate Transmission Parameters Message
   @details  This function will evaluate the transmission parameters
-            message and store the data in the display data structure.
-            \ref DisplayData
+            message and store the data in the signal registry.
+            \ref SIGNAL_LIST
 
   @param    N2kMsg NMEA2000 message
  */
@@ -238,9 +228,23 @@ void HandleNMEA2000Msg(const tN2kMsg &N2kMsg);
 /*! ******************************************************************
   @brief    Update the NMEA2000 messages
   @details  this function will check the NMEA2000 bus for new messages
-            and call the message handler for each message.
+            and call the message handler for each message. Afterwards
+            the signals which timed out are marked stale.
             \ref HandleNMEA2000Msg, \ref NMEA2000.setMessageHandler
  */
 void updateN2K(void);
 
+/*! ******************************************************************
+  @brief    Wait for the next update of the NMEA2000 messages
+  @details  With \ref N2K_ENGINE_RAPID_FAST_PATH enabled this function
+            returns as soon as the CAN driver received a frame, at the
+            latest after one period. If the wait fails, e.g. without an
+            installed driver, it sleeps for the period, so the task
+            never spins. Otherwise it sleeps till the next period.
+
+  @param    nextWakeTime Wake time of the running period [us]
+  @param    periodMs Period of the task [ms]
+ */
+void waitN2K(uint64_t &nextWakeTime, uint32_t periodMs);
+
 #endif // _PROCESS_N2K_H_
@@ -0,0 +1,85 @@
+/*!
+ * \file runFont.h
+ * \brief Text output with the run length fonts
+ *
+ * This file contains the text output with the fonts generated by
+ * scripts/assetCompiler.py. The fonts hold only the characters shown
+ * on the display and every glyph is stored as runs of background and
+ * foreground pixels, see \ref tRunGlyph. A run of foreground pixels is
+ * drawn as horizontal line, no bit of the glyph has to be tested at
+ * run time.
+ *
+ * The position of the text is calculated as by TFT_eSPI for the GFX
+ * fonts, so the text is at the same place as with drawString().
+ *
+ * \author Matthias Werner
+ * \date   October 2026
+ * \version 0.1
+ *
+ *
+ */
+
+#ifndef _RUNFONT_H_
+#define _RUNFONT_H_
+
+#include <hardwareDef.h>
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include <assetTypes.h>
+#include <paletteCanvas.h>
+
+/*! ******************************************************************
+  @brief    Get the width of a text
+  @details  Characters without a glyph in the font are skipped.
+  @param    Font Run length font
+  @param    Text Text to measure
+  @return   int16_t width of the text [px]
+ */
+int16_t runFontTextWidth(const tRunFont &Font, const char *Text);
+
+/*! ******************************************************************
+  @brief    Draw a text
+  @details  Only the foreground pixels are drawn, the background stays.
+  @param    Target Display or sprite to draw on
+  @param    Font Run length font
+  @param    Text Text to draw
+  @param    x X position of the datum [px]
+  @param    y Y position of the datum [px]
+  @param    Datum Alignment of the text, TL_DATUM to BR_DATUM or
+            L_BASELINE to R_BASELINE as in TFT_eSPI
+  @param    Color Colour of the text
+  @return   int16_t width of the text [px]
+ */
+int16_t runFontDrawString(TFT_eSPI &Target, const tRunFont &Font, const char *Text, int32_t x, int32_t y,
+                          uint8_t Datum, uint16_t Color);
+
+/*! ******************************************************************
+  @brief    Draw a text on a palette canvas
+  @details  As \ref runFontDrawString() with a palette index instead of
+            the colour.
+  @param    Target Canvas to draw on
+  @param    Font Run length font
+  @param    Text Text to draw
+  @param    x X position of the datum [px]
+  @param    y Y position of the datum [px]
+  @param    Datum Alignment of the text as in TFT_eSPI
+  @param    Index Palette index of the text
+  @return   int16_t width of the text [px]
+ */
+int16_t runFontDrawString(PaletteCanvas &Target, const tRunFont &Font, const char *Text, int32_t x, int32_t y,
+                          uint8_t Datum, uint8_t Index);
+
+/*! ******************************************************************
+  @brief    Benchmark the run length font
+  @details  This function will draw the text with the GFX font of the
+            same glyphs and with the run length font into the sprite
+            and print the time per text via Serial. Only compiled in if
+            @ref FONT_BENCHMARK is enabled.
+  @param    Sprite Sprite to draw on, created and deleted here
+  @param    Font Run length font
+  @param    GfxFont GFX font with the same glyphs
+  @param    Text Text to draw
+ */
+void benchmarkRunFont(TFT_eSprite &Sprite, const tRunFont &Font, const GFXfont *GfxFont, const char *Text);
+
+#endif // _RUNFONT_H_
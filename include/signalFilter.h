@@ -0,0 +1,142 @@
+/*!
+ * \file signalFilter.h
+ * \brief Fixed-point conditioning filters for the displayed signals
+ *
+ * This file contains streaming filters which smooth the raw signal
+ * values in the NMEA2000 handlers before they are written to the
+ * signal registry. All filters work on the raw integer values in
+ * 32 bit fixed-point math with 8 fractional bits, keep their state in
+ * a fixed size object and never allocate memory. Time steps are
+ * counted in ticks of 1024 us, so no 64 bit division is needed per
+ * sample. The raw values have to be within +-2^20, the 16 bit values
+ * of the NMEA2000 messages are.
+ *
+ * \author Matthias Werner
+ * \date   October 2026
+ * \version 0.1
+ *
+ *
+ */
+
+#ifndef _SIGNALFILTER_H_
+#define _SIGNALFILTER_H_
+
+#include <hardwareDef.h>
+#include <sysClock.h>
+
+/// Maximum window length of the median filter
+#define SIGNAL_FILTER_MEDIAN_MAX 7
+
+/// Time [ms] without sample after which a filter starts over
+#define SIGNAL_FILTER_RESET_TIMEOUT 1000
+
+/// Length of a time step tick of the filters [us] as a power of 2
+#define SIGNAL_FILTER_TICK_SHIFT 10
+
+/*! ******************************************************************
+  @enum   tSignalFilterType
+  @brief  Type of a signal filter
+ */
+typedef enum
+{
+  /// Pass the value unfiltered
+  SIGNAL_FILTER_NONE = 0,
+  /// Exponentially weighted moving average, Param1 = shift of the weight 1/2^n
+  SIGNAL_FILTER_EWMA,
+  /// Median of the last samples, Param1 = window length 1..SIGNAL_FILTER_MEDIAN_MAX
+  SIGNAL_FILTER_MEDIAN,
+  /// Rate limiter, Param1 = maximum change per second [raw units] 0..65535
+  SIGNAL_FILTER_RATE_LIMIT,
+  /// Alpha-beta tracker, Param1 = alpha [1/256], Param2 = beta [1/256]
+  SIGNAL_FILTER_ALPHA_BETA
+} tSignalFilterType;
+
+/*! ******************************************************************
+  @struct tSignalFilterConfig
+  @brief  Structure for the configuration of a signal filter
+ */
+typedef struct
+{
+  /// Type of the filter
+  tSignalFilterType Type;
+  /// First parameter, see \ref tSignalFilterType
+  int32_t Param1;
+  /// Second parameter, see \ref tSignalFilterType
+  int32_t Param2;
+} tSignalFilterConfig;
+
+/*! ******************************************************************
+  @class  SignalFilter
+  @brief  Class for one streaming signal filter
+
+  This class filters the samples of one signal with the configured
+  \ref tSignalFilterType. The first sample, and the first sample after
+  a pause of @ref SIGNAL_FILTER_RESET_TIMEOUT, is passed through and
+  initialises the state.
+ */
+class SignalFilter
+{
+public:
+  /// Constructor, the filter passes the values unfiltered
+  SignalFilter();
+
+  /*! ******************************************************************
+    @brief Configure the filter
+    @details Resets the state of the filter.
+    @param Config Configuration of the filter
+   */
+  void Configure(const tSignalFilterConfig &Config);
+
+  /*! ******************************************************************
+    @brief Filter a sample
+    @param Sample Raw value of the sample
+    @param now Time of the sample [us]
+    @return int32_t filtered raw value
+   */
+  int32_t Update(int32_t Sample, uint64_t now);
+
+  /// Reset the state, the next sample starts over
+  void Reset(void);
+
+private:
+  /// Exponentially weighted moving average
+  int32_t UpdateEwma(int32_t Sample);
+  /// Median of the last samples
+  int32_t UpdateMedian(int32_t Sample);
+  /// Rate limiter
+  int32_t UpdateRateLimit(int32_t Sample, uint32_t Ticks);
+  /// Alpha-beta tracker
+  int32_t UpdateAlphaBeta(int32_t Sample, uint32_t Ticks);
+
+  /// Configuration of the filter
+  tSignalFilterConfig Config;
+  /// true if the state holds a sample
+  bool Started;
+  /// Time of the last sample [us]
+  uint64_t LastTime;
+  /// Maximum change of the rate limiter [raw units << 12 per tick]
+  int32_t RateStep;
+  /// Filtered value [raw units << 8]
+  int32_t Value;
+  /// Velocity of the alpha-beta tracker [raw units << 8 per tick]
+  int32_t Velocity;
+  /// Samples of the median filter
+  int32_t Window[SIGNAL_FILTER_MEDIAN_MAX];
+  /// Number of samples in the window
+  uint8_t WindowCnt;
+  /// Next position in the window
+  uint8_t WindowPos;
+};
+
+/*! ******************************************************************
+  @brief    Benchmark the filters and check their step response
+  @details  This function will run every filter type on a step from 0
+            to 1000 with 100 ms between the samples, print the response
+            and the time per sample via Serial. A response which leaves
+            the expected tolerance is reported as an error. Only
+            compiled in if @ref SIGNAL_FILTER_BENCHMARK is enabled.
+  @return   bool false if a step response is out of tolerance
+ */
+bool benchmarkSignalFilters(void);
+
+#endif // _SIGNALFILTER_H_
@@ -0,0 +1,280 @@
+/*!
+ * \file signalRegistry.h
+ * \brief Typed registry of the displayed signals
+ *
+ * This file contains the registry of all signals passed from the
+ * NMEA2000 handlers to the display. The signals are declared once in
+ * \ref SIGNAL_LIST, from this list the signal IDs, the storage, the
+ * typed accessors and the initialisation are generated. Each signal
+ * exists once per tracked engine instance.
+ *
+ * Every change of a value or a quality increments a global version
+ * counter and sets the dirty bit of the signal in the dirty word of
+ * every consumer, so the display and loggers can take what changed
+ * since they looked last with one atomic exchange, without comparing
+ * values.
+ *
+ * Signals are written by the N2K task only and read by the display
+ * task. The values are protected by a sequence counter, readers never
+ * block and never see a torn value.
+ *
+ * \author Matthias Werner
+ * \date   October 2026
+ * \version 0.1
+ *
+ *
+ */
+
+#ifndef _SIGNALREGISTRY_H_
+#define _SIGNALREGISTRY_H_
+
+#include <hardwareDef.h>
+#include <sysClock.h>
+#include <timerWheel.h>
+#include <displaySignal.h>
+
+#include <atomic>
+
+/*! ******************************************************************
+  @brief  List of all signals
+
+  One entry per signal: X(Name, Type, Unit, TimeoutMs). The entry
+  generates the ID SIGNAL_ID_<Name> and the class <Name>Signal.
+ */
+#define SIGNAL_LIST(X)                                                                         \
+  X(EngineSpeed, uint16_t, SIGNAL_UNIT_RPM_0_25, N2K_MSG_ENGINE_RAPID_TIMEOUT)                 \
+  X(EngineHours, uint32_t, SIGNAL_UNIT_SECOND, N2K_MSG_ENGINE_DYNAMIC_TIMEOUT)                 \
+  X(EngineCoolantTemperature, uint16_t, SIGNAL_UNIT_KELVIN_0_01, N2K_MSG_ENGINE_DYNAMIC_TIMEOUT) \
+  X(EngineOilPressure, uint16_t, SIGNAL_UNIT_PASCAL_100, N2K_MSG_ENGINE_DYNAMIC_TIMEOUT)       \
+  X(EngineAlternatorVoltage, int16_t, SIGNAL_UNIT_VOLT_0_01, N2K_MSG_ENGINE_DYNAMIC_TIMEOUT)   \
+  X(EngineDiscreteStatus1, uint16_t, SIGNAL_UNIT_NONE, N2K_MSG_ENGINE_DYNAMIC_TIMEOUT)         \
+  X(EngineDiscreteStatus2, uint16_t, SIGNAL_UNIT_NONE, N2K_MSG_ENGINE_DYNAMIC_TIMEOUT)
+
+/*! ******************************************************************
+  @enum   tSignalId
+  @brief  ID of a signal, generated from \ref SIGNAL_LIST
+ */
+typedef enum
+{
+#define SIGNAL_ID(Name, Type, Unit, TimeoutMs) SIGNAL_ID_##Name,
+  SIGNAL_LIST(SIGNAL_ID)
+#undef SIGNAL_ID
+  /// Number of signals
+  SIGNAL_COUNT
+} tSignalId;
+
+/// Dirty bit of a signal of one engine instance
+#define SIGNAL_BIT(Id, Instance) (1UL << ((Id) * N2K_MAX_ENGINE_INSTANCES + (Instance)))
+
+static_assert(SIGNAL_COUNT * N2K_MAX_ENGINE_INSTANCES <= 32, "Dirty bits of all signals have to fit into 32 bits");
+
+/*! ******************************************************************
+  @enum   tSignalConsumer
+  @brief  Consumer of the dirty bits, each one takes its own copy
+ */
+typedef enum
+{
+  /// Display task
+  SIGNAL_CONSUMER_DISPLAY = 0,
+  /// Number of consumers
+  SIGNAL_CONSUMER_COUNT
+} tSignalConsumer;
+
+/*! ******************************************************************
+  @struct tSignalSlot
+  @brief  Structure for the storage of one signal of one engine instance
+ */
+typedef struct
+{
+  /// Sequence counter, odd while the value is written
+  std::atomic<uint32_t> Sequence;
+  /// Raw value in the resolution of the unit
+  int32_t Raw;
+  /// Quality of the value
+  tSignalQuality Quality;
+  /// Timestamp of the last update [us]
+  uint64_t Timestamp;
+  /// Registry version of the last change
+  uint32_t Version;
+  /// Dirty bit of the signal
+  uint32_t Bit;
+  /// Timer for the time out
+  tTimerWheelNode Timer;
+} tSignalSlot;
+
+/*! ******************************************************************
+  @brief    Init a signal slot
+  @param    Slot Signal slot
+  @param    Bit Dirty bit of the signal
+ */
+void signalSlotInit(tSignalSlot &Slot, uint32_t Bit);
+
+/*! ******************************************************************
+  @brief    Write a signal slot
+  @details  Only to be called from the N2K task. Increments the
+            registry version and sets the dirty bit if value or quality
+            changed, and restarts the time out of the signal.
+  @param    Slot Signal slot
+  @param    Raw Raw value, ignored if not available
+  @param    Quality Quality of the value
+  @param    TimeoutMs Time out of the signal [ms]
+  @param    now Time of the update [us]
+ */
+void signalSlotWrite(tSignalSlot &Slot, int32_t Raw, tSignalQuality Quality, uint32_t TimeoutMs, uint64_t now);
+
+/*! ******************************************************************
+  @brief    Read a signal slot without blocking
+  @param    Slot Signal slot
+  @param    Unit Unit of the signal
+  @return   tSignalValue value and quality
+ */
+tSignalValue signalSlotRead(const tSignalSlot &Slot, tSignalUnit Unit);
+
+/*! ******************************************************************
+  @class  Signal
+  @brief  Class for one typed signal of the registry
+
+  This class only has static members, each signal of
+  \ref SIGNAL_LIST is its own instantiation with its own storage.
+  There are no objects and no virtual functions.
+
+  @tparam T Type of the raw value
+  @tparam Unit Unit and resolution of the raw value
+  @tparam Id ID of the signal
+  @tparam TimeoutMs Time out [ms] after which the signal is stale
+ */
+template <typename T, tSignalUnit Unit, tSignalId Id, uint32_t TimeoutMs>
+class Signal
+{
+public:
+  /// Init the storage of all engine instances
+  static void Init(void)
+  {
+    for (uint8_t instance = 0; instance < N2K_MAX_ENGINE_INSTANCES; instance++)
+    {
+      signalSlotInit(Slots[instance], SIGNAL_BIT(Id, instance));
+    }
+  }
+
+  /*! ******************************************************************
+    @brief Set a received value
+    @param Instance Engine instance
+    @param Raw Raw value
+    @param Available false if the sender reported "not available"
+    @param now Time of the update [us]
+   */
+  static void Set(uint8_t Instance, T Raw, bool Available, uint64_t now)
+  {
+    if (Instance < N2K_MAX_ENGINE_INSTANCES)
+    {
+      signalSlotWrite(Slots[Instance], (int32_t)Raw, Available ? SIGNAL_VALID : SIGNAL_NOT_AVAILABLE, TimeoutMs, now);
+    }
+  }
+
+  /*! ******************************************************************
+    @brief Get the value and quality
+    @param Instance Engine instance
+    @return tSignalValue value and quality, no data for unknown instances
+   */
+  static tSignalValue GetValue(uint8_t Instance)
+  {
+    tSignalValue value = {0, Unit, SIGNAL_NO_DATA};
+
+    if (Instance < N2K_MAX_ENGINE_INSTANCES)
+    {
+      value = signalSlotRead(Slots[Instance], Unit);
+    }
+    return value;
+  }
+
+  /*! ******************************************************************
+    @brief Get the typed raw value
+    @param Instance Engine instance
+    @return T raw value, 0 if there is no value
+   */
+  static T Get(uint8_t Instance)
+  {
+    tSignalValue value = GetValue(Instance);
+
+    return signalHasValue(value) ? (T)value.Raw : (T)0;
+  }
+
+  /*! ******************************************************************
+    @brief Check if the signal changed since a registry version
+    @param Instance Engine instance
+    @param Version Registry version
+    @return bool true if changed
+   */
+  static bool ChangedSince(uint8_t Instance, uint32_t Version)
+  {
+    return (Instance < N2K_MAX_ENGINE_INSTANCES) && ((int32_t)(Slots[Instance].Version - Version) > 0);
+  }
+
+  /// Get the dirty bit of an engine instance
+  static uint32_t Bit(uint8_t Instance)
+  {
+    return (Instance < N2K_MAX_ENGINE_INSTANCES) ? SIGNAL_BIT(Id, Instance) : 0;
+  }
+
+private:
+  /// Storage of all engine instances
+  static tSignalSlot Slots[N2K_MAX_ENGINE_INSTANCES];
+};
+
+template <typename T, tSignalUnit Unit, tSignalId Id, uint32_t TimeoutMs>
+tSignalSlot Signal<T, Unit, Id, TimeoutMs>::Slots[N2K_MAX_ENGINE_INSTANCES];
+
+// Generate the signal classes
+#define SIGNAL_TYPE(Name, Type, Unit, TimeoutMs) \
+  typedef Signal<Type, Unit, SIGNAL_ID_##Name, TimeoutMs> Name##Signal;
+SIGNAL_LIST(SIGNAL_TYPE)
+#undef SIGNAL_TYPE
+
+/*! ******************************************************************
+  @brief    Init the signal registry
+  @details  This function will init all signals of \ref SIGNAL_LIST
+            with "no data".
+ */
+void signalRegistryInit(void);
+
+/*! ******************************************************************
+  @brief    Get the value of a signal by its ID
+  @details  For generic users like the alarm table, the typed
+            accessors of the signal classes are to be preferred.
+  @param    Id ID of the signal
+  @param    Instance Engine instance
+  @return   tSignalValue value and quality, no data for unknown IDs
+ */
+tSignalValue signalRegistryGetValue(tSignalId Id, uint8_t Instance);
+
+/*! ******************************************************************
+  @brief    Mark the signals stale which timed out
+  @details  Only to be called from the N2K task. Only valid signals
+            become stale, not available ones keep their quality.
+  @param    now Current time [us]
+ */
+void signalRegistryAdvance(uint64_t now);
+
+/*! ******************************************************************
+  @brief    Get the registry version
+  @details  The version is incremented with every change of a signal.
+  @return   uint32_t registry version
+ */
+uint32_t signalRegistryVersion(void);
+
+/*! ******************************************************************
+  @brief    Get and clear the dirty bits of a consumer
+  @details  The signals changed since the last call of the same
+            consumer, other consumers keep their own dirty bits.
+  @param    Consumer Consumer taking the dirty bits
+  @return   uint32_t dirty bits set since the last call, \ref SIGNAL_BIT
+ */
+uint32_t signalRegistryTakeDirty(tSignalConsumer Consumer);
+
+/*! ******************************************************************
+  @brief    Get the number of signals which timed out
+  @return   uint32_t number of time outs since start
+ */
+uint32_t signalRegistryExpiredCnt(void);
+
+#endif // _SIGNALREGISTRY_H_
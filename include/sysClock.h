@@ -0,0 +1,143 @@
+/*!
+ * \file sysClock.h
+ * \brief Monotonic system clock
+ *
+ * This file contains an injectable monotonic clock with a 64-bit
+ * microsecond base. All timestamps, timeouts and task periods of the
+ * speedometer are taken from this clock instead of calling millis()
+ * or vTaskDelay() directly. On the device the clock is driven by the
+ * ESP32 high resolution timer, for host simulations a virtual clock
+ * can be injected which only advances when asked to by a single driver.
+ *
+ * \author Matthias Werner
+ * \date   October 2026
+ * \version 0.1
+ *
+ *
+ */
+
+#ifndef _SYSCLOCK_H_
+#define _SYSCLOCK_H_
+
+#include <Arduino.h>
+
+/// Convert milliseconds to the clock base [us]
+#define CLOCK_MS_TO_US(ms) ((uint64_t)(ms) * 1000ULL)
+
+/// Convert the clock base [us] to milliseconds
+#define CLOCK_US_TO_MS(us) ((uint64_t)(us) / 1000ULL)
+
+/*! ******************************************************************
+  @struct tClockSource
+  @brief  Structure for a clock source
+
+  This structure contains the functions a clock source has to provide.
+  The time base is a monotonic 64-bit microsecond counter which will
+  not wrap during the lifetime of the device.
+ */
+typedef struct
+{
+  /// Return the current time in microseconds
+  uint64_t (*Now)(void);
+  /// Suspend the calling task for the given time in microseconds
+  void (*Sleep)(uint64_t Duration);
+  /// Suspend the calling task for the given time in microseconds or till
+  /// a task notification, true if notified. nullptr to only sleep.
+  bool (*WaitNotify)(uint64_t Duration);
+} tClockSource;
+
+/*! ******************************************************************
+  @brief    Set the clock source
+  @details  This function will replace the clock source used by all
+            modules. Passing nullptr restores the hardware clock.
+
+  @param    source Pointer to the clock source
+ */
+void setClockSource(const tClockSource *source);
+
+/*! ******************************************************************
+  @brief    Use the virtual clock
+  @details  This function will switch to a virtual clock which starts
+            at the given time and only advances by
+            \ref advanceVirtualClock. A task sleeping on the virtual
+            clock yields tick by tick till the driver advanced the time
+            past its wakeup, so all tasks see the same time and keep
+            their own periods. This allows host tests to run simulated
+            hours in milliseconds.
+
+  @param    startTime Start time of the virtual clock [us]
+ */
+void useVirtualClock(uint64_t startTime = 0);
+
+/*! ******************************************************************
+  @brief    Advance the virtual clock
+  @details  This function will advance the virtual clock by the given
+            time. It has no effect on the hardware clock.
+
+  @param    duration Time to advance [us]
+ */
+void advanceVirtualClock(uint64_t duration);
+
+/*! ******************************************************************
+  @brief    Get the current time in microseconds
+  @return   uint64_t monotonic time since start [us]
+ */
+uint64_t clockMicros(void);
+
+/*! ******************************************************************
+  @brief    Get the current time in milliseconds
+  @return   uint64_t monotonic time since start [ms]
+ */
+uint64_t clockMillis(void);
+
+/*! ******************************************************************
+  @brief    Check if a timeout is elapsed
+  @details  This function will check if more than the given timeout
+            has passed since the given timestamp.
+
+  @param    timestamp Timestamp of the event [us]
+  @param    timeoutMs Timeout [ms]
+  @return   bool true if timed out, false if not
+ */
+bool clockIsElapsed(uint64_t timestamp, uint32_t timeoutMs);
+
+/*! ******************************************************************
+  @brief    Suspend the calling task
+  @details  This function will suspend the calling task for the given
+            time using the active clock source.
+
+  @param    ms Time to sleep [ms]
+ */
+void clockSleepMs(uint32_t ms);
+
+/*! ******************************************************************
+  @brief    Suspend the calling task till the next period
+  @details  This function will suspend the calling task till the next
+            period is reached. In contrast to \ref clockSleepMs the
+            runtime of the task is taken into account, so the task
+            runs at a fixed rate. If the period is already missed the
+            schedule is restarted from now.
+
+  @param    nextWakeTime Time of the next wakeup, updated by this
+            function [us]. Initialize with 0.
+  @param    periodMs Period of the task [ms]
+ */
+void clockSleepUntil(uint64_t &nextWakeTime, uint32_t periodMs);
+
+/*! ******************************************************************
+  @brief    Suspend the calling task till the next period or a notification
+  @details  Like \ref clockSleepUntil, but the task is woken up early by
+            a FreeRTOS task notification. After an early wakeup the next
+            call sleeps for the rest of the same period, so the fixed
+            rate of the task is kept. On the virtual clock the task
+            waits for the notification till the driver advanced the time
+            to the end of the period.
+
+  @param    nextWakeTime Time of the next wakeup, updated by this
+            function [us]. Initialize with 0.
+  @param    periodMs Period of the task [ms]
+  @return   bool true if woken up by a notification
+ */
+bool clockSleepUntilNotified(uint64_t &nextWakeTime, uint32_t periodMs);
+
+#endif // _SYSCLOCK_H_
@@ -0,0 +1,160 @@
+/*!
+ * \file taskMonitor.h
+ * \brief Runtime statistics of the FreeRTOS tasks
+ *
+ * This file contains the functions for recording the runtime behaviour
+ * of the speedometer tasks. For every task the run time per cycle,
+ * the number of interruptions by other tasks, missed periods and the
+ * time spent waiting for the \ref SerialOutputMutex are recorded.
+ * The run time and the interruptions are taken from the run time
+ * counters of the FreeRTOS scheduler, so a task blocking in the middle
+ * of its cycle, e.g. on a mutex, is neither charged with the time of
+ * the other tasks nor counted as interrupted by a task it gave way to.
+ * All other times are taken from the clock in \ref sysClock.h.
+ *
+ * \author Matthias Werner
+ * \date   October 2026
+ * \version 0.1
+ *
+ *
+ */
+
+#ifndef _TASKMONITOR_H_
+#define _TASKMONITOR_H_
+
+#include <hardwareDef.h>
+#include <sysClock.h>
+
+/*! ******************************************************************
+  @enum   tTaskId
+  @brief  Identifier of the monitored tasks
+ */
+typedef enum
+{
+  TASK_ID_UPDATE_N2K = 0,
+  TASK_ID_UPDATE_DISPLAY,
+  TASK_ID_SET_DISPLAY_BRIGHTNESS,
+  TASK_ID_SHOW_N2K_STATISTICS,
+  /// Number of monitored tasks
+  TASK_ID_COUNT
+} tTaskId;
+
+/// Maximum number of FreeRTOS tasks read for the run time statistics
+#define TASK_MONITOR_MAX_TASKS 24
+
+/*! ******************************************************************
+  @struct tTaskRunTimes
+  @brief  Structure for the run time counters at one point in time
+ */
+typedef struct
+{
+  /// Time of the reading [us]
+  uint64_t Now;
+  /// Sum of the counters of all other tasks pinned to the core of the caller
+  uint32_t Others;
+  /// Counters of the monitored tasks
+  uint32_t Tasks[TASK_ID_COUNT];
+} tTaskRunTimes;
+
+/*! ******************************************************************
+  @struct tTaskStatistics
+  @brief  Structure for the runtime statistics of one task
+ */
+typedef struct
+{
+  /// FreeRTOS handle of the task
+  TaskHandle_t Handle;
+  /// Priority of the task
+  UBaseType_t Priority;
+  /// Period of the task [ms]
+  uint32_t Period;
+  /// Number of finished cycles
+  uint32_t Cycles;
+  /// Accumulated run time of all cycles [us]
+  uint64_t RunTimeTotal;
+  /// Maximum run time of one cycle [us]
+  uint32_t RunTimeMax;
+  /// Number of cycles interrupted by a task of higher priority
+  uint32_t Preemptions;
+  /// Tasks which interrupted a cycle, one bit per \ref tTaskId
+  uint8_t PreemptedBy;
+  /// Number of cycles which took longer than the period
+  uint32_t PeriodOverruns;
+  /// Number of times the Serial output mutex was taken
+  uint32_t MutexTakes;
+  /// Number of times the Serial output mutex could not be taken
+  uint32_t MutexTimeouts;
+  /// Accumulated wait time for the Serial output mutex [us]
+  uint64_t MutexWaitTotal;
+  /// Maximum wait time for the Serial output mutex [us]
+  uint32_t MutexWaitMax;
+  /// Start time of the running cycle [us], 0 if no cycle is running
+  uint64_t CycleStart;
+  /// Run time counters at the start of the running cycle
+  tTaskRunTimes CycleRunTimes;
+  /// Run time counters at the start could be read
+  bool CycleRunTimesValid;
+} tTaskStatistics;
+
+/// Mutex to protect the Serial output for tread safety
+extern SemaphoreHandle_t SerialOutputMutex;
+
+/*! ******************************************************************
+  @brief    Register a task for monitoring
+  @param    id Identifier of the task
+  @param    handle FreeRTOS handle of the task
+  @param    periodMs Period of the task [ms]
+ */
+void taskMonitorRegister(tTaskId id, TaskHandle_t handle, uint32_t periodMs);
+
+/*! ******************************************************************
+  @brief    Mark the start of a task cycle
+  @details  This function has to be called by the task right after
+            waking up. The run time counters of all tasks on the core
+            of the caller are taken as the reference of the cycle.
+  @param    id Identifier of the task
+ */
+void taskMonitorCycleStart(tTaskId id);
+
+/*! ******************************************************************
+  @brief    Mark the end of a task cycle
+  @details  This function has to be called by the task right before
+            going to sleep. The run time of the cycle is its wall time
+            without the time the other tasks pinned to the same core
+            ran, tasks without affinity are not taken into account.
+            Without run time statistics or with more than
+            @ref TASK_MONITOR_MAX_TASKS tasks the wall time is taken.
+            The cycle counts as interrupted if
+            a monitored task of higher priority ran meanwhile. Tasks of
+            the same or lower priority are not counted, they run mostly
+            because this task blocked.
+  @param    id Identifier of the task
+ */
+void taskMonitorCycleEnd(tTaskId id);
+
+/*! ******************************************************************
+  @brief    Take the Serial output mutex
+  @details  This function will take the \ref SerialOutputMutex and
+            record the wait time for the calling task.
+  @return   bool true if the mutex was taken, false if not
+ */
+bool takeSerialOutputMutex(void);
+
+/*! ******************************************************************
+  @brief    Give the Serial output mutex
+ */
+void giveSerialOutputMutex(void);
+
+/*! ******************************************************************
+  @brief    Get the statistics of a task
+  @param    id Identifier of the task
+  @return   const tTaskStatistics& statistics of the task
+ */
+const tTaskStatistics &getTaskStatistics(tTaskId id);
+
+/*! ******************************************************************
+  @brief    Show the task statistics via Serial
+ */
+void showTaskStatistics(void);
+
+#endif // _TASKMONITOR_H_
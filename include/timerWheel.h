@@ -0,0 +1,113 @@
+/*!
+ * \file timerWheel.h
+ * \brief Hashed timer wheel for the signal timeouts
+ *
+ * This file contains a hashed timer wheel. The timers are nodes owned
+ * by the caller and linked into the slot of their expiry tick, so no
+ * memory is allocated and starting, restarting or stopping a timer is
+ * O(1). Advancing the wheel only visits the slots of the elapsed ticks
+ * instead of scanning all timers.
+ *
+ * \author Matthias Werner
+ * \date   October 2026
+ * \version 0.1
+ *
+ *
+ */
+
+#ifndef _TIMERWHEEL_H_
+#define _TIMERWHEEL_H_
+
+#include <hardwareDef.h>
+#include <sysClock.h>
+
+/// Number of slots of the timer wheel
+#define TIMER_WHEEL_SLOTS 32
+
+/*! ******************************************************************
+  @struct tTimerWheelNode
+  @brief  Structure for one timer of the timer wheel
+ */
+typedef struct tTimerWheelNode
+{
+  /// Next timer in the slot
+  struct tTimerWheelNode *Next;
+  /// Previous timer in the slot
+  struct tTimerWheelNode *Prev;
+  /// Tick the timer expires
+  uint32_t ExpiryTick;
+  /// true if the timer is linked into the wheel
+  bool Active;
+  /// Function called when the timer expires
+  void (*Expired)(struct tTimerWheelNode *Node);
+  /// Context of the owner of the timer
+  void *Context;
+} tTimerWheelNode;
+
+/*! ******************************************************************
+  @class  TimerWheel
+  @brief  Class for a hashed timer wheel
+
+  This class sorts the timers into @ref TIMER_WHEEL_SLOTS slots by
+  their expiry tick. Timers longer than one revolution of the wheel
+  stay in their slot till the expiry tick is reached. The expiry
+  functions are called from \ref Advance, i.e. in the task advancing
+  the wheel.
+ */
+class TimerWheel
+{
+public:
+  /*! ******************************************************************
+    @brief Constructor
+    @param TickMs Resolution of the timer wheel [ms]
+   */
+  TimerWheel(uint32_t TickMs);
+
+  /*! ******************************************************************
+    @brief Init a timer node
+    @param Node Timer node
+    @param Expired Function called when the timer expires
+    @param Context Context of the owner of the timer
+   */
+  static void InitNode(tTimerWheelNode *Node, void (*Expired)(tTimerWheelNode *Node), void *Context);
+
+  /*! ******************************************************************
+    @brief Start or restart a timer
+    @param Node Timer node
+    @param TimeoutMs Timeout [ms]
+    @param now Current time [us]
+   */
+  void Start(tTimerWheelNode *Node, uint32_t TimeoutMs, uint64_t now);
+
+  /*! ******************************************************************
+    @brief Stop a timer
+    @param Node Timer node
+   */
+  void Stop(tTimerWheelNode *Node);
+
+  /*! ******************************************************************
+    @brief Advance the wheel and call the expiry functions
+    @param now Current time [us]
+   */
+  void Advance(uint64_t now);
+
+  /// Get the number of expired timers
+  uint32_t GetExpiredCnt(void);
+
+private:
+  /// Link a timer into the slot of its expiry tick
+  void Link(tTimerWheelNode *Node);
+  /// Unlink a timer from its slot
+  void Unlink(tTimerWheelNode *Node);
+
+  /// Timers sorted by expiry tick
+  tTimerWheelNode *Slots[TIMER_WHEEL_SLOTS];
+  /// Resolution of the timer wheel [us]
+  uint64_t TickUs;
+  /// Last processed tick
+  uint32_t CurrentTick;
+  /// Number of expired timers
+  uint32_t ExpiredCnt;
+};
+
+#endif // _TIMERWHEEL_H_
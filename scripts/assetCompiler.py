@@ -0,0 +1,572 @@
+"""Asset compiler of the speedometer.
+
+Converts the images and fonts listed in graphics/assets.json into C++ sources
+and headers. Every asset gets one source file holding its data in flash
+and one header with the extern declaration, the dimensions and the
+format, so the data is compiled once and no other translation unit has
+to parse it.
+
+Formats of the assets:
+
+  raw         RGB565 pixels, uint16_t per pixel
+  palette     images sharing one palette of up to 256 RGB565 colours,
+              one uint8_t index per pixel, black is index 0, more
+              colours are reduced by median cut
+  compressed  RGB565 stream of rgb565Codec.py, decoded strip by strip
+  atlas4      icons with 4 bits per pixel in one atlas, 0..14 is the
+              brightness of the lamp colour, 15 is transparent
+  font        Adafruit GFX font header, subset to the characters of the
+              asset and stored as runs of background and foreground
+              pixels per glyph, see include/runFont.h
+
+The script runs as PlatformIO pre script, see extra_scripts in
+platformio.ini. It regenerates an asset only if its sources or the
+scripts changed and adds the generated sources to the build.
+
+Usage without PlatformIO:
+  python scripts/assetCompiler.py [<project dir>]
+"""
+
+import json
+import os
+import re
+import struct
+import sys
+import zlib
+
+MANIFEST = os.path.join('graphics', 'assets.json')
+OUTPUT_DIR = '_generated'
+
+ATLAS_TRANSPARENT = 15
+ATLAS_FULL = 14
+
+
+# ---------------------------------------------------------------------------
+# PNG decoder, non interlaced images with 8 or 16 bits per channel or
+# palette and grey images with 1, 2, 4 or 8 bits per pixel
+# ---------------------------------------------------------------------------
+
+def paeth(a, b, c):
+    p = a + b - c
+    pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+    if pa <= pb and pa <= pc:
+        return a
+    return b if pb <= pc else c
+
+
+def unfilter(data, height, stride, bpp):
+    rows = []
+    prior = bytearray(stride)
+    pos = 0
+    for _ in range(height):
+        kind = data[pos]
+        row = bytearray(data[pos + 1:pos + 1 + stride])
+        pos += stride + 1
+        for i in range(stride):
+            left = row[i - bpp] if i >= bpp else 0
+            if kind == 1:
+                row[i] = (row[i] + left) & 0xFF
+            elif kind == 2:
+                row[i] = (row[i] + prior[i]) & 0xFF
+            elif kind == 3:
+                row[i] = (row[i] + ((left + prior[i]) >> 1)) & 0xFF
+            elif kind == 4:
+                upper_left = prior[i - bpp] if i >= bpp else 0
+                row[i] = (row[i] + paeth(left, prior[i], upper_left)) & 0xFF
+            elif kind != 0:
+                raise ValueError('unknown PNG filter %d' % kind)
+        rows.append(row)
+        prior = row
+    return rows
+
+
+def read_png(path):
+    """Return width, height and the pixels as list of (r, g, b, a)."""
+    with open(path, 'rb') as image:
+        data = image.read()
+    if data[:8] != b'\x89PNG\r\n\x1a\n':
+        raise ValueError('%s is no PNG' % path)
+
+    pos = 8
+    idat = bytearray()
+    palette = []
+    alpha = []
+    while pos < len(data):
+        length, kind = struct.unpack('>I4s', data[pos:pos + 8])
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += length + 12
+        if kind == b'IHDR':
+            width, height, depth, color, _, _, interlace = struct.unpack('>IIBBBBB', chunk)
+        elif kind == b'PLTE':
+            palette = [tuple(chunk[i:i + 3]) for i in range(0, length, 3)]
+        elif kind == b'tRNS':
+            alpha = list(chunk)
+        elif kind == b'IDAT':
+            idat += chunk
+        elif kind == b'IEND':
+            break
+
+    if interlace:
+        raise ValueError('%s: interlaced PNG not supported' % path)
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[color]
+    bits = channels * depth
+    stride = (width * bits + 7) // 8
+    rows = unfilter(zlib.decompress(bytes(idat)), height, stride, max(1, bits // 8))
+
+    pixels = []
+    for row in rows:
+        if depth < 8:
+            mask = (1 << depth) - 1
+            samples = [(row[(x * depth) >> 3] >> (8 - depth - ((x * depth) & 7))) & mask for x in range(width)]
+            scale = 255 // mask
+        elif depth == 16:
+            samples = row[0::2]
+            scale = 1
+        else:
+            samples = row
+            scale = 1
+        for x in range(width):
+            s = samples[x * channels:(x + 1) * channels]
+            if color == 3:
+                r, g, b = palette[s[0]]
+                pixels.append((r, g, b, alpha[s[0]] if s[0] < len(alpha) else 255))
+            elif color == 0:
+                grey = s[0] * scale if depth < 8 else s[0]
+                pixels.append((grey, grey, grey, 255))
+            elif color == 4:
+                pixels.append((s[0], s[0], s[0], s[1]))
+            elif color == 2:
+                pixels.append((s[0], s[1], s[2], 255))
+            else:
+                pixels.append(tuple(s))
+    return width, height, pixels
+
+
+# ---------------------------------------------------------------------------
+# GFX font reader
+# ---------------------------------------------------------------------------
+
+def read_gfx_font(path):
+    """Return the bitmaps, the glyphs, first, last and yAdvance of a GFX font header."""
+    with open(path, encoding='latin-1') as header:
+        text = header.read()
+    bitmaps = re.search(r'Bitmaps\[\]\s*PROGMEM\s*=\s*\{(.*?)\};', text, re.S)
+    glyphs = re.search(r'Glyphs\[\]\s*PROGMEM\s*=\s*\{(.*?)\};', text, re.S)
+    font = re.search(r'GFXfont\s+\w+\s+PROGMEM\s*=\s*\{.*?,.*?,\s*(0x[0-9A-Fa-f]+|\d+)\s*,'
+                     r'\s*(0x[0-9A-Fa-f]+|\d+)\s*,\s*(\d+)\s*\}', text, re.S)
+    if bitmaps is None or glyphs is None or font is None:
+        raise ValueError('%s is no GFX font' % path)
+    data = [int(value, 16) for value in re.findall(r'0x[0-9A-Fa-f]+', bitmaps.group(1))]
+    table = [tuple(int(value) for value in entry)
+             for entry in re.findall(r'\{\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+)\s*\}',
+                                     glyphs.group(1))]
+    first, last = int(font.group(1), 0), int(font.group(2), 0)
+    if len(table) != last - first + 1:
+        raise ValueError('%s: %d glyphs, expected %d' % (path, len(table), last - first + 1))
+    return data, table, first, last, int(font.group(3))
+
+
+def glyph_pixels(data, glyph):
+    """Return the pixels of a glyph as list of bool, row by row."""
+    offset, width, height = glyph[0], glyph[1], glyph[2]
+    return [bool(data[offset + (bit >> 3)] & (0x80 >> (bit & 7))) for bit in range(width * height)]
+
+
+def glyph_runs(pixels):
+    """Return the alternating runs of background and foreground pixels, starting with background."""
+    runs = []
+    current = False
+    length = 0
+    for pixel in pixels + [None]:
+        if pixel == current:
+            length += 1
+            continue
+        while length > 255:
+            runs += [255, 0]
+            length -= 255
+        runs.append(length)
+        current = not current
+        length = 1
+    return runs
+
+
+# ---------------------------------------------------------------------------
+# Pixel conversion
+# ---------------------------------------------------------------------------
+
+def to_rgb565(pixel):
+    """Convert a pixel to RGB565, a transparent pixel is blended on black."""
+    r, g, b, a = pixel
+    if a != 255:
+        r, g, b = r * a // 255, g * a // 255, b * a // 255
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+
+
+def to_level(pixel):
+    """Convert a pixel to the 4 bit brightness of the atlas."""
+    r, g, b, a = pixel
+    if a < 128:
+        return ATLAS_TRANSPARENT
+    return min(ATLAS_FULL, ((r * 77 + g * 150 + b * 29) * ATLAS_FULL + 255 * 128) // (255 * 256))
+
+
+def macro_name(name):
+    return re.sub(r'([a-z0-9])([A-Z])', r'\1_\2', name).upper()
+
+
+def hex_lines(values, digits, per_line):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append('\t' + ', '.join('0x%0*x' % (digits, value) for value in values[i:i + per_line]) + ',')
+    return lines
+
+
+def dec_lines(values, per_line):
+    return ['\t' + ', '.join('%d' % value for value in values[i:i + per_line]) + ','
+            for i in range(0, len(values), per_line)]
+
+
+# ---------------------------------------------------------------------------
+# Asset formats, each returns the declarations and the definitions
+# ---------------------------------------------------------------------------
+
+def compile_raw(asset, width, height, pixels):
+    name = asset['name']
+    data = [to_rgb565(pixel) for pixel in pixels]
+    declarations = [
+        '/// Pixels of %s' % name,
+        'extern const uint16_t _%s[];' % name,
+    ]
+    definitions = ['const uint16_t _%s[] PROGMEM = {' % name] + hex_lines(data, 4, 16) + ['};']
+    return declarations, definitions, len(data) * 2
+
+
+def expand_rgb565(color):
+    r, g, b = color >> 11, (color >> 5) & 0x3F, color & 0x1F
+    return (r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2)
+
+
+def color_distance(a, b):
+    return 2 * (a[0] - b[0]) ** 2 + 4 * (a[1] - b[1]) ** 2 + 3 * (a[2] - b[2]) ** 2
+
+
+def quantize(histogram, count):
+    """Reduce the colours of the histogram {rgb565: pixels} to count colours.
+
+    Median cut of the weighted colours, refined by a few k-means rounds.
+    Returns the palette and the palette index of every colour.
+    """
+    colors = sorted(histogram)
+    if len(colors) <= count:
+        return colors, {color: i for i, color in enumerate(colors)}
+
+    points = [(expand_rgb565(color), histogram[color]) for color in colors]
+    boxes = [points]
+    while len(boxes) < count:
+        # Split the box with the largest weighted range along its longest axis
+        def score(box):
+            if len(box) < 2:
+                return -1
+            ranges = [max(p[0][axis] for p in box) - min(p[0][axis] for p in box) for axis in range(3)]
+            return max(ranges) * sum(p[1] for p in box)
+        box = max(boxes, key=score)
+        if score(box) <= 0:
+            break
+        axis = max(range(3), key=lambda a: max(p[0][a] for p in box) - min(p[0][a] for p in box))
+        box.sort(key=lambda p: p[0][axis])
+        half = sum(p[1] for p in box) / 2.0
+        total = 0
+        for split in range(1, len(box)):
+            total += box[split - 1][1]
+            if total >= half:
+                break
+        boxes.remove(box)
+        boxes += [box[:split], box[split:]]
+
+    def mean(box):
+        weight = sum(p[1] for p in box)
+        return tuple(int(round(sum(p[0][axis] * p[1] for p in box) / weight)) for axis in range(3))
+
+    centers = [mean(box) for box in boxes]
+    for _ in range(4):
+        clusters = [[] for _ in centers]
+        for point in points:
+            clusters[min(range(len(centers)), key=lambda i: color_distance(point[0], centers[i]))].append(point)
+        centers = [mean(cluster) if cluster else center for cluster, center in zip(clusters, centers)]
+
+    palette = [((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3) for r, g, b in centers]
+    mapping = {}
+    for color, (rgb, _) in zip(colors, points):
+        mapping[color] = min(range(len(centers)), key=lambda i: color_distance(rgb, centers[i]))
+    return palette, mapping
+
+
+def compile_palette(asset, images):
+    """Images sharing one palette, black is always index 0."""
+    name = asset['name']
+    converted = [(source, width, height, [to_rgb565(pixel) for pixel in pixels])
+                 for source, (width, height, pixels) in images]
+    histogram = {}
+    for _, _, _, data in converted:
+        for color in data:
+            if color != 0:
+                histogram[color] = histogram.get(color, 0) + 1
+    colors, mapping = quantize(histogram, asset.get('colors', 256) - 1)
+    colors = [0] + colors
+    mapping = {color: index + 1 for color, index in mapping.items()}
+    mapping[0] = 0
+
+    declarations = [
+        '/// Number of colours of %s' % name,
+        '#define ASSET_%s_COLORS %d' % (macro_name(name), len(colors)),
+        '',
+        '/// Palette of %s' % name,
+        'extern const uint16_t _%sPalette[];' % name,
+    ]
+    definitions = ['const uint16_t _%sPalette[] PROGMEM = {' % name] + hex_lines(colors, 4, 16) + ['};']
+    size = len(colors) * 2
+    for source, width, height, data in converted:
+        image = os.path.splitext(os.path.basename(source))[0]
+        declarations += [
+            '',
+            '/// Width of %s [px]' % image,
+            '#define ASSET_%s_WIDTH %d' % (macro_name(image), width),
+            '/// Height of %s [px]' % image,
+            '#define ASSET_%s_HEIGHT %d' % (macro_name(image), height),
+            '/// Palettized image %s' % image,
+            'extern const tPalettedImage %sImage;' % image,
+        ]
+        definitions += ['', 'static const uint8_t _%s[] PROGMEM = {' % image]
+        definitions += hex_lines([mapping[color] for color in data], 2, 16) + ['};', '']
+        definitions.append('const tPalettedImage %sImage = {_%sPalette, _%s, %d, %d, %d};'
+                           % (image, name, image, len(colors), width, height))
+        size += width * height
+    return declarations, definitions, size
+
+
+def compile_compressed(asset, width, height, pixels):
+    name = asset['name']
+    data = [to_rgb565(pixel) for pixel in pixels]
+    stream, offsets = rgb565Codec.encode(data, width, height)
+    if rgb565Codec.decode(stream, offsets, width, height) != data:
+        raise ValueError('round trip of %s failed' % name)
+    declarations = [
+        '/// Compressed image %s' % name,
+        'extern const tCompressedImage %sImage;' % name,
+    ]
+    definitions = ['static const uint8_t _%s[] PROGMEM = {' % name] + hex_lines(stream, 2, 16) + ['};', '']
+    definitions += ['static const uint32_t _%sStrips[] PROGMEM = {' % name] + dec_lines(offsets, 8) + ['};', '']
+    definitions.append('const tCompressedImage %sImage = {_%s, _%sStrips, sizeof(_%s), %d, %d};'
+                       % (name, name, name, name, width, height))
+    return declarations, definitions, len(stream) + len(offsets) * 4
+
+
+def compile_atlas4(asset, images):
+    name = asset['name']
+    prefix = asset.get('prefix', macro_name(name) + '_')
+    data = []
+    declarations = []
+    icons = []
+    for source, (width, height, pixels) in images:
+        if width & 1:
+            raise ValueError('%s: width of an atlas icon has to be even' % source)
+        icon = prefix + macro_name(os.path.splitext(os.path.basename(source))[0])
+        icons.append('const tLampIcon %s = {%d, %d, %d};' % (icon, len(data), width, height))
+        declarations.append('extern const tLampIcon %s;' % icon)
+        levels = [to_level(pixel) for pixel in pixels]
+        data += [(levels[i] << 4) | levels[i + 1] for i in range(0, len(levels), 2)]
+    if len(data) > 0xFFFF:
+        raise ValueError('%s exceeds 64 kB' % name)
+    declarations = ['/// Icon atlas %s' % name, 'extern const uint8_t _%s[];' % name, ''] + declarations
+    definitions = ['const uint8_t _%s[] PROGMEM = {' % name] + hex_lines(data, 2, 16) + ['};', ''] + icons
+    return declarations, definitions, len(data)
+
+
+def compile_font(asset, font):
+    name = asset['name']
+    data, table, first, last, y_advance = font
+    chars = sorted(set(asset['chars']))
+    for char in chars:
+        if not first <= ord(char) <= last:
+            raise ValueError('%s has no glyph for %r' % (name, char))
+
+    # Ascent and descent of the full font as calculated by TFT_eSPI, so
+    # the text stays at the same position as with the GFX font
+    ascent = max([0] + [-glyph[5] for glyph in table[:-1]])
+    descent = max([0] + [glyph[2] + glyph[5] for glyph in table[:-1]])
+
+    runs = []
+    glyphs = []
+    gfx_bitmaps = []
+    gfx_glyphs = []
+    for code in range(first, last + 1):
+        glyph = table[code - first]
+        if chr(code) in chars:
+            glyphs.append('\t{%d, %d, %d, %d, %d, %d}, // %r' % ((len(runs),) + glyph[1:] + (chr(code),)))
+            runs += glyph_runs(glyph_pixels(data, glyph))
+        if chars[0] <= chr(code) <= chars[-1]:
+            if chr(code) in chars:
+                size = (glyph[1] * glyph[2] + 7) // 8
+                gfx_glyphs.append('\t{%d, %d, %d, %d, %d, %d},' % ((len(gfx_bitmaps),) + glyph[1:]))
+                gfx_bitmaps += data[glyph[0]:glyph[0] + size]
+            else:
+                gfx_glyphs.append('\t{0, 0, 0, 0, 0, 0},')
+
+    # Runs, glyph table, characters and font structure against bitmaps, glyph table and font structure
+    size = len(runs) + len(chars) * 8 + len(chars) + 1 + 16
+    source_size = len(data) + len(table) * 8 + 16
+    print('Font %s: %d -> %d glyphs, %d -> %d bytes (-%d%%)'
+          % (name, len(table), len(chars), source_size, size, 100 - 100 * size // source_size))
+
+    chars_literal = ''.join(chars).replace('\\', '\\\\').replace('"', '\\"')
+    declarations = [
+        '/// Characters of %s' % name,
+        '#define ASSET_%s_CHARS "%s"' % (macro_name(name), chars_literal),
+        '/// Size of the full GFX font [bytes]',
+        '#define ASSET_%s_SOURCE_SIZE %d' % (macro_name(name), source_size),
+        '',
+        '/// Run length font %s' % name,
+        'extern const tRunFont %s;' % name,
+        '',
+        '#if FONT_BENCHMARK',
+        '#include <TFT_eSPI.h>',
+        '/// GFX font %s with the same glyphs, only for the benchmark' % name,
+        'extern const GFXfont %sGfx;' % name,
+        '#endif // FONT_BENCHMARK',
+    ]
+    definitions = ['static const uint8_t _%sRuns[] PROGMEM = {' % name] + dec_lines(runs, 16) + ['};', '']
+    definitions += ['static const tRunGlyph _%sGlyphs[] PROGMEM = {' % name] + glyphs + ['};', '']
+    definitions.append('const tRunFont %s = {_%sRuns, _%sGlyphs, "%s", %d, %d, %d, %d};'
+                       % (name, name, name, chars_literal, len(chars), ascent, descent, y_advance))
+    definitions += [
+        '',
+        '#if FONT_BENCHMARK',
+        'static const uint8_t _%sGfxBitmaps[] PROGMEM = {' % name,
+    ] + hex_lines(gfx_bitmaps, 2, 16) + [
+        '};',
+        '',
+        'static const GFXglyph _%sGfxGlyphs[] PROGMEM = {' % name,
+    ] + gfx_glyphs + [
+        '};',
+        '',
+        'const GFXfont %sGfx PROGMEM = {(uint8_t *)_%sGfxBitmaps, (GFXglyph *)_%sGfxGlyphs, 0x%02X, 0x%02X, %d};'
+        % (name, name, name, ord(chars[0]), ord(chars[-1]), y_advance),
+        '#endif // FONT_BENCHMARK',
+    ]
+    width = max(table[ord(char) - first][1] for char in chars)
+    return declarations, definitions, size, width, y_advance
+
+
+FORMATS = {
+    'raw': ('ASSET_FORMAT_RAW', compile_raw),
+    'palette': ('ASSET_FORMAT_PALETTE', compile_palette),
+    'compressed': ('ASSET_FORMAT_COMPRESSED', compile_compressed),
+    'atlas4': ('ASSET_FORMAT_ATLAS4', compile_atlas4),
+    'font': ('ASSET_FORMAT_RUN_FONT', compile_font),
+}
+
+
+# ---------------------------------------------------------------------------
+# Generation of the sources
+# ---------------------------------------------------------------------------
+
+def write_if_changed(path, lines):
+    text = '\n'.join(lines) + '\n'
+    if os.path.exists(path):
+        with open(path, 'r') as current:
+            if current.read() == text:
+                return
+    with open(path, 'w', newline='\n') as output:
+        output.write(text)
+
+
+def compile_asset(project, asset, output):
+    name = asset['name']
+    sources = asset.get('sources', [asset.get('source')])
+    paths = [os.path.join(project, 'graphics', source) for source in sources]
+    header = os.path.join(output, name + '.h')
+    scripts = [os.path.join(project, 'scripts', script) for script in ('assetCompiler.py', 'rgb565Codec.py')]
+    inputs = paths + scripts + [os.path.join(project, MANIFEST)]
+    if os.path.exists(header) and os.path.getmtime(header) >= max(os.path.getmtime(path) for path in inputs):
+        return False
+
+    format_macro, compiler = FORMATS[asset['format']]
+    if asset['format'] == 'font':
+        declarations, definitions, size, width, height = compiler(asset, read_gfx_font(paths[0]))
+    elif asset['format'] in ('atlas4', 'palette'):
+        images = [(source, read_png(path)) for source, path in zip(sources, paths)]
+        declarations, definitions, size = compiler(asset, images)
+        width = max(image[0] for _, image in images)
+        height = sum(image[1] for _, image in images)
+    else:
+        width, height, pixels = read_png(paths[0])
+        declarations, definitions, size = compiler(asset, width, height, pixels)
+
+    folders = set(os.path.dirname(source) for source in sources)
+    if len(sources) > 1 and len(folders) == 1 and '' not in folders:
+        origin = 'graphics/%s/*.png' % folders.pop()
+    else:
+        origin = ', '.join('graphics/' + source for source in sources)
+    macro = macro_name(name)
+    guard = '_%s_ASSET_H_' % macro
+    write_if_changed(os.path.join(output, name + '.cpp'), [
+        '// Generated by scripts/assetCompiler.py from %s, do not edit' % origin,
+        '#include "%s.h"' % name,
+        '',
+    ] + definitions)
+    write_if_changed(header, [
+        '// Generated by scripts/assetCompiler.py from %s, do not edit' % origin,
+        '#ifndef %s' % guard,
+        '#define %s' % guard,
+        '',
+        '#include <assetTypes.h>',
+        '',
+        '/// Width of %s [px]' % name,
+        '#define ASSET_%s_WIDTH %d' % (macro, width),
+        '/// Height of %s [px]' % name,
+        '#define ASSET_%s_HEIGHT %d' % (macro, height),
+        '/// Format of %s' % name,
+        '#define ASSET_%s_FORMAT %s' % (macro, format_macro),
+        '/// Size of %s in flash [bytes]' % name,
+        '#define ASSET_%s_SIZE %d' % (macro, size),
+        '',
+    ] + declarations + [
+        '',
+        '#endif // %s' % guard,
+    ])
+    # Touch the header, so an unchanged asset is not compiled again next time
+    os.utime(header, None)
+    print('Asset %s: %s %dx%d, %d bytes' % (name, asset['format'], width, height, size))
+    return True
+
+
+def compile_assets(project):
+    output = os.path.join(project, OUTPUT_DIR)
+    if not os.path.isdir(output):
+        os.makedirs(output)
+    with open(os.path.join(project, MANIFEST)) as manifest:
+        assets = json.load(manifest)['assets']
+    for asset in assets:
+        compile_asset(project, asset, output)
+    return output
+
+
+try:
+    Import('env')  # noqa: F821, provided by PlatformIO
+except NameError:
+    env = None
+
+if env is not None:
+    PROJECT_DIR = env.subst('$PROJECT_DIR')
+    sys.path.insert(0, os.path.join(PROJECT_DIR, 'scripts'))
+    import rgb565Codec
+
+    generated = compile_assets(PROJECT_DIR)
+    env.Append(CPPPATH=[generated])
+    env.BuildSources(os.path.join('$BUILD_DIR', 'assets'), generated)
+
+elif __name__ == '__main__':
+    sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+    import rgb565Codec
+
+    compile_assets(sys.argv[1] if len(sys.argv) > 1 else os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
@@ -0,0 +1,142 @@
+"""Lossless RGB565 image codec of the speedometer.
+
+Encodes RGB565 images into the byte stream decoded by imageDecodeStrip
+(include/imageCodec.h), used by assetCompiler.py. The image is split
+into strips of STRIP_LINES lines, each strip starts with a fresh
+decoder state, so every strip can be decoded on its own.
+
+Ops of the stream, prev is the last pixel, index a table of 64 recently
+seen pixels at hash(pixel):
+
+  00iiiiii              INDEX     pixel = index[i]
+  01nnnnnn              RUN       repeat prev n + 1 times (1..64)
+  10rrggbb              DIFF      r, g, b differ by -2..1 from prev
+  110ggggg rrrrbbbb     LUMA      g differs by -16..15, r and b by -8..7
+  1110nnnn nnnnnnnn     RUN_LONG  repeat prev n + 65 times (65..4160)
+  11111111 hhhhhhhh llllllll RGB  pixel = hhhhhhhh llllllll
+"""
+
+STRIP_LINES = 16
+
+OP_INDEX = 0x00
+OP_RUN = 0x40
+OP_DIFF = 0x80
+OP_LUMA = 0xC0
+OP_RUN_LONG = 0xE0
+OP_RGB = 0xFF
+
+RUN_MAX = 64
+RUN_LONG_MAX = 4160
+
+
+def split(pixel):
+    return pixel >> 11, (pixel >> 5) & 0x3F, pixel & 0x1F
+
+
+def pixel_hash(pixel):
+    r, g, b = split(pixel)
+    return (r * 3 + g * 5 + b * 7) & 0x3F
+
+
+def wrap(value, bits):
+    half = 1 << (bits - 1)
+    return ((value + half) & ((1 << bits) - 1)) - half
+
+
+def encode_strip(pixels):
+    out = bytearray()
+    index = [0] * 64
+    prev = 0
+    run = 0
+
+    def flush_run():
+        nonlocal run
+        while run > 0:
+            if run > RUN_MAX:
+                n = min(run, RUN_LONG_MAX)
+                out.append(OP_RUN_LONG | ((n - RUN_MAX - 1) >> 8))
+                out.append((n - RUN_MAX - 1) & 0xFF)
+            else:
+                n = run
+                out.append(OP_RUN | (n - 1))
+            run -= n
+
+    for pixel in pixels:
+        if pixel == prev:
+            run += 1
+            continue
+        flush_run()
+
+        h = pixel_hash(pixel)
+        if index[h] == pixel:
+            out.append(OP_INDEX | h)
+        else:
+            r, g, b = split(pixel)
+            pr, pg, pb = split(prev)
+            dr, dg, db = wrap(r - pr, 5), wrap(g - pg, 6), wrap(b - pb, 5)
+            if -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+                out.append(OP_DIFF | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2))
+            elif -16 <= dg <= 15 and -8 <= dr <= 7 and -8 <= db <= 7:
+                out.append(OP_LUMA | (dg + 16))
+                out.append(((dr + 8) << 4) | (db + 8))
+            else:
+                out += bytes([OP_RGB, pixel >> 8, pixel & 0xFF])
+            index[h] = pixel
+        prev = pixel
+    flush_run()
+    return out
+
+
+def encode(pixels, width, height):
+    """Return the stream and the offset of every strip."""
+    data = bytearray()
+    offsets = []
+    for y in range(0, height, STRIP_LINES):
+        offsets.append(len(data))
+        lines = min(STRIP_LINES, height - y)
+        data += encode_strip(pixels[y * width:(y + lines) * width])
+    return bytes(data), offsets
+
+
+def decode_strip(data, pos, count):
+    out = []
+    index = [0] * 64
+    prev = 0
+    while len(out) < count:
+        op = data[pos]
+        pos += 1
+        if op == OP_RGB:
+            prev = (data[pos] << 8) | data[pos + 1]
+            pos += 2
+        elif (op & 0xF0) == OP_RUN_LONG:
+            out += [prev] * (((op & 0x0F) << 8 | data[pos]) + RUN_MAX + 1)
+            pos += 1
+            continue
+        elif (op & 0xE0) == OP_LUMA:
+            pr, pg, pb = split(prev)
+            dg = (op & 0x1F) - 16
+            dr = (data[pos] >> 4) - 8
+            db = (data[pos] & 0x0F) - 8
+            pos += 1
+            prev = ((pr + dr) & 0x1F) << 11 | ((pg + dg) & 0x3F) << 5 | ((pb + db) & 0x1F)
+        elif (op & 0xC0) == OP_DIFF:
+            pr, pg, pb = split(prev)
+            prev = (((pr + ((op >> 4) & 3) - 2) & 0x1F) << 11 |
+                    ((pg + ((op >> 2) & 3) - 2) & 0x3F) << 5 |
+                    ((pb + (op & 3) - 2) & 0x1F))
+        elif (op & 0xC0) == OP_RUN:
+            out += [prev] * ((op & 0x3F) + 1)
+            continue
+        else:
+            prev = index[op & 0x3F]
+        index[pixel_hash(prev)] = prev
+        out.append(prev)
+    return out
+
+
+def decode(data, offsets, width, height):
+    pixels = []
+    for strip, offset in enumerate(offsets):
+        lines = min(STRIP_LINES, height - strip * STRIP_LINES)
+        pixels += decode_strip(data, offset, lines * width)
+    return pixels
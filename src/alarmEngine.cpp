@@ -0,0 +1,248 @@
+/*!
+ * \file alarmEngine.cpp
+ * \brief Table driven engine alarms
+ *
+ * This file contains the alarm table, the evaluation with hysteresis
+ * and delay and the wake up of the display task.
+ *
+ */
+
+#include <alarmEngine.h>
+#include <latencyMonitor.h>
+
+#include <atomic>
+
+/*! ******************************************************************
+  @struct tAlarmDefinition
+  @brief  Structure for one entry of the alarm table
+ */
+typedef struct
+{
+  /// Name of the alarm
+  const char *Name;
+  /// Evaluated signal
+  tSignalId Signal;
+  /// Condition raising the alarm
+  tAlarmCondition Condition;
+  /// Threshold [raw units] or bit mask
+  int32_t Threshold;
+  /// Hysteresis [raw units]
+  int32_t Hysteresis;
+  /// Time [ms] the condition has to last till the alarm is raised
+  uint32_t DelayMs;
+  /// Only active while the engine runs
+  bool WhenRunning;
+} tAlarmDefinition;
+
+/*! ******************************************************************
+  @struct tAlarmState
+  @brief  Structure for the state of one alarm of one engine instance
+ */
+typedef struct
+{
+  /// true while the condition lasts but the delay is not yet elapsed
+  bool Pending;
+  /// Time the condition was met first [us]
+  uint64_t PendingSince;
+} tAlarmState;
+
+//******************************************************************
+// Init Global Variables
+//******************************************************************
+/// Alarm table, generated from ALARM_LIST
+static const tAlarmDefinition AlarmTable[ALARM_COUNT] = {
+#define ALARM_ENTRY(Name, Signal, Condition, Threshold, Hysteresis, DelayMs, WhenRunning) \
+  {#Name, SIGNAL_ID_##Signal, Condition, Threshold, Hysteresis, DelayMs, WhenRunning},
+    ALARM_LIST(ALARM_ENTRY)
+#undef ALARM_ENTRY
+};
+
+/// State of all alarms
+static tAlarmState AlarmStates[ALARM_COUNT][N2K_MAX_ENGINE_INSTANCES];
+/// Active alarms per engine instance
+static std::atomic<uint32_t> ActiveAlarms[N2K_MAX_ENGINE_INSTANCES];
+/// Number of raised alarms
+static uint32_t RaisedCnt = 0;
+/// Task to wake up on a change of a displayed alarm
+static TaskHandle_t AlarmNotifyTask = nullptr;
+
+//******************************************************************
+// Check if an engine instance is shown on the display
+//******************************************************************
+static bool IsDisplayed(uint8_t Instance)
+{
+  return (Instance == DISPLAY_ENGINE_INSTANCE) ||
+         (DISPLAY_TWIN_ENGINE && (Instance == DISPLAY_SECOND_ENGINE_INSTANCE));
+}
+
+//******************************************************************
+// Init the alarms
+//******************************************************************
+void alarmInit(TaskHandle_t NotifyTask)
+{
+  memset(AlarmStates, 0, sizeof(AlarmStates));
+  for (uint8_t instance = 0; instance < N2K_MAX_ENGINE_INSTANCES; instance++)
+  {
+    ActiveAlarms[instance].store(0);
+  }
+  RaisedCnt = 0;
+  AlarmNotifyTask = NotifyTask;
+}
+
+//******************************************************************
+// Evaluate the alarms of an engine instance
+//******************************************************************
+void alarmEvaluate(uint8_t Instance, uint64_t now)
+{
+  uint32_t previous;
+  uint32_t active;
+  tSignalValue speed;
+  tSignalValue value;
+  bool running;
+  bool raise;
+  bool clear;
+
+  if (Instance >= N2K_MAX_ENGINE_INSTANCES)
+  {
+    return;
+  }
+
+  previous = ActiveAlarms[Instance].load(std::memory_order_relaxed);
+  active = previous;
+
+  // Raw engine speed is given in 0.25 rpm
+  speed = EngineSpeedSignal::GetValue(Instance);
+  running = signalHasValue(speed) && (speed.Raw > ALARM_ENGINE_RUNNING_RPM * 4);
+
+  for (uint8_t id = 0; id < ALARM_COUNT; id++)
+  {
+    const tAlarmDefinition &alarm = AlarmTable[id];
+    tAlarmState &state = AlarmStates[id][Instance];
+
+    value = signalRegistryGetValue(alarm.Signal, Instance);
+
+    // A lost signal keeps the last state of its alarm
+    if (value.Quality == SIGNAL_STALE)
+    {
+      state.Pending = false;
+      continue;
+    }
+
+    if ((value.Quality != SIGNAL_VALID) || (alarm.WhenRunning && !running))
+    {
+      raise = false;
+      clear = true;
+    }
+    else
+    {
+      switch (alarm.Condition)
+      {
+      case ALARM_ABOVE:
+        raise = value.Raw > alarm.Threshold;
+        clear = value.Raw < alarm.Threshold - alarm.Hysteresis;
+        break;
+      case ALARM_BELOW:
+        raise = value.Raw < alarm.Threshold;
+        clear = value.Raw > alarm.Threshold + alarm.Hysteresis;
+        break;
+      default:
+        raise = (value.Raw & alarm.Threshold) != 0;
+        clear = !raise;
+        break;
+      }
+    }
+
+    if (active & ALARM_BIT(id))
+    {
+      if (clear)
+      {
+        active &= ~ALARM_BIT(id);
+      }
+    }
+    else if (raise)
+    {
+      // Raise the alarm after the condition lasted for the delay
+      if (!state.Pending)
+      {
+        state.Pending = true;
+        state.PendingSince = now;
+      }
+      if (now - state.PendingSince >= CLOCK_MS_TO_US(alarm.DelayMs))
+      {
+        state.Pending = false;
+        active |= ALARM_BIT(id);
+        RaisedCnt++;
+      }
+    }
+    else
+    {
+      state.Pending = false;
+    }
+  }
+
+  if (active == previous)
+  {
+    return;
+  }
+  ActiveAlarms[Instance].store(active, std::memory_order_release);
+
+  // Render a displayed alarm out of cycle
+  if (IsDisplayed(Instance))
+  {
+    if (active & ~previous)
+    {
+      latencyAlarmRaised(now);
+    }
+    if (AlarmNotifyTask != nullptr)
+    {
+      xTaskNotifyGive(AlarmNotifyTask);
+    }
+  }
+}
+
+//******************************************************************
+// Get the active alarms of an engine instance
+//******************************************************************
+uint32_t alarmGetActive(uint8_t Instance)
+{
+  return (Instance < N2K_MAX_ENGINE_INSTANCES) ? ActiveAlarms[Instance].load(std::memory_order_acquire) : 0;
+}
+
+//******************************************************************
+// Get the name of an alarm
+//******************************************************************
+const char *alarmGetName(tAlarmId Id)
+{
+  return (Id < ALARM_COUNT) ? AlarmTable[Id].Name : "";
+}
+
+//******************************************************************
+// Show the active alarms via Serial
+//******************************************************************
+void alarmShow(void)
+{
+  uint32_t active;
+
+  Serial.print("  Alarms raised: ");
+  Serial.println(RaisedCnt);
+  for (uint8_t instance = 0; instance < N2K_MAX_ENGINE_INSTANCES; instance++)
+  {
+    active = alarmGetActive(instance);
+    if (active == 0)
+    {
+      continue;
+    }
+    Serial.print("  Engine ");
+    Serial.print(instance);
+    Serial.print(" active:");
+    for (uint8_t id = 0; id < ALARM_COUNT; id++)
+    {
+      if (active & ALARM_BIT(id))
+      {
+        Serial.print(" ");
+        Serial.print(AlarmTable[id].Name);
+      }
+    }
+    Serial.println();
+  }
+}
@@ -0,0 +1,202 @@
+/*!
+ * \file bandRenderer.cpp
+ * \brief Composition of the frame in horizontal bands
+ *
+ * This file contains the display list and the rendering of the frame
+ * band by band on the palette canvas.
+ *
+ */
+
+#include <bandRenderer.h>
+#include <runFont.h>
+
+//************************************************
+// Constructor
+BandRenderer::BandRenderer(TFT_eSPI *Tft, PaletteCanvas *Canvas)
+{
+  this->Tft = Tft;
+  this->Canvas = Canvas;
+  Count = 0;
+}
+
+//************************************************
+// Remove all commands of the display list
+void BandRenderer::Clear(void)
+{
+  Count = 0;
+}
+
+//************************************************
+// Get the next free command
+tBandCommand *BandRenderer::NextCommand(uint8_t Type, int16_t x, int16_t y, int16_t Top, int16_t Bottom)
+{
+  tBandCommand *command;
+
+  if (Count >= BAND_RENDERER_COMMANDS)
+  {
+    return nullptr;
+  }
+  command = &Commands[Count++];
+  command->Type = Type;
+  command->x = x;
+  command->y = y;
+  command->Top = Top;
+  command->Bottom = Bottom;
+  return command;
+}
+
+//************************************************
+// Add a rectangle of a palettized image
+bool BandRenderer::AddImage(const tPalettedImage &Image, int16_t x, int16_t y, int16_t sx, int16_t sy, int16_t w,
+                            int16_t h)
+{
+  tBandCommand *command = NextCommand(BAND_COMMAND_IMAGE, x, y, y, y + h - 1);
+
+  if (command == nullptr)
+  {
+    return false;
+  }
+  command->Image.Image = &Image;
+  command->Image.sx = sx;
+  command->Image.sy = sy;
+  command->Image.w = w;
+  command->Image.h = h;
+  return true;
+}
+
+//************************************************
+// Add a palettized image rotated around its pivot
+bool BandRenderer::AddRotated(const tPalettedImage &Image, int16_t PivotX, int16_t PivotY, int16_t x, int16_t y,
+                              int16_t Angle, uint8_t Transparent)
+{
+  // The image stays within the distance of its farthest corner from the pivot
+  int16_t dx = (PivotX > Image.Width - PivotX) ? PivotX : Image.Width - PivotX;
+  int16_t dy = (PivotY > Image.Height - PivotY) ? PivotY : Image.Height - PivotY;
+  int16_t radius = (int16_t)ceilf(sqrtf((float)dx * dx + (float)dy * dy)) + 1;
+  tBandCommand *command = NextCommand(BAND_COMMAND_ROTATED, x, y, y - radius, y + radius);
+
+  if (command == nullptr)
+  {
+    return false;
+  }
+  command->Rotated.Image = &Image;
+  command->Rotated.PivotX = PivotX;
+  command->Rotated.PivotY = PivotY;
+  command->Rotated.Angle = Angle;
+  command->Rotated.Transparent = Transparent;
+  return true;
+}
+
+//************************************************
+// Add an anti aliased arc with round ends
+bool BandRenderer::AddArc(int16_t x, int16_t y, int16_t r, int16_t ir, uint16_t StartAngle, uint16_t EndAngle,
+                          uint8_t Ramp, uint8_t Levels)
+{
+  tBandCommand *command = NextCommand(BAND_COMMAND_ARC, x, y, y - r - 1, y + r + 1);
+
+  if (command == nullptr)
+  {
+    return false;
+  }
+  command->Arc.r = r;
+  command->Arc.ir = ir;
+  command->Arc.StartAngle = StartAngle;
+  command->Arc.EndAngle = EndAngle;
+  command->Arc.Ramp = Ramp;
+  command->Arc.Levels = Levels;
+  return true;
+}
+
+//************************************************
+// Add a text
+bool BandRenderer::AddText(const tRunFont &Font, const char *Text, int16_t x, int16_t y, uint8_t Datum, uint8_t Index)
+{
+  // Any datum keeps the text within one line height of y
+  tBandCommand *command = NextCommand(BAND_COMMAND_TEXT, x, y, y - Font.YAdvance, y + Font.YAdvance);
+
+  if (command == nullptr)
+  {
+    return false;
+  }
+  command->Text.Font = &Font;
+  strncpy(command->Text.Text, Text, BAND_RENDERER_TEXT_LENGTH - 1);
+  command->Text.Text[BAND_RENDERER_TEXT_LENGTH - 1] = '\0';
+  command->Text.Datum = Datum;
+  command->Text.Index = Index;
+  return true;
+}
+
+//************************************************
+// Add an icon of an icon atlas
+bool BandRenderer::AddIcon(const tLampIcon &Icon, const uint8_t *Atlas, int16_t x, int16_t y, uint8_t Ramp)
+{
+  tBandCommand *command = NextCommand(BAND_COMMAND_ICON, x, y, y, y + Icon.Height - 1);
+
+  if (command == nullptr)
+  {
+    return false;
+  }
+  command->Icon.Icon = &Icon;
+  command->Icon.Atlas = Atlas;
+  command->Icon.Ramp = Ramp;
+  return true;
+}
+
+//************************************************
+// Draw one command onto the band of the canvas
+void BandRenderer::Draw(const tBandCommand &Command)
+{
+  switch (Command.Type)
+  {
+  case BAND_COMMAND_IMAGE:
+    Canvas->PushImage(Command.x, Command.y, *Command.Image.Image, Command.Image.sx, Command.Image.sy, Command.Image.w,
+                      Command.Image.h);
+    break;
+  case BAND_COMMAND_ROTATED:
+    Canvas->PushRotated(*Command.Rotated.Image, Command.Rotated.PivotX, Command.Rotated.PivotY, Command.x, Command.y,
+                        Command.Rotated.Angle, Command.Rotated.Transparent);
+    break;
+  case BAND_COMMAND_ARC:
+    Canvas->DrawSmoothArc(Command.x, Command.y, Command.Arc.r, Command.Arc.ir, Command.Arc.StartAngle,
+                          Command.Arc.EndAngle, Command.Arc.Ramp, Command.Arc.Levels);
+    break;
+  case BAND_COMMAND_TEXT:
+    runFontDrawString(*Canvas, *Command.Text.Font, Command.Text.Text, Command.x, Command.y, Command.Text.Datum,
+                      Command.Text.Index);
+    break;
+  case BAND_COMMAND_ICON:
+    Canvas->PushIcon(*Command.Icon.Icon, Command.Icon.Atlas, Command.x, Command.y, Command.Icon.Ramp);
+    break;
+  default:
+    break;
+  }
+}
+
+//************************************************
+// Render a rectangle of the frame to the display
+void BandRenderer::Render(int32_t x, int32_t y, int32_t w, int32_t h)
+{
+  int16_t lines = Canvas->GetBandHeight();
+
+  Tft->startWrite();
+  for (int32_t top = y; top < y + h; top += lines)
+  {
+    int32_t bottom = (top + lines < y + h) ? top + lines - 1 : y + h - 1;
+
+    // Compose the band from the commands touching it
+    Canvas->SetBand(top);
+    Canvas->FillSprite(0);
+    for (uint8_t i = 0; i < Count; i++)
+    {
+      if ((Commands[i].Bottom >= top) && (Commands[i].Top <= bottom))
+      {
+        Draw(Commands[i]);
+      }
+    }
+
+    // The DMA of this band overlaps the composition of the next one
+    Canvas->PushSprite(x, top, x, top, w, bottom - top + 1);
+  }
+  Tft->dmaWait();
+  Tft->endWrite();
+}
@@ -7,268 +7,276 @@
  *
  */
 #include "displayCtl.h"
+#include <atomic>
 
 //******************************************************************
 // Init Global Variables
 //******************************************************************
 TFT_eSPI tft = TFT_eSPI();
-TFT_eSprite needle = TFT_eSprite(&tft);
-TFT_eSprite background = TFT_eSprite(&tft);
-TFT_eSprite textSprite = TFT_eSprite(&tft);
+PaletteCanvas background = PaletteCanvas(&tft);
+BandRenderer frame = BandRenderer(&tft, &background);
+
+/// Scale of the engine speed, the labels in the colour of the major ticks
+static constexpr tGaugeScale EngineSpeedScale = {
+    0, GAUGE_RPM_MAX, SCALE_ANGLE_START, SCALE_ANGLE_END, GAUGE_RPM_MINOR_STEP, GAUGE_RPM_MAJOR_STEP,
+    GAUGE_RPM_REDLINE, GAUGE_RPM_LABEL_DIVIDER, IWIDTH / 2, IHEIGHT / 2,
+    SCALE_MINOR_INNER, SCALE_MINOR_OUTER, SCALE_MINOR_WIDTH, SCALE_MAJOR_INNER, SCALE_MAJOR_OUTER, SCALE_MAJOR_WIDTH,
+    SCALE_REDLINE_INNER, SCALE_REDLINE_OUTER, SCALE_LABEL_RADIUS, &textFont, PALETTE_SCALE_MAJOR + ARC_RAMP_LEVELS - 1,
+    PALETTE_SCALE_MINOR, PALETTE_SCALE_MAJOR, PALETTE_SCALE_REDLINE, ARC_RAMP_LEVELS};
+
+/// Face with the scale, rendered once at boot and copied into every frame
+static PaletteCanvas ScaleLayer = PaletteCanvas(&tft);
+/// Image of the face with the scale
+static tPalettedImage ScaleImage;
+
+/// Night colours requested by the brightness task
+static std::atomic<bool> NightModeRequested(false);
+/// Night colours of the palette
+static bool NightModeShown = false;
+
+/// Warning lamps sharing the lamp slots, highest priority first
+static constexpr tLampDefinition LampTable[] = {
+    {&LAMP_ICON_OVERHEAT, ALARM_BIT(ALARM_ID_CoolantHigh) | ALARM_BIT(ALARM_ID_OverTemperature) |
+                              ALARM_BIT(ALARM_ID_LowCoolantLevel) | ALARM_BIT(ALARM_ID_WaterFlow),
+     PALETTE_LAMP_RED},
+    {&LAMP_ICON_WARNING, ALARM_BIT(ALARM_ID_EmergencyStopMode) | ALARM_BIT(ALARM_ID_EngineShuttingDown) |
+                             ALARM_BIT(ALARM_ID_WarningLevel2) | ALARM_BIT(ALARM_ID_WarningLevel1) |
+                             ALARM_BIT(ALARM_ID_PowerReduction) | ALARM_BIT(ALARM_ID_NeutralStartProtect),
+     PALETTE_LAMP_RED},
+    {&LAMP_ICON_CHARGE, ALARM_BIT(ALARM_ID_VoltageLow) | ALARM_BIT(ALARM_ID_VoltageHigh) |
+                            ALARM_BIT(ALARM_ID_ChargeIndicator) | ALARM_BIT(ALARM_ID_LowSystemVoltage),
+     PALETTE_LAMP_RED},
+    {&LAMP_ICON_WATER_IN_FUEL, ALARM_BIT(ALARM_ID_WaterInFuel) | ALARM_BIT(ALARM_ID_LowFuelPressure),
+     PALETTE_LAMP_AMBER},
+    {&LAMP_ICON_CHECK_ENGINE, ALARM_BIT(ALARM_ID_CheckEngine) | ALARM_BIT(ALARM_ID_EGRSystem) |
+                                  ALARM_BIT(ALARM_ID_ThrottlePositionSensor) | ALARM_BIT(ALARM_ID_HighBoostPressure) |
+                                  ALARM_BIT(ALARM_ID_RevLimitExceeded) | ALARM_BIT(ALARM_ID_SubThrottle) |
+                                  ALARM_BIT(ALARM_ID_EngineCommError),
+     PALETTE_LAMP_AMBER},
+    {&LAMP_ICON_PREHEAT, ALARM_BIT(ALARM_ID_PreheatIndicator), PALETTE_LAMP_AMBER},
+    {&LAMP_ICON_MAINTENANCE, ALARM_BIT(ALARM_ID_MaintenanceNeeded) | ALARM_BIT(ALARM_ID_LowOilLevel), PALETTE_LAMP_AMBER},
+};
+
+/// Oil pressure lamp with its own place over the oil can of the scale
+static constexpr tLampDefinition OilLampTable[] = {
+    {&LAMP_ICON_OIL, ALARM_OIL_PRESSURE_MASK, PALETTE_LAMP_RED},
+};
 
 //******************************************************************
-// Init the display and images
-//******************************************************************
-void initDisplay()
-{
-    // Init the display
-    tft.init();
-    tft.fillScreen(TFT_BLACK);
-    tft.setSwapBytes(true);
-    tft.setRotation(0);
-    tft.setPivot(IWIDTH / 2, IHEIGHT / 2);
-    tft.pushImage(0, 0, IWIDTH, IHEIGHT, _startscreen);
-
-    // Create the background sprite
-    background.createSprite(IWIDTH, IHEIGHT);
-    background.setSwapBytes(true);
-    background.setColorDepth(16);
-    background.fillSprite(TFT_BLACK);
-
-    // Create the needle sprite
-    needle.createSprite(NEEDLE_WIDTH, NEEDLE_HEIGHT);
-    needle.setColorDepth(16);
-    needle.setSwapBytes(true);
-    needle.pushImage(0, 0, NEEDLE_WIDTH, NEEDLE_HEIGHT, _needle);
-    needle.setPivot(NEEDLE_WIDTH / 2, NEEDLE_HEIGHT);
-}
-
-//******************************************************************
-// Show the engine speed on the screen
+// Layout of the engine page
 //******************************************************************
-void updateDspEngineSpeed(double speed)
-{
-    // Transfer the speed to a string
-    String speedStr = String(speed, 0);
-
-    // Create a 16-bit sprite
-    textSprite.setColorDepth(16);
-    textSprite.createSprite(SPEEDTEXT_WIDTH, SPEEDTEXT_HEIGHT);
-
-    // Fill it with black (this will be the transparent colour this time)
-    textSprite.fillSprite(TFT_BLACK);
-
-    // Draw a background for the numbers (for testing only)
-    // textSprite.fillRect(0, 0, SPEEDTEXT_WIDTH, SPEEDTEXT_HEIGHT, TFT_RED);
-
-    // Set the font parameters
-    textSprite.setTextSize(1);                    // Font size scaling is x1
-    textSprite.setTextColor(TFT_WHITE);           // White text, no background colour
-    textSprite.setTextDatum(MR_DATUM);            // Middle right text alignment
-    textSprite.setFreeFont(&G7_Segment_7a32pt7b); // Set the font
-
-    // Draw the text
-    textSprite.drawString(speedStr, SPEEDTEXT_WIDTH, SPEEDTEXT_HEIGHT / 2);
-
-    // Push the sprite to the background sprite
-    textSprite.pushToSprite(&background, 52, 125, TFT_BLACK);
 
-    // Delete sprite to free up the RAM
-    textSprite.deleteSprite();
-
-    // Show the needle on the screen
-    updateDspNeedlePosition(speed);
-}
+/// Needles of both engines
+static constexpr tNeedleGaugeLayout NeedleLayout = {&EngineSpeedScale, &needleImage, NEEDLE_WIDTH / 2, NEEDLE_HEIGHT, 0};
+
+/// Coolant temperature arc along the track on the right of the scale
+static constexpr tArcBarLayout CoolantArcLayout = {
+    IWIDTH / 2, IHEIGHT / 2, COOLANT_ARC_OUTER_DIAMETER, COOLANT_ARC_INNER_DIAMETER, COOLANT_ARC_ANGLE_START,
+    COOLANT_ARC_ANGLE_END, COOLANT_MIN_TEMPERATURE, COOLANT_MAX_TEMPERATURE, COOLANT_CRITICAL_TEMPERATURE,
+    PALETTE_ARC_OK, PALETTE_ARC_PASSIV, PALETTE_ARC_CRITICAL, ARC_RAMP_LEVELS};
+
+/// Font, box, text position and datum, decimals, missing text and suffix, colours
+static constexpr tNumericReadoutLayout EngineSpeedTextLayout = {
+    &speedFont, {52, 125, SPEEDTEXT_WIDTH, SPEEDTEXT_HEIGHT}, 188, 152, MR_DATUM, 0, "---", "",
+    PALETTE_WHITE, PALETTE_STALE, PALETTE_WHITE, INT32_MAX};
+static constexpr tNumericReadoutLayout CoolantTextLayout = {
+    &smallFont, {COOLANT_TEXT_POSITION_X, COOLANT_TEXT_POSITION_Y, COOLANT_TEXT_WIDTH, COOLANT_TEXT_HEIGHT},
+    230, 96, MR_DATUM, 0, "--", " C",
+    PALETTE_WHITE, PALETTE_STALE, PALETTE_GREEN, COOLANT_CRITICAL_TEMPERATURE};
+static constexpr tNumericReadoutLayout EngineHoursTextLayout = {
+    &smallFont, {ENGINEHOURS_POSITION_X, ENGINEHOURS_POSITION_Y, ENGINEHOURS_TEXT_WIDTH, ENGINEHOURS_TEXT_HEIGHT},
+    139, 196, MR_DATUM, 1, "--.-", "h",
+    PALETTE_WHITE, PALETTE_STALE, PALETTE_WHITE, INT32_MAX};
+
+/// Lamps, atlas, position of the first slot, number and distance of the slots
+static constexpr tLampLayout OilLampLayout = {OilLampTable, 1, _lampAtlas, 153, 38, 1, 0};
+static constexpr tLampLayout LampSlotsLayout = {LampTable, sizeof(LampTable) / sizeof(LampTable[0]), _lampAtlas,
+                                                58, 70, 4, 20};
+
+/// Rectangles of the frame changed since it was pushed
+static DamageList Damage = DamageList(IWIDTH, IHEIGHT);
+
+/// Widgets of the engine page, drawn in the order of the declarations
+static Lamp OilLamp = Lamp(OilLampLayout);
+static Lamp LampSlots = Lamp(LampSlotsLayout);
+static NeedleGauge SecondNeedle = NeedleGauge(NeedleLayout);
+static NumericReadout EngineSpeedText = NumericReadout(EngineSpeedTextLayout);
+static NeedleGauge EngineSpeedNeedle = NeedleGauge(NeedleLayout);
+static ArcBar CoolantArc = ArcBar(CoolantArcLayout);
+static NumericReadout CoolantText = NumericReadout(CoolantTextLayout);
+static NumericReadout EngineHoursText = NumericReadout(EngineHoursTextLayout);
+
+/// The whole frame
+static constexpr tWidgetBox FullFrame = {0, 0, IWIDTH, IHEIGHT};
+/// The whole frame is damaged, every widget is pushed with the next update
+static bool FullFrameDamaged = false;
 
 //******************************************************************
-// Show a needle on the screen at a given engine speed
+// Push a compressed image strip by strip to the TFT or a sprite
 //******************************************************************
-void updateDspNeedlePosition(int speed)
+template <typename TTarget>
+static bool pushCompressedImage(TTarget &target, const tCompressedImage &image)
 {
-    int angle = map(speed, 0, 4000, 226, 386);
-    // Limit the angle to 0-359
-    if (angle > 359)
+    // The strip is only needed once at the start, so it does not stay in RAM
+    uint16_t *pixels = (uint16_t *)malloc((size_t)image.Width * IMAGE_STRIP_LINES * sizeof(uint16_t));
+    uint16_t lines;
+
+    if (pixels == nullptr)
     {
-        angle = angle - 360;
+        return false;
     }
-    // Draw the needle at the given angle
-    needle.pushRotated(&background, angle, TFT_BLACK);
-}
-
-//******************************************************************
-// Show the text on the screen
-//******************************************************************
-void showText(double speed)
-{
-    String speedStr = String(speed, 0);
-
-    // Create a 16-bit sprite
-    textSprite.setColorDepth(16);
-    textSprite.createSprite(SPEEDTEXT_WIDTH, SPEEDTEXT_HEIGHT);
-
-    // Fill it with black (this will be the transparent colour this time)
-    textSprite.fillSprite(TFT_BLACK);
 
-    // Draw a background for the numbers
-    // textSprite.fillRect(0, 0, SPEEDTEXT_WIDTH, SPEEDTEXT_HEIGHT, TFT_RED);
-
-    // Set the font parameters
-    textSprite.setTextSize(1);        // Font size scaling is x1
-    textSprite.setTextColor(TFT_RED); // White text, no background colour
-    textSprite.setTextDatum(MR_DATUM);
-    textSprite.setFreeFont(&airstrikeb3d18pt7b);
-
-    // Draw Text
-    textSprite.drawString(speedStr + " °C", STD_TEXT_WIDTH, STD_TEXT_HEIGHT / 2);
-
-    // Push sprite to TFT screen CGRAM at coordinate x,y (top left corner)
-    // All black pixels will not be drawn hence will show as "transparent"
-    textSprite.pushToSprite(&background, 57, 50, TFT_BLACK);
-
-    // Delete sprite to free up the RAM
-    textSprite.deleteSprite();
+    for (uint16_t strip = 0; strip < imageStripCount(image); strip++)
+    {
+        lines = imageDecodeStrip(image, strip, pixels);
+        target.pushImage(0, strip * IMAGE_STRIP_LINES, image.Width, lines, pixels);
+    }
+    free(pixels);
+    return true;
 }
 
 //******************************************************************
-// Show the engine Hours on the screen
+// Init the display and images
 //******************************************************************
-void updateDspEngineHours(double engineHours)
+void initDisplay()
 {
-    // Transfer the engine hours to a string
-    String engineHoursStr = String(engineHours, 1);
-
-    // Create a 16-bit sprite
-    textSprite.setColorDepth(16);
-    textSprite.createSprite(ENGINEHOURS_TEXT_WIDTH, ENGINEHOURS_TEXT_HEIGHT);
-
-    // Fill it with black (this will be the transparent colour this time)
-    textSprite.fillSprite(TFT_BLACK);
-
-    // Draw a background for the numbers (for testing only)
-    // textSprite.fillRect(0, 0, ENGINEHOURS_TEXT_WIDTH, ENGINEHOURS_TEXT_HEIGHT, TFT_RED);
-
-    // Set the font parameters
-    textSprite.setTextSize(1);                     // Font size scaling is x1
-    textSprite.setTextColor(TFT_WHITE);            // White text, no background colour
-    textSprite.setTextDatum(MR_DATUM);             // Middle right text alignment
-    textSprite.setFreeFont(&White_On_Black10pt7b); // Set the font
-
-    // Draw Text
-    textSprite.drawString(engineHoursStr + "h", (ENGINEHOURS_TEXT_WIDTH - 1), (ENGINEHOURS_TEXT_HEIGHT / 2) - 3);
+    // Init the display
+    tft.init();
+    tft.fillScreen(TFT_BLACK);
+    tft.setSwapBytes(true);
+    tft.setRotation(0);
+    tft.setPivot(IWIDTH / 2, IHEIGHT / 2);
+    if (!pushCompressedImage(tft, startscreenImage))
+    {
+        // Only if Debug is enabled
+#ifdef DEBUG_ERROR
+        Serial.println("Failed to allocate the start screen strip");
+#endif
+    }
 
-    // Push sprite to TFT screen CGRAM at coordinate x,y (top left corner)
-    // All black pixels will not be drawn hence will show as "transparent"
-    textSprite.pushToSprite(&background, ENGINEHOURS_POSITION_X, ENGINEHOURS_POSITION_Y, TFT_BLACK);
+    // Create the canvas of palette indices for one band of the frame
+    background.CreateSprite(IWIDTH, FRAME_BAND_LINES);
+    background.InitDma();
+
+    // Palette of the scale and the needle, then the colours of the values
+    background.SetPalette(0, _dialPalette, ASSET_DIAL_COLORS);
+    background.SetPaletteColor(PALETTE_WHITE, TFT_WHITE);
+    background.SetPaletteColor(PALETTE_STALE, STALE_VALUE_COLOR);
+    background.SetPaletteColor(PALETTE_GREEN, TFT_GREEN);
+    background.SetPaletteColor(PALETTE_RED, TFT_RED);
+    background.SetPaletteRamp(PALETTE_ARC_OK, COOLANT_ARC_COLOR_OK, ARC_RAMP_LEVELS);
+    background.SetPaletteRamp(PALETTE_ARC_PASSIV, COOLANT_ARC_COLOR_PASSIV, ARC_RAMP_LEVELS);
+    background.SetPaletteRamp(PALETTE_ARC_CRITICAL, COOLANT_ARC_COLOR_CRITICAL, ARC_RAMP_LEVELS);
+    background.SetPaletteRamp(PALETTE_LAMP_RED, LAMP_COLOR_RED, LAMP_ATLAS_FULL);
+    background.SetPaletteRamp(PALETTE_LAMP_AMBER, LAMP_COLOR_AMBER, LAMP_ATLAS_FULL);
+    background.SetPaletteRamp(PALETTE_SCALE_MINOR, SCALE_MINOR_COLOR, ARC_RAMP_LEVELS);
+    background.SetPaletteRamp(PALETTE_SCALE_MAJOR, SCALE_MAJOR_COLOR, ARC_RAMP_LEVELS);
+    background.SetPaletteRamp(PALETTE_SCALE_REDLINE, SCALE_REDLINE_COLOR, ARC_RAMP_LEVELS);
+
+    // Render the scale over the face once, without memory the face is shown alone
+    if (ScaleLayer.CreateSprite(IWIDTH, IHEIGHT, false))
+    {
+        gaugeScaleRender(ScaleLayer, faceImage, EngineSpeedScale);
+        ScaleImage = ScaleLayer.GetImage();
+    }
+    else
+    {
+        ScaleImage = faceImage;
+    }
 
-    // Delete sprite to free up the RAM
-    textSprite.deleteSprite();
+    // The first update draws the whole frame
+    Damage.Add(FullFrame);
+    FullFrameDamaged = true;
+
+    // Benchmark the image decoder (only if enabled)
+    benchmarkImageCodec(startscreenImage);
+#if FONT_BENCHMARK
+    TFT_eSprite fontSprite = TFT_eSprite(&tft);
+    benchmarkRunFont(fontSprite, speedFont, &speedFontGfx, "3888");
+    benchmarkRunFont(fontSprite, smallFont, &smallFontGfx, "1234.5h");
+#endif
 }
 
 //******************************************************************
-// Show coolant temperature on the screen
+// update the display
 //******************************************************************
-void updateDspCoolantTemperatur(double tCoolant)
+uint8_t updateDisplay(tSignalValue speed, tSignalValue secondSpeed, tSignalValue tCoolant, tSignalValue engineHours, uint32_t alarms)
 {
-    double angleSegment = 0;
-    uint16_t arcColor = 0x0000;
-
-    // String with the coolant temperature
-    String tCoolantStr = String(tCoolant, 0);
+    uint8_t pushed = 0;
 
-    // ******************************************************************
-    // Draw the Arc
-    // ******************************************************************
-    // Specify the colour of the arc
-    if (tCoolant > COOLANT_CRITICAL_TEMPERATURE)
+    // Each widget adds the rectangles it changed
+    if (OilLamp.Update(Damage, alarms))
     {
-        arcColor = COOLANT_ARC_COLOR_CRITICAL;
+        pushed |= DISPLAY_PUSHED_LAMPS;
     }
-    else
+    if (LampSlots.Update(Damage, alarms))
     {
-        arcColor = COOLANT_ARC_COLOR_OK;
+        pushed |= DISPLAY_PUSHED_LAMPS;
     }
-    // Limit the temperature to the min and max values
-    if (tCoolant > COOLANT_MAX_TEMPERATURE)
+    SecondNeedle.Update(Damage, signalToDisplayUnit(secondSpeed), secondSpeed.Quality == SIGNAL_VALID);
+    if (EngineSpeedText.Update(Damage, speed))
     {
-        tCoolant = COOLANT_MAX_TEMPERATURE;
+        pushed |= DISPLAY_PUSHED_SPEED;
     }
-    if (tCoolant < COOLANT_MIN_TEMPERATURE + 2)
+    if (EngineSpeedNeedle.Update(Damage, signalToDisplayUnit(speed), signalHasValue(speed)))
     {
-        tCoolant = COOLANT_MIN_TEMPERATURE + 2;
-        arcColor = COOLANT_ARC_COLOR_PASSIV;
+        pushed |= DISPLAY_PUSHED_SPEED;
     }
+    CoolantArc.Update(Damage, tCoolant);
+    CoolantText.Update(Damage, tCoolant);
+    EngineHoursText.Update(Damage, engineHours);
 
-    // Calculate the angles for the arc
-    angleSegment = (double)(COOLANT_ARC_ANGLE_END - COOLANT_ARC_ANGLE_START) / (COOLANT_MAX_TEMPERATURE - COOLANT_MIN_TEMPERATURE);
-    angleSegment = (double)COOLANT_ARC_ANGLE_START + angleSegment * (tCoolant - COOLANT_MIN_TEMPERATURE);
-
-    // Draw the arc on the background
-    background.drawSmoothArc(120, 120, COOLANT_ARC_OUTER_DIAMETER, COOLANT_ARC_INNER_DIAMETER, (uint16_t)angleSegment, COOLANT_ARC_ANGLE_START, arcColor, TFT_BLACK, true);
-
-    // ******************************************************************
-    // Draw the Value
-    // ******************************************************************
-
-    // Create a 8-bit sprite
-    textSprite.setColorDepth(16);
-    textSprite.createSprite(COOLANT_TEXT_WIDTH, COOLANT_TEXT_HEIGHT);
-
-    // Fill it with black (this will be the transparent colour this time)
-    textSprite.fillSprite(TFT_BLACK);
-
-    // Draw a background for the numbers
-    // textSprite.fillRect(0, 0, 61, 28, TFT_GREEN);
-
-    // Set the font parameters
-    textSprite.setTextSize(1); // Font size scaling is x1
-    if (tCoolant > COOLANT_CRITICAL_TEMPERATURE)
+    if (Damage.IsEmpty())
     {
-        textSprite.setTextColor(TFT_GREEN); // White text, no background colour
+        return 0;
     }
-    else
+    if (FullFrameDamaged)
     {
-        textSprite.setTextColor(TFT_WHITE); // White text, no background colour
+        pushed = DISPLAY_PUSHED_SPEED | DISPLAY_PUSHED_LAMPS;
+        FullFrameDamaged = false;
     }
-    textSprite.setTextDatum(MR_DATUM);
-    textSprite.setFreeFont(&White_On_Black10pt7b);
-
-    // Draw Text
-    textSprite.drawString(tCoolantStr + " C", (COOLANT_TEXT_WIDTH - 1), (COOLANT_TEXT_HEIGHT / 2) - 3);
 
-    // Push sprite to TFT screen CGRAM at coordinate x,y (top left corner)
-    // All black pixels will not be drawn hence will show as "transparent"
-    textSprite.pushToSprite(&background, COOLANT_TEXT_POSITION_X, COOLANT_TEXT_POSITION_Y, TFT_BLACK);
+    // The display list of the whole frame, the scale first, all widgets over it
+    frame.Clear();
+    frame.AddImage(ScaleImage, 0, 0, 0, 0, IWIDTH, IHEIGHT);
+    OilLamp.Draw(frame);
+    LampSlots.Draw(frame);
+    SecondNeedle.Draw(frame);
+    EngineSpeedText.Draw(frame);
+    EngineSpeedNeedle.Draw(frame);
+    CoolantArc.Draw(frame);
+    CoolantText.Draw(frame);
+    EngineHoursText.Draw(frame);
+
+    // Compose only the damaged rectangles band by band and expand them through the palette to the TFT
+    Damage.Render(frame);
+    return pushed;
+}
 
-    // Delete sprite to free up the RAM
-    textSprite.deleteSprite();
+//******************************************************************
+// Request the night colours
+//******************************************************************
+bool requestDspNightMode(bool night)
+{
+    return NightModeRequested.exchange(night, std::memory_order_relaxed) != night;
 }
 
 //******************************************************************
-// update the display
+// Apply the requested night colours
 //******************************************************************
-void updateDisplay(double speed, double tCoolant, double engineHours, bool oilPressureWarningActive)
+bool updateDspNightMode()
 {
-    // Push the background sprite to the TFT
-    if (oilPressureWarningActive)
-    {
-        // Push the background sprite with OilWarning
-        background.pushImage(0, 0, 240, 240, _scale_2);
-    }
-    else
+    bool night = NightModeRequested.load(std::memory_order_relaxed);
+
+    if (night == NightModeShown)
     {
-        // Push the background sprite with no OilWarning
-        background.pushImage(0, 0, 240, 240, _scale_1);
+        return false;
     }
 
-    // Show the engine speed
-    updateDspEngineSpeed(speed);
-
-    // Show the coolant temperature
-    updateDspCoolantTemperatur(tCoolant);
-
-    // Show the engine hours
-    updateDspEngineHours(engineHours);
-
-    // Push the background sprite to the TFT
-    background.pushSprite(0, 0);
-}
\ No newline at end of file
+    // Only the palette changes, but every pixel of the frame with it
+    background.SetNightColor(night ? NIGHT_MODE_COLOR : 0);
+    Damage.Add(FullFrame);
+    FullFrameDamaged = true;
+    NightModeShown = night;
+    return true;
+}
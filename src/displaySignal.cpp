@@ -0,0 +1,45 @@
+/*!
+ * \file displaySignal.cpp
+ * \brief Value and quality of a displayed signal
+ *
+ * This file contains the conversion of the raw signal values to
+ * display units.
+ *
+ */
+
+#include <displaySignal.h>
+
+//*****************************************************************************
+// Divide and round to the nearest integer
+static inline int32_t DivRound(int32_t Value, int32_t Divisor)
+{
+  return (Value >= 0) ? (Value + Divisor / 2) / Divisor : (Value - Divisor / 2) / Divisor;
+}
+
+//*****************************************************************************
+// Convert a signal to display units
+int32_t signalToDisplayUnit(const tSignalValue &Signal, int32_t Scale)
+{
+  // All raw values are 16 bit, except the engine hours, so the scaled
+  // values fit into 32 bits and the divisions by constants are cheap
+  switch (Signal.Unit)
+  {
+  case SIGNAL_UNIT_RPM_0_25:
+    return DivRound(Signal.Raw * Scale, 4);
+  case SIGNAL_UNIT_KELVIN_0_01:
+    // 0 degrees Celsius are 273.15 K
+    return DivRound((Signal.Raw - 27315) * Scale, 100);
+  case SIGNAL_UNIT_PASCAL_100:
+    // 100 Pa are 1 mbar
+    return Signal.Raw * Scale;
+  case SIGNAL_UNIT_VOLT_0_01:
+    return DivRound(Signal.Raw * Scale, 100);
+  case SIGNAL_UNIT_SECOND:
+    // Whole hours first, the seconds of a long running engine times Scale may not fit
+    return (Signal.Raw / 3600) * Scale + DivRound((Signal.Raw % 3600) * Scale, 3600);
+  case SIGNAL_UNIT_NONE:
+    return Signal.Raw * Scale;
+  default:
+    return Signal.Raw;
+  }
+}
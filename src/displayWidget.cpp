@@ -0,0 +1,467 @@
+/*!
+ * \file displayWidget.cpp
+ * \brief Retained widgets of the display
+ *
+ * This file contains the damaged rectangles of a frame and the needle,
+ * arc bar, numeric readout and lamp widgets, which add their commands
+ * to the display list and report the area they changed.
+ *
+ */
+
+#include <displayWidget.h>
+
+/// Conversion of degrees to radians
+#define WIDGET_DEG_TO_RAD ((float)M_PI / 180.0f)
+
+//*****************************************************************************
+// Get the union of two rectangles
+tWidgetBox widgetBoxUnion(const tWidgetBox &a, const tWidgetBox &b)
+{
+  tWidgetBox box;
+
+  if ((a.w <= 0) || (a.h <= 0))
+  {
+    return b;
+  }
+  if ((b.w <= 0) || (b.h <= 0))
+  {
+    return a;
+  }
+  box.x = (a.x < b.x) ? a.x : b.x;
+  box.y = (a.y < b.y) ? a.y : b.y;
+  box.w = ((a.x + a.w > b.x + b.w) ? a.x + a.w : b.x + b.w) - box.x;
+  box.h = ((a.y + a.h > b.y + b.h) ? a.y + a.h : b.y + b.h) - box.y;
+  return box;
+}
+
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ---------------------------> Damage List <-----------------------------------
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//*****************************************************************************
+// Constructor
+DamageList::DamageList(int16_t Width, int16_t Height)
+{
+  this->Width = Width;
+  this->Height = Height;
+  Count = 0;
+}
+
+//*****************************************************************************
+// Remove all rectangles
+void DamageList::Clear(void)
+{
+  Count = 0;
+}
+
+//*****************************************************************************
+// Add a damaged rectangle
+void DamageList::Add(const tWidgetBox &Box)
+{
+  int16_t left = (Box.x < 0) ? 0 : Box.x;
+  int16_t top = (Box.y < 0) ? 0 : Box.y;
+  int16_t right = (Box.x + Box.w > Width) ? Width : Box.x + Box.w;
+  int16_t bottom = (Box.y + Box.h > Height) ? Height : Box.y + Box.h;
+  tWidgetBox box = {left, top, (int16_t)(right - left), (int16_t)(bottom - top)};
+  uint8_t i = 0;
+
+  if ((box.w <= 0) || (box.h <= 0))
+  {
+    return;
+  }
+
+  // Merge the overlapping rectangles, the union may overlap further ones
+  while (i < Count)
+  {
+    if ((Boxes[i].x < box.x + box.w) && (box.x < Boxes[i].x + Boxes[i].w) && (Boxes[i].y < box.y + box.h) &&
+        (box.y < Boxes[i].y + Boxes[i].h))
+    {
+      box = widgetBoxUnion(box, Boxes[i]);
+      Boxes[i] = Boxes[--Count];
+      i = 0;
+    }
+    else
+    {
+      i++;
+    }
+  }
+
+  if (Count < DAMAGE_LIST_BOXES)
+  {
+    Boxes[Count++] = box;
+  }
+  else
+  {
+    Boxes[Count - 1] = widgetBoxUnion(Boxes[Count - 1], box);
+  }
+}
+
+//*****************************************************************************
+// Check if nothing is damaged
+bool DamageList::IsEmpty(void) const
+{
+  return Count == 0;
+}
+
+//*****************************************************************************
+// Render the damaged rectangles and remove them
+void DamageList::Render(BandRenderer &Frame)
+{
+  for (uint8_t i = 0; i < Count; i++)
+  {
+    Frame.Render(Boxes[i].x, Boxes[i].y, Boxes[i].w, Boxes[i].h);
+  }
+  Count = 0;
+}
+
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ---------------------------> Needle Gauge <----------------------------------
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//*****************************************************************************
+// Constructor
+NeedleGauge::NeedleGauge(const tNeedleGaugeLayout &Layout)
+{
+  this->Layout = &Layout;
+  Angle = 0;
+  Shown = false;
+}
+
+//*****************************************************************************
+// Area covered by the needle at an angle
+tWidgetBox NeedleGauge::Bounds(int16_t Angle) const
+{
+  float sinAngle = sinf(Angle * WIDGET_DEG_TO_RAD);
+  float cosAngle = cosf(Angle * WIDGET_DEG_TO_RAD);
+  int32_t minX = INT32_MAX;
+  int32_t minY = INT32_MAX;
+  int32_t maxX = INT32_MIN;
+  int32_t maxY = INT32_MIN;
+  tWidgetBox box;
+
+  // The rotated corners as in PaletteCanvas::PushRotated, one pixel around
+  for (uint8_t corner = 0; corner < 4; corner++)
+  {
+    float cx = ((corner & 1) ? Layout->Needle->Width : 0) - Layout->PivotX;
+    float cy = ((corner & 2) ? Layout->Needle->Height : 0) - Layout->PivotY;
+    int32_t rx = Layout->Scale->CenterX + (int32_t)floorf(cx * cosAngle - cy * sinAngle);
+    int32_t ry = Layout->Scale->CenterY + (int32_t)floorf(cx * sinAngle + cy * cosAngle);
+    minX = (rx < minX) ? rx : minX;
+    maxX = (rx > maxX) ? rx : maxX;
+    minY = (ry < minY) ? ry : minY;
+    maxY = (ry > maxY) ? ry : maxY;
+  }
+  box.x = (int16_t)(minX - 1);
+  box.y = (int16_t)(minY - 1);
+  box.w = (int16_t)(maxX - minX + 4);
+  box.h = (int16_t)(maxY - minY + 4);
+  return box;
+}
+
+//*****************************************************************************
+// Update the needle
+bool NeedleGauge::Update(DamageList &Damage, int32_t Value, bool Shown)
+{
+  int16_t angle = gaugeScaleAngle(*Layout->Scale, Value);
+
+  if ((Shown == this->Shown) && (!Shown || (angle == Angle)))
+  {
+    return false;
+  }
+
+  // The needle leaves its old place and covers the new one
+  if (this->Shown)
+  {
+    Damage.Add(Bounds(Angle));
+  }
+  if (Shown)
+  {
+    Damage.Add(Bounds(angle));
+  }
+  Angle = angle;
+  this->Shown = Shown;
+  return true;
+}
+
+//*****************************************************************************
+// Add the needle to the display list
+void NeedleGauge::Draw(BandRenderer &Frame) const
+{
+  if (Shown)
+  {
+    Frame.AddRotated(*Layout->Needle, Layout->PivotX, Layout->PivotY, Layout->Scale->CenterX, Layout->Scale->CenterY,
+                     Angle, Layout->Transparent);
+  }
+}
+
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ---------------------------> Arc Bar <---------------------------------------
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//*****************************************************************************
+// Constructor
+ArcBar::ArcBar(const tArcBarLayout &Layout)
+{
+  this->Layout = &Layout;
+  Angle = 0;
+  Ramp = 0;
+  Shown = false;
+}
+
+//*****************************************************************************
+// Area covered by the whole range of the bar
+tWidgetBox ArcBar::Bounds(void) const
+{
+  float center = (Layout->r + Layout->ir) / 2.0f;
+  int32_t half = (Layout->r - Layout->ir) / 2 + 3;
+  uint16_t start = (Layout->StartAngle < Layout->EndAngle) ? Layout->StartAngle : Layout->EndAngle;
+  uint16_t end = (Layout->StartAngle < Layout->EndAngle) ? Layout->EndAngle : Layout->StartAngle;
+  int32_t minX = INT32_MAX;
+  int32_t minY = INT32_MAX;
+  int32_t maxX = INT32_MIN;
+  int32_t maxY = INT32_MIN;
+  tWidgetBox box;
+
+  // The centre line as in PaletteCanvas::DrawSmoothArc, widened by the half width and a pixel more
+  for (float angle = start; angle <= end + 2.0f; angle += 2.0f)
+  {
+    float a = ((angle < end) ? angle : end) * WIDGET_DEG_TO_RAD;
+    int32_t px = Layout->x + (int32_t)lroundf(-sinf(a) * center);
+    int32_t py = Layout->y + (int32_t)lroundf(cosf(a) * center);
+    minX = (px < minX) ? px : minX;
+    maxX = (px > maxX) ? px : maxX;
+    minY = (py < minY) ? py : minY;
+    maxY = (py > maxY) ? py : maxY;
+  }
+  box.x = (int16_t)(minX - half);
+  box.y = (int16_t)(minY - half);
+  box.w = (int16_t)(maxX - minX + 2 * half + 1);
+  box.h = (int16_t)(maxY - minY + 2 * half + 1);
+  return box;
+}
+
+//*****************************************************************************
+// Update the bar
+bool ArcBar::Update(DamageList &Damage, const tSignalValue &Value)
+{
+  int32_t value = signalToDisplayUnit(Value);
+  uint8_t ramp = (value > Layout->CriticalValue) ? Layout->CriticalRamp : Layout->Ramp;
+  bool shown = signalHasValue(Value);
+  float angleSegment;
+  uint16_t angle;
+
+  // Limit the value to the range, the shortest bar is shown passive
+  if (value > Layout->MaxValue)
+  {
+    value = Layout->MaxValue;
+  }
+  if (value < Layout->MinValue + 2)
+  {
+    value = Layout->MinValue + 2;
+    ramp = Layout->PassivRamp;
+  }
+  // A stale value is shown passive
+  if (Value.Quality != SIGNAL_VALID)
+  {
+    ramp = Layout->PassivRamp;
+  }
+
+  angleSegment = (float)(Layout->EndAngle - Layout->StartAngle) / (Layout->MaxValue - Layout->MinValue);
+  angle = (uint16_t)((float)Layout->StartAngle + angleSegment * (value - Layout->MinValue));
+
+  if ((shown == Shown) && (!shown || ((angle == Angle) && (ramp == Ramp))))
+  {
+    return false;
+  }
+  Damage.Add(Bounds());
+  Angle = angle;
+  Ramp = ramp;
+  Shown = shown;
+  return true;
+}
+
+//*****************************************************************************
+// Add the bar to the display list
+void ArcBar::Draw(BandRenderer &Frame) const
+{
+  if (!Shown)
+  {
+    return;
+  }
+
+  // The arc is drawn clockwise, from the lower of both angles
+  if (Layout->EndAngle < Layout->StartAngle)
+  {
+    Frame.AddArc(Layout->x, Layout->y, Layout->r, Layout->ir, Angle, Layout->StartAngle, Ramp, Layout->Levels);
+  }
+  else
+  {
+    Frame.AddArc(Layout->x, Layout->y, Layout->r, Layout->ir, Layout->StartAngle, Angle, Ramp, Layout->Levels);
+  }
+}
+
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ---------------------------> Numeric Readout <-------------------------------
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//*****************************************************************************
+// Constructor
+NumericReadout::NumericReadout(const tNumericReadoutLayout &Layout)
+{
+  this->Layout = &Layout;
+  Text[0] = '\0';
+  Index = Layout.StaleIndex;
+}
+
+//*****************************************************************************
+// Area of the box widened to a text
+tWidgetBox NumericReadout::Bounds(const char *Text) const
+{
+  int16_t width = runFontTextWidth(*Layout->Font, Text);
+  int16_t left = Layout->TextX;
+  tWidgetBox box;
+
+  // Horizontal alignment as in runFontDrawString, one pixel around
+  switch ((Layout->Datum >= L_BASELINE) ? (Layout->Datum - L_BASELINE) : (Layout->Datum % 3))
+  {
+  case 1:
+    left -= width / 2;
+    break;
+  case 2:
+    left -= width;
+    break;
+  default:
+    break;
+  }
+  box.x = left - 1;
+  box.y = Layout->Box.y;
+  box.w = width + 2;
+  box.h = Layout->Box.h;
+  return widgetBoxUnion(Layout->Box, box);
+}
+
+//*****************************************************************************
+// Update the readout
+bool NumericReadout::Update(DamageList &Damage, const tSignalValue &Value)
+{
+  char text[BAND_RENDERER_TEXT_LENGTH];
+  uint8_t index = Layout->StaleIndex;
+  int32_t value = 0;
+
+  if (!signalHasValue(Value))
+  {
+    snprintf(text, sizeof(text), "%s%s", Layout->Missing, Layout->Suffix);
+  }
+  else if (Layout->Decimals == 0)
+  {
+    value = signalToDisplayUnit(Value);
+    snprintf(text, sizeof(text), "%ld%s", (long)value, Layout->Suffix);
+  }
+  else
+  {
+    value = signalToDisplayUnit(Value, 10);
+    // The sign on its own, the whole part of -0.5 has none
+    snprintf(text, sizeof(text), "%s%ld.%ld%s", (value < 0) ? "-" : "", labs((long)(value / 10)),
+             labs((long)(value % 10)), Layout->Suffix);
+    value /= 10;
+  }
+
+  // Set the colour of a valid value
+  if (Value.Quality == SIGNAL_VALID)
+  {
+    index = (value > Layout->CriticalValue) ? Layout->CriticalIndex : Layout->Index;
+  }
+
+  if ((index == Index) && (strcmp(text, Text) == 0))
+  {
+    return false;
+  }
+  // A longer text may not fit into the box
+  Damage.Add(widgetBoxUnion(Bounds(Text), Bounds(text)));
+  strcpy(Text, text);
+  Index = index;
+  return true;
+}
+
+//*****************************************************************************
+// Add the readout to the display list
+void NumericReadout::Draw(BandRenderer &Frame) const
+{
+  Frame.AddText(*Layout->Font, Text, Layout->TextX, Layout->TextY, Layout->Datum, Index);
+}
+
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ---------------------------> Lamp <------------------------------------------
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//*****************************************************************************
+// Constructor
+Lamp::Lamp(const tLampLayout &Layout)
+{
+  this->Layout = &Layout;
+  Shown = 0;
+}
+
+//*****************************************************************************
+// Area of all slots
+tWidgetBox Lamp::Bounds(void) const
+{
+  int16_t width = 0;
+  int16_t height = 0;
+  tWidgetBox box;
+
+  // Big enough for the largest icon in every slot
+  for (uint8_t lamp = 0; lamp < Layout->Count; lamp++)
+  {
+    width = (Layout->Lamps[lamp].Icon->Width > width) ? Layout->Lamps[lamp].Icon->Width : width;
+    height = (Layout->Lamps[lamp].Icon->Height > height) ? Layout->Lamps[lamp].Icon->Height : height;
+  }
+  box.x = Layout->x;
+  box.y = Layout->y;
+  box.w = (int16_t)((Layout->Slots - 1) * Layout->SlotDistance + width);
+  box.h = height;
+  return box;
+}
+
+//*****************************************************************************
+// Update the lamps
+bool Lamp::Update(DamageList &Damage, uint32_t Alarms)
+{
+  uint32_t shown = 0;
+  uint8_t slot = 0;
+
+  // Fill the slots in the order of the layout
+  for (uint8_t lamp = 0; (lamp < Layout->Count) && (slot < Layout->Slots); lamp++)
+  {
+    if (Alarms & Layout->Lamps[lamp].Alarms)
+    {
+      shown |= 1UL << lamp;
+      slot++;
+    }
+  }
+
+  if (shown == Shown)
+  {
+    return false;
+  }
+  Damage.Add(Bounds());
+  Shown = shown;
+  return true;
+}
+
+//*****************************************************************************
+// Add the lamps to the display list
+void Lamp::Draw(BandRenderer &Frame) const
+{
+  uint8_t slot = 0;
+
+  for (uint8_t lamp = 0; lamp < Layout->Count; lamp++)
+  {
+    if (Shown & (1UL << lamp))
+    {
+      Frame.AddIcon(*Layout->Lamps[lamp].Icon, Layout->Atlas, Layout->x + slot * Layout->SlotDistance, Layout->y,
+                    Layout->Lamps[lamp].Ramp);
+      slot++;
+    }
+  }
+}
@@ -0,0 +1,92 @@
+/*!
+ * \file gaugeScale.cpp
+ * \brief Scale of a round gauge generated from its description
+ *
+ * This file contains the needle angle and the rendering of the redline,
+ * the ticks and the labels of a gauge scale.
+ *
+ */
+
+#include <gaugeScale.h>
+#include <runFont.h>
+
+/// Conversion of degrees to radians
+#define SCALE_DEG_TO_RAD ((float)M_PI / 180.0f)
+
+//*****************************************************************************
+// Needle angle of a value with fractions, not limited to 0..359
+static float ScaleAngle(const tGaugeScale &Scale, int32_t Value)
+{
+  return Scale.StartAngle +
+         (float)(Value - Scale.MinValue) * (Scale.EndAngle - Scale.StartAngle) / (Scale.MaxValue - Scale.MinValue);
+}
+
+//*****************************************************************************
+// Draw a tick from the inner to the outer radius
+static void DrawTick(PaletteCanvas &Layer, const tGaugeScale &Scale, float Angle, uint8_t Inner, uint8_t Outer,
+                     uint8_t Width, uint8_t Ramp)
+{
+  float dx = sinf(Angle * SCALE_DEG_TO_RAD);
+  float dy = -cosf(Angle * SCALE_DEG_TO_RAD);
+
+  // The round ends would stick out, the line ends half a width inside
+  Layer.DrawSmoothLine(Scale.CenterX + dx * (Inner + Width / 2.0f), Scale.CenterY + dy * (Inner + Width / 2.0f),
+                       Scale.CenterX + dx * (Outer - Width / 2.0f), Scale.CenterY + dy * (Outer - Width / 2.0f), Width,
+                       Ramp, Scale.Levels);
+}
+
+//*****************************************************************************
+// Draw an upright label centred on the label radius
+static void DrawLabel(PaletteCanvas &Layer, const tGaugeScale &Scale, float Angle, int32_t Value)
+{
+  char text[12];
+
+  snprintf(text, sizeof(text), "%ld", (long)(Value / Scale.LabelDivider));
+  runFontDrawString(Layer, *Scale.LabelFont, text,
+                    Scale.CenterX + (int32_t)lroundf(sinf(Angle * SCALE_DEG_TO_RAD) * Scale.LabelRadius),
+                    Scale.CenterY - (int32_t)lroundf(cosf(Angle * SCALE_DEG_TO_RAD) * Scale.LabelRadius), MC_DATUM,
+                    Scale.LabelIndex);
+}
+
+//*****************************************************************************
+// Get the needle angle of a value
+int16_t gaugeScaleAngle(const tGaugeScale &Scale, int32_t Value)
+{
+  Value = (Value < Scale.MinValue) ? Scale.MinValue : ((Value > Scale.MaxValue) ? Scale.MaxValue : Value);
+  return (int16_t)lroundf(ScaleAngle(Scale, Value)) % 360;
+}
+
+//*****************************************************************************
+// Render the scale over the face into a layer
+void gaugeScaleRender(PaletteCanvas &Layer, const tPalettedImage &Face, const tGaugeScale &Scale)
+{
+  Layer.SetBand(0);
+  Layer.PushImage(0, 0, Face, 0, 0, Face.Width, Face.Height);
+
+  // The redline below the ticks, the arc angles count from 6 o'clock
+  if (Scale.RedlineValue < Scale.MaxValue)
+  {
+    Layer.DrawSmoothArc(Scale.CenterX, Scale.CenterY, Scale.RedlineOuter, Scale.RedlineInner,
+                        ((int32_t)lroundf(ScaleAngle(Scale, Scale.RedlineValue)) + 180) % 360,
+                        ((int32_t)lroundf(ScaleAngle(Scale, Scale.MaxValue)) + 180) % 360, Scale.RedlineRamp,
+                        Scale.Levels);
+  }
+
+  // The minor ticks between the major ticks
+  for (int32_t value = Scale.MinValue + Scale.MinorStep; value < Scale.MaxValue; value += Scale.MinorStep)
+  {
+    if ((value - Scale.MinValue) % Scale.MajorStep != 0)
+    {
+      DrawTick(Layer, Scale, ScaleAngle(Scale, value), Scale.MinorInner, Scale.MinorOuter, Scale.MinorWidth,
+               Scale.MinorRamp);
+    }
+  }
+
+  // The major ticks with their labels
+  for (int32_t value = Scale.MinValue + Scale.MajorStep; value < Scale.MaxValue; value += Scale.MajorStep)
+  {
+    DrawTick(Layer, Scale, ScaleAngle(Scale, value), Scale.MajorInner, Scale.MajorOuter, Scale.MajorWidth,
+             Scale.MajorRamp);
+    DrawLabel(Layer, Scale, ScaleAngle(Scale, value), value);
+  }
+}
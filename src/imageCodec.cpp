@@ -0,0 +1,207 @@
+/*!
+ * \file imageCodec.cpp
+ * \brief Lossless codec for the RGB565 images
+ *
+ * This file contains the strip decoder and a benchmark against copying
+ * the raw image from flash. The format of the stream is described in
+ * scripts/rgb565Codec.py.
+ *
+ */
+
+#include <imageCodec.h>
+#include <sysClock.h>
+
+/// Pixel from the table of recently seen pixels
+#define IMAGE_OP_INDEX 0x00
+/// Repeat the previous pixel 1..64 times
+#define IMAGE_OP_RUN 0x40
+/// Small difference to the previous pixel
+#define IMAGE_OP_DIFF 0x80
+/// Larger difference to the previous pixel, one more byte
+#define IMAGE_OP_LUMA 0xc0
+/// Repeat the previous pixel 65..4160 times, one more byte
+#define IMAGE_OP_RUN_LONG 0xe0
+/// Raw pixel, two more bytes
+#define IMAGE_OP_RGB 0xff
+
+/// Longest run of a short run op
+#define IMAGE_RUN_MAX 64
+
+/// Position of a pixel in the table of recently seen pixels
+#define IMAGE_PIXEL_HASH(p) ((((p) >> 11) * 3 + (((p) >> 5) & 0x3f) * 5 + ((p) & 0x1f) * 7) & 0x3f)
+
+//*****************************************************************************
+// Repeat the previous pixel, never beyond the end of the strip
+static inline uint32_t FillRun(uint16_t *Pixels, uint32_t n, uint32_t count, uint32_t run, uint16_t pixel)
+{
+  if (run > count - n)
+  {
+    run = count - n;
+  }
+  while (run--)
+  {
+    Pixels[n++] = pixel;
+  }
+  return n;
+}
+
+//*****************************************************************************
+// Get the number of strips of an image
+uint16_t imageStripCount(const tCompressedImage &Image)
+{
+  return (Image.Height + IMAGE_STRIP_LINES - 1) / IMAGE_STRIP_LINES;
+}
+
+//*****************************************************************************
+// Decode one strip of an image
+uint16_t imageDecodeStrip(const tCompressedImage &Image, uint16_t Strip, uint16_t *Pixels)
+{
+  uint16_t index[64] = {0};
+  uint16_t prev = 0;
+  uint16_t lines;
+  uint32_t count;
+  uint32_t n = 0;
+  const uint8_t *data;
+  uint8_t op;
+
+  if (Strip >= imageStripCount(Image))
+  {
+    return 0;
+  }
+  lines = Image.Height - Strip * IMAGE_STRIP_LINES;
+  if (lines > IMAGE_STRIP_LINES)
+  {
+    lines = IMAGE_STRIP_LINES;
+  }
+  count = (uint32_t)lines * Image.Width;
+
+  // The flash of the ESP32 is memory mapped, the stream is read directly
+  data = Image.Data + Image.Strips[Strip];
+
+  while (n < count)
+  {
+    op = *data++;
+
+    if (op == IMAGE_OP_RGB)
+    {
+      prev = ((uint16_t)data[0] << 8) | data[1];
+      data += 2;
+    }
+    else if ((op & 0xf0) == IMAGE_OP_RUN_LONG)
+    {
+      // Runs repeat the previous pixel, which is already in the table
+      n = FillRun(Pixels, n, count, ((((uint32_t)op & 0x0f) << 8) | *data++) + IMAGE_RUN_MAX + 1, prev);
+      continue;
+    }
+    else if ((op & 0xf0) == 0xf0)
+    {
+      // Reserved op, the stream is corrupt
+      return 0;
+    }
+    else if ((op & 0xe0) == IMAGE_OP_LUMA)
+    {
+      int8_t dg = (int8_t)(op & 0x1f) - 16;
+      int8_t dr = (int8_t)(*data >> 4) - 8;
+      int8_t db = (int8_t)(*data & 0x0f) - 8;
+
+      data++;
+      prev = (((prev >> 11) + dr) & 0x1f) << 11 |
+             ((((prev >> 5) & 0x3f) + dg) & 0x3f) << 5 |
+             (((prev & 0x1f) + db) & 0x1f);
+    }
+    else if ((op & 0xc0) == IMAGE_OP_DIFF)
+    {
+      prev = (((prev >> 11) + ((op >> 4) & 0x03) - 2) & 0x1f) << 11 |
+             ((((prev >> 5) & 0x3f) + ((op >> 2) & 0x03) - 2) & 0x3f) << 5 |
+             (((prev & 0x1f) + (op & 0x03) - 2) & 0x1f);
+    }
+    else if ((op & 0xc0) == IMAGE_OP_RUN)
+    {
+      n = FillRun(Pixels, n, count, (op & 0x3f) + 1, prev);
+      continue;
+    }
+    else
+    {
+      prev = index[op & 0x3f];
+    }
+
+    index[IMAGE_PIXEL_HASH(prev)] = prev;
+    Pixels[n++] = prev;
+  }
+  return lines;
+}
+
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ---------------------------> Benchmark <-------------------------------------
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#if IMAGE_CODEC_BENCHMARK
+
+/// Number of full image decodes
+#define IMAGE_CODEC_BENCHMARK_LOOPS 20
+
+//*****************************************************************************
+// Benchmark the decoder
+void benchmarkImageCodec(const tCompressedImage &Image)
+{
+  uint32_t stripBytes = (uint32_t)Image.Width * IMAGE_STRIP_LINES * sizeof(uint16_t);
+  uint16_t *pixels = (uint16_t *)malloc(stripBytes);
+  uint16_t strips = imageStripCount(Image);
+  uint32_t copyBytes = (Image.Size > stripBytes) ? stripBytes : Image.Size;
+  uint32_t sourceRange = Image.Size - copyBytes + 1;
+  uint64_t start;
+  uint64_t decodeTime;
+  uint64_t copyTime;
+
+  if (pixels == nullptr)
+  {
+    return;
+  }
+
+  start = clockMicros();
+  for (uint32_t loop = 0; loop < IMAGE_CODEC_BENCHMARK_LOOPS; loop++)
+  {
+    for (uint16_t strip = 0; strip < strips; strip++)
+    {
+      imageDecodeStrip(Image, strip, pixels);
+    }
+  }
+  decodeTime = clockMicros() - start;
+
+  // Copy as many bytes from flash as the raw image has, the stream is reused as source
+  start = clockMicros();
+  for (uint32_t loop = 0; loop < IMAGE_CODEC_BENCHMARK_LOOPS; loop++)
+  {
+    for (uint16_t strip = 0; strip < strips; strip++)
+    {
+      memcpy(pixels, Image.Data + (strip * stripBytes) % sourceRange, copyBytes);
+    }
+  }
+  copyTime = clockMicros() - start;
+
+  Serial.print("  Image ");
+  Serial.print(Image.Width);
+  Serial.print("x");
+  Serial.print(Image.Height);
+  Serial.print(": decode ");
+  Serial.print((uint32_t)(decodeTime / IMAGE_CODEC_BENCHMARK_LOOPS));
+  Serial.print("us raw flash copy ");
+  Serial.print((uint32_t)(copyTime / IMAGE_CODEC_BENCHMARK_LOOPS));
+  Serial.print("us compressed ");
+  Serial.print(Image.Size);
+  Serial.print(" bytes raw ");
+  Serial.print((uint32_t)Image.Width * Image.Height * sizeof(uint16_t));
+  Serial.println(" bytes");
+
+  free(pixels);
+}
+
+#else
+
+//*****************************************************************************
+// Benchmark disabled
+void benchmarkImageCodec(const tCompressedImage &Image)
+{
+}
+
+#endif // IMAGE_CODEC_BENCHMARK
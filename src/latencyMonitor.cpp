@@ -0,0 +1,265 @@
+/*!
+ * \file latencyMonitor.cpp
+ * \brief End-to-end latency from CAN frame to pixels on screen
+ *
+ * This file contains the latency histograms and the frame stamps
+ * passed from the N2K task to the display task.
+ *
+ */
+
+#include <latencyMonitor.h>
+#include <taskMonitor.h>
+
+//******************************************************************
+// Init Global Variables
+//******************************************************************
+LatencyHistogram DisplayWaitLatency("Wait for display", LATENCY_BUDGET_MS);
+LatencyHistogram EndToEndLatency("Frame to pixels", LATENCY_BUDGET_MS);
+LatencyHistogram AlarmLatency("Alarm to pixels", ALARM_LATENCY_BUDGET_MS);
+
+/// Frame ID of the last arrived frame
+static uint32_t ArrivedFrameId = 0;
+/// Arrival time of the last arrived frame [us]
+static uint64_t ArrivedFrameTime = 0;
+/// Frame ID of the frame in the running display update
+static uint32_t RenderFrameId = 0;
+/// Arrival time of the frame in the running display update [us]
+static uint64_t RenderFrameTime = 0;
+/// Frame ID of the last frame which was shown on screen
+static uint32_t ShownFrameId = 0;
+/// Time of the first alarm raised since the last display update [us], 0 if none
+static uint64_t RaisedAlarmTime = 0;
+/// Time of the alarm in the running display update [us], 0 if none
+static uint64_t RenderAlarmTime = 0;
+
+/// Spinlock to protect the frame stamp between the tasks
+static portMUX_TYPE LatencyMux = portMUX_INITIALIZER_UNLOCKED;
+
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// -------------------------> Latency Histogram <-------------------------------
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//************************************************
+// Constructor
+LatencyHistogram::LatencyHistogram(const char *Name, uint32_t BudgetMs)
+{
+  this->Name = Name;
+  this->BudgetMs = BudgetMs;
+  Reset();
+}
+
+//************************************************
+// Add a latency sample
+void LatencyHistogram::AddSample(uint64_t Latency)
+{
+  uint32_t bucket = (uint32_t)(CLOCK_US_TO_MS(Latency) / LATENCY_HISTOGRAM_BUCKET_WIDTH);
+
+  // Collect all samples above the range in the last bucket
+  if (bucket >= LATENCY_HISTOGRAM_BUCKETS)
+  {
+    bucket = LATENCY_HISTOGRAM_BUCKETS - 1;
+  }
+  Buckets[bucket]++;
+
+  Count++;
+  Sum += Latency;
+  if (Latency > Max)
+  {
+    Max = (uint32_t)Latency;
+  }
+  if (Latency < Min)
+  {
+    Min = (uint32_t)Latency;
+  }
+  if (Latency > CLOCK_MS_TO_US(BudgetMs))
+  {
+    OverBudgetCnt++;
+  }
+}
+
+//************************************************
+// Clear all samples
+void LatencyHistogram::Reset(void)
+{
+  memset(Buckets, 0, sizeof(Buckets));
+  Count = 0;
+  OverBudgetCnt = 0;
+  Sum = 0;
+  Min = UINT32_MAX;
+  Max = 0;
+}
+
+//************************************************
+// Get the number of samples
+uint32_t LatencyHistogram::GetCount(void)
+{
+  return Count;
+}
+
+//************************************************
+// Get the number of samples above the budget
+uint32_t LatencyHistogram::GetOverBudgetCnt(void)
+{
+  return OverBudgetCnt;
+}
+
+//************************************************
+// Get the maximum latency
+uint32_t LatencyHistogram::GetMax(void)
+{
+  return Max;
+}
+
+//************************************************
+// Get a percentile of the latency
+uint32_t LatencyHistogram::GetPercentile(uint8_t Percent)
+{
+  uint32_t limit = (uint32_t)(((uint64_t)Count * Percent + 99) / 100);
+  uint32_t sum = 0;
+
+  for (uint8_t bucket = 0; bucket < LATENCY_HISTOGRAM_BUCKETS; bucket++)
+  {
+    sum += Buckets[bucket];
+    if ((sum >= limit) && (sum > 0))
+    {
+      return (bucket + 1) * LATENCY_HISTOGRAM_BUCKET_WIDTH;
+    }
+  }
+  return 0;
+}
+
+//************************************************
+// Show the histogram via Serial
+void LatencyHistogram::Show(void)
+{
+  Serial.print("  ");
+  Serial.print(Name);
+  Serial.print(": samples ");
+  Serial.print(Count);
+  if (Count == 0)
+  {
+    Serial.println();
+    return;
+  }
+  Serial.print(" min/avg/max ");
+  Serial.print(CLOCK_US_TO_MS(Min));
+  Serial.print("/");
+  Serial.print(CLOCK_US_TO_MS(Sum / Count));
+  Serial.print("/");
+  Serial.print(CLOCK_US_TO_MS(Max));
+  Serial.print("ms p50 <");
+  Serial.print(GetPercentile(50));
+  Serial.print("ms p95 <");
+  Serial.print(GetPercentile(95));
+  Serial.print("ms over budget (");
+  Serial.print(BudgetMs);
+  Serial.print("ms): ");
+  Serial.println(OverBudgetCnt);
+
+  // Print the buckets in one line
+  Serial.print("   ");
+  for (uint8_t bucket = 0; bucket < LATENCY_HISTOGRAM_BUCKETS; bucket++)
+  {
+    Serial.print(" ");
+    Serial.print(Buckets[bucket]);
+  }
+  Serial.println();
+}
+
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ---------------------------> Frame Stamps <----------------------------------
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//******************************************************************
+// Stamp a newly arrived frame
+//******************************************************************
+void latencyFrameArrived(uint64_t arrivalTime)
+{
+  taskENTER_CRITICAL(&LatencyMux);
+  ArrivedFrameId++;
+  ArrivedFrameTime = arrivalTime;
+  taskEXIT_CRITICAL(&LatencyMux);
+}
+
+//******************************************************************
+// Stamp a raised alarm
+//******************************************************************
+void latencyAlarmRaised(uint64_t raiseTime)
+{
+  taskENTER_CRITICAL(&LatencyMux);
+  if (RaisedAlarmTime == 0)
+  {
+    RaisedAlarmTime = raiseTime;
+  }
+  taskEXIT_CRITICAL(&LatencyMux);
+}
+
+//******************************************************************
+// Mark the start of a display update
+//******************************************************************
+void latencyRenderStart(void)
+{
+  uint64_t now = clockMicros();
+
+  taskENTER_CRITICAL(&LatencyMux);
+  RenderFrameId = ArrivedFrameId;
+  RenderFrameTime = ArrivedFrameTime;
+  RenderAlarmTime = RaisedAlarmTime;
+  RaisedAlarmTime = 0;
+  taskEXIT_CRITICAL(&LatencyMux);
+
+  // Only new frames count, the display repeats old values as well
+  if ((RenderFrameId != ShownFrameId) && (now >= RenderFrameTime))
+  {
+    DisplayWaitLatency.AddSample(now - RenderFrameTime);
+  }
+}
+
+//******************************************************************
+// Mark the end of a display update
+//******************************************************************
+void latencyRenderDone(bool framePushed, bool alarmPushed)
+{
+  uint64_t now = clockMicros();
+
+  // Record the latency the first time the frame reaches the screen, a
+  // frame which did not change the shown speed is on screen already
+  if (RenderFrameId != ShownFrameId)
+  {
+    if (framePushed)
+    {
+      EndToEndLatency.AddSample(now - RenderFrameTime);
+    }
+    ShownFrameId = RenderFrameId;
+  }
+
+  // An alarm is only rendered once, if it changed the lamps at all
+  if (RenderAlarmTime != 0)
+  {
+    if (alarmPushed)
+    {
+      AlarmLatency.AddSample(now - RenderAlarmTime);
+    }
+    RenderAlarmTime = 0;
+  }
+}
+
+//******************************************************************
+// Show the latency statistics via Serial
+//******************************************************************
+void showLatencyStatistics(void)
+{
+  // Only if Debug is enabled
+#ifdef DEBUG_LATENCY_STATISTICS
+  // Tread safety with mutex SerialOutputMutex
+  if (takeSerialOutputMutex())
+  {
+    Serial.println("Latency Statistics:");
+    DisplayWaitLatency.Show();
+    EndToEndLatency.Show();
+    AlarmLatency.Show();
+    // free the mutex
+    giveSerialOutputMutex();
+  }
+#endif
+}
@@ -13,6 +13,12 @@
 #include <Arduino.h>
 #include "displayCtl.h"
 #include <process_n2k.h>
+#include <sysClock.h>
+#include <taskMonitor.h>
+#include <latencyMonitor.h>
+#include <n2kFastDecode.h>
+#include <signalFilter.h>
+#include <alarmEngine.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 
@@ -30,7 +36,8 @@ uint8_t calcDisplayBrightness();
  * \brief Set the display brightness
  *
  * This function will calculate the display brightness based on the
- * analog value of the brightness sensor.
+ * analog value of the brightness sensor. With the night brightness the
+ * night colours of the display are requested.
  *
  */
 void setDisplayBrightness();
@@ -50,32 +57,83 @@ SemaphoreHandle_t SerialOutputMutex;
 /*!
  * \brief Task for updating NMEA2000 messages
  *
- * This task runs on core 1 and updates NMEA2000 messages every 50ms.
+ * This task runs on core 1 and updates NMEA2000 messages every 50ms,
+ * or as soon as a frame is received if N2K_ENGINE_RAPID_FAST_PATH is enabled.
  *
  * \param parameter Pointer to task parameters (not used).
  */
 void taskUpdateN2K(void *parameter)
 {
+  uint64_t nextWakeTime = 0;
+
+  // Register the task for the runtime statistics
+  taskMonitorRegister(TASK_ID_UPDATE_N2K, xTaskGetCurrentTaskHandle(), TASK_UPDATE_N2K_PERIOD);
+
   for (;;)
   {
+    taskMonitorCycleStart(TASK_ID_UPDATE_N2K);
     updateN2K();
-    vTaskDelay(pdMS_TO_TICKS(50)); // Delay for 50ms
+    taskMonitorCycleEnd(TASK_ID_UPDATE_N2K);
+    waitN2K(nextWakeTime, TASK_UPDATE_N2K_PERIOD);
   }
 }
 
 /*!
  * \brief Task for updating the display
  *
- * This task runs on core 1 and updates the display every 100ms.
+ * This task runs on core 1 and updates the display every 100ms if a
+ * shown signal changed. A changed alarm wakes the task up at once and
+ * is rendered out of cycle.
  *
  * \param parameter Pointer to task parameters (not used).
  */
 void taskUpdateDisplay(void *parameter)
 {
+  uint64_t nextWakeTime = 0;
+  uint32_t changed;
+  uint32_t alarms;
+  // Widgets pushed by the display update
+  uint8_t pushed;
+  bool firstUpdate = true;
+  bool colorsChanged;
+  // Alarms shown on screen
+  uint32_t shownAlarms = 0;
+  // Signals shown on screen
+  const uint32_t shownSignals = EngineSpeedSignal::Bit(DISPLAY_ENGINE_INSTANCE) |
+                                (DISPLAY_TWIN_ENGINE ? EngineSpeedSignal::Bit(DISPLAY_SECOND_ENGINE_INSTANCE) : 0) |
+                                EngineCoolantTemperatureSignal::Bit(DISPLAY_ENGINE_INSTANCE) |
+                                EngineHoursSignal::Bit(DISPLAY_ENGINE_INSTANCE);
+
+  // Register the task for the runtime statistics
+  taskMonitorRegister(TASK_ID_UPDATE_DISPLAY, xTaskGetCurrentTaskHandle(), TASK_UPDATE_DISPLAY_PERIOD);
+
   for (;;)
   {
-    updateDisplay(DisplayData.EngineSpeed, DisplayData.EngineCoolantTemperature, DisplayData.EngineHours, DisplayData.LowOilPressureWarning);
-    vTaskDelay(pdMS_TO_TICKS(100)); // Delay for 100ms
+    taskMonitorCycleStart(TASK_ID_UPDATE_DISPLAY);
+
+    // Update only if a shown signal, the colours or an alarm changed, the
+    // widgets redraw only what changed on the screen
+    colorsChanged = updateDspNightMode();
+    changed = signalRegistryTakeDirty(SIGNAL_CONSUMER_DISPLAY);
+    alarms = alarmGetActive(DISPLAY_ENGINE_INSTANCE);
+    if (firstUpdate || colorsChanged || (alarms != shownAlarms) || (changed & shownSignals))
+    {
+      latencyRenderStart();
+      // Take the alarms again, one raised meanwhile is part of this update
+      alarms = alarmGetActive(DISPLAY_ENGINE_INSTANCE);
+      pushed = updateDisplay(EngineSpeedSignal::GetValue(DISPLAY_ENGINE_INSTANCE),
+                             EngineSpeedSignal::GetValue(DISPLAY_TWIN_ENGINE ? DISPLAY_SECOND_ENGINE_INSTANCE : N2K_MAX_ENGINE_INSTANCES),
+                             EngineCoolantTemperatureSignal::GetValue(DISPLAY_ENGINE_INSTANCE),
+                             EngineHoursSignal::GetValue(DISPLAY_ENGINE_INSTANCE),
+                             alarms);
+      // Only widgets which reached the screen count for the latency
+      latencyRenderDone((pushed & DISPLAY_PUSHED_SPEED) != 0, (pushed & DISPLAY_PUSHED_LAMPS) != 0);
+      shownAlarms = alarms;
+      firstUpdate = false;
+    }
+
+    taskMonitorCycleEnd(TASK_ID_UPDATE_DISPLAY);
+    clockSleepUntilNotified(nextWakeTime, TASK_UPDATE_DISPLAY_PERIOD);
   }
 }
 
@@ -88,10 +146,17 @@ void taskUpdateDisplay(void *parameter)
  */
 void taskSetDisplayBrightness(void *parameter)
 {
+  uint64_t nextWakeTime = 0;
+
+  // Register the task for the runtime statistics
+  taskMonitorRegister(TASK_ID_SET_DISPLAY_BRIGHTNESS, xTaskGetCurrentTaskHandle(), TASK_SET_DISPLAY_BRIGHTNESS_PERIOD);
+
   for (;;)
   {
+    taskMonitorCycleStart(TASK_ID_SET_DISPLAY_BRIGHTNESS);
     setDisplayBrightness();
-    vTaskDelay(pdMS_TO_TICKS(250)); // Delay for 250ms
+    taskMonitorCycleEnd(TASK_ID_SET_DISPLAY_BRIGHTNESS);
+    clockSleepUntil(nextWakeTime, TASK_SET_DISPLAY_BRIGHTNESS_PERIOD);
   }
 }
 
@@ -104,10 +169,19 @@ void taskSetDisplayBrightness(void *parameter)
  */
 void taskShowN2kStatistics(void *parameter)
 {
+  uint64_t nextWakeTime = 0;
+
+  // Register the task for the runtime statistics
+  taskMonitorRegister(TASK_ID_SHOW_N2K_STATISTICS, xTaskGetCurrentTaskHandle(), TASK_SHOW_N2K_STATISTICS_PERIOD);
+
   for (;;)
   {
+    taskMonitorCycleStart(TASK_ID_SHOW_N2K_STATISTICS);
     N2kMessageStatistics.ShowStatistics();
-    vTaskDelay(pdMS_TO_TICKS(2000)); // Delay for 2 seconds
+    showTaskStatistics();
+    showLatencyStatistics();
+    taskMonitorCycleEnd(TASK_ID_SHOW_N2K_STATISTICS);
+    clockSleepUntil(nextWakeTime, TASK_SHOW_N2K_STATISTICS_PERIOD);
   }
 }
 
@@ -129,7 +203,7 @@ void setup(void)
   initDisplay();
 
   // Initial Display Delay for Startscreen
-  delay(5000);
+  clockSleepMs(5000);
 
   // Set the PWM Output for the Display Brightness
   pinMode(TFT_BL, OUTPUT);
@@ -141,6 +215,17 @@ void setup(void)
   // Init the NMEA2000
   initN2K();
 
+  // Benchmark the N2K decoders (only if enabled)
+  benchmarkN2kDecoders();
+  // Benchmark the signal filters (only if enabled), a wrong step response is only reported
+  if (!benchmarkSignalFilters())
+  {
+    // Only if Debug is enabled
+#ifdef DEBUG_ERROR
+    Serial.println("Signal filter step response out of tolerance");
+#endif
+  }
+
   // Create the Mutex for N2K Serial Output
   SerialOutputMutex = xSemaphoreCreateMutex();
   // Check if the Mutex was created
@@ -152,9 +237,10 @@ void setup(void)
 #endif
   }
 
-  // Create tasks for multitasking
-  xTaskCreatePinnedToCore(taskUpdateN2K, "UpdateN2K", 2048, NULL, 5, &taskUpdateN2KHandle, 1);                                  // Core 1
+  // Create tasks for multitasking, the display task first to get woken up by the alarms
   xTaskCreatePinnedToCore(taskUpdateDisplay, "UpdateDisplay", 2048, NULL, 2, &taskUpdateDisplayHandle, 1);                      // Core 1
+  alarmInit(taskUpdateDisplayHandle);
+  xTaskCreatePinnedToCore(taskUpdateN2K, "UpdateN2K", 2048, NULL, 5, &taskUpdateN2KHandle, 1);                                  // Core 1
   xTaskCreatePinnedToCore(taskSetDisplayBrightness, "SetDisplayBrightness", 2048, NULL, 1, &taskSetDisplayBrightnessHandle, 1); // Core 1
   xTaskCreatePinnedToCore(taskShowN2kStatistics, "ShowN2kStatistics", 2048, NULL, 1, &taskShowN2kStatisticsHandle, 1);         // Core 1
 }
@@ -218,19 +304,16 @@ uint8_t calcDisplayBrightness()
   // Only if Debug is enabled
 #ifdef DEBUG_DISPLAY_BRIGHTNESS
   // Tread safety with mutex SerialOutputMutex
-  if (SerialOutputMutex)
+  if (takeSerialOutputMutex())
   {
-    if (xSemaphoreTake(SerialOutputMutex, pdMS_TO_TICKS(20)) == pdTRUE)
-    {
-      Serial.print(millis());
-      Serial.print(": Brightness Sensor Analog Value: ");
-      Serial.print(value);
-      Serial.print(" -- > Brightness: ");
-      Serial.println(brightness);
-
-      // free the mutex
-      xSemaphoreGive(SerialOutputMutex);
-    }
+    Serial.print(clockMillis());
+    Serial.print(": Brightness Sensor Analog Value: ");
+    Serial.print(value);
+    Serial.print(" -- > Brightness: ");
+    Serial.println(brightness);
+
+    // free the mutex
+    giveSerialOutputMutex();
   }
 #endif
 
@@ -251,4 +334,12 @@ void setDisplayBrightness()
 
   // Set the brightness
   analogWrite(TFT_BL, brightness);
+
+#if DISPLAY_NIGHT_MODE
+  // Switch to the night colours with the night brightness, the display task redraws at once
+  if (requestDspNightMode(brightness == BRIGHTNESS_OUTPUT_NIGHT) && (taskUpdateDisplayHandle != NULL))
+  {
+    xTaskNotifyGive(taskUpdateDisplayHandle);
+  }
+#endif
 }
@@ -0,0 +1,858 @@
+/*!
+ * \file n2kCanDriver.cpp
+ * \brief NMEA2000 CAN driver for the ESP32-S3 TWAI controller
+ *
+ * This file contains the CAN driver for the NMEA2000 library and the
+ * calculation of the acceptance filter from the subscribed PGNs.
+ *
+ * Layout of the 29-bit NMEA2000 identifier:
+ * - bit 28-26 priority
+ * - bit 25-24 extended data page, data page
+ * - bit 23-16 PDU format (PF)
+ * - bit 15-8  PDU specific (PS), destination address if PF < 240
+ * - bit 7-0   source address
+ *
+ */
+
+#include <n2kCanDriver.h>
+#include <sysClock.h>
+
+/// Bits of the PGN within the identifier
+#define N2K_ID_PGN_MASK 0x03FFFF00UL
+/// Bits of the PDU specific field within the identifier
+#define N2K_ID_PS_MASK 0x0000FF00UL
+/// Bits of the source address within the identifier
+#define N2K_ID_SOURCE_MASK 0x000000FFUL
+/// Bits of the identifier covered by one filter in dual filter mode
+#define N2K_ID_DUAL_FILTER_MASK 0x1FFFE000UL
+/// Shift of the identifier to the filter bits in dual filter mode
+#define N2K_ID_DUAL_FILTER_SHIFT 13
+
+//******************************************************************
+// Init Global Variables
+//******************************************************************
+tNMEA2000_twai N2kCanDriver(ESP32_CAN_TX_PIN, ESP32_CAN_RX_PIN);
+tNMEA2000 &NMEA2000 = N2kCanDriver;
+
+/*! ******************************************************************
+  @struct tN2kCoalescedPGN
+  @brief  Structure for a single frame PGN whose newest frame replaces an older one
+ */
+typedef struct
+{
+  /// PGN of the message
+  unsigned long PGN;
+  /// Offset of the instance byte in the data
+  uint8_t InstanceOffset;
+} tN2kCoalescedPGN;
+
+/// Single frame PGNs coalesced in the staging buffer, the first byte of
+/// other PGNs is e.g. a SID or the frame counter of a fast-packet
+static const tN2kCoalescedPGN CoalescedPGNs[] = {
+    {127488L, 0}, // Engine Rapid, engine instance
+    {127493L, 0}, // Transmission Parameters, transmission instance
+};
+
+//******************************************************************
+// Get the offset of the instance byte of a coalesced PGN
+//******************************************************************
+static int8_t GetCoalesceOffset(unsigned long PGN)
+{
+  for (uint8_t i = 0; i < sizeof(CoalescedPGNs) / sizeof(CoalescedPGNs[0]); i++)
+  {
+    if (CoalescedPGNs[i].PGN == PGN)
+    {
+      return CoalescedPGNs[i].InstanceOffset;
+    }
+  }
+  return -1;
+}
+
+//******************************************************************
+// Count the set bits of a value
+//******************************************************************
+static uint8_t CountBits(uint32_t value)
+{
+  uint8_t cnt = 0;
+
+  for (; value; value &= value - 1)
+  {
+    cnt++;
+  }
+  return cnt;
+}
+
+//******************************************************************
+// Get code and relevant bits of the identifier for one PGN
+//******************************************************************
+static void GetIdFilter(unsigned long PGN, int16_t Source, uint32_t &Code, uint32_t &Care)
+{
+  Code = (PGN << 8) & N2K_ID_PGN_MASK;
+  Care = N2K_ID_PGN_MASK;
+
+  // PDU1 format, the PDU specific field is the destination address
+  if (((PGN >> 8) & 0xFF) < 240)
+  {
+    Code &= ~N2K_ID_PS_MASK;
+    Care &= ~N2K_ID_PS_MASK;
+  }
+
+  if (Source != N2K_CAN_ANY_SOURCE)
+  {
+    Code |= (uint32_t)Source & N2K_ID_SOURCE_MASK;
+    Care |= N2K_ID_SOURCE_MASK;
+  }
+}
+
+//******************************************************************
+// Merge the identifier filters of a group of PGNs
+//******************************************************************
+static void MergeIdFilter(const unsigned long *PGNs, uint8_t Cnt, uint32_t Group, bool InGroup,
+                          int16_t Source, uint32_t &Code, uint32_t &Care)
+{
+  bool first = true;
+  uint32_t code;
+  uint32_t care;
+
+  Code = 0;
+  Care = 0;
+  for (uint8_t i = 0; i < Cnt; i++)
+  {
+    if ((((Group >> i) & 1) != 0) != InGroup)
+    {
+      continue;
+    }
+    GetIdFilter(PGNs[i], Source, code, care);
+    if (first)
+    {
+      Code = code;
+      Care = care;
+      first = false;
+    }
+    else
+    {
+      // Bits which differ between the PGNs become "don't care"
+      Care &= care & ~(Code ^ code);
+      Code &= Care;
+    }
+  }
+}
+
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ----------------------> Fast-Packet Reassembly <-----------------------------
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//************************************************
+// Constructor
+N2kFastPacketPool::N2kFastPacketPool()
+{
+  memset(Slots, 0, sizeof(Slots));
+  CompletedCnt = 0;
+  IncompleteCnt = 0;
+  EvictedCnt = 0;
+  OutOfOrderCnt = 0;
+}
+
+//************************************************
+// Find the slot of a running message
+tN2kFastPacketSlot *N2kFastPacketPool::FindSlot(uint8_t Source, unsigned long PGN, uint8_t SequenceId)
+{
+  for (uint8_t i = 0; i < N2K_FAST_PACKET_SLOTS; i++)
+  {
+    if (Slots[i].InUse && (Slots[i].Source == Source) && (Slots[i].PGN == PGN) && (Slots[i].SequenceId == SequenceId))
+    {
+      return &Slots[i];
+    }
+  }
+  return nullptr;
+}
+
+//************************************************
+// Allocate a slot, evict the oldest if the pool is full
+tN2kFastPacketSlot *N2kFastPacketPool::AllocSlot(void)
+{
+  tN2kFastPacketSlot *oldest = &Slots[0];
+
+  for (uint8_t i = 0; i < N2K_FAST_PACKET_SLOTS; i++)
+  {
+    if (!Slots[i].InUse)
+    {
+      return &Slots[i];
+    }
+    if (Slots[i].StartTime < oldest->StartTime)
+    {
+      oldest = &Slots[i];
+    }
+  }
+
+  // Pool is full, reuse the oldest slot
+  EvictedCnt++;
+  return oldest;
+}
+
+//************************************************
+// Drop all slots older than the timeout
+void N2kFastPacketPool::ExpireSlots(uint64_t now)
+{
+  for (uint8_t i = 0; i < N2K_FAST_PACKET_SLOTS; i++)
+  {
+    if (Slots[i].InUse && (now - Slots[i].StartTime > CLOCK_MS_TO_US(N2K_FAST_PACKET_TIMEOUT)))
+    {
+      Slots[i].InUse = false;
+      IncompleteCnt++;
+    }
+  }
+}
+
+//************************************************
+// Add a frame of a fast-packet message
+bool N2kFastPacketPool::AddFrame(unsigned long id, unsigned char len, const unsigned char *buf, uint64_t now, tN2kMsg &N2kMsg)
+{
+  tN2kFastPacketSlot *slot;
+  uint8_t source = id & N2K_ID_SOURCE_MASK;
+  unsigned long PGN = tNMEA2000_twai::GetPGN(id);
+  uint8_t sequenceId;
+  uint8_t frame;
+  uint8_t copy;
+
+  // Classic CAN allows a DLC up to 15 for 8 data bytes
+  len = (len > 8) ? 8 : len;
+  if (len < 2)
+  {
+    OutOfOrderCnt++;
+    return false;
+  }
+
+  // Byte 0: bit 7-5 sequence ID, bit 4-0 frame counter
+  sequenceId = buf[0] >> 5;
+  frame = buf[0] & 0x1F;
+  slot = FindSlot(source, PGN, sequenceId);
+
+  if (frame == 0)
+  {
+    // Byte 1 of the first frame holds the total length, a malformed
+    // frame must not evict a slot still being reassembled
+    if ((buf[1] == 0) || (buf[1] > N2K_FAST_PACKET_MAX_LEN))
+    {
+      OutOfOrderCnt++;
+      return false;
+    }
+
+    // A new start of a running message, the old one is incomplete
+    if (slot)
+    {
+      IncompleteCnt++;
+    }
+    else
+    {
+      slot = AllocSlot();
+    }
+    slot->InUse = true;
+    slot->Source = source;
+    slot->Priority = (id >> 26) & 0x07;
+    slot->SequenceId = sequenceId;
+    slot->PGN = PGN;
+    slot->Length = buf[1];
+    slot->Received = 0;
+    slot->NextFrame = 1;
+    slot->StartTime = now;
+    copy = len - 2;
+    buf += 2;
+  }
+  else
+  {
+    // Frame without start or gap in the frame counter
+    if (!slot)
+    {
+      OutOfOrderCnt++;
+      return false;
+    }
+    if (frame != slot->NextFrame)
+    {
+      slot->InUse = false;
+      OutOfOrderCnt++;
+      return false;
+    }
+    slot->NextFrame++;
+    copy = len - 1;
+    buf += 1;
+  }
+
+  // Copy the payload, the last frame is padded
+  if (copy > slot->Length - slot->Received)
+  {
+    copy = slot->Length - slot->Received;
+  }
+  memcpy(&slot->Data[slot->Received], buf, copy);
+  slot->Received += copy;
+
+  if (slot->Received < slot->Length)
+  {
+    return false;
+  }
+
+  // Message complete
+  N2kMsg.PGN = slot->PGN;
+  N2kMsg.Priority = slot->Priority;
+  N2kMsg.Source = slot->Source;
+  N2kMsg.Destination = 0xFF;
+  N2kMsg.DataLen = slot->Length;
+  N2kMsg.MsgTime = (unsigned long)CLOCK_US_TO_MS(now);
+  memcpy(N2kMsg.Data, slot->Data, slot->Length);
+  slot->InUse = false;
+  CompletedCnt++;
+  return true;
+}
+
+//************************************************
+// Get the number of reassembled messages
+uint32_t N2kFastPacketPool::GetCompletedCnt(void)
+{
+  return CompletedCnt;
+}
+
+//************************************************
+// Get the number of messages dropped incomplete
+uint32_t N2kFastPacketPool::GetIncompleteCnt(void)
+{
+  return IncompleteCnt;
+}
+
+//************************************************
+// Get the number of messages evicted because the pool was full
+uint32_t N2kFastPacketPool::GetEvictedCnt(void)
+{
+  return EvictedCnt;
+}
+
+//************************************************
+// Get the number of frames received out of order
+uint32_t N2kFastPacketPool::GetOutOfOrderCnt(void)
+{
+  return OutOfOrderCnt;
+}
+
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// --------------------------> TWAI CAN Driver <--------------------------------
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//************************************************
+// Constructor
+tNMEA2000_twai::tNMEA2000_twai(gpio_num_t TxPin, gpio_num_t RxPin) : tNMEA2000()
+{
+  this->TxPin = TxPin;
+  this->RxPin = RxPin;
+  SubscribedPGNCnt = 0;
+  FastPacketHandler = nullptr;
+  EarlyPGN = 0;
+  EarlyFrameHandler = nullptr;
+  RxEarlyCnt = 0;
+  AcceptedSource = N2K_CAN_ANY_SOURCE;
+  RxFrameCnt = 0;
+  RxRejectedCnt = 0;
+  RxLostCnt = 0;
+  RxCoalescedCnt = 0;
+  StagedFrameCnt = 0;
+  StageSequence = 0;
+  RxQueueLen = N2K_CAN_RX_QUEUE_LEN;
+  RxQueueGrowLen = 0;
+  memset(&RxStatistics, 0, sizeof(RxStatistics));
+  memset(&RxStatisticsLast, 0, sizeof(RxStatisticsLast));
+  RxStatisticsStart = 0;
+  LastMissedCount = 0;
+  LastOverrunCount = 0;
+  CalcFilter();
+}
+
+//************************************************
+// Subscribe a PGN
+bool tNMEA2000_twai::SubscribePGN(unsigned long PGN, bool FastPacket)
+{
+  if (SubscribedPGNCnt >= N2K_CAN_MAX_SUBSCRIBED_PGNS)
+  {
+    return false;
+  }
+  SubscribedPGNs[SubscribedPGNCnt] = PGN;
+  SubscribedFastPacket[SubscribedPGNCnt] = FastPacket;
+  SubscribedPGNCnt++;
+  return true;
+}
+
+//************************************************
+// Set the handler for reassembled fast-packet messages
+void tNMEA2000_twai::SetFastPacketHandler(void (*Handler)(const tN2kMsg &N2kMsg))
+{
+  FastPacketHandler = Handler;
+}
+
+//************************************************
+// Set the early frame handler for one single-frame PGN
+void tNMEA2000_twai::SetEarlyFrameHandler(unsigned long PGN, bool (*Handler)(unsigned long id, unsigned char len, const unsigned char *buf, uint64_t now))
+{
+  EarlyPGN = PGN;
+  EarlyFrameHandler = Handler;
+}
+
+//************************************************
+// Wait for received frames
+bool tNMEA2000_twai::WaitRxData(uint32_t TimeoutMs)
+{
+  uint32_t alerts = 0;
+
+  if (twai_read_alerts(&alerts, pdMS_TO_TICKS(TimeoutMs)) != ESP_OK)
+  {
+    return false;
+  }
+  return (alerts & TWAI_ALERT_RX_DATA) != 0;
+}
+
+//************************************************
+// Get the fast-packet reassembly pool
+N2kFastPacketPool &tNMEA2000_twai::GetFastPacketPool(void)
+{
+  return FastPacketPool;
+}
+
+//************************************************
+// Check if a subscribed PGN is a fast-packet message
+bool tNMEA2000_twai::IsFastPacket(unsigned long PGN)
+{
+  for (uint8_t i = 0; i < SubscribedPGNCnt; i++)
+  {
+    if (SubscribedPGNs[i] == PGN)
+    {
+      return SubscribedFastPacket[i];
+    }
+  }
+  return false;
+}
+
+//************************************************
+// Set the length of the receive queue
+void tNMEA2000_twai::SetRxQueueLen(uint32_t Len)
+{
+  RxQueueLen = Len;
+}
+
+//************************************************
+// Get the receive statistics of the last reporting interval
+const tN2kCanRxStatistics &tNMEA2000_twai::GetRxStatistics(void)
+{
+  return RxStatisticsLast;
+}
+
+//************************************************
+// Get the number of frames replaced by a newer frame of the same signal
+uint32_t tNMEA2000_twai::GetRxCoalescedCnt(void)
+{
+  return RxCoalescedCnt;
+}
+
+//************************************************
+// Get the number of frames consumed by the early frame handler
+uint32_t tNMEA2000_twai::GetRxEarlyCnt(void)
+{
+  return RxEarlyCnt;
+}
+
+//************************************************
+// Get the number of frames lost since start
+uint32_t tNMEA2000_twai::GetRxLostCnt(void)
+{
+  return RxLostCnt;
+}
+
+//************************************************
+// Set the accepted source address
+void tNMEA2000_twai::SetAcceptedSource(int16_t Source)
+{
+  AcceptedSource = Source;
+}
+
+//************************************************
+// Get the programmed acceptance filter
+const tN2kCanFilter &tNMEA2000_twai::GetFilter(void)
+{
+  return Filter;
+}
+
+//************************************************
+// Get the number of frames received from the controller
+uint32_t tNMEA2000_twai::GetRxFrameCnt(void)
+{
+  return RxFrameCnt;
+}
+
+//************************************************
+// Get the number of frames rejected by the software filter
+uint32_t tNMEA2000_twai::GetRxRejectedCnt(void)
+{
+  return RxRejectedCnt;
+}
+
+//************************************************
+// Get the PGN of a CAN identifier
+unsigned long tNMEA2000_twai::GetPGN(unsigned long id)
+{
+  unsigned long PGN = (id & N2K_ID_PGN_MASK) >> 8;
+
+  // PDU1 format, the PDU specific field is the destination address
+  if (((PGN >> 8) & 0xFF) < 240)
+  {
+    PGN &= ~0xFFUL;
+  }
+  return PGN;
+}
+
+//************************************************
+// Check if a frame passes the software filter
+bool tNMEA2000_twai::IsSubscribed(unsigned long id)
+{
+  unsigned long PGN;
+
+  // Nothing subscribed, everything passes
+  if (SubscribedPGNCnt == 0)
+  {
+    return true;
+  }
+
+  if ((AcceptedSource != N2K_CAN_ANY_SOURCE) && ((id & N2K_ID_SOURCE_MASK) != (uint32_t)AcceptedSource))
+  {
+    return false;
+  }
+
+  PGN = GetPGN(id);
+  for (uint8_t i = 0; i < SubscribedPGNCnt; i++)
+  {
+    if (SubscribedPGNs[i] == PGN)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+//************************************************
+// Calculate the acceptance filter from the subscribed PGNs
+void tNMEA2000_twai::CalcFilter(void)
+{
+  uint32_t code;
+  uint32_t care;
+  uint32_t codeB;
+  uint32_t careB;
+  uint32_t accepted;
+  uint32_t group;
+
+  // Nothing subscribed, accept all frames
+  if (SubscribedPGNCnt == 0)
+  {
+    Filter.AcceptanceCode = 0;
+    Filter.AcceptanceMask = 0xFFFFFFFF;
+    Filter.SingleFilter = true;
+    Filter.AcceptedPGNs = 1UL << 18;
+    return;
+  }
+
+  // Single filter mode, one filter over the whole identifier
+  MergeIdFilter(SubscribedPGNs, SubscribedPGNCnt, 0, false, AcceptedSource, code, care);
+  Filter.AcceptanceCode = code << 3;
+  Filter.AcceptanceMask = (~care << 3) | 0x07;
+  Filter.SingleFilter = true;
+  Filter.AcceptedPGNs = 1UL << CountBits(~care & N2K_ID_PGN_MASK);
+
+  // Dual filter mode, two filters over the upper 16 bits of the identifier.
+  // Try every split of the PGNs into two groups and keep the tightest one.
+  for (group = 1; group < (1UL << (SubscribedPGNCnt - 1)); group++)
+  {
+    MergeIdFilter(SubscribedPGNs, SubscribedPGNCnt, group, false, AcceptedSource, code, care);
+    MergeIdFilter(SubscribedPGNs, SubscribedPGNCnt, group, true, AcceptedSource, codeB, careB);
+    care &= N2K_ID_DUAL_FILTER_MASK;
+    careB &= N2K_ID_DUAL_FILTER_MASK;
+
+    accepted = (1UL << CountBits(~care & N2K_ID_PGN_MASK)) + (1UL << CountBits(~careB & N2K_ID_PGN_MASK));
+    if (accepted < Filter.AcceptedPGNs)
+    {
+      Filter.AcceptanceCode = (((code >> N2K_ID_DUAL_FILTER_SHIFT) & 0xFFFF) << 16) |
+                              ((codeB >> N2K_ID_DUAL_FILTER_SHIFT) & 0xFFFF);
+      Filter.AcceptanceMask = (((~care >> N2K_ID_DUAL_FILTER_SHIFT) & 0xFFFF) << 16) |
+                              ((~careB >> N2K_ID_DUAL_FILTER_SHIFT) & 0xFFFF);
+      Filter.SingleFilter = false;
+      Filter.AcceptedPGNs = accepted;
+    }
+  }
+}
+
+//************************************************
+// Install and start the TWAI driver with the current settings
+bool tNMEA2000_twai::InstallDriver(void)
+{
+  twai_general_config_t generalConfig = TWAI_GENERAL_CONFIG_DEFAULT(TxPin, RxPin, TWAI_MODE_NORMAL);
+  twai_timing_config_t timingConfig = TWAI_TIMING_CONFIG_250KBITS();
+  twai_filter_config_t filterConfig;
+
+  filterConfig.acceptance_code = Filter.AcceptanceCode;
+  filterConfig.acceptance_mask = Filter.AcceptanceMask;
+  filterConfig.single_filter = Filter.SingleFilter;
+
+  generalConfig.rx_queue_len = RxQueueLen;
+  generalConfig.tx_queue_len = N2K_CAN_TX_QUEUE_LEN;
+  // Used to wake up the N2K task on received frames
+  generalConfig.alerts_enabled = TWAI_ALERT_RX_DATA;
+
+  if (twai_driver_install(&generalConfig, &timingConfig, &filterConfig) != ESP_OK)
+  {
+    return false;
+  }
+
+  // The counters of the driver start from zero after installation
+  LastMissedCount = 0;
+  LastOverrunCount = 0;
+  RxStatistics.QueueLen = RxQueueLen;
+
+  return (twai_start() == ESP_OK);
+}
+
+//************************************************
+// Install and start the TWAI driver
+bool tNMEA2000_twai::CANOpen()
+{
+  // Program the acceptance filter from the subscribed PGNs
+  CalcFilter();
+
+  RxStatisticsStart = clockMicros();
+  return InstallDriver();
+}
+
+//************************************************
+// Update the receive statistics and decide on a longer receive queue
+void tNMEA2000_twai::UpdateRxStatistics(uint64_t now)
+{
+  twai_status_info_t status;
+
+  if (twai_get_status_info(&status) != ESP_OK)
+  {
+    return;
+  }
+
+  // Frames waiting in the queue before it is drained
+  if (status.msgs_to_rx > RxStatistics.MaxQueueDepth)
+  {
+    RxStatistics.MaxQueueDepth = status.msgs_to_rx;
+  }
+
+  // Frames lost since the last update
+  RxStatistics.QueueFullCnt += status.rx_missed_count - LastMissedCount;
+  RxStatistics.OverrunCnt += status.rx_overrun_count - LastOverrunCount;
+  RxLostCnt += (status.rx_missed_count - LastMissedCount) + (status.rx_overrun_count - LastOverrunCount);
+  LastMissedCount = status.rx_missed_count;
+  LastOverrunCount = status.rx_overrun_count;
+
+  if (now - RxStatisticsStart < CLOCK_MS_TO_US(N2K_CAN_RX_STATISTICS_INTERVAL))
+  {
+    return;
+  }
+
+  // Close the reporting interval
+  RxStatisticsLast = RxStatistics;
+  memset(&RxStatistics, 0, sizeof(RxStatistics));
+  RxStatistics.QueueLen = RxQueueLen;
+  RxStatisticsStart = now;
+
+  // Grow the queue if it was filled to 3/4 or frames were lost
+  if (N2K_CAN_RX_QUEUE_ADAPTIVE && (RxQueueLen < N2K_CAN_RX_QUEUE_MAX_LEN) &&
+      ((RxStatisticsLast.QueueFullCnt > 0) || (RxStatisticsLast.MaxQueueDepth * 4 >= RxQueueLen * 3)))
+  {
+    RxQueueGrowLen = (RxQueueLen * 2 > N2K_CAN_RX_QUEUE_MAX_LEN) ? N2K_CAN_RX_QUEUE_MAX_LEN : RxQueueLen * 2;
+  }
+}
+
+//************************************************
+// Install the driver with the longer receive queue once it is empty
+void tNMEA2000_twai::GrowRxQueue(void)
+{
+  twai_status_info_t status;
+  uint32_t oldLen = RxQueueLen;
+  uint64_t start;
+  uint32_t lost;
+
+  if (RxQueueGrowLen == 0)
+  {
+    return;
+  }
+
+  // Installing the driver again drops the queue, wait for a call which
+  // drained it completely, the backlog causing the growth is kept
+  if ((twai_get_status_info(&status) != ESP_OK) || (status.msgs_to_rx > 0))
+  {
+    return;
+  }
+
+  // The queue length can only be changed by installing the driver again
+  start = clockMicros();
+  twai_stop();
+  twai_driver_uninstall();
+  RxQueueLen = RxQueueGrowLen;
+  RxQueueGrowLen = 0;
+  if (!InstallDriver())
+  {
+    // Fall back to the old queue length
+    RxQueueLen = oldLen;
+    InstallDriver();
+  }
+
+  // Frames arriving without an installed driver are dropped silently,
+  // count the ones expected at the rate of the last reporting interval
+  lost = (uint32_t)((RxStatisticsLast.FrameCnt * (clockMicros() - start) + CLOCK_MS_TO_US(N2K_CAN_RX_STATISTICS_INTERVAL) - 1) /
+                    CLOCK_MS_TO_US(N2K_CAN_RX_STATISTICS_INTERVAL));
+  RxStatistics.ReinstallCnt += lost;
+  RxLostCnt += lost;
+}
+
+//************************************************
+// Send a frame via the TWAI driver
+bool tNMEA2000_twai::CANSendFrame(unsigned long id, unsigned char len, const unsigned char *buf, bool wait_sent)
+{
+  twai_message_t message;
+
+  memset(&message, 0, sizeof(message));
+  message.extd = 1;
+  message.identifier = id;
+  message.data_length_code = (len > 8) ? 8 : len;
+  memcpy(message.data, buf, message.data_length_code);
+
+  return (twai_transmit(&message, wait_sent ? pdMS_TO_TICKS(10) : 0) == ESP_OK);
+}
+
+//************************************************
+// Stage a received frame, coalesce it with an older one of the same signal
+void tNMEA2000_twai::StageFrame(const twai_message_t &message)
+{
+  tN2kCanFrame *frame = nullptr;
+  unsigned char len = (message.data_length_code > 8) ? 8 : message.data_length_code;
+  int8_t offset = GetCoalesceOffset(GetPGN(message.identifier));
+
+  // Only the listed PGNs are known to carry the latest value of a
+  // signal, keyed by PGN, source and instance
+  if ((offset >= 0) && (len > offset))
+  {
+    for (uint8_t i = 0; i < StagedFrameCnt; i++)
+    {
+      if ((StagedFrames[i].Id == message.identifier) && (StagedFrames[i].Len > offset) &&
+          (StagedFrames[i].Data[offset] == message.data[offset]))
+      {
+        frame = &StagedFrames[i];
+        RxCoalescedCnt++;
+        break;
+      }
+    }
+  }
+
+  if (!frame)
+  {
+    frame = &StagedFrames[StagedFrameCnt++];
+  }
+
+  frame->Id = message.identifier;
+  frame->Len = len;
+  frame->Sequence = StageSequence++;
+  memcpy(frame->Data, message.data, len);
+}
+
+//************************************************
+// Drain the TWAI receive queue into the staging buffer
+void tNMEA2000_twai::DrainRxQueue(uint64_t now)
+{
+  twai_message_t message;
+
+  while ((StagedFrameCnt < N2K_CAN_STAGING_LEN) && (twai_receive(&message, 0) == ESP_OK))
+  {
+    RxFrameCnt++;
+    RxStatistics.FrameCnt++;
+
+    // Classic CAN allows a DLC up to 15 for 8 data bytes
+    if (message.data_length_code > 8)
+    {
+      message.data_length_code = 8;
+    }
+
+    // NMEA2000 uses extended data frames only
+    if (!message.extd || message.rtr)
+    {
+      RxRejectedCnt++;
+      continue;
+    }
+
+    // Reject what the acceptance filter could not express
+    if (!IsSubscribed(message.identifier))
+    {
+      RxRejectedCnt++;
+      continue;
+    }
+
+    // Decode the early PGN right here, bypassing staging and library
+    if (EarlyFrameHandler && (GetPGN(message.identifier) == EarlyPGN) &&
+        EarlyFrameHandler(message.identifier, message.data_length_code, message.data, now))
+    {
+      RxEarlyCnt++;
+      continue;
+    }
+
+    // Reassemble subscribed fast-packet messages in the own pool
+    if (FastPacketHandler && IsFastPacket(GetPGN(message.identifier)))
+    {
+      if (FastPacketPool.AddFrame(message.identifier, message.data_length_code, message.data, now, FastPacketMsg))
+      {
+        FastPacketHandler(FastPacketMsg);
+      }
+      continue;
+    }
+
+    StageFrame(message);
+  }
+}
+
+//************************************************
+// Get the next subscribed frame from the TWAI driver
+bool tNMEA2000_twai::CANGetFrame(unsigned long &id, unsigned char &len, unsigned char *buf)
+{
+  uint64_t now = clockMicros();
+  uint8_t best = 0;
+
+  // Drop fast-packet messages which will not be completed any more
+  FastPacketPool.ExpireSlots(now);
+
+  // Record the queue depth before draining it
+  UpdateRxStatistics(now);
+
+  // Fetch everything that arrived since the last call
+  DrainRxQueue(now);
+
+  // Grow the queue only after it was drained into the staging buffer
+  GrowRxQueue();
+
+  if (StagedFrameCnt == 0)
+  {
+    return false;
+  }
+
+  // Serve the highest N2K priority (lowest value) first, oldest first within a priority
+  for (uint8_t i = 1; i < StagedFrameCnt; i++)
+  {
+    uint8_t priority = (StagedFrames[i].Id >> 26) & 0x07;
+    uint8_t bestPriority = (StagedFrames[best].Id >> 26) & 0x07;
+
+    if ((priority < bestPriority) ||
+        ((priority == bestPriority) && ((int32_t)(StagedFrames[i].Sequence - StagedFrames[best].Sequence) < 0)))
+    {
+      best = i;
+    }
+  }
+
+  id = StagedFrames[best].Id;
+  len = StagedFrames[best].Len;
+  memcpy(buf, StagedFrames[best].Data, len);
+
+  // The order within the buffer does not matter, fill the gap with the last frame
+  StagedFrames[best] = StagedFrames[--StagedFrameCnt];
+  return true;
+}
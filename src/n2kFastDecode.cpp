@@ -0,0 +1,283 @@
+/*!
+ * \file n2kFastDecode.cpp
+ * \brief Specialized decoders for the displayed NMEA2000 messages
+ *
+ * This file contains the decoders which extract only the displayed
+ * fields straight from the payload bytes and a benchmark against the
+ * library parsers.
+ *
+ */
+
+#include <n2kFastDecode.h>
+#include <sysClock.h>
+
+//*****************************************************************************
+// Read one byte, return the default if the message is too short
+static inline uint8_t GetByte(const tN2kMsg &N2kMsg, int Index, uint8_t Default)
+{
+  return (Index < N2kMsg.DataLen) ? N2kMsg.Data[Index] : Default;
+}
+
+//*****************************************************************************
+// Read a little endian 16-bit value, return the default if the message is too short
+static inline uint16_t GetUInt16(const tN2kMsg &N2kMsg, int Index, uint16_t Default)
+{
+  if (Index + 2 > N2kMsg.DataLen)
+  {
+    return Default;
+  }
+  return (uint16_t)N2kMsg.Data[Index] | ((uint16_t)N2kMsg.Data[Index + 1] << 8);
+}
+
+//*****************************************************************************
+// Read a little endian 32-bit value, return the default if the message is too short
+static inline uint32_t GetUInt32(const tN2kMsg &N2kMsg, int Index, uint32_t Default)
+{
+  if (Index + 4 > N2kMsg.DataLen)
+  {
+    return Default;
+  }
+  return (uint32_t)N2kMsg.Data[Index] | ((uint32_t)N2kMsg.Data[Index + 1] << 8) |
+         ((uint32_t)N2kMsg.Data[Index + 2] << 16) | ((uint32_t)N2kMsg.Data[Index + 3] << 24);
+}
+
+//*****************************************************************************
+// Decode PGN 127488 Engine Rapid
+bool FastParseN2kEngineRapid(const tN2kMsg &N2kMsg, tN2kFastEngineRapid &Data)
+{
+  if ((N2kMsg.PGN != 127488L) || (N2kMsg.DataLen < 1))
+  {
+    return false;
+  }
+
+  Data.EngineInstance = N2kMsg.Data[0];
+  Data.EngineSpeed = GetUInt16(N2kMsg, 1, N2kUInt16NA);
+  return true;
+}
+
+//*****************************************************************************
+// Decode PGN 127488 Engine Rapid from a raw CAN frame
+bool FastParseN2kEngineRapidFrame(unsigned char len, const unsigned char *buf, tN2kFastEngineRapid &Data)
+{
+  if (len < 3)
+  {
+    return false;
+  }
+
+  Data.EngineInstance = buf[0];
+  Data.EngineSpeed = (uint16_t)buf[1] | ((uint16_t)buf[2] << 8);
+  return true;
+}
+
+//*****************************************************************************
+// Decode PGN 127489 Engine Dynamic Parameters
+bool FastParseN2kEngineDynamic(const tN2kMsg &N2kMsg, tN2kFastEngineDynamic &Data)
+{
+  if ((N2kMsg.PGN != 127489L) || (N2kMsg.DataLen < 1))
+  {
+    return false;
+  }
+
+  // Byte layout: 0 instance, 1-2 oil pressure, 3-4 oil temperature,
+  // 5-6 coolant temperature, 7-8 alternator voltage, 9-10 fuel rate,
+  // 11-14 engine hours, 15-16 coolant pressure, 17-18 fuel pressure,
+  // 19 reserved, 20-21 status 1, 22-23 status 2, 24 load, 25 torque
+  Data.EngineInstance = N2kMsg.Data[0];
+  Data.OilPressure = GetUInt16(N2kMsg, 1, N2kUInt16NA);
+  Data.CoolantTemperature = GetUInt16(N2kMsg, 5, N2kUInt16NA);
+  Data.AlternatorVoltage = (int16_t)GetUInt16(N2kMsg, 7, N2kInt16NA);
+  Data.EngineHours = GetUInt32(N2kMsg, 11, N2kUInt32NA);
+  Data.Status1.Status = GetUInt16(N2kMsg, 20, 0);
+  Data.Status2.Status = GetUInt16(N2kMsg, 22, 0);
+  return true;
+}
+
+//*****************************************************************************
+// Decode PGN 127493 Transmission Parameters
+bool FastParseN2kTransmission(const tN2kMsg &N2kMsg, tN2kFastTransmission &Data)
+{
+  if ((N2kMsg.PGN != 127493L) || (N2kMsg.DataLen < 1))
+  {
+    return false;
+  }
+
+  Data.EngineInstance = N2kMsg.Data[0];
+  Data.TransmissionGear = (tN2kTransmissionGear)(GetByte(N2kMsg, 1, N2kTG_Unknown) & 0x03);
+  return true;
+}
+
+//*****************************************************************************
+// Decode PGN 126992 System Time
+bool FastParseN2kSystemTime(const tN2kMsg &N2kMsg, tN2kFastSystemTime &Data)
+{
+  if ((N2kMsg.PGN != 126992L) || (N2kMsg.DataLen < 1))
+  {
+    return false;
+  }
+
+  Data.SystemDate = GetUInt16(N2kMsg, 2, N2kUInt16NA);
+  Data.SystemTime = GetUInt32(N2kMsg, 4, N2kUInt32NA);
+  return true;
+}
+
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ---------------------------> Benchmark <-------------------------------------
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#if N2K_DECODE_BENCHMARK
+
+/// Number of decodes per message and parser
+#define N2K_DECODE_BENCHMARK_LOOPS 10000
+
+/// Sink for the decoded values, keeps the compiler from removing the loops
+static volatile uint32_t BenchmarkSink;
+
+//*****************************************************************************
+// Print one benchmark result
+static void PrintBenchmarkResult(const char *Label, uint64_t LibraryTime, uint64_t FastTime)
+{
+  Serial.print(Label);
+  Serial.print(": library ");
+  Serial.print((uint32_t)(LibraryTime * 1000 / N2K_DECODE_BENCHMARK_LOOPS));
+  Serial.print("ns fast ");
+  Serial.print((uint32_t)(FastTime * 1000 / N2K_DECODE_BENCHMARK_LOOPS));
+  Serial.print("ns speedup x");
+  Serial.println(FastTime ? (double)LibraryTime / FastTime : 0.0, 1);
+}
+
+//*****************************************************************************
+// Benchmark the decoders
+void benchmarkN2kDecoders(void)
+{
+  tN2kMsg N2kMsg;
+  uint64_t start;
+  uint64_t libraryTime;
+  uint64_t fastTime;
+
+  // ---------> 127488 Engine Rapid <--------------
+  {
+    unsigned char EngineInstance;
+    double EngineSpeed;
+    double EngineBoostPressure;
+    int8_t EngineTiltTrim;
+    tN2kFastEngineRapid Data;
+
+    SetN2kEngineParamRapid(N2kMsg, 0, 2150.25, 120000, 5);
+
+    start = clockMicros();
+    for (uint32_t i = 0; i < N2K_DECODE_BENCHMARK_LOOPS; i++)
+    {
+      ParseN2kEngineParamRapid(N2kMsg, EngineInstance, EngineSpeed, EngineBoostPressure, EngineTiltTrim);
+      BenchmarkSink = (uint32_t)EngineSpeed;
+    }
+    libraryTime = clockMicros() - start;
+
+    start = clockMicros();
+    for (uint32_t i = 0; i < N2K_DECODE_BENCHMARK_LOOPS; i++)
+    {
+      FastParseN2kEngineRapid(N2kMsg, Data);
+      BenchmarkSink = Data.EngineSpeed;
+    }
+    fastTime = clockMicros() - start;
+    PrintBenchmarkResult("  127488 Engine Rapid", libraryTime, fastTime);
+  }
+
+  // ---------> 127489 Engine Dynamic <--------------
+  {
+    unsigned char EngineInstance;
+    double EngineOilPress, EngineOilTemp, EngineCoolantTemp, AlternatorVoltage, FuelRate;
+    double EngineHours, EngineCoolantPress, EngineFuelPress;
+    int8_t EngineLoad, EngineTorque;
+    tN2kEngineDiscreteStatus1 Status1;
+    tN2kEngineDiscreteStatus2 Status2;
+    tN2kFastEngineDynamic Data;
+
+    SetN2kEngineDynamicParam(N2kMsg, 0, 350000, 360.15, 355.15, 14.2, 12.5, 1234567, 150000, 300000, 55, 40, Status1, Status2);
+
+    start = clockMicros();
+    for (uint32_t i = 0; i < N2K_DECODE_BENCHMARK_LOOPS; i++)
+    {
+      ParseN2kEngineDynamicParam(N2kMsg, EngineInstance, EngineOilPress, EngineOilTemp, EngineCoolantTemp,
+                                 AlternatorVoltage, FuelRate, EngineHours, EngineCoolantPress, EngineFuelPress,
+                                 EngineLoad, EngineTorque, Status1, Status2);
+      BenchmarkSink = (uint32_t)EngineCoolantTemp;
+    }
+    libraryTime = clockMicros() - start;
+
+    start = clockMicros();
+    for (uint32_t i = 0; i < N2K_DECODE_BENCHMARK_LOOPS; i++)
+    {
+      FastParseN2kEngineDynamic(N2kMsg, Data);
+      BenchmarkSink = Data.CoolantTemperature;
+    }
+    fastTime = clockMicros() - start;
+    PrintBenchmarkResult("  127489 Engine Dynamic", libraryTime, fastTime);
+  }
+
+  // ---------> 127493 Transmission Parameters <--------------
+  {
+    unsigned char EngineInstance;
+    tN2kTransmissionGear TransmissionGear;
+    double OilPressure;
+    double OilTemperature;
+    unsigned char DiscreteStatus1;
+    tN2kFastTransmission Data;
+
+    SetN2kTransmissionParameters(N2kMsg, 0, N2kTG_Forward, 1500000, 330.15, 0);
+
+    start = clockMicros();
+    for (uint32_t i = 0; i < N2K_DECODE_BENCHMARK_LOOPS; i++)
+    {
+      ParseN2kTransmissionParameters(N2kMsg, EngineInstance, TransmissionGear, OilPressure, OilTemperature, DiscreteStatus1);
+      BenchmarkSink = TransmissionGear;
+    }
+    libraryTime = clockMicros() - start;
+
+    start = clockMicros();
+    for (uint32_t i = 0; i < N2K_DECODE_BENCHMARK_LOOPS; i++)
+    {
+      FastParseN2kTransmission(N2kMsg, Data);
+      BenchmarkSink = Data.TransmissionGear;
+    }
+    fastTime = clockMicros() - start;
+    PrintBenchmarkResult("  127493 Transmission", libraryTime, fastTime);
+  }
+
+  // ---------> 126992 System Time <--------------
+  {
+    unsigned char SID;
+    uint16_t SystemDate;
+    double SystemTime;
+    tN2kTimeSource TimeSource;
+    tN2kFastSystemTime Data;
+
+    SetN2kSystemTime(N2kMsg, 1, 20000, 43200.5, N2ktimes_GPS);
+
+    start = clockMicros();
+    for (uint32_t i = 0; i < N2K_DECODE_BENCHMARK_LOOPS; i++)
+    {
+      ParseN2kSystemTime(N2kMsg, SID, SystemDate, SystemTime, TimeSource);
+      BenchmarkSink = SystemDate;
+    }
+    libraryTime = clockMicros() - start;
+
+    start = clockMicros();
+    for (uint32_t i = 0; i < N2K_DECODE_BENCHMARK_LOOPS; i++)
+    {
+      FastParseN2kSystemTime(N2kMsg, Data);
+      BenchmarkSink = Data.SystemDate;
+    }
+    fastTime = clockMicros() - start;
+    PrintBenchmarkResult("  126992 System Time", libraryTime, fastTime);
+  }
+}
+
+#else
+
+//*****************************************************************************
+// Benchmark disabled
+void benchmarkN2kDecoders(void)
+{
+}
+
+#endif // N2K_DECODE_BENCHMARK
@@ -0,0 +1,234 @@
+/*!
+ * \file n2kSourceArbiter.cpp
+ * \brief Arbitration between several senders of the same engine data
+ *
+ * This file contains the tracking of the source addresses and the
+ * selection policies.
+ *
+ */
+
+#include <n2kSourceArbiter.h>
+
+//************************************************
+// Constructor
+N2kSourceArbiter::N2kSourceArbiter(tN2kArbiterPolicy Policy)
+{
+  this->Policy = Policy;
+  memset(Sources, 0, sizeof(Sources));
+  Selected = nullptr;
+  Timeout = CLOCK_MS_TO_US(N2K_ARBITER_TIMEOUT_INTERVALS * N2K_ARBITER_ENGINE_DYNAMIC_INTERVAL);
+  IntervalStart = 0;
+  FailoverCnt = 0;
+  RejectedCnt = 0;
+}
+
+//************************************************
+// Set the nominal interval of the message
+void N2kSourceArbiter::SetInterval(uint32_t Interval)
+{
+  Timeout = CLOCK_MS_TO_US(N2K_ARBITER_TIMEOUT_INTERVALS * Interval);
+}
+
+//************************************************
+// Check if an entry received a message within the timeout
+bool N2kSourceArbiter::IsAlive(const tN2kSourceEntry *Entry, uint64_t now)
+{
+  return Entry && Entry->InUse && (now - Entry->LastTimestamp <= Timeout);
+}
+
+//************************************************
+// Find the entry of a source, allocate one if not tracked yet
+tN2kSourceEntry *N2kSourceArbiter::GetEntry(uint8_t Source, uint64_t now)
+{
+  tN2kSourceEntry *unused = nullptr;
+
+  for (uint8_t i = 0; i < N2K_ARBITER_MAX_SOURCES; i++)
+  {
+    if (Sources[i].InUse && (Sources[i].Source == Source))
+    {
+      return &Sources[i];
+    }
+    // Unused entries or dead sources which are not selected can be reused
+    if (!unused && (&Sources[i] != Selected) && !IsAlive(&Sources[i], now))
+    {
+      unused = &Sources[i];
+    }
+  }
+
+  // Table full with alive sources, the message is not tracked
+  if (!unused)
+  {
+    return nullptr;
+  }
+
+  memset(unused, 0, sizeof(tN2kSourceEntry));
+  unused->InUse = true;
+  unused->Source = Source;
+  return unused;
+}
+
+//************************************************
+// Close the rate interval if it is over
+void N2kSourceArbiter::UpdateRates(uint64_t now)
+{
+  uint64_t elapsed = now - IntervalStart;
+
+  if (elapsed < CLOCK_MS_TO_US(N2K_ARBITER_RATE_INTERVAL))
+  {
+    return;
+  }
+
+  for (uint8_t i = 0; i < N2K_ARBITER_MAX_SOURCES; i++)
+  {
+    Sources[i].Rate = (uint32_t)((uint64_t)Sources[i].IntervalCnt * CLOCK_MS_TO_US(10000) / elapsed);
+    Sources[i].IntervalCnt = 0;
+  }
+  IntervalStart = now;
+
+  // The rates changed, the highest rate source may be another one
+  if (Policy == N2K_ARBITER_HIGHEST_RATE)
+  {
+    for (uint8_t i = 0; i < N2K_ARBITER_MAX_SOURCES; i++)
+    {
+      if (IsAlive(&Sources[i], now) && IsAlive(Selected, now) && (Sources[i].Rate > Selected->Rate))
+      {
+        Selected = &Sources[i];
+      }
+    }
+  }
+}
+
+//************************************************
+// Select the source according to the policy
+void N2kSourceArbiter::SelectSource(uint64_t now)
+{
+  tN2kSourceEntry *best = nullptr;
+  bool failover = (Selected != nullptr) && !IsAlive(Selected, now);
+
+  // The preferred source takes over as soon as it is alive
+  if (Policy == N2K_ARBITER_PREFERRED)
+  {
+    for (uint8_t i = 0; i < N2K_ARBITER_MAX_SOURCES; i++)
+    {
+      if (IsAlive(&Sources[i], now) && (Sources[i].Source == N2K_ARBITER_PREFERRED_SOURCE))
+      {
+        Selected = &Sources[i];
+        return;
+      }
+    }
+  }
+
+  // Keep an alive source, no jumping between sources
+  if (IsAlive(Selected, now))
+  {
+    return;
+  }
+
+  // Fail over to the most recent source, or the one with the highest rate
+  for (uint8_t i = 0; i < N2K_ARBITER_MAX_SOURCES; i++)
+  {
+    if (!IsAlive(&Sources[i], now))
+    {
+      continue;
+    }
+    if (!best ||
+        ((Policy == N2K_ARBITER_HIGHEST_RATE) && (Sources[i].Rate > best->Rate)) ||
+        ((Policy != N2K_ARBITER_HIGHEST_RATE) && (Sources[i].LastTimestamp > best->LastTimestamp)))
+    {
+      best = &Sources[i];
+    }
+  }
+
+  Selected = best;
+  if (failover && Selected)
+  {
+    FailoverCnt++;
+  }
+}
+
+//************************************************
+// Record a message and check if its source is selected
+bool N2kSourceArbiter::Accept(uint8_t Source, uint64_t now)
+{
+  tN2kSourceEntry *entry = GetEntry(Source, now);
+
+  if (!entry)
+  {
+    RejectedCnt++;
+    return false;
+  }
+
+  entry->MsgCnt++;
+  entry->IntervalCnt++;
+  entry->LastTimestamp = now;
+
+  UpdateRates(now);
+  SelectSource(now);
+
+  if (entry != Selected)
+  {
+    RejectedCnt++;
+    return false;
+  }
+  return true;
+}
+
+//************************************************
+// Get the selected source address
+uint8_t N2kSourceArbiter::GetSelectedSource(void)
+{
+  return Selected ? Selected->Source : N2K_ARBITER_NO_SOURCE;
+}
+
+//************************************************
+// Get the number of failovers
+uint32_t N2kSourceArbiter::GetFailoverCnt(void)
+{
+  return FailoverCnt;
+}
+
+//************************************************
+// Get the number of messages dropped from not selected sources
+uint32_t N2kSourceArbiter::GetRejectedCnt(void)
+{
+  return RejectedCnt;
+}
+
+//************************************************
+// Show the tracked sources via Serial
+void N2kSourceArbiter::Show(const char *Label, uint8_t Instance)
+{
+  uint64_t now = clockMicros();
+
+  if (!Selected)
+  {
+    return;
+  }
+
+  Serial.print("  ");
+  Serial.print(Label);
+  Serial.print(" #");
+  Serial.print(Instance);
+  Serial.print(" sources:");
+  for (uint8_t i = 0; i < N2K_ARBITER_MAX_SOURCES; i++)
+  {
+    if (!Sources[i].InUse)
+    {
+      continue;
+    }
+    Serial.print(" ");
+    Serial.print(Sources[i].Source);
+    Serial.print((&Sources[i] == Selected) ? "*" : "");
+    Serial.print(IsAlive(&Sources[i], now) ? "" : " (dead)");
+    Serial.print(" ");
+    Serial.print(Sources[i].Rate / 10);
+    Serial.print(".");
+    Serial.print(Sources[i].Rate % 10);
+    Serial.print("/s");
+  }
+  Serial.print(" (failovers: ");
+  Serial.print(FailoverCnt);
+  Serial.print(", dropped: ");
+  Serial.print(RejectedCnt);
+  Serial.println(")");
+}
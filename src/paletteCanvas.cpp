@@ -0,0 +1,584 @@
+/*!
+ * \file paletteCanvas.cpp
+ * \brief Canvas with 8-bit palette indices for the display composition
+ *
+ * This file contains the drawing functions on the palette indices of a
+ * band of the frame and the expansion to RGB565 while pushing to the
+ * display.
+ *
+ */
+
+#include <paletteCanvas.h>
+#include <math.h>
+#include <esp_heap_caps.h>
+
+/// Conversion of degrees to radians
+#define CANVAS_DEG_TO_RAD ((float)M_PI / 180.0f)
+
+//************************************************
+// Constructor
+PaletteCanvas::PaletteCanvas(TFT_eSPI *Tft)
+{
+  this->Tft = Tft;
+  Pixels = nullptr;
+  LineBuffer[0] = nullptr;
+  LineBuffer[1] = nullptr;
+  NextBuffer = 0;
+  Dma = false;
+  Width = 0;
+  Height = 0;
+  Top = 0;
+  NightColor = 0;
+  memset(Palette, 0, sizeof(Palette));
+  memset(Output, 0, sizeof(Output));
+}
+
+//************************************************
+// Allocate the pixels and the line buffers
+bool PaletteCanvas::CreateSprite(int16_t Width, int16_t Height, bool Push)
+{
+  size_t lineBytes = (size_t)Width * PALETTE_CANVAS_PUSH_LINES * sizeof(uint16_t);
+
+  DeleteSprite();
+
+  if (Push)
+  {
+    // The line buffers are read by the DMA and have to be in internal RAM
+    Pixels = (uint8_t *)malloc((size_t)Width * Height);
+    LineBuffer[0] = (uint16_t *)heap_caps_malloc(lineBytes, MALLOC_CAP_DMA | MALLOC_CAP_8BIT);
+    LineBuffer[1] = (uint16_t *)heap_caps_malloc(lineBytes, MALLOC_CAP_DMA | MALLOC_CAP_8BIT);
+  }
+  else
+  {
+    // Keep the internal RAM free, a cached layer is only copied from
+    Pixels = (uint8_t *)heap_caps_malloc((size_t)Width * Height, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (Pixels == nullptr)
+    {
+      Pixels = (uint8_t *)malloc((size_t)Width * Height);
+    }
+  }
+  if ((Pixels == nullptr) || (Push && ((LineBuffer[0] == nullptr) || (LineBuffer[1] == nullptr))))
+  {
+    DeleteSprite();
+    return false;
+  }
+  this->Width = Width;
+  this->Height = Height;
+  Top = 0;
+  memset(Pixels, 0, (size_t)Width * Height);
+  return true;
+}
+
+//************************************************
+// Free the pixels and the line buffers
+void PaletteCanvas::DeleteSprite(void)
+{
+  free(Pixels);
+  free(LineBuffer[0]);
+  free(LineBuffer[1]);
+  Pixels = nullptr;
+  LineBuffer[0] = nullptr;
+  LineBuffer[1] = nullptr;
+  Width = 0;
+  Height = 0;
+}
+
+//************************************************
+// Push with DMA
+bool PaletteCanvas::InitDma(void)
+{
+  Dma = Tft->initDMA();
+  return Dma;
+}
+
+//************************************************
+// Move the canvas to a band of the frame
+void PaletteCanvas::SetBand(int16_t Top)
+{
+  this->Top = Top;
+}
+
+//************************************************
+// Get the first line of the band
+int16_t PaletteCanvas::GetBandTop(void) const
+{
+  return Top;
+}
+
+//************************************************
+// Get the number of lines of the band
+int16_t PaletteCanvas::GetBandHeight(void) const
+{
+  return Height;
+}
+
+//************************************************
+// Get the pixels as palettized image
+tPalettedImage PaletteCanvas::GetImage(void) const
+{
+  tPalettedImage image = {Palette, Pixels, PALETTE_CANVAS_COLORS, (uint16_t)Width, (uint16_t)Height};
+  return image;
+}
+
+//************************************************
+// Set one colour of the palette
+void PaletteCanvas::SetPaletteColor(uint8_t Index, uint16_t Color)
+{
+  Palette[Index] = Color;
+  Output[Index] = OutputColor(Color);
+}
+
+//************************************************
+// Copy colours from flash to the palette
+void PaletteCanvas::SetPalette(uint8_t First, const uint16_t *Colors, uint16_t Count)
+{
+  for (uint16_t i = 0; (i < Count) && (First + i < PALETTE_CANVAS_COLORS); i++)
+  {
+    SetPaletteColor(First + i, pgm_read_word(&Colors[i]));
+  }
+}
+
+//************************************************
+// Set a ramp from black to a colour
+void PaletteCanvas::SetPaletteRamp(uint8_t First, uint16_t Color, uint8_t Levels)
+{
+  uint16_t r, g, b;
+
+  for (uint8_t level = 1; (level <= Levels) && (First + level - 1 < PALETTE_CANVAS_COLORS); level++)
+  {
+    r = ((Color >> 11) * level) / Levels;
+    g = (((Color >> 5) & 0x3f) * level) / Levels;
+    b = ((Color & 0x1f) * level) / Levels;
+    SetPaletteColor(First + level - 1, (r << 11) | (g << 5) | b);
+  }
+}
+
+//************************************************
+// Get one colour of the palette
+uint16_t PaletteCanvas::GetPaletteColor(uint8_t Index) const
+{
+  return Palette[Index];
+}
+
+//************************************************
+// Show all colours in shades of one night colour
+void PaletteCanvas::SetNightColor(uint16_t Color)
+{
+  NightColor = Color;
+  for (uint16_t i = 0; i < PALETTE_CANVAS_COLORS; i++)
+  {
+    Output[i] = OutputColor(Palette[i]);
+  }
+}
+
+//************************************************
+// Convert a colour of the palette for the output
+uint16_t PaletteCanvas::OutputColor(uint16_t Color) const
+{
+  uint32_t luminance;
+
+  if (NightColor == 0)
+  {
+    return Color;
+  }
+
+  // Luminance 0..255 of the colour, weights of ITU-R BT.601
+  luminance = (77 * (((Color >> 11) * 527 + 23) >> 6) + 150 * ((((Color >> 5) & 0x3f) * 259 + 33) >> 6) +
+               29 * (((Color & 0x1f) * 527 + 23) >> 6)) >>
+              8;
+
+  // Night colour scaled by the luminance
+  return ((((NightColor >> 11) * luminance) / 255) << 11) | (((((NightColor >> 5) & 0x3f) * luminance) / 255) << 5) |
+         (((NightColor & 0x1f) * luminance) / 255);
+}
+
+//************************************************
+// Clip a rectangle to the band
+bool PaletteCanvas::Clip(int32_t &x, int32_t &y, int32_t &w, int32_t &h) const
+{
+  if (x < 0)
+  {
+    w += x;
+    x = 0;
+  }
+  if (y < Top)
+  {
+    h -= Top - y;
+    y = Top;
+  }
+  if (x + w > Width)
+  {
+    w = Width - x;
+  }
+  if (y + h > Top + Height)
+  {
+    h = Top + Height - y;
+  }
+  return (Pixels != nullptr) && (w > 0) && (h > 0);
+}
+
+//************************************************
+// Fill the whole canvas with one palette index
+void PaletteCanvas::FillSprite(uint8_t Index)
+{
+  if (Pixels != nullptr)
+  {
+    memset(Pixels, Index, (size_t)Width * Height);
+  }
+}
+
+//************************************************
+// Set one pixel
+void PaletteCanvas::DrawPixel(int32_t x, int32_t y, uint8_t Index)
+{
+  if ((Pixels != nullptr) && (x >= 0) && (y >= Top) && (x < Width) && (y < Top + Height))
+  {
+    Pixels[(y - Top) * Width + x] = Index;
+  }
+}
+
+//************************************************
+// Draw a horizontal line
+void PaletteCanvas::DrawFastHLine(int32_t x, int32_t y, int32_t w, uint8_t Index)
+{
+  FillRect(x, y, w, 1, Index);
+}
+
+//************************************************
+// Fill a rectangle
+void PaletteCanvas::FillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint8_t Index)
+{
+  if (!Clip(x, y, w, h))
+  {
+    return;
+  }
+  for (int32_t line = y; line < y + h; line++)
+  {
+    memset(&Pixels[(line - Top) * Width + x], Index, w);
+  }
+}
+
+//************************************************
+// Copy a rectangle of a palettized image
+void PaletteCanvas::PushImage(int32_t x, int32_t y, const tPalettedImage &Image, int32_t sx, int32_t sy, int32_t w,
+                              int32_t h)
+{
+  int32_t dx = x;
+  int32_t dy = y;
+
+  // Keep the rectangle within the image
+  if (sx < 0)
+  {
+    w += sx;
+    dx -= sx;
+    sx = 0;
+  }
+  if (sy < 0)
+  {
+    h += sy;
+    dy -= sy;
+    sy = 0;
+  }
+  if (sx + w > Image.Width)
+  {
+    w = Image.Width - sx;
+  }
+  if (sy + h > Image.Height)
+  {
+    h = Image.Height - sy;
+  }
+
+  // And within the canvas
+  x = dx;
+  y = dy;
+  if (!Clip(x, y, w, h))
+  {
+    return;
+  }
+  sx += x - dx;
+  sy += y - dy;
+
+  for (int32_t line = 0; line < h; line++)
+  {
+    memcpy_P(&Pixels[(y + line - Top) * Width + x], &Image.Pixels[(sy + line) * Image.Width + sx], w);
+  }
+}
+
+//************************************************
+// Draw a palettized image rotated around its pivot
+void PaletteCanvas::PushRotated(const tPalettedImage &Image, int16_t PivotX, int16_t PivotY, int32_t x, int32_t y,
+                                int16_t Angle, uint8_t Transparent)
+{
+  const int32_t one = 1 << PALETTE_CANVAS_ROTATE_FRACTION_BITS;
+  float angle = Angle * CANVAS_DEG_TO_RAD;
+  float sinAngle = sinf(angle);
+  float cosAngle = cosf(angle);
+  // Steps of the source position per canvas pixel, the inverse rotation
+  int32_t sinStep = (int32_t)lroundf(-sinAngle * one);
+  int32_t cosStep = (int32_t)lroundf(cosAngle * one);
+  uint32_t sourceWidth = (uint32_t)Image.Width << PALETTE_CANVAS_ROTATE_FRACTION_BITS;
+  uint32_t sourceHeight = (uint32_t)Image.Height << PALETTE_CANVAS_ROTATE_FRACTION_BITS;
+  int32_t minX = INT32_MAX;
+  int32_t minY = INT32_MAX;
+  int32_t maxX = INT32_MIN;
+  int32_t maxY = INT32_MIN;
+
+  if (Pixels == nullptr)
+  {
+    return;
+  }
+
+  // Bounding box of the rotated corners
+  for (uint8_t corner = 0; corner < 4; corner++)
+  {
+    float cx = ((corner & 1) ? Image.Width : 0) - PivotX;
+    float cy = ((corner & 2) ? Image.Height : 0) - PivotY;
+    int32_t rx = x + (int32_t)floorf(cx * cosAngle - cy * sinAngle);
+    int32_t ry = y + (int32_t)floorf(cx * sinAngle + cy * cosAngle);
+    minX = (rx < minX) ? rx : minX;
+    maxX = (rx + 1 > maxX) ? rx + 1 : maxX;
+    minY = (ry < minY) ? ry : minY;
+    maxY = (ry + 1 > maxY) ? ry + 1 : maxY;
+  }
+  minX = (minX < 0) ? 0 : minX;
+  minY = (minY < Top) ? Top : minY;
+  maxX = (maxX >= Width) ? Width - 1 : maxX;
+  maxY = (maxY >= Top + Height) ? Top + Height - 1 : maxY;
+
+  for (int32_t row = minY; row <= maxY; row++)
+  {
+    int32_t dx = minX - x;
+    int32_t dy = row - y;
+    uint32_t sx = (uint32_t)(cosStep * dx - sinStep * dy + (PivotX << PALETTE_CANVAS_ROTATE_FRACTION_BITS) + one / 2);
+    uint32_t sy = (uint32_t)(sinStep * dx + cosStep * dy + (PivotY << PALETTE_CANVAS_ROTATE_FRACTION_BITS) + one / 2);
+    uint8_t *pixel = &Pixels[(row - Top) * Width + minX];
+
+    for (int32_t col = minX; col <= maxX; col++, pixel++, sx += cosStep, sy += sinStep)
+    {
+      // A negative position wraps to a large value and fails the check too
+      if ((sx < sourceWidth) && (sy < sourceHeight))
+      {
+        uint8_t index = pgm_read_byte(&Image.Pixels[(sy >> PALETTE_CANVAS_ROTATE_FRACTION_BITS) * Image.Width +
+                                                    (sx >> PALETTE_CANVAS_ROTATE_FRACTION_BITS)]);
+        if (index != Transparent)
+        {
+          *pixel = index;
+        }
+      }
+    }
+  }
+}
+
+//************************************************
+// Draw an icon of an icon atlas with a ramp
+void PaletteCanvas::PushIcon(const tLampIcon &Icon, const uint8_t *Atlas, int32_t x, int32_t y, uint8_t Ramp)
+{
+  const uint8_t *data = &Atlas[Icon.Offset];
+  int32_t first = (y < Top) ? Top - y : 0;
+  int32_t last = (y + Icon.Height > Top + Height) ? Top + Height - y : Icon.Height;
+  uint8_t level;
+
+  for (int32_t row = first; row < last; row++)
+  {
+    for (int32_t col = 0; col < Icon.Width; col++)
+    {
+      // Two pixels per byte, the left one in the high nibble
+      level = pgm_read_byte(data + (row * Icon.Width + col) / 2);
+      level = (col & 1) ? (level & 0x0f) : (level >> 4);
+      if (level != LAMP_ATLAS_TRANSPARENT)
+      {
+        DrawPixel(x + col, y + row, (level == 0) ? 0 : Ramp + level - 1);
+      }
+    }
+  }
+}
+
+//************************************************
+// Draw an anti aliased line with round ends
+void PaletteCanvas::DrawSmoothLine(float x0, float y0, float x1, float y1, float LineWidth, uint8_t Ramp,
+                                   uint8_t Levels)
+{
+  float half = LineWidth / 2.0f;
+  float dx = x1 - x0;
+  float dy = y1 - y0;
+  float length2 = dx * dx + dy * dy;
+  int32_t minX = (int32_t)floorf(((x0 < x1) ? x0 : x1) - half - 1.0f);
+  int32_t maxX = (int32_t)ceilf(((x0 > x1) ? x0 : x1) + half + 1.0f);
+  int32_t minY = (int32_t)floorf(((y0 < y1) ? y0 : y1) - half - 1.0f);
+  int32_t maxY = (int32_t)ceilf(((y0 > y1) ? y0 : y1) + half + 1.0f);
+
+  // Only the pixels of the band
+  minY = (minY < Top) ? Top : minY;
+  maxY = (maxY >= Top + Height) ? Top + Height - 1 : maxY;
+  minX = (minX < 0) ? 0 : minX;
+  maxX = (maxX >= Width) ? Width - 1 : maxX;
+
+  for (int32_t py = minY; py <= maxY; py++)
+  {
+    for (int32_t px = minX; px <= maxX; px++)
+    {
+      // Distance of the pixel centre to the nearest point of the line
+      float t = (length2 > 0.0f) ? ((px - x0) * dx + (py - y0) * dy) / length2 : 0.0f;
+      t = (t < 0.0f) ? 0.0f : ((t > 1.0f) ? 1.0f : t);
+      float ex = px - (x0 + t * dx);
+      float ey = py - (y0 + t * dy);
+      float coverage = half + 0.5f - sqrtf(ex * ex + ey * ey);
+      uint8_t level;
+
+      if (coverage <= 0.0f)
+      {
+        continue;
+      }
+      level = (coverage >= 1.0f) ? Levels : (uint8_t)(coverage * Levels + 0.5f);
+      if (level > 0)
+      {
+        Pixels[(py - Top) * Width + px] = Ramp + level - 1;
+      }
+    }
+  }
+}
+
+//************************************************
+// Draw an anti aliased arc with round ends
+void PaletteCanvas::DrawSmoothArc(int32_t x, int32_t y, int32_t r, int32_t ir, uint32_t StartAngle, uint32_t EndAngle,
+                                  uint8_t Ramp, uint8_t Levels)
+{
+  float center = (r + ir) / 2.0f;
+  float half = (r - ir) / 2.0f;
+  float start = (float)(StartAngle % 360);
+  float sweep = (float)(((EndAngle % 360) + 360 - (StartAngle % 360)) % 360);
+  float startX = -sinf(start * CANVAS_DEG_TO_RAD) * center;
+  float startY = cosf(start * CANVAS_DEG_TO_RAD) * center;
+  float endX = -sinf((start + sweep) * CANVAS_DEG_TO_RAD) * center;
+  float endY = cosf((start + sweep) * CANVAS_DEG_TO_RAD) * center;
+  int32_t outer2 = (r + 1) * (r + 1);
+  int32_t inner2 = (ir > 1) ? (ir - 1) * (ir - 1) : 0;
+  int32_t minX = x + r + 1;
+  int32_t minY = y + r + 1;
+  int32_t maxX = x - r - 1;
+  int32_t maxY = y - r - 1;
+
+  // Bounding box of the centre line, widened by the half width
+  for (float angle = start; angle <= start + sweep + 2.0f; angle += 2.0f)
+  {
+    float a = ((angle < start + sweep) ? angle : start + sweep) * CANVAS_DEG_TO_RAD;
+    int32_t px = x + (int32_t)lroundf(-sinf(a) * center);
+    int32_t py = y + (int32_t)lroundf(cosf(a) * center);
+    minX = (px < minX) ? px : minX;
+    maxX = (px > maxX) ? px : maxX;
+    minY = (py < minY) ? py : minY;
+    maxY = (py > maxY) ? py : maxY;
+  }
+  minX -= (int32_t)half + 2;
+  minY -= (int32_t)half + 2;
+  maxX += (int32_t)half + 2;
+  maxY += (int32_t)half + 2;
+
+  // Only the lines of the band
+  minY = (minY < Top) ? Top : minY;
+  maxY = (maxY >= Top + Height) ? Top + Height - 1 : maxY;
+
+  for (int32_t py = minY; py <= maxY; py++)
+  {
+    for (int32_t px = minX; px <= maxX; px++)
+    {
+      int32_t dx = px - x;
+      int32_t dy = py - y;
+      int32_t d2 = dx * dx + dy * dy;
+      float distance;
+      float coverage;
+      uint8_t level;
+
+      // Only the ring can be covered
+      if ((d2 > outer2) || (d2 < inner2))
+      {
+        continue;
+      }
+
+      // Angle clockwise from 6 o'clock, relative to the start
+      float angle = atan2f((float)-dx, (float)dy) / CANVAS_DEG_TO_RAD - start;
+      while (angle < 0.0f)
+      {
+        angle += 360.0f;
+      }
+
+      if (angle <= sweep)
+      {
+        distance = fabsf(sqrtf((float)d2) - center);
+      }
+      else
+      {
+        // Outside of the sweep only the round ends are covered
+        float ds = sqrtf((dx - startX) * (dx - startX) + (dy - startY) * (dy - startY));
+        float de = sqrtf((dx - endX) * (dx - endX) + (dy - endY) * (dy - endY));
+        distance = (ds < de) ? ds : de;
+      }
+
+      coverage = half + 0.5f - distance;
+      if (coverage <= 0.0f)
+      {
+        continue;
+      }
+      level = (coverage >= 1.0f) ? Levels : (uint8_t)(coverage * Levels + 0.5f);
+      if (level > 0)
+      {
+        DrawPixel(px, py, Ramp + level - 1);
+      }
+    }
+  }
+}
+
+//************************************************
+// Push a rectangle of the band to the display
+void PaletteCanvas::PushSprite(int32_t tx, int32_t ty, int32_t sx, int32_t sy, int32_t sw, int32_t sh)
+{
+  int32_t x = sx;
+  int32_t y = sy;
+  bool swap = Tft->getSwapBytes();
+
+  if ((LineBuffer[0] == nullptr) || !Clip(sx, sy, sw, sh))
+  {
+    return;
+  }
+  tx += sx - x;
+  ty += sy - y;
+
+  // The bytes are swapped while expanding, the DMA would swap them in place in an extra pass
+  Tft->setSwapBytes(false);
+  for (int32_t line = 0; line < sh; line += PALETTE_CANVAS_PUSH_LINES)
+  {
+    int32_t lines = (sh - line < PALETTE_CANVAS_PUSH_LINES) ? sh - line : PALETTE_CANVAS_PUSH_LINES;
+    uint16_t *buffer = LineBuffer[NextBuffer];
+    uint16_t *out = buffer;
+
+    // Expand the indices to RGB565, the DMA of the other buffer may still run
+    for (int32_t row = 0; row < lines; row++)
+    {
+      const uint8_t *in = &Pixels[(sy + line + row - Top) * Width + sx];
+      for (int32_t col = 0; col < sw; col++)
+      {
+        uint16_t color = Output[*in++];
+        *out++ = swap ? (uint16_t)((color << 8) | (color >> 8)) : color;
+      }
+    }
+
+    // pushImageDMA() waits for the previous transfer, which used the other buffer
+    if (Dma)
+    {
+      Tft->pushImageDMA(tx, ty + line, sw, lines, buffer);
+      NextBuffer ^= 1;
+    }
+    else
+    {
+      Tft->pushImage(tx, ty + line, sw, lines, buffer);
+    }
+  }
+  Tft->setSwapBytes(swap);
+}
+
+//************************************************
+// Push the whole band to the display
+void PaletteCanvas::PushSprite(int32_t x, int32_t y)
+{
+  PushSprite(x, y + Top, 0, Top, Width, Height);
+}
@@ -13,7 +13,13 @@
 
 #include <process_n2k.h>
 #include <N2kMessagesEnumToStr.h>
-#include <NMEA2000_CAN.h>
+#include <n2kCanDriver.h>
+#include <latencyMonitor.h>
+#include <n2kFastDecode.h>
+#include <n2kSourceArbiter.h>
+#include <signalFilter.h>
+#include <alarmEngine.h>
+#include <limits>
 
 // Define DISPLAY_ENGINE_INSTANCE if not already defined
 #ifndef DISPLAY_ENGINE_INSTANCE
@@ -26,25 +32,69 @@
 Stream *OutputStream;
 #endif
 
-// Global Structure for the display data
-tDisplayData DisplayData;
-
 // Object for the NMEA2000 messages statistics
 N2kMsgStatistics N2kMessageStatistics;
 
+// Arbitration between several senders per engine instance
+static N2kSourceArbiter EngineRapidArbiter[N2K_MAX_ENGINE_INSTANCES];
+static N2kSourceArbiter EngineDynamicArbiter[N2K_MAX_ENGINE_INSTANCES];
+
+// Conditioning of the noisy signals per engine instance
+static SignalFilter EngineSpeedFilter[N2K_MAX_ENGINE_INSTANCES];
+static SignalFilter CoolantTemperatureFilter[N2K_MAX_ENGINE_INSTANCES];
+static SignalFilter AlternatorVoltageFilter[N2K_MAX_ENGINE_INSTANCES];
+
 // Handler for the NMEA2000 messages
 tNMEA2000Handler NMEA2000Handlers[] = {
-    {126992L, &SystemTime},
-    {127488L, &EngineRapid},
-    {127489L, &EngineDynamicParameters},
-    {127493L, &TransmissionParameters},
-    {0, 0} // Terminator for the PGN search function, indicating the end of the handler list
+    {126992L, &SystemTime, false},
+    {127488L, &EngineRapid, false},
+    {127489L, &EngineDynamicParameters, true},
+    {127493L, &TransmissionParameters, false},
+    {0, 0, false} // Terminator for the PGN search function, indicating the end of the handler list
 };
 
 void updateN2K(void)
 {
+  uint64_t now;
+
   // Process NMEA2000 messages
   NMEA2000.ParseMessages();
+  now = clockMicros();
+
+  // Mark the signals stale which timed out
+  signalRegistryAdvance(now);
+  // Raise the alarms whose delay elapsed
+  for (uint8_t instance = 0; instance < N2K_MAX_ENGINE_INSTANCES; instance++)
+  {
+    alarmEvaluate(instance, now);
+  }
+}
+
+//*****************************************************************************
+// Wait for the next update of the NMEA2000 messages
+void waitN2K(uint64_t &nextWakeTime, uint32_t periodMs)
+{
+#if N2K_ENGINE_RAPID_FAST_PATH
+  uint64_t start = clockMicros();
+
+  // Wake up on the next received frame
+  if (N2kCanDriver.WaitRxData(periodMs))
+  {
+    nextWakeTime = clockMicros();
+    return;
+  }
+
+  // Sleep for the rest of the period, nothing after a timeout, but the
+  // whole period if the wait failed at once, e.g. without a driver
+  if (!clockIsElapsed(start, periodMs))
+  {
+    nextWakeTime = start;
+    clockSleepUntil(nextWakeTime, periodMs);
+  }
+  nextWakeTime = clockMicros();
+#else
+  clockSleepUntil(nextWakeTime, periodMs);
+#endif
 }
 
 //*****************************************************************************
@@ -53,15 +103,12 @@ void PrintFailedToParsePGN(uint32_t PGN)
 {
 #ifdef DEBUG_ERROR
   // Tread safety with mutex SerialOutputMutex
-  if (SerialOutputMutex)
+  if (takeSerialOutputMutex())
   {
-    if (xSemaphoreTake(SerialOutputMutex, pdMS_TO_TICKS(20)) == pdTRUE)
-    {
-      OutputStream->print("Failed to parse PGN: ");
-      OutputStream->println(PGN);
-      // free the mutex
-      xSemaphoreGive(SerialOutputMutex);
-    }
+    OutputStream->print("Failed to parse PGN: ");
+    OutputStream->println(PGN);
+    // free the mutex
+    giveSerialOutputMutex();
   }
 #endif
 }
@@ -119,7 +166,38 @@ int8_t initN2K(void)
   NMEA2000.EnableForward(DEBUG_RAW_N2K_MESSAGES);
 #endif
 
-  // NMEA2000.SetN2kCANReceiveFrameBufSize(50);
+  // Nothing received so far
+  signalRegistryInit();
+
+  // Configure the signal filters
+  const tSignalFilterConfig engineSpeedFilter = FILTER_ENGINE_SPEED;
+  const tSignalFilterConfig coolantTemperatureFilter = FILTER_COOLANT_TEMPERATURE;
+  const tSignalFilterConfig alternatorVoltageFilter = FILTER_ALTERNATOR_VOLTAGE;
+  for (uint8_t instance = 0; instance < N2K_MAX_ENGINE_INSTANCES; instance++)
+  {
+    EngineSpeedFilter[instance].Configure(engineSpeedFilter);
+    CoolantTemperatureFilter[instance].Configure(coolantTemperatureFilter);
+    AlternatorVoltageFilter[instance].Configure(alternatorVoltageFilter);
+    // The source timeout follows the rate of the message
+    EngineRapidArbiter[instance].SetInterval(N2K_ARBITER_ENGINE_RAPID_INTERVAL);
+    EngineDynamicArbiter[instance].SetInterval(N2K_ARBITER_ENGINE_DYNAMIC_INTERVAL);
+  }
+
+  // Subscribe the PGNs of the handler list, only these pass the CAN filter
+  for (int iHandler = 0; NMEA2000Handlers[iHandler].PGN != 0; iHandler++)
+  {
+    N2kCanDriver.SubscribePGN(NMEA2000Handlers[iHandler].PGN, NMEA2000Handlers[iHandler].FastPacket);
+  }
+  N2kCanDriver.SetAcceptedSource(N2K_ACCEPTED_SOURCE_ADDRESS);
+  // Subscribed fast-packet messages are reassembled by the CAN driver
+  N2kCanDriver.SetFastPacketHandler(HandleNMEA2000Msg);
+#if N2K_ENGINE_RAPID_FAST_PATH
+  // Engine Rapid of the displayed engine is decoded by the CAN driver
+  N2kCanDriver.SetEarlyFrameHandler(127488L, EngineRapidFrame);
+#endif
+
+  // Receive queue of the TWAI driver, the library frame buffer is not used
+  N2kCanDriver.SetRxQueueLen(N2K_CAN_RX_QUEUE_LEN);
   // Do not forward bus messages at all
   NMEA2000.SetForwardType(tNMEA2000::fwdt_Text);
   NMEA2000.SetMsgHandler(HandleNMEA2000Msg);
@@ -143,15 +221,12 @@ void HandleNMEA2000Msg(const tN2kMsg &N2kMsg)
 // Only if Debug is enabled
 #ifdef DEBUG_NSK_MSG
   // Tread safety with mutex SerialOutputMutex
-  if (SerialOutputMutex)
+  if (takeSerialOutputMutex())
   {
-    if (xSemaphoreTake(SerialOutputMutex, pdMS_TO_TICKS(20)) == pdTRUE)
-    {
-      OutputStream->print(millis());
-      OutputStream->print(": In Main Handler: ");
-      OutputStream->println(N2kMsg.PGN);
-      xSemaphoreGive(SerialOutputMutex);
-    }
+    OutputStream->print(clockMillis());
+    OutputStream->print(": In Main Handler: ");
+    OutputStream->println(N2kMsg.PGN);
+    giveSerialOutputMutex();
   }
 #endif
 
@@ -167,8 +242,11 @@ void HandleNMEA2000Msg(const tN2kMsg &N2kMsg)
 }
 
 //*****************************************************************************
-void EngineRapid(const tN2kMsg &N2kMsg)
+// Print Engine Rapid message decoded by the library parser
+void PrintEngineRapid(const tN2kMsg &N2kMsg)
 {
+// Only if Debug is enabled
+#ifdef DEBUG_NSK_MSG
   unsigned char EngineInstance;
   double EngineSpeed;
   double EngineBoostPressure;
@@ -176,31 +254,74 @@ void EngineRapid(const tN2kMsg &N2kMsg)
 
   if (ParseN2kEngineParamRapid(N2kMsg, EngineInstance, EngineSpeed, EngineBoostPressure, EngineTiltTrim))
   {
-    // Update N2k Statistics
-    N2kMessageStatistics.UpdateMsgCnt(N2kMsg.PGN);
-// Only if Debug is enabled
-#ifdef DEBUG_NSK_MSG
     // Tread safety with mutex SerialOutputMutex
-    if (SerialOutputMutex)
+    if (takeSerialOutputMutex())
     {
-      if (xSemaphoreTake(SerialOutputMutex, pdMS_TO_TICKS(20)) == pdTRUE)
-      {
-        OutputStream->print(millis());
-        OutputStream->print(": ");
-        PrintLabelValWithConversionCheckUnDef("Engine rapid params: ", EngineInstance, 0, true);
-        PrintLabelValWithConversionCheckUnDef("  RPM: ", EngineSpeed, 0, true);
-        PrintLabelValWithConversionCheckUnDef("  boost pressure (Pa): ", EngineBoostPressure, 0, true);
-        PrintLabelValWithConversionCheckUnDef("  tilt trim: ", EngineTiltTrim, 0, true);
-        // free the mutex
-        xSemaphoreGive(SerialOutputMutex);
-      }
+      OutputStream->print(clockMillis());
+      OutputStream->print(": ");
+      PrintLabelValWithConversionCheckUnDef("Engine rapid params: ", EngineInstance, 0, true);
+      PrintLabelValWithConversionCheckUnDef("  RPM: ", EngineSpeed, 0, true);
+      PrintLabelValWithConversionCheckUnDef("  boost pressure (Pa): ", EngineBoostPressure, 0, true);
+      PrintLabelValWithConversionCheckUnDef("  tilt trim: ", EngineTiltTrim, 0, true);
+      // free the mutex
+      giveSerialOutputMutex();
     }
+  }
 #endif
-    // Update the display data if the engine instance is the one to be displayed
-    if (EngineInstance == DISPLAY_ENGINE_INSTANCE)
+}
+
+//*****************************************************************************
+// Filter a raw value, "not available" passes unfiltered and resets the filter
+template <typename T>
+T FilterSignal(SignalFilter &Filter, T Raw, bool Available, uint64_t now)
+{
+  int32_t value;
+
+  if (!Available)
+  {
+    Filter.Reset();
+    return Raw;
+  }
+
+  // Keep overshoot off the range limits, the top values are reserved for "not available"
+  value = Filter.Update((int32_t)Raw, now);
+  if (value < (int32_t)std::numeric_limits<T>::min())
+  {
+    value = std::numeric_limits<T>::min();
+  }
+  else if (value > (int32_t)std::numeric_limits<T>::max() - 2)
+  {
+    value = std::numeric_limits<T>::max() - 2;
+  }
+  return (T)value;
+}
+
+//*****************************************************************************
+void EngineRapid(const tN2kMsg &N2kMsg)
+{
+  uint64_t ArrivalTime = clockMicros();
+  tN2kFastEngineRapid Data;
+
+  if (FastParseN2kEngineRapid(N2kMsg, Data))
+  {
+    // Update N2k Statistics, per instance as for the frames decoded in the CAN driver
+    N2kMessageStatistics.UpdateMsgCnt(N2kMsg.PGN, Data.EngineInstance);
+    // Only if Debug is enabled
+    PrintEngineRapid(N2kMsg);
+
+    // Update the engine speed if the engine instance is tracked and the sender selected
+    if ((Data.EngineInstance < N2K_MAX_ENGINE_INSTANCES) &&
+        EngineRapidArbiter[Data.EngineInstance].Accept(N2kMsg.Source, ArrivalTime))
     {
-      // Update the display data
-      DisplayData.EngineSpeed = EngineSpeed;
+      bool available = Data.EngineSpeed != N2kUInt16NA;
+      uint16_t speed = FilterSignal(EngineSpeedFilter[Data.EngineInstance], Data.EngineSpeed, available, ArrivalTime);
+
+      EngineSpeedSignal::Set(Data.EngineInstance, speed, available, ArrivalTime);
+      // Stamp the frame of the displayed engine for the latency measurement
+      if (Data.EngineInstance == DISPLAY_ENGINE_INSTANCE)
+      {
+        latencyFrameArrived(ArrivalTime);
+      }
     }
   }
   else
@@ -213,8 +334,42 @@ void EngineRapid(const tN2kMsg &N2kMsg)
 }
 
 //*****************************************************************************
-void EngineDynamicParameters(const tN2kMsg &N2kMsg)
+// Decode an EngineRapid frame in the CAN driver
+bool EngineRapidFrame(unsigned long id, unsigned char len, const unsigned char *buf, uint64_t now)
 {
+  tN2kFastEngineRapid Data;
+
+  // Frames of other instances take the way through the library
+  if (!FastParseN2kEngineRapidFrame(len, buf, Data) || (Data.EngineInstance >= N2K_MAX_ENGINE_INSTANCES))
+  {
+    return false;
+  }
+
+  // Update N2k Statistics
+  N2kMessageStatistics.UpdateMsgCnt(127488L, Data.EngineInstance);
+
+  // Only the selected sender updates the engine speed
+  if (EngineRapidArbiter[Data.EngineInstance].Accept(id & 0xFF, now))
+  {
+    bool available = Data.EngineSpeed != N2kUInt16NA;
+    uint16_t speed = FilterSignal(EngineSpeedFilter[Data.EngineInstance], Data.EngineSpeed, available, now);
+
+    EngineSpeedSignal::Set(Data.EngineInstance, speed, available, now);
+    // Stamp the frame of the displayed engine for the latency measurement
+    if (Data.EngineInstance == DISPLAY_ENGINE_INSTANCE)
+    {
+      latencyFrameArrived(now);
+    }
+  }
+  return true;
+}
+
+//*****************************************************************************
+// Print Engine Dynamic message decoded by the library parser
+void PrintEngineDynamicParameters(const tN2kMsg &N2kMsg)
+{
+// Only if Debug is enabled
+#ifdef DEBUG_NSK_MSG
   unsigned char EngineInstance;
   double EngineOilPress;
   double EngineOilTemp;
@@ -234,45 +389,63 @@ void EngineDynamicParameters(const tN2kMsg &N2kMsg)
                                  EngineCoolantPress, EngineFuelPress,
                                  EngineLoad, EngineTorque, Status1, Status2))
   {
-    // Update N2k Statistics
-    N2kMessageStatistics.UpdateMsgCnt(N2kMsg.PGN);
-// Only if Debug is enabled
-#ifdef DEBUG_NSK_MSG
     // Tread safety with mutex SerialOutputMutex
-    if (SerialOutputMutex)
+    if (takeSerialOutputMutex())
     {
-      if (xSemaphoreTake(SerialOutputMutex, pdMS_TO_TICKS(20)) == pdTRUE)
-      {
-        OutputStream->print(millis());
-        OutputStream->print(": ");
-        PrintLabelValWithConversionCheckUnDef("Engine dynamic params: ", EngineInstance, 0, true);
-        PrintLabelValWithConversionCheckUnDef("  oil pressure (Pa): ", EngineOilPress, 0, true);
-        PrintLabelValWithConversionCheckUnDef("  oil temp (C): ", EngineOilTemp, &KelvinToC, true);
-        PrintLabelValWithConversionCheckUnDef("  coolant temp (C): ", EngineCoolantTemp, &KelvinToC, true);
-        PrintLabelValWithConversionCheckUnDef("  altenator voltage (V): ", AlternatorVoltage, 0, true);
-        PrintLabelValWithConversionCheckUnDef("  fuel rate (l/h): ", FuelRate, 0, true);
-        PrintLabelValWithConversionCheckUnDef("  engine hours (h): ", EngineHours, &SecondsToh, true);
-        PrintLabelValWithConversionCheckUnDef("  coolant pressure (Pa): ", EngineCoolantPress, 0, true);
-        PrintLabelValWithConversionCheckUnDef("  fuel pressure (Pa): ", EngineFuelPress, 0, true);
-        PrintLabelValWithConversionCheckUnDef("  engine load (%): ", EngineLoad, 0, true);
-        PrintLabelValWithConversionCheckUnDef("  engine torque (%): ", EngineTorque, 0, true);
+      OutputStream->print(clockMillis());
+      OutputStream->print(": ");
+      PrintLabelValWithConversionCheckUnDef("Engine dynamic params: ", EngineInstance, 0, true);
+      PrintLabelValWithConversionCheckUnDef("  oil pressure (Pa): ", EngineOilPress, 0, true);
+      PrintLabelValWithConversionCheckUnDef("  oil temp (C): ", EngineOilTemp, &KelvinToC, true);
+      PrintLabelValWithConversionCheckUnDef("  coolant temp (C): ", EngineCoolantTemp, &KelvinToC, true);
+      PrintLabelValWithConversionCheckUnDef("  altenator voltage (V): ", AlternatorVoltage, 0, true);
+      PrintLabelValWithConversionCheckUnDef("  fuel rate (l/h): ", FuelRate, 0, true);
+      PrintLabelValWithConversionCheckUnDef("  engine hours (h): ", EngineHours, &SecondsToh, true);
+      PrintLabelValWithConversionCheckUnDef("  coolant pressure (Pa): ", EngineCoolantPress, 0, true);
+      PrintLabelValWithConversionCheckUnDef("  fuel pressure (Pa): ", EngineFuelPress, 0, true);
+      PrintLabelValWithConversionCheckUnDef("  engine load (%): ", EngineLoad, 0, true);
+      PrintLabelValWithConversionCheckUnDef("  engine torque (%): ", EngineTorque, 0, true);
 
-        // free the mutex
-        xSemaphoreGive(SerialOutputMutex);
-      }
+      // free the mutex
+      giveSerialOutputMutex();
     }
+  }
 #endif
+}
+
+//*****************************************************************************
+void EngineDynamicParameters(const tN2kMsg &N2kMsg)
+{
+  uint64_t now = clockMicros();
+  tN2kFastEngineDynamic Data;
 
-    // Update the display data if the engine instance is the one to be displayed
-    if (EngineInstance == DISPLAY_ENGINE_INSTANCE)
+  if (FastParseN2kEngineDynamic(N2kMsg, Data))
+  {
+    // Update N2k Statistics
+    N2kMessageStatistics.UpdateMsgCnt(N2kMsg.PGN, Data.EngineInstance);
+    // Only if Debug is enabled
+    PrintEngineDynamicParameters(N2kMsg);
+
+    // Update the display data if the engine instance is tracked and the sender selected
+    if ((Data.EngineInstance < N2K_MAX_ENGINE_INSTANCES) &&
+        EngineDynamicArbiter[Data.EngineInstance].Accept(N2kMsg.Source, now))
     {
-      DisplayData.EngineHours = SecondsToh(EngineHours);
-      DisplayData.EngineOilPressure = PascalTomBar(EngineOilPress);
-      DisplayData.EngineCoolantTemperature = KelvinToC(EngineCoolantTemp);
-      DisplayData.EngineAlternatorVoltage = AlternatorVoltage;
-      DisplayData.EngineDiscreteStatus1 = Status1;
-      DisplayData.EngineDiscreteStatus2 = Status2;
-      DisplayData.LowOilPressureWarning = Status1.Bits.LowOilPressure;
+      uint8_t instance = Data.EngineInstance;
+      bool coolantAvailable = Data.CoolantTemperature != N2kUInt16NA;
+      bool voltageAvailable = Data.AlternatorVoltage != N2kInt16NA;
+      uint16_t coolant = FilterSignal(CoolantTemperatureFilter[instance], Data.CoolantTemperature, coolantAvailable, now);
+      int16_t voltage = FilterSignal(AlternatorVoltageFilter[instance], Data.AlternatorVoltage, voltageAvailable, now);
+
+      EngineHoursSignal::Set(instance, Data.EngineHours, Data.EngineHours != N2kUInt32NA, now);
+      EngineOilPressureSignal::Set(instance, Data.OilPressure, Data.OilPressure != N2kUInt16NA, now);
+      EngineCoolantTemperatureSignal::Set(instance, coolant, coolantAvailable, now);
+      EngineAlternatorVoltageSignal::Set(instance, voltage, voltageAvailable, now);
+      // All bits set is not available, not every status alarm at once
+      EngineDiscreteStatus1Signal::Set(instance, Data.Status1.Status, Data.Status1.Status != N2kUInt16NA, now);
+      EngineDiscreteStatus2Signal::Set(instance, Data.Status2.Status, Data.Status2.Status != N2kUInt16NA, now);
+
+      // Check the alarms right away, not only with the next update
+      alarmEvaluate(instance, now);
     }
   }
   else
@@ -285,41 +458,48 @@ void EngineDynamicParameters(const tN2kMsg &N2kMsg)
 }
 
 //*****************************************************************************
-void TransmissionParameters(const tN2kMsg &N2kMsg)
+// Print Transmission Parameters message decoded by the library parser
+void PrintTransmissionParameters(const tN2kMsg &N2kMsg)
 {
+// Only if Debug is enabled
+#ifdef DEBUG_NSK_MSG
   unsigned char EngineInstance;
   tN2kTransmissionGear TransmissionGear;
   double OilPressure;
   double OilTemperature;
   unsigned char DiscreteStatus1;
 
-  if (ParseN2kTransmissionParameters(N2kMsg, EngineInstance, TransmissionGear, OilPressure, OilTemperature, DiscreteStatus1))
+  if (OutputStream && ParseN2kTransmissionParameters(N2kMsg, EngineInstance, TransmissionGear, OilPressure, OilTemperature, DiscreteStatus1))
   {
-    // Update N2k Statistics
-    N2kMessageStatistics.UpdateMsgCnt(N2kMsg.PGN);
-// Only if Debug is enabled
-#ifdef DEBUG_NSK_MSG
-    if (OutputStream)
+    // Tread safety with mutex SerialOutputMutex
+    if (takeSerialOutputMutex())
     {
-      // Tread safety with mutex SerialOutputMutex
-      if (SerialOutputMutex)
-      {
-        if (xSemaphoreTake(SerialOutputMutex, pdMS_TO_TICKS(20)) == pdTRUE)
-        {
-          OutputStream->print(millis());
-          OutputStream->print(": ");
-          PrintLabelValWithConversionCheckUnDef("Transmission params: ", EngineInstance, 0, true);
-          OutputStream->print("  gear: ");
-          PrintN2kEnumType(TransmissionGear, OutputStream);
-          PrintLabelValWithConversionCheckUnDef("  oil pressure (Pa): ", OilPressure, 0, true);
-          PrintLabelValWithConversionCheckUnDef("  oil temperature (C): ", OilTemperature, &KelvinToC, true);
-          PrintLabelValWithConversionCheckUnDef("  discrete status: ", DiscreteStatus1, 0, true);
-          // free the mutex
-          xSemaphoreGive(SerialOutputMutex);
-        }
-      }
+      OutputStream->print(clockMillis());
+      OutputStream->print(": ");
+      PrintLabelValWithConversionCheckUnDef("Transmission params: ", EngineInstance, 0, true);
+      OutputStream->print("  gear: ");
+      PrintN2kEnumType(TransmissionGear, OutputStream);
+      PrintLabelValWithConversionCheckUnDef("  oil pressure (Pa): ", OilPressure, 0, true);
+      PrintLabelValWithConversionCheckUnDef("  oil temperature (C): ", OilTemperature, &KelvinToC, true);
+      PrintLabelValWithConversionCheckUnDef("  discrete status: ", DiscreteStatus1, 0, true);
+      // free the mutex
+      giveSerialOutputMutex();
     }
+  }
 #endif
+}
+
+//*****************************************************************************
+void TransmissionParameters(const tN2kMsg &N2kMsg)
+{
+  tN2kFastTransmission Data;
+
+  if (FastParseN2kTransmission(N2kMsg, Data))
+  {
+    // Update N2k Statistics
+    N2kMessageStatistics.UpdateMsgCnt(N2kMsg.PGN);
+    // Only if Debug is enabled
+    PrintTransmissionParameters(N2kMsg);
   }
   else
   {
@@ -331,54 +511,61 @@ void TransmissionParameters(const tN2kMsg &N2kMsg)
 }
 
 //*****************************************************************************
-void SystemTime(const tN2kMsg &N2kMsg)
+// Print System Time message decoded by the library parser
+void PrintSystemTime(const tN2kMsg &N2kMsg)
 {
+// Only if Debug is enabled
+#ifdef DEBUG_NSK_MSG
   unsigned char SID;
   uint16_t SystemDate;
   double SystemTime;
-  tN2kTimeSource TimeSource; // Declare TimeSource variable
+  tN2kTimeSource TimeSource;
+
   if (ParseN2kSystemTime(N2kMsg, SID, SystemDate, SystemTime, TimeSource))
   {
-    // Validate parsed values
-    if (SystemDate > 0 && SystemTime >= 0.0 && SystemTime < 86400.0)
+    // Tread safety with mutex SerialOutputMutex
+    if (takeSerialOutputMutex())
+    {
+      OutputStream->print(clockMillis());
+      OutputStream->print(": ");
+      OutputStream->println("System time:");
+      PrintLabelValWithConversionCheckUnDef("  SID: ", SID, 0, true);
+      PrintLabelValWithConversionCheckUnDef("  days since 1.1.1970: ", SystemDate, 0, true);
+      PrintLabelValWithConversionCheckUnDef("  seconds since midnight: ", SystemTime, 0, true);
+      OutputStream->print("  time source: ");
+      PrintN2kEnumType(TimeSource, OutputStream);
+      // free the mutex
+      giveSerialOutputMutex();
+    }
+  }
+#endif
+}
+
+//*****************************************************************************
+void SystemTime(const tN2kMsg &N2kMsg)
+{
+  tN2kFastSystemTime Data;
+
+  if (FastParseN2kSystemTime(N2kMsg, Data))
+  {
+    // Validate parsed values, the time is given in 0.0001 s since midnight
+    if ((Data.SystemDate > 0) && (Data.SystemDate != N2kUInt16NA) && (Data.SystemTime < 864000000UL))
     {
       // Update N2k Statistics
       N2kMessageStatistics.UpdateMsgCnt(N2kMsg.PGN);
-// Only if Debug is enabled
-#ifdef DEBUG_NSK_MSG
-      // Tread safety with mutex SerialOutputMutex
-      if (SerialOutputMutex)
-      {
-        if (xSemaphoreTake(SerialOutputMutex, pdMS_TO_TICKS(20)) == pdTRUE)
-        {
-          OutputStream->print(millis());
-          OutputStream->print(": ");
-          OutputStream->println("System time:");
-          PrintLabelValWithConversionCheckUnDef("  SID: ", SID, 0, true);
-          PrintLabelValWithConversionCheckUnDef("  days since 1.1.1970: ", SystemDate, 0, true);
-          PrintLabelValWithConversionCheckUnDef("  seconds since midnight: ", SystemTime, 0, true);
-          OutputStream->print("  time source: ");
-          PrintN2kEnumType(TimeSource, OutputStream);
-          // free the mutex
-          xSemaphoreGive(SerialOutputMutex);
-        }
-      }
-
-#endif
+      // Only if Debug is enabled
+      PrintSystemTime(N2kMsg);
     }
     else
     {
 // Only if Debug is enabled
 #ifdef DEBUG_ERROR
       // Tread safety with mutex SerialOutputMutex
-      if (SerialOutputMutex)
+      if (takeSerialOutputMutex())
       {
-        if (xSemaphoreTake(SerialOutputMutex, pdMS_TO_TICKS(20)) == pdTRUE)
-        {
-          OutputStream->println("Invalid system time data received.");
-          // free the mutex
-          xSemaphoreGive(SerialOutputMutex);
-        }
+        OutputStream->println("Invalid system time data received.");
+        // free the mutex
+        giveSerialOutputMutex();
       }
 #endif
     }
@@ -396,6 +583,32 @@ void SystemTime(const tN2kMsg &N2kMsg)
 // ----------------------> Message Statistics <-------------------------------
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
+/// Spinlock to protect the timestamps, 64 bits are no atomic access
+static portMUX_TYPE N2kStatisticsMux = portMUX_INITIALIZER_UNLOCKED;
+
+//************************************************
+// Set a timestamp to the current time, it is read by other tasks
+static void SetTimestamp(uint64_t &Timestamp)
+{
+  uint64_t now = clockMicros();
+
+  taskENTER_CRITICAL(&N2kStatisticsMux);
+  Timestamp = now;
+  taskEXIT_CRITICAL(&N2kStatisticsMux);
+}
+
+//************************************************
+// Get a timestamp written by the N2K task
+static uint64_t GetTimestamp(const uint64_t &Timestamp)
+{
+  uint64_t timestamp;
+
+  taskENTER_CRITICAL(&N2kStatisticsMux);
+  timestamp = Timestamp;
+  taskEXIT_CRITICAL(&N2kStatisticsMux);
+  return timestamp;
+}
+
 //************************************************
 // Constructor
 N2kMsgStatistics::N2kMsgStatistics()
@@ -433,16 +646,16 @@ void N2kMsgStatistics::UpdateMsgCnt(uint32_t PGN, uint8_t Instance)
     // System Time Message
   case 126992L:
     SystemTimeCnt++;
-    SystemTimeLastTimestamp = millis();
+    SetTimestamp(SystemTimeLastTimestamp);
     break;
 
     // Engine Rapid Message
   case 127488L:
     // Check for the correct instance
-    if ((Instance == DISPLAY_ENGINE_INSTANCE) || (Instance == 0))
+    if (Instance == DISPLAY_ENGINE_INSTANCE)
     {
       EngineRapidCnt++;
-      EngineRapidLastTimestamp = millis();
+      SetTimestamp(EngineRapidLastTimestamp);
     }
 
     break;
@@ -450,17 +663,17 @@ void N2kMsgStatistics::UpdateMsgCnt(uint32_t PGN, uint8_t Instance)
     // Engine Dynamic Message
   case 127489L:
     // Check for the correct instance
-    if ((Instance == DISPLAY_ENGINE_INSTANCE) || (Instance == 0))
+    if (Instance == DISPLAY_ENGINE_INSTANCE)
     {
       EngineDynamicCnt++;
-      EngineDynamicLastTimestamp = millis();
+      SetTimestamp(EngineDynamicLastTimestamp);
     }
     break;
 
     // Transmission Parameters Message
   case 127493L:
     TransmissionParametersCnt++;
-    TransmissionParametersLastTimestamp = millis();
+    SetTimestamp(TransmissionParametersLastTimestamp);
     break;
   default:
     break;
@@ -563,14 +776,7 @@ uint32_t N2kMsgStatistics::GetFailedMsgCnt(uint32_t PGN)
 // Check if the N2K message is timed out
 bool N2kMsgStatistics::N2kIsTimeOut(void)
 {
-  if ((millis() - EngineRapidLastTimestamp) > N2K_MSG_ENGINE_RAPID_TIMEOUT)
-  {
-    return true;
-  }
-  else
-  {
-    return false;
-  }
+  return clockIsElapsed(GetTimestamp(EngineRapidLastTimestamp), N2K_MSG_ENGINE_RAPID_TIMEOUT);
 }
 
 //************************************************
@@ -580,47 +786,89 @@ void N2kMsgStatistics::ShowStatistics(void)
   // Only if Debug is enabled
 #ifdef DEBUG_N2K_MSG_STATISTICS
   // Tread safety with mutex SerialOutputMutex
-  if (SerialOutputMutex)
+  if (takeSerialOutputMutex())
   {
-    if (xSemaphoreTake(SerialOutputMutex, pdMS_TO_TICKS(20)) == pdTRUE)
+    // Show the statistics via Serial
+    Serial.println("N2K Message Statistics:");
+    Serial.print("  System Time: ");
+    Serial.print(SystemTimeCnt);
+    Serial.print(" (failed: ");
+    Serial.print(SystemTimeFailedCnt);
+    Serial.println(")");
+    Serial.print("  Engine Rapid: ");
+    Serial.print(EngineRapidCnt);
+    Serial.print(" (failed: ");
+    Serial.print(EngineRapidFailedCnt);
+    Serial.print(") Last: ");
+    Serial.print(CLOCK_US_TO_MS(clockMicros() - GetTimestamp(EngineRapidLastTimestamp)));
+    Serial.println("ms ago");
+    Serial.print("  Engine Dynamic: ");
+    Serial.print(EngineDynamicCnt);
+    Serial.print(" (failed: ");
+    Serial.print(EngineDynamicFailedCnt);
+    Serial.println(")");
+    Serial.print("  Transmission Parameters: ");
+    Serial.print(TransmissionParametersCnt);
+    Serial.print(" (failed: ");
+    Serial.print(TransmissionParametersFailedCnt);
+    Serial.println(")");
+    Serial.print("  CAN frames: ");
+    Serial.print(N2kCanDriver.GetRxFrameCnt());
+    Serial.print(" (rejected by software filter: ");
+    Serial.print(N2kCanDriver.GetRxRejectedCnt());
+    Serial.print(", coalesced: ");
+    Serial.print(N2kCanDriver.GetRxCoalescedCnt());
+    Serial.print(", early decoded: ");
+    Serial.print(N2kCanDriver.GetRxEarlyCnt());
+    Serial.print(", hardware filter: ");
+    Serial.print(N2kCanDriver.GetFilter().SingleFilter ? "single" : "dual");
+    Serial.print(" mode for ");
+    Serial.print(N2kCanDriver.GetFilter().AcceptedPGNs);
+    Serial.println(" PGNs)");
+    Serial.print("  CAN RX queue: ");
+    Serial.print(N2kCanDriver.GetRxStatistics().QueueLen);
+    Serial.print(" (max depth: ");
+    Serial.print(N2kCanDriver.GetRxStatistics().MaxQueueDepth);
+    Serial.print(", queue full: ");
+    Serial.print(N2kCanDriver.GetRxStatistics().QueueFullCnt);
+    Serial.print(", overruns: ");
+    Serial.print(N2kCanDriver.GetRxStatistics().OverrunCnt);
+    Serial.print(", reinstall: ");
+    Serial.print(N2kCanDriver.GetRxStatistics().ReinstallCnt);
+    Serial.print(", lost since start: ");
+    Serial.print(N2kCanDriver.GetRxLostCnt());
+    Serial.println(")");
+    Serial.print("  Fast-packets: ");
+    Serial.print(N2kCanDriver.GetFastPacketPool().GetCompletedCnt());
+    Serial.print(" (incomplete: ");
+    Serial.print(N2kCanDriver.GetFastPacketPool().GetIncompleteCnt());
+    Serial.print(", evicted: ");
+    Serial.print(N2kCanDriver.GetFastPacketPool().GetEvictedCnt());
+    Serial.print(", out of order: ");
+    Serial.print(N2kCanDriver.GetFastPacketPool().GetOutOfOrderCnt());
+    Serial.println(")");
+    Serial.print("  Signal timeouts: ");
+    Serial.println(signalRegistryExpiredCnt());
+    // Engine alarms
+    alarmShow();
+    // Senders of the engine data
+    for (uint8_t instance = 0; instance < N2K_MAX_ENGINE_INSTANCES; instance++)
     {
-      // Show the statistics via Serial
-      Serial.println("N2K Message Statistics:");
-      Serial.print("  System Time: ");
-      Serial.print(SystemTimeCnt);
-      Serial.print(" (failed: ");
-      Serial.print(SystemTimeFailedCnt);
-      Serial.println(")");
-      Serial.print("  Engine Rapid: ");
-      Serial.print(EngineRapidCnt);
-      Serial.print(" (failed: ");
-      Serial.print(EngineRapidFailedCnt);
-      Serial.print(") Last: ");
-      Serial.print(millis() - EngineRapidLastTimestamp);
-      Serial.println("ms ago");
-      Serial.print("  Engine Dynamic: ");
-      Serial.print(EngineDynamicCnt);
-      Serial.print(" (failed: ");
-      Serial.print(EngineDynamicFailedCnt);
-      Serial.println(")");
-      Serial.print("  Transmission Parameters: ");
-      Serial.print(TransmissionParametersCnt);
-      Serial.print(" (failed: ");
-      Serial.print(TransmissionParametersFailedCnt);
-      Serial.println(")");
-      // check if Engine Rapid is timed out
-      if (N2kIsTimeOut())
-      {
-        Serial.println("  ---> Engine Rapid Message is timed out!");
-      }
-      else
-      {
-        Serial.println("  ---> Nsk Messages are coming in time");
-      }
-
-      // free the mutex
-      xSemaphoreGive(SerialOutputMutex);
+      EngineRapidArbiter[instance].Show("Engine Rapid", instance);
+      EngineDynamicArbiter[instance].Show("Engine Dynamic", instance);
     }
+    // check if Engine Rapid is timed out
+    if (N2kIsTimeOut())
+    {
+      Serial.println("  ---> Engine Rapid Message is timed out!");
+    }
+    else
+    {
+      Serial.println("  ---> Nsk Messages are coming in time");
+    }
+
+    // free the mutex
+    giveSerialOutputMutex();
   }
 
 #endif
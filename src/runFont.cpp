@@ -0,0 +1,250 @@
+/*!
+ * \file runFont.cpp
+ * \brief Text output with the run length fonts
+ *
+ * This file contains the glyph lookup, the text measurement and the
+ * run length glyph renderer and a benchmark against the GFX fonts of
+ * TFT_eSPI.
+ *
+ */
+
+#include <runFont.h>
+#include <sysClock.h>
+
+//*****************************************************************************
+// Find the glyph of a character, nullptr if the font has none
+static const tRunGlyph *FindGlyph(const tRunFont &Font, char Char)
+{
+  for (uint8_t i = 0; i < Font.Count; i++)
+  {
+    if (Font.Chars[i] == Char)
+    {
+      return &Font.Glyphs[i];
+    }
+  }
+  return nullptr;
+}
+
+//*****************************************************************************
+// Draw a run of foreground pixels on the display or a sprite
+static inline void DrawSpan(TFT_eSPI &Target, int32_t x, int32_t y, int32_t w, uint16_t Color)
+{
+  Target.drawFastHLine(x, y, w, Color);
+}
+
+//*****************************************************************************
+// Draw a run of foreground pixels on a palette canvas
+static inline void DrawSpan(PaletteCanvas &Target, int32_t x, int32_t y, int32_t w, uint8_t Index)
+{
+  Target.DrawFastHLine(x, y, w, Index);
+}
+
+//*****************************************************************************
+// Draw the runs of one glyph with the baseline at y
+template <typename TTarget, typename TColor>
+static void DrawGlyph(TTarget &Target, const tRunFont &Font, const tRunGlyph &Glyph, int32_t x, int32_t y,
+                      TColor Color)
+{
+  const uint8_t *runs = &Font.Runs[Glyph.Offset];
+  uint32_t remaining = (uint32_t)Glyph.Width * Glyph.Height;
+  int32_t left = x + Glyph.XOffset;
+  int32_t line = y + Glyph.YOffset;
+  uint32_t column = 0;
+  bool foreground = false;
+
+  while (remaining > 0)
+  {
+    uint32_t run = pgm_read_byte(runs++);
+    if (run > remaining)
+    {
+      run = remaining;
+    }
+    remaining -= run;
+
+    if (foreground)
+    {
+      // Split the run at the end of the rows
+      while (run > 0)
+      {
+        uint32_t span = Glyph.Width - column;
+        if (span > run)
+        {
+          span = run;
+        }
+        DrawSpan(Target, left + column, line, span, Color);
+        column += span;
+        run -= span;
+        if (column == Glyph.Width)
+        {
+          column = 0;
+          line++;
+        }
+      }
+    }
+    else
+    {
+      column += run;
+      line += column / Glyph.Width;
+      column %= Glyph.Width;
+    }
+    foreground = !foreground;
+  }
+}
+
+//*****************************************************************************
+// Get the width of a text
+int16_t runFontTextWidth(const tRunFont &Font, const char *Text)
+{
+  int16_t width = 0;
+
+  while (*Text)
+  {
+    const tRunGlyph *glyph = FindGlyph(Font, *Text++);
+    if (glyph == nullptr)
+    {
+      continue;
+    }
+    // As TFT_eSPI the last character counts with its visible width
+    if (*Text)
+    {
+      width += glyph->XAdvance;
+    }
+    else
+    {
+      width += glyph->XOffset + glyph->Width;
+    }
+  }
+  return width;
+}
+
+//*****************************************************************************
+// Draw a text on the display, a sprite or a palette canvas
+template <typename TTarget, typename TColor>
+static int16_t DrawString(TTarget &Target, const tRunFont &Font, const char *Text, int32_t x, int32_t y,
+                          uint8_t Datum, TColor Color)
+{
+  int16_t width = runFontTextWidth(Font, Text);
+
+  // Horizontal alignment, left, centre or right
+  switch ((Datum >= L_BASELINE) ? (Datum - L_BASELINE) : (Datum % 3))
+  {
+  case 1:
+    x -= width / 2;
+    break;
+  case 2:
+    x -= width;
+    break;
+  default:
+    break;
+  }
+
+  // Vertical alignment, y is the baseline afterwards
+  if (Datum < L_BASELINE)
+  {
+    switch (Datum / 3)
+    {
+    case 0:
+      y += Font.Ascent;
+      break;
+    case 1:
+      y += Font.Ascent - Font.Ascent / 2;
+      break;
+    default:
+      y -= Font.Descent;
+      break;
+    }
+  }
+
+  while (*Text)
+  {
+    const tRunGlyph *glyph = FindGlyph(Font, *Text++);
+    if (glyph != nullptr)
+    {
+      DrawGlyph(Target, Font, *glyph, x, y, Color);
+      x += glyph->XAdvance;
+    }
+  }
+  return width;
+}
+
+//*****************************************************************************
+// Draw a text
+int16_t runFontDrawString(TFT_eSPI &Target, const tRunFont &Font, const char *Text, int32_t x, int32_t y,
+                          uint8_t Datum, uint16_t Color)
+{
+  return DrawString(Target, Font, Text, x, y, Datum, Color);
+}
+
+//*****************************************************************************
+// Draw a text on a palette canvas
+int16_t runFontDrawString(PaletteCanvas &Target, const tRunFont &Font, const char *Text, int32_t x, int32_t y,
+                          uint8_t Datum, uint8_t Index)
+{
+  return DrawString(Target, Font, Text, x, y, Datum, Index);
+}
+
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ---------------------------> Benchmark <-------------------------------------
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#if FONT_BENCHMARK
+
+/// Number of texts drawn per font
+#define FONT_BENCHMARK_LOOPS 200
+
+/// Width of the benchmark sprite [px]
+#define FONT_BENCHMARK_WIDTH 240
+
+//*****************************************************************************
+// Benchmark the run length font
+void benchmarkRunFont(TFT_eSprite &Sprite, const tRunFont &Font, const GFXfont *GfxFont, const char *Text)
+{
+  uint64_t start;
+  uint64_t gfxTime;
+  uint64_t runTime;
+
+  Sprite.setColorDepth(16);
+  if (Sprite.createSprite(FONT_BENCHMARK_WIDTH, Font.YAdvance) == nullptr)
+  {
+    return;
+  }
+
+  Sprite.setTextSize(1);
+  Sprite.setTextColor(TFT_WHITE);
+  Sprite.setTextDatum(MR_DATUM);
+  Sprite.setFreeFont(GfxFont);
+  start = clockMicros();
+  for (uint32_t i = 0; i < FONT_BENCHMARK_LOOPS; i++)
+  {
+    Sprite.drawString(Text, FONT_BENCHMARK_WIDTH - 1, Font.YAdvance / 2);
+  }
+  gfxTime = clockMicros() - start;
+
+  start = clockMicros();
+  for (uint32_t i = 0; i < FONT_BENCHMARK_LOOPS; i++)
+  {
+    runFontDrawString(Sprite, Font, Text, FONT_BENCHMARK_WIDTH - 1, Font.YAdvance / 2, MR_DATUM, TFT_WHITE);
+  }
+  runTime = clockMicros() - start;
+
+  Sprite.deleteSprite();
+
+  Serial.print("  Font \"");
+  Serial.print(Text);
+  Serial.print("\": gfx ");
+  Serial.print((uint32_t)(gfxTime / FONT_BENCHMARK_LOOPS));
+  Serial.print("us runs ");
+  Serial.print((uint32_t)(runTime / FONT_BENCHMARK_LOOPS));
+  Serial.print("us speedup x");
+  Serial.println(runTime ? (double)gfxTime / runTime : 0.0, 1);
+}
+
+#else
+
+//*****************************************************************************
+// Benchmark disabled
+void benchmarkRunFont(TFT_eSprite &Sprite, const tRunFont &Font, const GFXfont *GfxFont, const char *Text)
+{
+}
+
+#endif // FONT_BENCHMARK
@@ -0,0 +1,325 @@
+/*!
+ * \file signalFilter.cpp
+ * \brief Fixed-point conditioning filters for the displayed signals
+ *
+ * This file contains the filter implementations and a benchmark which
+ * checks the step response of each filter type.
+ *
+ */
+
+#include <signalFilter.h>
+
+/// Number of fractional bits of the filter state
+#define SIGNAL_FILTER_FRACTION_BITS 8
+
+/// Number of fractional bits of the step of the rate limiter
+#define SIGNAL_FILTER_RATE_BITS 12
+
+/// Maximum number of ticks between two samples before the filter starts over
+#define SIGNAL_FILTER_TICKS_MAX ((uint32_t)(CLOCK_MS_TO_US(SIGNAL_FILTER_RESET_TIMEOUT) >> SIGNAL_FILTER_TICK_SHIFT) + 1)
+
+/// Maximum velocity of the alpha-beta tracker, keeps the prediction within 2^26
+#define SIGNAL_FILTER_VELOCITY_MAX ((int32_t)((1L << 26) / SIGNAL_FILTER_TICKS_MAX))
+
+/// Convert a raw value to the filter state
+#define TO_FIXED(x) ((int32_t)(x) * (1 << SIGNAL_FILTER_FRACTION_BITS))
+
+/// Convert the filter state to a rounded raw value
+#define FROM_FIXED(x) ((int32_t)(((x) + (1 << (SIGNAL_FILTER_FRACTION_BITS - 1))) >> SIGNAL_FILTER_FRACTION_BITS))
+
+//************************************************
+// Multiply with a factor in 1/256 in 32 bits
+static inline int32_t MulFraction(int32_t Value, int32_t Factor)
+{
+  // Split the value, the product of the whole value may not fit
+  return (Value >> 8) * Factor + (((Value & 0xFF) * Factor) >> 8);
+}
+
+//************************************************
+// Constructor
+SignalFilter::SignalFilter()
+{
+  Config.Type = SIGNAL_FILTER_NONE;
+  Config.Param1 = 0;
+  Config.Param2 = 0;
+  RateStep = 0;
+  Reset();
+}
+
+//************************************************
+// Configure the filter
+void SignalFilter::Configure(const tSignalFilterConfig &Config)
+{
+  this->Config = Config;
+
+  // Keep the median window within the buffer
+  if ((Config.Type == SIGNAL_FILTER_MEDIAN) &&
+      ((Config.Param1 < 1) || (Config.Param1 > SIGNAL_FILTER_MEDIAN_MAX)))
+  {
+    this->Config.Param1 = SIGNAL_FILTER_MEDIAN_MAX;
+  }
+
+  // Keep the step of the longest time step within 32 bits
+  if ((Config.Type == SIGNAL_FILTER_RATE_LIMIT) && (Config.Param1 < 0))
+  {
+    this->Config.Param1 = 0;
+  }
+  else if ((Config.Type == SIGNAL_FILTER_RATE_LIMIT) && (Config.Param1 > 65535))
+  {
+    this->Config.Param1 = 65535;
+  }
+
+  // Change per tick, once here instead of a division per sample
+  RateStep = (int32_t)(((int64_t)this->Config.Param1 << (SIGNAL_FILTER_RATE_BITS + SIGNAL_FILTER_TICK_SHIFT)) / 1000000);
+  Reset();
+}
+
+//************************************************
+// Reset the state, the next sample starts over
+void SignalFilter::Reset(void)
+{
+  Started = false;
+  LastTime = 0;
+  Value = 0;
+  Velocity = 0;
+  WindowCnt = 0;
+  WindowPos = 0;
+}
+
+//************************************************
+// Filter a sample
+int32_t SignalFilter::Update(int32_t Sample, uint64_t now)
+{
+  uint64_t elapsed = now - LastTime;
+  uint32_t ticks;
+
+  // Start over after a pause, old state would only delay the new value
+  if (Started && (elapsed > CLOCK_MS_TO_US(SIGNAL_FILTER_RESET_TIMEOUT)))
+  {
+    Reset();
+  }
+  LastTime = now;
+
+  if (!Started)
+  {
+    Started = true;
+    Value = TO_FIXED(Sample);
+    Velocity = 0;
+    if (Config.Type == SIGNAL_FILTER_MEDIAN)
+    {
+      UpdateMedian(Sample);
+    }
+    return Sample;
+  }
+
+  // Rounded number of ticks, at most SIGNAL_FILTER_TICKS_MAX
+  ticks = ((uint32_t)elapsed + (1 << (SIGNAL_FILTER_TICK_SHIFT - 1))) >> SIGNAL_FILTER_TICK_SHIFT;
+
+  switch (Config.Type)
+  {
+  case SIGNAL_FILTER_EWMA:
+    return UpdateEwma(Sample);
+  case SIGNAL_FILTER_MEDIAN:
+    return UpdateMedian(Sample);
+  case SIGNAL_FILTER_RATE_LIMIT:
+    return UpdateRateLimit(Sample, ticks);
+  case SIGNAL_FILTER_ALPHA_BETA:
+    return UpdateAlphaBeta(Sample, ticks);
+  default:
+    return Sample;
+  }
+}
+
+//************************************************
+// Exponentially weighted moving average
+int32_t SignalFilter::UpdateEwma(int32_t Sample)
+{
+  // y += (x - y) / 2^n
+  Value += (TO_FIXED(Sample) - Value) >> Config.Param1;
+  return FROM_FIXED(Value);
+}
+
+//************************************************
+// Median of the last samples
+int32_t SignalFilter::UpdateMedian(int32_t Sample)
+{
+  int32_t sorted[SIGNAL_FILTER_MEDIAN_MAX];
+  int32_t value;
+  uint8_t i;
+  int8_t j;
+
+  Window[WindowPos] = Sample;
+  WindowPos = (WindowPos + 1) % Config.Param1;
+  if (WindowCnt < Config.Param1)
+  {
+    WindowCnt++;
+  }
+
+  // Insertion sort, the window holds only a few samples
+  for (i = 0; i < WindowCnt; i++)
+  {
+    value = Window[i];
+    for (j = i - 1; (j >= 0) && (sorted[j] > value); j--)
+    {
+      sorted[j + 1] = sorted[j];
+    }
+    sorted[j + 1] = value;
+  }
+  return sorted[WindowCnt / 2];
+}
+
+//************************************************
+// Rate limiter
+int32_t SignalFilter::UpdateRateLimit(int32_t Sample, uint32_t Ticks)
+{
+  int32_t maxDelta = (int32_t)((uint32_t)RateStep * Ticks >> (SIGNAL_FILTER_RATE_BITS - SIGNAL_FILTER_FRACTION_BITS));
+  int32_t delta = TO_FIXED(Sample) - Value;
+
+  if (delta > maxDelta)
+  {
+    delta = maxDelta;
+  }
+  else if (delta < -maxDelta)
+  {
+    delta = -maxDelta;
+  }
+  Value += delta;
+  return FROM_FIXED(Value);
+}
+
+//************************************************
+// Alpha-beta tracker
+int32_t SignalFilter::UpdateAlphaBeta(int32_t Sample, uint32_t Ticks)
+{
+  int32_t dt = (int32_t)Ticks;
+  int32_t residual;
+
+  if (dt < 1)
+  {
+    dt = 1;
+  }
+
+  // Predict with the tracked velocity and correct with the residual
+  Value += Velocity * dt;
+  residual = TO_FIXED(Sample) - Value;
+  Value += MulFraction(residual, Config.Param1);
+  Velocity += MulFraction(residual, Config.Param2) / dt;
+  if (Velocity > SIGNAL_FILTER_VELOCITY_MAX)
+  {
+    Velocity = SIGNAL_FILTER_VELOCITY_MAX;
+  }
+  else if (Velocity < -SIGNAL_FILTER_VELOCITY_MAX)
+  {
+    Velocity = -SIGNAL_FILTER_VELOCITY_MAX;
+  }
+  return FROM_FIXED(Value);
+}
+
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ---------------------------> Benchmark <-------------------------------------
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#if SIGNAL_FILTER_BENCHMARK
+
+/// Number of samples per filter for the timing
+#define SIGNAL_FILTER_BENCHMARK_LOOPS 10000
+
+/// Number of samples of the step response
+#define SIGNAL_FILTER_STEP_SAMPLES 12
+
+/// Sink for the filtered values, keeps the compiler from removing the loops
+static volatile int32_t BenchmarkSink;
+
+/*! ******************************************************************
+  @struct tSignalFilterStep
+  @brief  Structure for a filter and its expected step response
+ */
+typedef struct
+{
+  /// Configuration of the filter
+  tSignalFilterConfig Config;
+  /// Name shown via Serial
+  const char *Label;
+  /// Expected response to the first sample of the step
+  int32_t First;
+  /// Expected response to the last sample of the step
+  int32_t Last;
+  /// Allowed deviation of the response
+  int32_t Tolerance;
+} tSignalFilterStep;
+
+//*****************************************************************************
+// Benchmark the filters and check their step response
+bool benchmarkSignalFilters(void)
+{
+  // Expected values from the same math in floating point, e.g. 1000 * (1 - 0.75^11)
+  // for the EWMA, the alpha-beta tracker overshoots and settles back
+  const tSignalFilterStep steps[] = {
+      {{SIGNAL_FILTER_EWMA, 2, 0}, "EWMA 1/4", 250, 958, 2},
+      {{SIGNAL_FILTER_MEDIAN, 5, 0}, "Median 5", 1000, 1000, 0},
+      {{SIGNAL_FILTER_RATE_LIMIT, 2000, 0}, "Rate 2000/s", 200, 1000, 3},
+      {{SIGNAL_FILTER_ALPHA_BETA, 128, 32}, "Alpha-beta 0.5/0.125", 500, 1032, 3},
+  };
+  SignalFilter filter;
+  uint64_t start;
+  uint64_t now;
+  int32_t first = 0;
+  int32_t last = 0;
+  bool passed = true;
+
+  for (uint8_t i = 0; i < sizeof(steps) / sizeof(steps[0]); i++)
+  {
+    // Step response: 0 at the start, 1000 from the second sample on
+    filter.Configure(steps[i].Config);
+    now = 0;
+    Serial.print("  ");
+    Serial.print(steps[i].Label);
+    Serial.print(" step:");
+    for (uint8_t sample = 0; sample < SIGNAL_FILTER_STEP_SAMPLES; sample++)
+    {
+      last = filter.Update(sample ? 1000 : 0, now);
+      if (sample == 1)
+      {
+        first = last;
+      }
+      Serial.print(" ");
+      Serial.print(last);
+      now += CLOCK_MS_TO_US(100);
+    }
+
+    // Time per sample with a noisy input
+    filter.Configure(steps[i].Config);
+    start = clockMicros();
+    for (uint32_t loop = 0; loop < SIGNAL_FILTER_BENCHMARK_LOOPS; loop++)
+    {
+      BenchmarkSink = filter.Update(1000 + (int32_t)(loop & 0x1F) - 16, CLOCK_MS_TO_US(loop * 10));
+    }
+    Serial.print(" | ");
+    Serial.print((uint32_t)((clockMicros() - start) * 1000 / SIGNAL_FILTER_BENCHMARK_LOOPS));
+    Serial.println("ns/sample");
+
+    if ((abs(first - steps[i].First) > steps[i].Tolerance) ||
+        (abs(last - steps[i].Last) > steps[i].Tolerance))
+    {
+      Serial.print("  ERROR: ");
+      Serial.print(steps[i].Label);
+      Serial.print(" step response out of tolerance, expected ");
+      Serial.print(steps[i].First);
+      Serial.print(" .. ");
+      Serial.println(steps[i].Last);
+      passed = false;
+    }
+  }
+  return passed;
+}
+
+#else
+
+//*****************************************************************************
+// Benchmark disabled
+bool benchmarkSignalFilters(void)
+{
+  return true;
+}
+
+#endif // SIGNAL_FILTER_BENCHMARK
@@ -0,0 +1,179 @@
+/*!
+ * \file signalRegistry.cpp
+ * \brief Typed registry of the displayed signals
+ *
+ * This file contains the storage access, the version counter and the
+ * time out handling of the signal registry.
+ *
+ */
+
+#include <signalRegistry.h>
+
+//******************************************************************
+// Init Global Variables
+//******************************************************************
+/// Registry version, incremented with every change
+static std::atomic<uint32_t> RegistryVersion(0);
+/// Dirty bits of the signals changed since the last take, one word per consumer
+static std::atomic<uint32_t> RegistryDirty[SIGNAL_CONSUMER_COUNT];
+
+/// Timer wheel for the time out of all signals
+static TimerWheel SignalTimers(TASK_UPDATE_N2K_PERIOD);
+
+//******************************************************************
+// Mark a signal changed
+//******************************************************************
+static void MarkChanged(tSignalSlot &Slot)
+{
+  Slot.Version = RegistryVersion.fetch_add(1, std::memory_order_acq_rel) + 1;
+  for (uint8_t consumer = 0; consumer < SIGNAL_CONSUMER_COUNT; consumer++)
+  {
+    RegistryDirty[consumer].fetch_or(Slot.Bit, std::memory_order_release);
+  }
+}
+
+//******************************************************************
+// Mark a signal stale after its time out
+//******************************************************************
+static void SignalExpired(tTimerWheelNode *Node)
+{
+  tSignalSlot &slot = *(tSignalSlot *)Node->Context;
+
+  // Only a valid value becomes stale, a not available signal has no
+  // value to show, its Raw still holds the value before
+  if (slot.Quality != SIGNAL_VALID)
+  {
+    return;
+  }
+
+  slot.Sequence.fetch_add(1, std::memory_order_acquire);
+  slot.Quality = SIGNAL_STALE;
+  slot.Sequence.fetch_add(1, std::memory_order_release);
+  MarkChanged(slot);
+}
+
+//******************************************************************
+// Init a signal slot
+//******************************************************************
+void signalSlotInit(tSignalSlot &Slot, uint32_t Bit)
+{
+  Slot.Sequence.store(0);
+  Slot.Raw = 0;
+  Slot.Quality = SIGNAL_NO_DATA;
+  Slot.Timestamp = 0;
+  Slot.Version = 0;
+  Slot.Bit = Bit;
+  TimerWheel::InitNode(&Slot.Timer, SignalExpired, &Slot);
+}
+
+//******************************************************************
+// Write a signal slot
+//******************************************************************
+void signalSlotWrite(tSignalSlot &Slot, int32_t Raw, tSignalQuality Quality, uint32_t TimeoutMs, uint64_t now)
+{
+  // Only a new value or quality is a change, a repeated value needs no redraw
+  bool changed = (Quality != Slot.Quality) || ((Quality == SIGNAL_VALID) && (Raw != Slot.Raw));
+
+  // Readers retry while the sequence counter is odd or changed
+  Slot.Sequence.fetch_add(1, std::memory_order_acquire);
+  if (Quality == SIGNAL_VALID)
+  {
+    Slot.Raw = Raw;
+  }
+  Slot.Quality = Quality;
+  Slot.Timestamp = now;
+  Slot.Sequence.fetch_add(1, std::memory_order_release);
+
+  if (changed)
+  {
+    MarkChanged(Slot);
+  }
+  SignalTimers.Start(&Slot.Timer, TimeoutMs, now);
+}
+
+//******************************************************************
+// Read a signal slot without blocking
+//******************************************************************
+tSignalValue signalSlotRead(const tSignalSlot &Slot, tSignalUnit Unit)
+{
+  tSignalValue value;
+  uint32_t sequence;
+
+  value.Unit = Unit;
+  do
+  {
+    sequence = Slot.Sequence.load(std::memory_order_acquire);
+    value.Raw = Slot.Raw;
+    value.Quality = Slot.Quality;
+    std::atomic_thread_fence(std::memory_order_acquire);
+  } while ((sequence & 1) || (sequence != Slot.Sequence.load(std::memory_order_relaxed)));
+
+  return value;
+}
+
+//******************************************************************
+// Init the signal registry
+//******************************************************************
+void signalRegistryInit(void)
+{
+  for (uint8_t consumer = 0; consumer < SIGNAL_CONSUMER_COUNT; consumer++)
+  {
+    RegistryDirty[consumer].store(0);
+  }
+#define SIGNAL_INIT(Name, Type, Unit, TimeoutMs) Name##Signal::Init();
+  SIGNAL_LIST(SIGNAL_INIT)
+#undef SIGNAL_INIT
+}
+
+//******************************************************************
+// Get the value of a signal by its ID
+//******************************************************************
+tSignalValue signalRegistryGetValue(tSignalId Id, uint8_t Instance)
+{
+  tSignalValue value = {0, SIGNAL_UNIT_NONE, SIGNAL_NO_DATA};
+
+  switch (Id)
+  {
+#define SIGNAL_GET(Name, Type, Unit, TimeoutMs) \
+  case SIGNAL_ID_##Name:                        \
+    value = Name##Signal::GetValue(Instance);   \
+    break;
+    SIGNAL_LIST(SIGNAL_GET)
+#undef SIGNAL_GET
+  default:
+    break;
+  }
+  return value;
+}
+
+//******************************************************************
+// Mark the signals stale which timed out
+//******************************************************************
+void signalRegistryAdvance(uint64_t now)
+{
+  SignalTimers.Advance(now);
+}
+
+//******************************************************************
+// Get the registry version
+//******************************************************************
+uint32_t signalRegistryVersion(void)
+{
+  return RegistryVersion.load(std::memory_order_acquire);
+}
+
+//******************************************************************
+// Get and clear the dirty bits of a consumer
+//******************************************************************
+uint32_t signalRegistryTakeDirty(tSignalConsumer Consumer)
+{
+  return RegistryDirty[Consumer].exchange(0, std::memory_order_acq_rel);
+}
+
+//******************************************************************
+// Get the number of signals which timed out
+//******************************************************************
+uint32_t signalRegistryExpiredCnt(void)
+{
+  return SignalTimers.GetExpiredCnt();
+}
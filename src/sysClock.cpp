@@ -0,0 +1,224 @@
+/*!
+ * \file sysClock.cpp
+ * \brief Monotonic system clock
+ *
+ * This file contains the hardware and the virtual clock source and
+ * the functions for timestamps, timeouts and task periods.
+ *
+ */
+
+#include <sysClock.h>
+#include <esp_timer.h>
+
+//******************************************************************
+// Hardware Clock
+//******************************************************************
+
+// Current time of the ESP32 high resolution timer
+static uint64_t HardwareClockNow(void)
+{
+  return (uint64_t)esp_timer_get_time();
+}
+
+// Suspend the task with the FreeRTOS scheduler
+static void HardwareClockSleep(uint64_t Duration)
+{
+  // Round up, the sleep must not be shorter than asked
+  TickType_t ticks = pdMS_TO_TICKS(CLOCK_US_TO_MS(Duration + 999));
+
+  // Always yield at least one tick to let lower priority tasks run
+  if (ticks == 0)
+  {
+    ticks = 1;
+  }
+  vTaskDelay(ticks);
+}
+
+// Suspend the task with the FreeRTOS scheduler till a notification
+static bool HardwareClockWaitNotify(uint64_t Duration)
+{
+  // Round up, the period must not end before the wakeup
+  TickType_t ticks = pdMS_TO_TICKS(CLOCK_US_TO_MS(Duration + 999));
+
+  if (ticks == 0)
+  {
+    ticks = 1;
+  }
+  return ulTaskNotifyTake(pdTRUE, ticks) != 0;
+}
+
+/// Clock source of the ESP32 high resolution timer
+static const tClockSource HardwareClock = {&HardwareClockNow, &HardwareClockSleep, &HardwareClockWaitNotify};
+
+//******************************************************************
+// Virtual Clock
+//******************************************************************
+
+/// Current time of the virtual clock [us]
+static uint64_t VirtualClockTime = 0;
+
+/// Spinlock to protect the virtual time, 64 bits are no atomic access
+static portMUX_TYPE VirtualClockMux = portMUX_INITIALIZER_UNLOCKED;
+
+// Current time of the virtual clock
+static uint64_t VirtualClockNow(void)
+{
+  uint64_t now;
+
+  taskENTER_CRITICAL(&VirtualClockMux);
+  now = VirtualClockTime;
+  taskEXIT_CRITICAL(&VirtualClockMux);
+  return now;
+}
+
+// Sleeping on the virtual clock waits till the driver advanced the time
+static void VirtualClockSleep(uint64_t Duration)
+{
+  uint64_t deadline = VirtualClockNow() + Duration;
+
+  // Yield a tick at a time, so the driver and the other tasks can run
+  while (VirtualClockNow() < deadline)
+  {
+    vTaskDelay(1);
+  }
+}
+
+// Waiting on the virtual clock ends with a notification or the deadline
+static bool VirtualClockWaitNotify(uint64_t Duration)
+{
+  uint64_t deadline = VirtualClockNow() + Duration;
+
+  // Wait a tick at a time for the notification, till the driver advanced the time
+  while (VirtualClockNow() < deadline)
+  {
+    if (ulTaskNotifyTake(pdTRUE, 1) != 0)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+/// Clock source of the virtual clock
+static const tClockSource VirtualClock = {&VirtualClockNow, &VirtualClockSleep, &VirtualClockWaitNotify};
+
+/// Active clock source
+static const tClockSource *ActiveClock = &HardwareClock;
+
+//******************************************************************
+// Set the clock source
+//******************************************************************
+void setClockSource(const tClockSource *source)
+{
+  if (source)
+  {
+    ActiveClock = source;
+  }
+  else
+  {
+    ActiveClock = &HardwareClock;
+  }
+}
+
+//******************************************************************
+// Use the virtual clock
+//******************************************************************
+void useVirtualClock(uint64_t startTime)
+{
+  taskENTER_CRITICAL(&VirtualClockMux);
+  VirtualClockTime = startTime;
+  taskEXIT_CRITICAL(&VirtualClockMux);
+  setClockSource(&VirtualClock);
+}
+
+//******************************************************************
+// Advance the virtual clock
+//******************************************************************
+void advanceVirtualClock(uint64_t duration)
+{
+  taskENTER_CRITICAL(&VirtualClockMux);
+  VirtualClockTime += duration;
+  taskEXIT_CRITICAL(&VirtualClockMux);
+}
+
+//******************************************************************
+// Get the current time in microseconds
+//******************************************************************
+uint64_t clockMicros(void)
+{
+  return ActiveClock->Now();
+}
+
+//******************************************************************
+// Get the current time in milliseconds
+//******************************************************************
+uint64_t clockMillis(void)
+{
+  return CLOCK_US_TO_MS(ActiveClock->Now());
+}
+
+//******************************************************************
+// Check if a timeout is elapsed
+//******************************************************************
+bool clockIsElapsed(uint64_t timestamp, uint32_t timeoutMs)
+{
+  return (clockMicros() - timestamp) > CLOCK_MS_TO_US(timeoutMs);
+}
+
+//******************************************************************
+// Suspend the calling task
+//******************************************************************
+void clockSleepMs(uint32_t ms)
+{
+  ActiveClock->Sleep(CLOCK_MS_TO_US(ms));
+}
+
+//******************************************************************
+// Suspend the calling task till the next period
+//******************************************************************
+void clockSleepUntil(uint64_t &nextWakeTime, uint32_t periodMs)
+{
+  uint64_t now = clockMicros();
+
+  // First call or period missed, restart the schedule from now
+  if ((nextWakeTime == 0) || (nextWakeTime + CLOCK_MS_TO_US(periodMs) < now))
+  {
+    nextWakeTime = now;
+  }
+
+  nextWakeTime += CLOCK_MS_TO_US(periodMs);
+
+  // Sleep for the rest of the period
+  if (nextWakeTime > now)
+  {
+    ActiveClock->Sleep(nextWakeTime - now);
+  }
+}
+
+//******************************************************************
+// Suspend the calling task till the next period or a notification
+//******************************************************************
+bool clockSleepUntilNotified(uint64_t &nextWakeTime, uint32_t periodMs)
+{
+  uint64_t now = clockMicros();
+
+  // First call or period missed, restart the schedule from now
+  if ((nextWakeTime == 0) || (nextWakeTime + CLOCK_MS_TO_US(periodMs) < now))
+  {
+    nextWakeTime = now;
+  }
+
+  // After an early wakeup the period is not yet reached
+  if (nextWakeTime <= now)
+  {
+    nextWakeTime += CLOCK_MS_TO_US(periodMs);
+  }
+
+  // A clock source without notifications sleeps for the rest of the period
+  if (!ActiveClock->WaitNotify)
+  {
+    ActiveClock->Sleep(nextWakeTime - now);
+    return false;
+  }
+  return ActiveClock->WaitNotify(nextWakeTime - now);
+}
@@ -0,0 +1,284 @@
+/*!
+ * \file taskMonitor.cpp
+ * \brief Runtime statistics of the FreeRTOS tasks
+ *
+ * This file contains the functions for recording and showing the
+ * runtime statistics of the speedometer tasks.
+ *
+ */
+
+#include <taskMonitor.h>
+
+/// Marker for "no task running"
+#define TASK_ID_NONE -1
+
+/// Statistics of all monitored tasks
+static tTaskStatistics TaskStatistics[TASK_ID_COUNT];
+
+/// Spinlock to protect the statistics, tasks may run on both cores
+static portMUX_TYPE TaskMonitorMux = portMUX_INITIALIZER_UNLOCKED;
+
+#if (configUSE_TRACE_FACILITY == 1) && (configGENERATE_RUN_TIME_STATS == 1)
+/// Status of all tasks, one buffer per core
+static TaskStatus_t TaskStatusBuffer[portNUM_PROCESSORS][TASK_MONITOR_MAX_TASKS];
+#endif
+
+//******************************************************************
+// Find the monitored task of the caller
+//******************************************************************
+static int8_t findCurrentTask(void)
+{
+  TaskHandle_t handle = xTaskGetCurrentTaskHandle();
+
+  for (int8_t id = 0; id < TASK_ID_COUNT; id++)
+  {
+    if (TaskStatistics[id].Handle == handle)
+    {
+      return id;
+    }
+  }
+  return TASK_ID_NONE;
+}
+
+//******************************************************************
+// Read the run time counters of all tasks on the core of the caller
+//******************************************************************
+static bool readRunTimes(tTaskRunTimes &runTimes)
+{
+  bool valid = false;
+
+  memset(&runTimes, 0, sizeof(runTimes));
+#if (configUSE_TRACE_FACILITY == 1) && (configGENERATE_RUN_TIME_STATS == 1)
+  BaseType_t core = xPortGetCoreID();
+  TaskHandle_t self = xTaskGetCurrentTaskHandle();
+  TaskStatus_t *status = TaskStatusBuffer[core];
+  UBaseType_t count;
+
+  // No other task of this core may run and use the buffer meanwhile,
+  // the counters of all tasks but the caller are complete then
+  vTaskSuspendAll();
+  runTimes.Now = clockMicros();
+  count = uxTaskGetSystemState(status, TASK_MONITOR_MAX_TASKS, nullptr);
+  for (UBaseType_t i = 0; i < count; i++)
+  {
+    if ((status[i].xHandle != self) && (xTaskGetAffinity(status[i].xHandle) == core))
+    {
+      runTimes.Others += (uint32_t)status[i].ulRunTimeCounter;
+    }
+    for (uint8_t id = 0; id < TASK_ID_COUNT; id++)
+    {
+      if (TaskStatistics[id].Handle == status[i].xHandle)
+      {
+        runTimes.Tasks[id] = (uint32_t)status[i].ulRunTimeCounter;
+      }
+    }
+  }
+  xTaskResumeAll();
+  // The buffer is too small if no task was read
+  valid = (count > 0);
+#else
+  runTimes.Now = clockMicros();
+#endif
+  return valid;
+}
+
+//******************************************************************
+// Register a task for monitoring
+//******************************************************************
+void taskMonitorRegister(tTaskId id, TaskHandle_t handle, uint32_t periodMs)
+{
+  UBaseType_t priority = uxTaskPriorityGet(handle);
+
+  taskENTER_CRITICAL(&TaskMonitorMux);
+  memset(&TaskStatistics[id], 0, sizeof(tTaskStatistics));
+  TaskStatistics[id].Handle = handle;
+  TaskStatistics[id].Priority = priority;
+  TaskStatistics[id].Period = periodMs;
+  taskEXIT_CRITICAL(&TaskMonitorMux);
+}
+
+//******************************************************************
+// Mark the start of a task cycle
+//******************************************************************
+void taskMonitorCycleStart(tTaskId id)
+{
+  tTaskRunTimes runTimes;
+  bool valid = readRunTimes(runTimes);
+
+  taskENTER_CRITICAL(&TaskMonitorMux);
+  tTaskStatistics &task = TaskStatistics[id];
+  task.CycleStart = runTimes.Now;
+  task.CycleRunTimes = runTimes;
+  task.CycleRunTimesValid = valid;
+  taskEXIT_CRITICAL(&TaskMonitorMux);
+}
+
+//******************************************************************
+// Mark the end of a task cycle
+//******************************************************************
+void taskMonitorCycleEnd(tTaskId id)
+{
+  tTaskRunTimes runTimes;
+  bool valid = readRunTimes(runTimes);
+  uint8_t preemptedBy = 0;
+  uint64_t otherTime;
+
+  taskENTER_CRITICAL(&TaskMonitorMux);
+  tTaskStatistics &task = TaskStatistics[id];
+  uint64_t wallTime = runTimes.Now - task.CycleStart;
+  uint64_t runTime = wallTime;
+
+  // The counter of the running task lacks its current slice, but all
+  // other tasks of the core are switched out, so their counters are
+  // complete. The task ran whenever none of them did.
+  valid = valid && task.CycleRunTimesValid;
+  if (valid)
+  {
+    // The counters wrap around, the difference is still right
+    otherTime = (uint32_t)(runTimes.Others - task.CycleRunTimes.Others) / TASK_RUN_TIME_COUNTER_PER_US;
+    runTime = (otherTime < wallTime) ? wallTime - otherTime : 0;
+  }
+
+  task.Cycles++;
+  task.RunTimeTotal += runTime;
+  if (runTime > task.RunTimeMax)
+  {
+    task.RunTimeMax = (uint32_t)runTime;
+  }
+  if (wallTime > CLOCK_MS_TO_US(task.Period))
+  {
+    task.PeriodOverruns++;
+  }
+
+  // A task of higher priority which ran meanwhile interrupted the cycle
+  for (uint8_t other = 0; valid && (other < TASK_ID_COUNT); other++)
+  {
+    if ((other != id) && TaskStatistics[other].Handle &&
+        (TaskStatistics[other].Priority > task.Priority) &&
+        (runTimes.Tasks[other] != task.CycleRunTimes.Tasks[other]))
+    {
+      preemptedBy |= (uint8_t)(1 << other);
+    }
+  }
+  if (preemptedBy)
+  {
+    task.Preemptions++;
+    task.PreemptedBy |= preemptedBy;
+  }
+  taskEXIT_CRITICAL(&TaskMonitorMux);
+}
+
+//******************************************************************
+// Take the Serial output mutex
+//******************************************************************
+bool takeSerialOutputMutex(void)
+{
+  uint64_t start;
+  uint64_t waitTime;
+  bool taken;
+  int8_t id;
+
+  if (!SerialOutputMutex)
+  {
+    return false;
+  }
+
+  start = clockMicros();
+  taken = (xSemaphoreTake(SerialOutputMutex, pdMS_TO_TICKS(20)) == pdTRUE);
+  waitTime = clockMicros() - start;
+
+  // Record the wait time for the calling task
+  id = findCurrentTask();
+  if (id != TASK_ID_NONE)
+  {
+    taskENTER_CRITICAL(&TaskMonitorMux);
+    tTaskStatistics &task = TaskStatistics[id];
+    if (taken)
+    {
+      task.MutexTakes++;
+    }
+    else
+    {
+      task.MutexTimeouts++;
+    }
+    task.MutexWaitTotal += waitTime;
+    if (waitTime > task.MutexWaitMax)
+    {
+      task.MutexWaitMax = (uint32_t)waitTime;
+    }
+    taskEXIT_CRITICAL(&TaskMonitorMux);
+  }
+
+  return taken;
+}
+
+//******************************************************************
+// Give the Serial output mutex
+//******************************************************************
+void giveSerialOutputMutex(void)
+{
+  xSemaphoreGive(SerialOutputMutex);
+}
+
+//******************************************************************
+// Get the statistics of a task
+//******************************************************************
+const tTaskStatistics &getTaskStatistics(tTaskId id)
+{
+  return TaskStatistics[id];
+}
+
+//******************************************************************
+// Show the task statistics via Serial
+//******************************************************************
+void showTaskStatistics(void)
+{
+  // Only if Debug is enabled
+#ifdef DEBUG_TASK_STATISTICS
+  tTaskStatistics snapshot[TASK_ID_COUNT];
+
+  // Copy the statistics to keep the critical section short
+  taskENTER_CRITICAL(&TaskMonitorMux);
+  memcpy(snapshot, TaskStatistics, sizeof(snapshot));
+  taskEXIT_CRITICAL(&TaskMonitorMux);
+
+  // Tread safety with mutex SerialOutputMutex
+  if (takeSerialOutputMutex())
+  {
+    Serial.println("Task Statistics:");
+    for (uint8_t id = 0; id < TASK_ID_COUNT; id++)
+    {
+      tTaskStatistics &task = snapshot[id];
+
+      if (!task.Handle)
+      {
+        continue;
+      }
+      Serial.print("  ");
+      Serial.print(pcTaskGetName(task.Handle));
+      Serial.print(": cycles ");
+      Serial.print(task.Cycles);
+      Serial.print(" run avg/max ");
+      Serial.print(task.Cycles ? (uint32_t)(task.RunTimeTotal / task.Cycles) : 0);
+      Serial.print("/");
+      Serial.print(task.RunTimeMax);
+      Serial.print("us preempted ");
+      Serial.print(task.Preemptions);
+      Serial.print(" by 0x");
+      Serial.print(task.PreemptedBy, HEX);
+      Serial.print(" overruns ");
+      Serial.print(task.PeriodOverruns);
+      Serial.print(" mutex wait avg/max ");
+      Serial.print(task.MutexTakes ? (uint32_t)(task.MutexWaitTotal / task.MutexTakes) : 0);
+      Serial.print("/");
+      Serial.print(task.MutexWaitMax);
+      Serial.print("us timeouts ");
+      Serial.print(task.MutexTimeouts);
+      Serial.print(" stack free ");
+      Serial.println(uxTaskGetStackHighWaterMark(task.Handle));
+    }
+    // free the mutex
+    giveSerialOutputMutex();
+  }
+#endif
+}
@@ -0,0 +1,132 @@
+/*!
+ * \file timerWheel.cpp
+ * \brief Hashed timer wheel for the signal timeouts
+ *
+ * This file contains the slot handling of the timer wheel.
+ *
+ */
+
+#include <timerWheel.h>
+
+//************************************************
+// Constructor
+TimerWheel::TimerWheel(uint32_t TickMs)
+{
+  memset(Slots, 0, sizeof(Slots));
+  TickUs = CLOCK_MS_TO_US(TickMs ? TickMs : 1);
+  CurrentTick = 0;
+  ExpiredCnt = 0;
+}
+
+//************************************************
+// Init a timer node
+void TimerWheel::InitNode(tTimerWheelNode *Node, void (*Expired)(tTimerWheelNode *Node), void *Context)
+{
+  memset(Node, 0, sizeof(tTimerWheelNode));
+  Node->Expired = Expired;
+  Node->Context = Context;
+}
+
+//************************************************
+// Link a timer into the slot of its expiry tick
+void TimerWheel::Link(tTimerWheelNode *Node)
+{
+  tTimerWheelNode **slot = &Slots[Node->ExpiryTick % TIMER_WHEEL_SLOTS];
+
+  Node->Prev = nullptr;
+  Node->Next = *slot;
+  if (*slot)
+  {
+    (*slot)->Prev = Node;
+  }
+  *slot = Node;
+  Node->Active = true;
+}
+
+//************************************************
+// Unlink a timer from its slot
+void TimerWheel::Unlink(tTimerWheelNode *Node)
+{
+  if (Node->Prev)
+  {
+    Node->Prev->Next = Node->Next;
+  }
+  else
+  {
+    Slots[Node->ExpiryTick % TIMER_WHEEL_SLOTS] = Node->Next;
+  }
+  if (Node->Next)
+  {
+    Node->Next->Prev = Node->Prev;
+  }
+  Node->Next = nullptr;
+  Node->Prev = nullptr;
+  Node->Active = false;
+}
+
+//************************************************
+// Start or restart a timer
+void TimerWheel::Start(tTimerWheelNode *Node, uint32_t TimeoutMs, uint64_t now)
+{
+  if (Node->Active)
+  {
+    Unlink(Node);
+  }
+
+  // Round up, a timer never expires early
+  Node->ExpiryTick = (uint32_t)((now + CLOCK_MS_TO_US(TimeoutMs) + TickUs - 1) / TickUs);
+  Link(Node);
+}
+
+//************************************************
+// Stop a timer
+void TimerWheel::Stop(tTimerWheelNode *Node)
+{
+  if (Node->Active)
+  {
+    Unlink(Node);
+  }
+}
+
+//************************************************
+// Advance the wheel and call the expiry functions
+void TimerWheel::Advance(uint64_t now)
+{
+  uint32_t target = (uint32_t)(now / TickUs);
+  tTimerWheelNode *node;
+  tTimerWheelNode *next;
+
+  // Each slot has to be visited only once, even after a long pause
+  if (target - CurrentTick > TIMER_WHEEL_SLOTS)
+  {
+    CurrentTick = target - TIMER_WHEEL_SLOTS;
+  }
+
+  while (CurrentTick != target)
+  {
+    CurrentTick++;
+    for (node = Slots[CurrentTick % TIMER_WHEEL_SLOTS]; node; node = next)
+    {
+      next = node->Next;
+
+      // Timers of a later revolution stay in the slot
+      if ((int32_t)(node->ExpiryTick - CurrentTick) > 0)
+      {
+        continue;
+      }
+      Unlink(node);
+      ExpiredCnt++;
+      if (node->Expired)
+      {
+        node->Expired(node);
+      }
+    }
+  }
+}
+
+//************************************************
+// Get the number of expired timers
+uint32_t TimerWheel::GetExpiredCnt(void)
+{
+  return ExpiredCnt;
+}